@@ -0,0 +1,198 @@
+//! Where a remote call's time goes, without network noise
+//!
+//! Runs DUP on a Zig runtime behind gRPC's in-process transport and breaks
+//! the mean round trip down into the Zig marshaling stages on both sides
+//! and the interpreter, each timed on its own; the remainder is gRPC core,
+//! proto encoding and dispatch. TCP loopback is shown for comparison.
+//! Run with `zig build bench`.
+
+const std = @import("std");
+const forthic = @import("forthic");
+
+const Interpreter = forthic.Interpreter;
+const Value = forthic.Value;
+const GrpcClient = forthic.grpc.GrpcClient;
+const GrpcServer = forthic.grpc.GrpcServer;
+const CoreModule = forthic.modules.standard.CoreModule;
+const serializer = forthic.grpc.serializer;
+const client_mod = forthic.grpc.client;
+
+const iterations: usize = 5_000;
+const warmup: usize = 200;
+/// Elements in the large-stack case
+const large_len: usize = 10_000;
+
+fn setupSession(_: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+    const core_mod = try CoreModule.init(interp.allocator);
+    try interp.registerModule(&core_mod.module);
+    try interp.curModule().importModule("", &core_mod.module, interp);
+    return core_mod;
+}
+
+fn teardownSession(_: ?*anyopaque, _: *Interpreter, state: ?*anyopaque) void {
+    const core_mod: *CoreModule = @ptrCast(@alignCast(state orelse return));
+    core_mod.deinit();
+}
+
+/// Mean microseconds per call of one stage
+const Breakdown = struct {
+    client_serialize: f64,
+    server_deserialize: f64,
+    interpreter: f64,
+    server_serialize: f64,
+    client_deserialize: f64,
+    round_trip: f64,
+
+    fn marshaling(self: Breakdown) f64 {
+        return self.client_serialize + self.server_deserialize + self.server_serialize + self.client_deserialize;
+    }
+};
+
+fn meanUs(timer: *std.time.Timer) f64 {
+    return @as(f64, @floatFromInt(timer.read())) / std.time.ns_per_us / @as(f64, @floatFromInt(iterations));
+}
+
+fn timeSerialize(allocator: std.mem.Allocator, values: []const Value) !f64 {
+    var timer = try std.time.Timer.start();
+    for (0..iterations) |_| {
+        const owned = try serializer.serializeValueSlice(allocator, values, .{});
+        serializer.freeStackValueArray(allocator, owned);
+    }
+    return meanUs(&timer);
+}
+
+fn timeDeserialize(allocator: std.mem.Allocator, values: []const Value) !f64 {
+    const owned = try serializer.serializeValueSlice(allocator, values, .{});
+    defer serializer.freeStackValueArray(allocator, owned);
+
+    var timer = try std.time.Timer.start();
+    for (0..iterations) |_| {
+        for (owned) |stack_value| {
+            var value = try serializer.deserializeValue(allocator, stack_value.?);
+            value.deinit(allocator);
+        }
+    }
+    return meanUs(&timer);
+}
+
+/// Push the arguments, run DUP and drop the results, as a session does
+fn timeInterpreter(interp: *Interpreter, args: []const Value) !f64 {
+    const allocator = interp.allocator;
+    var timer = try std.time.Timer.start();
+    for (0..iterations) |_| {
+        for (args) |*arg| try interp.stackPush(try arg.clone(allocator));
+        try interp.run("DUP");
+        while (interp.stack.length() > 0) {
+            var value = try interp.stackPop();
+            value.deinit(allocator);
+        }
+    }
+    return meanUs(&timer);
+}
+
+fn timeRoundTrip(allocator: std.mem.Allocator, client: *GrpcClient, args: []const Value) !f64 {
+    for (0..warmup) |_| {
+        var result = try client.executeWord("DUP", args);
+        result.deinit(allocator);
+    }
+
+    var timer = try std.time.Timer.start();
+    for (0..iterations) |_| {
+        var result = try client.executeWord("DUP", args);
+        result.deinit(allocator);
+    }
+    return meanUs(&timer);
+}
+
+fn measure(allocator: std.mem.Allocator, interp: *Interpreter, client: *GrpcClient, args: []const Value) !Breakdown {
+    // DUP leaves the arguments plus a copy of the top one
+    var results: std.ArrayList(Value) = .{};
+    defer {
+        for (results.items) |*value| value.deinit(allocator);
+        results.deinit(allocator);
+    }
+    for (args) |*arg| try results.append(allocator, try arg.clone(allocator));
+    try results.append(allocator, try args[args.len - 1].clone(allocator));
+
+    return Breakdown{
+        .client_serialize = try timeSerialize(allocator, args),
+        .server_deserialize = try timeDeserialize(allocator, args),
+        .interpreter = try timeInterpreter(interp, args),
+        .server_serialize = try timeSerialize(allocator, results.items),
+        .client_deserialize = try timeDeserialize(allocator, results.items),
+        .round_trip = try timeRoundTrip(allocator, client, args),
+    };
+}
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{ .thread_safe = true }){};
+    defer _ = gpa.deinit();
+    const allocator = gpa.allocator();
+
+    const setup = GrpcServer.SessionSetup{ .setupFn = setupSession, .teardownFn = teardownSession };
+
+    const inproc_server = try GrpcServer.initAddress(allocator, "inproc:bench", setup);
+    defer inproc_server.deinit();
+    try inproc_server.start();
+
+    const tcp_server = try GrpcServer.init(allocator, 0, setup);
+    defer tcp_server.deinit();
+    try tcp_server.start();
+
+    var tcp_buf: [32]u8 = undefined;
+    const tcp_address = try std.fmt.bufPrint(&tcp_buf, "127.0.0.1:{d}", .{tcp_server.getPort()});
+
+    var inproc_client = try GrpcClient.init(allocator, "inproc:bench");
+    defer inproc_client.deinit();
+    var tcp_client = try GrpcClient.init(allocator, tcp_address);
+    defer tcp_client.deinit();
+
+    const interp = try allocator.create(Interpreter);
+    defer allocator.destroy(interp);
+    interp.* = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+    const core_state = try setupSession(null, interp);
+    defer teardownSession(null, interp, core_state);
+
+    const small = [_]Value{Value.initInt(42)};
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    try array.array_value.ensureTotalCapacity(allocator, large_len);
+    for (0..large_len) |i| {
+        array.array_value.appendAssumeCapacity(Value.initInt(@intCast(i)));
+    }
+    const large = [_]Value{array};
+
+    const cases = [_]struct { name: []const u8, args: []const Value }{
+        .{ .name = "small stack (1 int)", .args = &small },
+        .{ .name = "large stack (10k ints)", .args = &large },
+    };
+
+    std.debug.print("calls per stage: {d}, mean us per call\n", .{iterations});
+    for (cases) |case| {
+        const stages = try measure(allocator, interp, &inproc_client, case.args);
+        const tcp = try timeRoundTrip(allocator, &tcp_client, case.args);
+        const remainder = stages.round_trip - stages.marshaling() - stages.interpreter;
+
+        std.debug.print("{s}\n", .{case.name});
+        std.debug.print("  client serialize     {d:>10.2}\n", .{stages.client_serialize});
+        std.debug.print("  server deserialize   {d:>10.2}\n", .{stages.server_deserialize});
+        std.debug.print("  interpreter          {d:>10.2}\n", .{stages.interpreter});
+        std.debug.print("  server serialize     {d:>10.2}\n", .{stages.server_serialize});
+        std.debug.print("  client deserialize   {d:>10.2}\n", .{stages.client_deserialize});
+        std.debug.print("  grpc/proto/dispatch  {d:>10.2}  (remainder)\n", .{remainder});
+        std.debug.print("  in-process total     {d:>10.2}\n", .{stages.round_trip});
+        std.debug.print("  tcp loopback total   {d:>10.2}\n", .{tcp});
+    }
+
+    // Cross-check against the split the client records for every call
+    if (inproc_client.wordMetrics(0)) |entry| {
+        std.debug.print("client metrics for {s}: rpc mean {d:.2} us, marshaling mean {d:.2} us\n", .{
+            entry.word_name,
+            @as(f64, @floatFromInt(client_mod.latencyMean(&entry.metrics.rpc))) / std.time.ns_per_us,
+            @as(f64, @floatFromInt(client_mod.latencyMean(&entry.metrics.serialization))) / std.time.ns_per_us,
+        });
+    }
+}
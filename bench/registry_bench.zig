@@ -0,0 +1,120 @@
+//! Runtime lookup throughput: RuntimeManager snapshot vs a mutex-guarded map
+//!
+//! Reader threads look up runtimes by name while one writer keeps
+//! registering new ones, the pattern of several interpreters sharing the
+//! manager. No runtime has to be running: clients connect lazily.
+//! Run with `zig build bench`.
+
+const std = @import("std");
+const forthic = @import("forthic");
+
+const GrpcClient = forthic.grpc.GrpcClient;
+const RuntimeManager = forthic.grpc.RuntimeManager;
+
+const lookups_per_thread: usize = 1_000_000;
+/// Runtimes registered before the readers start
+const initial_runtimes: usize = 16;
+/// Runtimes the writer adds while the readers run
+const added_runtimes: usize = 64;
+const thread_counts = [_]usize{ 1, 2, 4, 8 };
+
+/// The pre-snapshot design: one map behind one lock
+const LockedRegistry = struct {
+    mutex: std.Thread.Mutex = .{},
+    map: std.StringHashMap(*GrpcClient),
+
+    fn get(self: *LockedRegistry, name: []const u8) ?*GrpcClient {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        return self.map.get(name);
+    }
+
+    fn put(self: *LockedRegistry, name: []const u8, client: *GrpcClient) !void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        try self.map.put(name, client);
+    }
+};
+
+const Run = struct {
+    names: []const []const u8,
+    manager: *RuntimeManager,
+    locked: *LockedRegistry,
+    use_snapshot: bool,
+    misses: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+
+    fn read(self: *Run, seed: usize) void {
+        var misses: usize = 0;
+        for (0..lookups_per_thread) |i| {
+            const name = self.names[(seed + i) % initial_runtimes];
+            const found = if (self.use_snapshot) self.manager.getClient(name) else self.locked.get(name);
+            if (found == null) misses += 1;
+        }
+        _ = self.misses.fetchAdd(misses, .monotonic);
+    }
+
+    fn write(self: *Run) void {
+        for (self.names[initial_runtimes..]) |name| {
+            const client = self.manager.connectRuntime(name, "localhost:1") catch return;
+            if (!self.use_snapshot) self.locked.put(name, client) catch return;
+        }
+    }
+};
+
+/// Lookups per second across all reader threads
+fn measure(run: *Run, readers: usize) !f64 {
+    var threads: [thread_counts[thread_counts.len - 1]]std.Thread = undefined;
+
+    var timer = try std.time.Timer.start();
+    const writer = try std.Thread.spawn(.{}, Run.write, .{run});
+    for (threads[0..readers], 0..) |*thread, i| {
+        thread.* = try std.Thread.spawn(.{}, Run.read, .{ run, i });
+    }
+    for (threads[0..readers]) |thread| thread.join();
+    const elapsed = timer.read();
+    writer.join();
+
+    if (run.misses.load(.monotonic) != 0) return error.LookupMissed;
+    const total: f64 = @floatFromInt(readers * lookups_per_thread);
+    return total / (@as(f64, @floatFromInt(elapsed)) / std.time.ns_per_s);
+}
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{ .thread_safe = true }){};
+    defer _ = gpa.deinit();
+    const allocator = gpa.allocator();
+
+    const names = try allocator.alloc([]u8, initial_runtimes + added_runtimes * (2 * thread_counts.len));
+    defer {
+        for (names) |name| allocator.free(name);
+        allocator.free(names);
+    }
+    for (names, 0..) |*name, i| name.* = try std.fmt.allocPrint(allocator, "runtime-{d}", .{i});
+
+    std.debug.print("{s:>8} {s:>16} {s:>16}\n", .{ "threads", "snapshot/s", "mutex/s" });
+
+    var next_name: usize = initial_runtimes;
+    for (thread_counts) |readers| {
+        var rates: [2]f64 = undefined;
+        for (&rates, [_]bool{ true, false }) |*rate, use_snapshot| {
+            const manager = try RuntimeManager.getInstance(allocator);
+            defer manager.deinit();
+            var locked = LockedRegistry{ .map = std.StringHashMap(*GrpcClient).init(allocator) };
+            defer locked.map.deinit();
+
+            for (names[0..initial_runtimes]) |name| {
+                try locked.put(name, try manager.connectRuntime(name, "localhost:1"));
+            }
+
+            // Fresh names each run, so the writer really registers
+            var run_names: [initial_runtimes + added_runtimes][]const u8 = undefined;
+            for (run_names[0..initial_runtimes], names[0..initial_runtimes]) |*dst, src| dst.* = src;
+            for (run_names[initial_runtimes..], names[next_name..][0..added_runtimes]) |*dst, src| dst.* = src;
+            next_name += added_runtimes;
+
+            var run = Run{ .names = &run_names, .manager = manager, .locked = &locked, .use_snapshot = use_snapshot };
+            rate.* = try measure(&run, readers);
+        }
+        std.debug.print("{d:>8} {d:>16.0} {d:>16.0}\n", .{ readers, rates[0], rates[1] });
+    }
+}
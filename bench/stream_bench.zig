@@ -0,0 +1,84 @@
+//! Calls per second: unary ExecuteWord vs pipelined ExecuteStream
+//!
+//! Starts an in-process Zig server on a free port and runs the same word
+//! through both paths. Run with `zig build bench`.
+
+const std = @import("std");
+const forthic = @import("forthic");
+
+const Interpreter = forthic.Interpreter;
+const Value = forthic.Value;
+const GrpcClient = forthic.grpc.GrpcClient;
+const GrpcServer = forthic.grpc.GrpcServer;
+const CoreModule = forthic.modules.standard.CoreModule;
+
+const iterations: usize = 20_000;
+/// Stream requests kept in flight before the oldest is awaited
+const pipeline_depth: usize = 64;
+
+fn setupSession(_: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+    const core_mod = try CoreModule.init(interp.allocator);
+    try interp.registerModule(&core_mod.module);
+    try interp.curModule().importModule("", &core_mod.module, interp);
+    return core_mod;
+}
+
+fn teardownSession(_: ?*anyopaque, _: *Interpreter, state: ?*anyopaque) void {
+    const core_mod: *CoreModule = @ptrCast(@alignCast(state orelse return));
+    core_mod.deinit();
+}
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{ .thread_safe = true }){};
+    defer _ = gpa.deinit();
+    const allocator = gpa.allocator();
+
+    const server = try GrpcServer.init(allocator, 0, .{
+        .setupFn = setupSession,
+        .teardownFn = teardownSession,
+    });
+    defer server.deinit();
+    try server.start();
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    const args = [_]Value{Value.initInt(42)};
+
+    // Unary: one round trip per call, arguments and results every time
+    var timer = try std.time.Timer.start();
+    for (0..iterations) |_| {
+        var result = try client.executeWord("DUP", &args);
+        result.deinit(allocator);
+    }
+    const unary_ns = timer.read();
+
+    // Streamed: requests pipelined on one stream, session stack keeps the value
+    var pending: [pipeline_depth]u64 = undefined;
+    timer.reset();
+    for (0..iterations) |i| {
+        const push: []const Value = if (i == 0) &args else &.{};
+        if (i >= pipeline_depth) {
+            var result = try client.awaitStream(pending[i % pipeline_depth]);
+            result.deinit(allocator);
+        }
+        // DUP POP leaves the session stack unchanged
+        pending[i % pipeline_depth] = try client.submitStream(if (i % 2 == 0) "DUP" else "POP", push, 0);
+    }
+    for (iterations -| pipeline_depth..iterations) |i| {
+        var result = try client.awaitStream(pending[i % pipeline_depth]);
+        result.deinit(allocator);
+    }
+    const stream_ns = timer.read();
+    client.closeStream();
+
+    std.debug.print("calls: {d}\n", .{iterations});
+    std.debug.print("unary ExecuteWord:       {d:>10.0} calls/s\n", .{callsPerSecond(unary_ns)});
+    std.debug.print("pipelined ExecuteStream: {d:>10.0} calls/s (depth {d})\n", .{ callsPerSecond(stream_ns), pipeline_depth });
+}
+
+fn callsPerSecond(elapsed_ns: u64) f64 {
+    return @as(f64, @floatFromInt(iterations)) * std.time.ns_per_s / @as(f64, @floatFromInt(elapsed_ns));
+}
@@ -0,0 +1,119 @@
+//! Per-call latency: TCP loopback vs Unix domain socket
+//!
+//! Starts one in-process Zig server on each transport and times unary
+//! ExecuteWord calls with a small and a large stack. Run with `zig build bench`.
+
+const std = @import("std");
+const forthic = @import("forthic");
+
+const Interpreter = forthic.Interpreter;
+const Value = forthic.Value;
+const GrpcClient = forthic.grpc.GrpcClient;
+const GrpcServer = forthic.grpc.GrpcServer;
+const CoreModule = forthic.modules.standard.CoreModule;
+
+const iterations: usize = 5_000;
+const warmup: usize = 200;
+/// Elements in the large-stack case
+const large_len: usize = 10_000;
+
+fn setupSession(_: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+    const core_mod = try CoreModule.init(interp.allocator);
+    try interp.registerModule(&core_mod.module);
+    try interp.curModule().importModule("", &core_mod.module, interp);
+    return core_mod;
+}
+
+fn teardownSession(_: ?*anyopaque, _: *Interpreter, state: ?*anyopaque) void {
+    const core_mod: *CoreModule = @ptrCast(@alignCast(state orelse return));
+    core_mod.deinit();
+}
+
+const Latency = struct {
+    p50_us: f64,
+    p99_us: f64,
+};
+
+/// Time `iterations` DUP calls and return latency percentiles
+fn measure(allocator: std.mem.Allocator, client: *GrpcClient, args: []const Value) !Latency {
+    const samples = try allocator.alloc(u64, iterations);
+    defer allocator.free(samples);
+
+    for (0..warmup) |_| {
+        var result = try client.executeWord("DUP", args);
+        result.deinit(allocator);
+    }
+
+    var timer = try std.time.Timer.start();
+    for (samples) |*sample| {
+        timer.reset();
+        var result = try client.executeWord("DUP", args);
+        sample.* = timer.read();
+        result.deinit(allocator);
+    }
+
+    std.mem.sort(u64, samples, {}, std.sort.asc(u64));
+    return Latency{
+        .p50_us = nsToUs(samples[iterations / 2]),
+        .p99_us = nsToUs(samples[iterations * 99 / 100]),
+    };
+}
+
+fn nsToUs(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_us;
+}
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{ .thread_safe = true }){};
+    defer _ = gpa.deinit();
+    const allocator = gpa.allocator();
+
+    const setup = GrpcServer.SessionSetup{ .setupFn = setupSession, .teardownFn = teardownSession };
+
+    const tcp_server = try GrpcServer.init(allocator, 0, setup);
+    defer tcp_server.deinit();
+    try tcp_server.start();
+
+    var path_buf: [64]u8 = undefined;
+    const path = try std.fmt.bufPrint(&path_buf, "/tmp/forthic-bench-{d}.sock", .{std.time.milliTimestamp()});
+    defer std.fs.deleteFileAbsolute(path) catch {};
+
+    var uds_buf: [80]u8 = undefined;
+    const uds_address = try std.fmt.bufPrint(&uds_buf, "unix:{s}", .{path});
+    const uds_server = try GrpcServer.initAddress(allocator, uds_address, setup);
+    defer uds_server.deinit();
+    try uds_server.start();
+
+    var tcp_buf: [32]u8 = undefined;
+    const tcp_address = try std.fmt.bufPrint(&tcp_buf, "127.0.0.1:{d}", .{tcp_server.getPort()});
+
+    var tcp_client = try GrpcClient.init(allocator, tcp_address);
+    defer tcp_client.deinit();
+    var uds_client = try GrpcClient.init(allocator, uds_address);
+    defer uds_client.deinit();
+
+    const small = [_]Value{Value.initInt(42)};
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    try array.array_value.ensureTotalCapacity(allocator, large_len);
+    for (0..large_len) |i| {
+        array.array_value.appendAssumeCapacity(Value.initInt(@intCast(i)));
+    }
+    const large = [_]Value{array};
+
+    const cases = [_]struct { name: []const u8, args: []const Value }{
+        .{ .name = "small stack (1 int)", .args = &small },
+        .{ .name = "large stack (10k ints)", .args = &large },
+    };
+
+    std.debug.print("calls per case: {d}\n", .{iterations});
+    for (cases) |case| {
+        const tcp = try measure(allocator, &tcp_client, case.args);
+        const uds = try measure(allocator, &uds_client, case.args);
+
+        std.debug.print("{s}\n", .{case.name});
+        std.debug.print("  tcp loopback: p50 {d:>8.1} us  p99 {d:>8.1} us\n", .{ tcp.p50_us, tcp.p99_us });
+        std.debug.print("  unix socket:  p50 {d:>8.1} us  p99 {d:>8.1} us\n", .{ uds.p50_us, uds.p99_us });
+    }
+}
@@ -126,4 +126,38 @@ pub fn build(b: *std.Build) void {
     test_step.dependOn(&run_literals_tests.step);
     test_step.dependOn(&run_core_module_tests.step);
     test_step.dependOn(&run_grpc_tests.step);
+
+    // ==========================================================================
+    // Benchmarks
+    // ==========================================================================
+
+    const bench_step = b.step("bench", "Run benchmarks (ReleaseFast)");
+
+    const bench_sources = &[_][]const u8{
+        "bench/stream_bench.zig",
+        "bench/transport_bench.zig",
+        "bench/registry_bench.zig",
+        "bench/inproc_bench.zig",
+    };
+
+    const bench_forthic_module = b.createModule(.{
+        .root_source_file = b.path("src/main.zig"),
+        .target = target,
+        .optimize = .ReleaseFast,
+    });
+
+    for (bench_sources) |source| {
+        const bench_exe = b.addExecutable(.{
+            .name = std.fs.path.stem(source),
+            .root_module = b.createModule(.{
+                .root_source_file = b.path(source),
+                .target = target,
+                .optimize = .ReleaseFast,
+            }),
+        });
+        bench_exe.root_module.addImport("forthic", bench_forthic_module);
+        addGrpcSupport(bench_exe, b, grpc_cpp_files, cpp_flags);
+
+        bench_step.dependOn(&b.addRunArtifact(bench_exe).step);
+    }
 }
@@ -25,8 +25,12 @@ namespace forthic {
 static const char* ForthicRuntime_method_names[] = {
   "/forthic.ForthicRuntime/ExecuteWord",
   "/forthic.ForthicRuntime/ExecuteSequence",
+  "/forthic.ForthicRuntime/ExecuteWordChunked",
+  "/forthic.ForthicRuntime/ExecuteStream",
   "/forthic.ForthicRuntime/ListModules",
   "/forthic.ForthicRuntime/GetModuleInfo",
+  "/forthic.ForthicRuntime/FetchRef",
+  "/forthic.ForthicRuntime/ReleaseRefs",
 };
 
 std::unique_ptr< ForthicRuntime::Stub> ForthicRuntime::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -38,8 +42,12 @@ std::unique_ptr< ForthicRuntime::Stub> ForthicRuntime::NewStub(const std::shared
 ForthicRuntime::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_ExecuteWord_(ForthicRuntime_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ExecuteSequence_(ForthicRuntime_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ListModules_(ForthicRuntime_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetModuleInfo_(ForthicRuntime_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ExecuteWordChunked_(ForthicRuntime_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ExecuteStream_(ForthicRuntime_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_ListModules_(ForthicRuntime_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetModuleInfo_(ForthicRuntime_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_FetchRef_(ForthicRuntime_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReleaseRefs_(ForthicRuntime_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status ForthicRuntime::Stub::ExecuteWord(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::forthic::ExecuteWordResponse* response) {
@@ -88,6 +96,38 @@ void ForthicRuntime::Stub::async::ExecuteSequence(::grpc::ClientContext* context
   return result;
 }
 
+::grpc::ClientReader< ::forthic::ResultChunk>* ForthicRuntime::Stub::ExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::forthic::ResultChunk>::Create(channel_.get(), rpcmethod_ExecuteWordChunked_, context, request);
+}
+
+void ForthicRuntime::Stub::async::ExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest* request, ::grpc::ClientReadReactor< ::forthic::ResultChunk>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::forthic::ResultChunk>::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteWordChunked_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::forthic::ResultChunk>* ForthicRuntime::Stub::AsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::forthic::ResultChunk>::Create(channel_.get(), cq, rpcmethod_ExecuteWordChunked_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::forthic::ResultChunk>* ForthicRuntime::Stub::PrepareAsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::forthic::ResultChunk>::Create(channel_.get(), cq, rpcmethod_ExecuteWordChunked_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* ForthicRuntime::Stub::ExecuteStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::forthic::StreamRequest, ::forthic::StreamResponse>::Create(channel_.get(), rpcmethod_ExecuteStream_, context);
+}
+
+void ForthicRuntime::Stub::async::ExecuteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::forthic::StreamRequest,::forthic::StreamResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::forthic::StreamRequest,::forthic::StreamResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* ForthicRuntime::Stub::AsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::forthic::StreamRequest, ::forthic::StreamResponse>::Create(channel_.get(), cq, rpcmethod_ExecuteStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* ForthicRuntime::Stub::PrepareAsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::forthic::StreamRequest, ::forthic::StreamResponse>::Create(channel_.get(), cq, rpcmethod_ExecuteStream_, context, false, nullptr);
+}
+
 ::grpc::Status ForthicRuntime::Stub::ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::forthic::ListModulesResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::forthic::ListModulesRequest, ::forthic::ListModulesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListModules_, context, request, response);
 }
@@ -134,6 +174,52 @@ void ForthicRuntime::Stub::async::GetModuleInfo(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::Status ForthicRuntime::Stub::FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::forthic::FetchRefResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::forthic::FetchRefRequest, ::forthic::FetchRefResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_FetchRef_, context, request, response);
+}
+
+void ForthicRuntime::Stub::async::FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::forthic::FetchRefRequest, ::forthic::FetchRefResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_FetchRef_, context, request, response, std::move(f));
+}
+
+void ForthicRuntime::Stub::async::FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_FetchRef_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>* ForthicRuntime::Stub::PrepareAsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::forthic::FetchRefResponse, ::forthic::FetchRefRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_FetchRef_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>* ForthicRuntime::Stub::AsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncFetchRefRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status ForthicRuntime::Stub::ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::forthic::ReleaseRefsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReleaseRefs_, context, request, response);
+}
+
+void ForthicRuntime::Stub::async::ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReleaseRefs_, context, request, response, std::move(f));
+}
+
+void ForthicRuntime::Stub::async::ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReleaseRefs_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>* ForthicRuntime::Stub::PrepareAsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::forthic::ReleaseRefsResponse, ::forthic::ReleaseRefsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReleaseRefs_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>* ForthicRuntime::Stub::AsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReleaseRefsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ForthicRuntime::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ForthicRuntime_method_names[0],
@@ -157,6 +243,26 @@ ForthicRuntime::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ForthicRuntime_method_names[2],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< ForthicRuntime::Service, ::forthic::ExecuteWordRequest, ::forthic::ResultChunk>(
+          [](ForthicRuntime::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::forthic::ExecuteWordRequest* req,
+             ::grpc::ServerWriter<::forthic::ResultChunk>* writer) {
+               return service->ExecuteWordChunked(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ForthicRuntime_method_names[3],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< ForthicRuntime::Service, ::forthic::StreamRequest, ::forthic::StreamResponse>(
+          [](ForthicRuntime::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::forthic::StreamResponse,
+             ::forthic::StreamRequest>* stream) {
+               return service->ExecuteStream(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ForthicRuntime_method_names[4],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< ForthicRuntime::Service, ::forthic::ListModulesRequest, ::forthic::ListModulesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](ForthicRuntime::Service* service,
@@ -166,7 +272,7 @@ ForthicRuntime::Service::Service() {
                return service->ListModules(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ForthicRuntime_method_names[3],
+      ForthicRuntime_method_names[5],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< ForthicRuntime::Service, ::forthic::GetModuleInfoRequest, ::forthic::GetModuleInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](ForthicRuntime::Service* service,
@@ -175,6 +281,26 @@ ForthicRuntime::Service::Service() {
              ::forthic::GetModuleInfoResponse* resp) {
                return service->GetModuleInfo(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ForthicRuntime_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ForthicRuntime::Service, ::forthic::FetchRefRequest, ::forthic::FetchRefResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ForthicRuntime::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::forthic::FetchRefRequest* req,
+             ::forthic::FetchRefResponse* resp) {
+               return service->FetchRef(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ForthicRuntime_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ForthicRuntime::Service, ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ForthicRuntime::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::forthic::ReleaseRefsRequest* req,
+             ::forthic::ReleaseRefsResponse* resp) {
+               return service->ReleaseRefs(ctx, req, resp);
+             }, this)));
 }
 
 ForthicRuntime::Service::~Service() {
@@ -194,6 +320,19 @@ ForthicRuntime::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ForthicRuntime::Service::ExecuteWordChunked(::grpc::ServerContext* context, const ::forthic::ExecuteWordRequest* request, ::grpc::ServerWriter< ::forthic::ResultChunk>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ForthicRuntime::Service::ExecuteStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status ForthicRuntime::Service::ListModules(::grpc::ServerContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response) {
   (void) context;
   (void) request;
@@ -208,6 +347,20 @@ ForthicRuntime::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ForthicRuntime::Service::FetchRef(::grpc::ServerContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ForthicRuntime::Service::ReleaseRefs(::grpc::ServerContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace forthic
 #include <grpcpp/ports_undef.inc>
@@ -53,6 +53,27 @@ class ForthicRuntime final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ExecuteSequenceResponse>> PrepareAsyncExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ExecuteSequenceResponse>>(PrepareAsyncExecuteSequenceRaw(context, request, cq));
     }
+    // Execute a single word and stream the result stack back in chunks
+    // For results too large to hold in one message
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::forthic::ResultChunk>> ExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::forthic::ResultChunk>>(ExecuteWordChunkedRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>> AsyncExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>>(AsyncExecuteWordChunkedRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>> PrepareAsyncExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>>(PrepareAsyncExecuteWordChunkedRaw(context, request, cq));
+    }
+    // Pipelined execution over one long-lived stream with a session-scoped stack
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>> ExecuteStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>>(ExecuteStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>> AsyncExecuteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>>(AsyncExecuteStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>> PrepareAsyncExecuteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>>(PrepareAsyncExecuteStreamRaw(context, cq));
+    }
     // Phase 3: Module discovery
     // List available runtime-specific modules (excludes standard library)
     virtual ::grpc::Status ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::forthic::ListModulesResponse* response) = 0;
@@ -70,6 +91,23 @@ class ForthicRuntime final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::GetModuleInfoResponse>> PrepareAsyncGetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::GetModuleInfoResponse>>(PrepareAsyncGetModuleInfoRaw(context, request, cq));
     }
+    // Remote value handles
+    // Materialize the value behind a handle returned as a RemoteRefValue
+    virtual ::grpc::Status FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::forthic::FetchRefResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>> AsyncFetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>>(AsyncFetchRefRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>> PrepareAsyncFetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>>(PrepareAsyncFetchRefRaw(context, request, cq));
+    }
+    // Drop handles the caller no longer references so the runtime can free the values
+    virtual ::grpc::Status ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::forthic::ReleaseRefsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>> AsyncReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>>(AsyncReleaseRefsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>> PrepareAsyncReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>>(PrepareAsyncReleaseRefsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -79,6 +117,11 @@ class ForthicRuntime final {
       // Execute a sequence of words in one remote call (batched execution optimization)
       virtual void ExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest* request, ::forthic::ExecuteSequenceResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest* request, ::forthic::ExecuteSequenceResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Execute a single word and stream the result stack back in chunks
+      // For results too large to hold in one message
+      virtual void ExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest* request, ::grpc::ClientReadReactor< ::forthic::ResultChunk>* reactor) = 0;
+      // Pipelined execution over one long-lived stream with a session-scoped stack
+      virtual void ExecuteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::forthic::StreamRequest,::forthic::StreamResponse>* reactor) = 0;
       // Phase 3: Module discovery
       // List available runtime-specific modules (excludes standard library)
       virtual void ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response, std::function<void(::grpc::Status)>) = 0;
@@ -86,6 +129,13 @@ class ForthicRuntime final {
       // Get detailed information about a specific module
       virtual void GetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Remote value handles
+      // Materialize the value behind a handle returned as a RemoteRefValue
+      virtual void FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Drop handles the caller no longer references so the runtime can free the values
+      virtual void ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -95,10 +145,20 @@ class ForthicRuntime final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ExecuteWordResponse>* PrepareAsyncExecuteWordRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ExecuteSequenceResponse>* AsyncExecuteSequenceRaw(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ExecuteSequenceResponse>* PrepareAsyncExecuteSequenceRaw(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::forthic::ResultChunk>* ExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>* AsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::forthic::ResultChunk>* PrepareAsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>* ExecuteStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>* AsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::forthic::StreamRequest, ::forthic::StreamResponse>* PrepareAsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ListModulesResponse>* AsyncListModulesRaw(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ListModulesResponse>* PrepareAsyncListModulesRaw(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::GetModuleInfoResponse>* AsyncGetModuleInfoRaw(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::GetModuleInfoResponse>* PrepareAsyncGetModuleInfoRaw(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>* AsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::FetchRefResponse>* PrepareAsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>* AsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::forthic::ReleaseRefsResponse>* PrepareAsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -117,6 +177,24 @@ class ForthicRuntime final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ExecuteSequenceResponse>> PrepareAsyncExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ExecuteSequenceResponse>>(PrepareAsyncExecuteSequenceRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::forthic::ResultChunk>> ExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::forthic::ResultChunk>>(ExecuteWordChunkedRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::forthic::ResultChunk>> AsyncExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::forthic::ResultChunk>>(AsyncExecuteWordChunkedRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::forthic::ResultChunk>> PrepareAsyncExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::forthic::ResultChunk>>(PrepareAsyncExecuteWordChunkedRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>> ExecuteStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>>(ExecuteStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>> AsyncExecuteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>>(AsyncExecuteStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>> PrepareAsyncExecuteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>>(PrepareAsyncExecuteStreamRaw(context, cq));
+    }
     ::grpc::Status ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::forthic::ListModulesResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ListModulesResponse>> AsyncListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ListModulesResponse>>(AsyncListModulesRaw(context, request, cq));
@@ -131,6 +209,20 @@ class ForthicRuntime final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::GetModuleInfoResponse>> PrepareAsyncGetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::GetModuleInfoResponse>>(PrepareAsyncGetModuleInfoRaw(context, request, cq));
     }
+    ::grpc::Status FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::forthic::FetchRefResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>> AsyncFetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>>(AsyncFetchRefRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>> PrepareAsyncFetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>>(PrepareAsyncFetchRefRaw(context, request, cq));
+    }
+    ::grpc::Status ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::forthic::ReleaseRefsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>> AsyncReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>>(AsyncReleaseRefsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>> PrepareAsyncReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>>(PrepareAsyncReleaseRefsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -138,10 +230,16 @@ class ForthicRuntime final {
       void ExecuteWord(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest* request, ::forthic::ExecuteWordResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void ExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest* request, ::forthic::ExecuteSequenceResponse* response, std::function<void(::grpc::Status)>) override;
       void ExecuteSequence(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest* request, ::forthic::ExecuteSequenceResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ExecuteWordChunked(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest* request, ::grpc::ClientReadReactor< ::forthic::ResultChunk>* reactor) override;
+      void ExecuteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::forthic::StreamRequest,::forthic::StreamResponse>* reactor) override;
       void ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response, std::function<void(::grpc::Status)>) override;
       void ListModules(::grpc::ClientContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response, std::function<void(::grpc::Status)>) override;
       void GetModuleInfo(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, std::function<void(::grpc::Status)>) override;
+      void FetchRef(::grpc::ClientContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReleaseRefs(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -157,14 +255,28 @@ class ForthicRuntime final {
     ::grpc::ClientAsyncResponseReader< ::forthic::ExecuteWordResponse>* PrepareAsyncExecuteWordRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::ExecuteSequenceResponse>* AsyncExecuteSequenceRaw(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::ExecuteSequenceResponse>* PrepareAsyncExecuteSequenceRaw(::grpc::ClientContext* context, const ::forthic::ExecuteSequenceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::forthic::ResultChunk>* ExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request) override;
+    ::grpc::ClientAsyncReader< ::forthic::ResultChunk>* AsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::forthic::ResultChunk>* PrepareAsyncExecuteWordChunkedRaw(::grpc::ClientContext* context, const ::forthic::ExecuteWordRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* ExecuteStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* AsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::forthic::StreamRequest, ::forthic::StreamResponse>* PrepareAsyncExecuteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::ListModulesResponse>* AsyncListModulesRaw(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::ListModulesResponse>* PrepareAsyncListModulesRaw(::grpc::ClientContext* context, const ::forthic::ListModulesRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::GetModuleInfoResponse>* AsyncGetModuleInfoRaw(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::forthic::GetModuleInfoResponse>* PrepareAsyncGetModuleInfoRaw(::grpc::ClientContext* context, const ::forthic::GetModuleInfoRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>* AsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::forthic::FetchRefResponse>* PrepareAsyncFetchRefRaw(::grpc::ClientContext* context, const ::forthic::FetchRefRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>* AsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::forthic::ReleaseRefsResponse>* PrepareAsyncReleaseRefsRaw(::grpc::ClientContext* context, const ::forthic::ReleaseRefsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ExecuteWord_;
     const ::grpc::internal::RpcMethod rpcmethod_ExecuteSequence_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExecuteWordChunked_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExecuteStream_;
     const ::grpc::internal::RpcMethod rpcmethod_ListModules_;
     const ::grpc::internal::RpcMethod rpcmethod_GetModuleInfo_;
+    const ::grpc::internal::RpcMethod rpcmethod_FetchRef_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReleaseRefs_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -176,11 +288,21 @@ class ForthicRuntime final {
     virtual ::grpc::Status ExecuteWord(::grpc::ServerContext* context, const ::forthic::ExecuteWordRequest* request, ::forthic::ExecuteWordResponse* response);
     // Execute a sequence of words in one remote call (batched execution optimization)
     virtual ::grpc::Status ExecuteSequence(::grpc::ServerContext* context, const ::forthic::ExecuteSequenceRequest* request, ::forthic::ExecuteSequenceResponse* response);
+    // Execute a single word and stream the result stack back in chunks
+    // For results too large to hold in one message
+    virtual ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* context, const ::forthic::ExecuteWordRequest* request, ::grpc::ServerWriter< ::forthic::ResultChunk>* writer);
+    // Pipelined execution over one long-lived stream with a session-scoped stack
+    virtual ::grpc::Status ExecuteStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* stream);
     // Phase 3: Module discovery
     // List available runtime-specific modules (excludes standard library)
     virtual ::grpc::Status ListModules(::grpc::ServerContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response);
     // Get detailed information about a specific module
     virtual ::grpc::Status GetModuleInfo(::grpc::ServerContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response);
+    // Remote value handles
+    // Materialize the value behind a handle returned as a RemoteRefValue
+    virtual ::grpc::Status FetchRef(::grpc::ServerContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response);
+    // Drop handles the caller no longer references so the runtime can free the values
+    virtual ::grpc::Status ReleaseRefs(::grpc::ServerContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_ExecuteWord : public BaseClass {
@@ -223,12 +345,52 @@ class ForthicRuntime final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteWordChunked(::grpc::ServerContext* context, ::forthic::ExecuteWordRequest* request, ::grpc::ServerAsyncWriter< ::forthic::ResultChunk>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ExecuteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExecuteStream() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_ExecuteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_ListModules : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ListModules() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_ListModules() override {
       BaseClassMustBeDerivedFromService(this);
@@ -239,7 +401,7 @@ class ForthicRuntime final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestListModules(::grpc::ServerContext* context, ::forthic::ListModulesRequest* request, ::grpc::ServerAsyncResponseWriter< ::forthic::ListModulesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -248,7 +410,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(5);
     }
     ~WithAsyncMethod_GetModuleInfo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -259,10 +421,50 @@ class ForthicRuntime final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetModuleInfo(::grpc::ServerContext* context, ::forthic::GetModuleInfoRequest* request, ::grpc::ServerAsyncResponseWriter< ::forthic::GetModuleInfoResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_FetchRef() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFetchRef(::grpc::ServerContext* context, ::forthic::FetchRefRequest* request, ::grpc::ServerAsyncResponseWriter< ::forthic::FetchRefResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReleaseRefs(::grpc::ServerContext* context, ::forthic::ReleaseRefsRequest* request, ::grpc::ServerAsyncResponseWriter< ::forthic::ReleaseRefsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ExecuteWord<WithAsyncMethod_ExecuteSequence<WithAsyncMethod_ListModules<WithAsyncMethod_GetModuleInfo<Service > > > > AsyncService;
+  typedef WithAsyncMethod_ExecuteWord<WithAsyncMethod_ExecuteSequence<WithAsyncMethod_ExecuteWordChunked<WithAsyncMethod_ExecuteStream<WithAsyncMethod_ListModules<WithAsyncMethod_GetModuleInfo<WithAsyncMethod_FetchRef<WithAsyncMethod_ReleaseRefs<Service > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_ExecuteWord : public BaseClass {
    private:
@@ -318,18 +520,63 @@ class ForthicRuntime final {
       ::grpc::CallbackServerContext* /*context*/, const ::forthic::ExecuteSequenceRequest* /*request*/, ::forthic::ExecuteSequenceResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::forthic::ExecuteWordRequest, ::forthic::ResultChunk>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::forthic::ExecuteWordRequest* request) { return this->ExecuteWordChunked(context, request); }));
+    }
+    ~WithCallbackMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::forthic::ResultChunk>* ExecuteWordChunked(
+      ::grpc::CallbackServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ExecuteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExecuteStream() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::forthic::StreamRequest, ::forthic::StreamResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ExecuteStream(context); }));
+    }
+    ~WithCallbackMethod_ExecuteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::forthic::StreamRequest, ::forthic::StreamResponse>* ExecuteStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_ListModules : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ListModules() {
-      ::grpc::Service::MarkMethodCallback(2,
+      ::grpc::Service::MarkMethodCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::forthic::ListModulesRequest, ::forthic::ListModulesResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::forthic::ListModulesRequest* request, ::forthic::ListModulesResponse* response) { return this->ListModules(context, request, response); }));}
     void SetMessageAllocatorFor_ListModules(
         ::grpc::MessageAllocator< ::forthic::ListModulesRequest, ::forthic::ListModulesResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::forthic::ListModulesRequest, ::forthic::ListModulesResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -350,13 +597,13 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::forthic::GetModuleInfoRequest, ::forthic::GetModuleInfoResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::forthic::GetModuleInfoRequest* request, ::forthic::GetModuleInfoResponse* response) { return this->GetModuleInfo(context, request, response); }));}
     void SetMessageAllocatorFor_GetModuleInfo(
         ::grpc::MessageAllocator< ::forthic::GetModuleInfoRequest, ::forthic::GetModuleInfoResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::forthic::GetModuleInfoRequest, ::forthic::GetModuleInfoResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -371,7 +618,61 @@ class ForthicRuntime final {
     virtual ::grpc::ServerUnaryReactor* GetModuleInfo(
       ::grpc::CallbackServerContext* /*context*/, const ::forthic::GetModuleInfoRequest* /*request*/, ::forthic::GetModuleInfoResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_ExecuteWord<WithCallbackMethod_ExecuteSequence<WithCallbackMethod_ListModules<WithCallbackMethod_GetModuleInfo<Service > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_FetchRef() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::forthic::FetchRefRequest, ::forthic::FetchRefResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::forthic::FetchRefRequest* request, ::forthic::FetchRefResponse* response) { return this->FetchRef(context, request, response); }));}
+    void SetMessageAllocatorFor_FetchRef(
+        ::grpc::MessageAllocator< ::forthic::FetchRefRequest, ::forthic::FetchRefResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::forthic::FetchRefRequest, ::forthic::FetchRefResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* FetchRef(
+      ::grpc::CallbackServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::forthic::ReleaseRefsRequest* request, ::forthic::ReleaseRefsResponse* response) { return this->ReleaseRefs(context, request, response); }));}
+    void SetMessageAllocatorFor_ReleaseRefs(
+        ::grpc::MessageAllocator< ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReleaseRefs(
+      ::grpc::CallbackServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_ExecuteWord<WithCallbackMethod_ExecuteSequence<WithCallbackMethod_ExecuteWordChunked<WithCallbackMethod_ExecuteStream<WithCallbackMethod_ListModules<WithCallbackMethod_GetModuleInfo<WithCallbackMethod_FetchRef<WithCallbackMethod_ReleaseRefs<Service > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_ExecuteWord : public BaseClass {
@@ -408,12 +709,46 @@ class ForthicRuntime final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ExecuteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExecuteStream() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_ExecuteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_ListModules : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ListModules() {
-      ::grpc::Service::MarkMethodGeneric(2);
+      ::grpc::Service::MarkMethodGeneric(4);
     }
     ~WithGenericMethod_ListModules() override {
       BaseClassMustBeDerivedFromService(this);
@@ -430,7 +765,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(5);
     }
     ~WithGenericMethod_GetModuleInfo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -442,6 +777,40 @@ class ForthicRuntime final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_FetchRef() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ExecuteWord : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -482,12 +851,52 @@ class ForthicRuntime final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteWordChunked(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ExecuteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExecuteStream() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_ExecuteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ListModules : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ListModules() {
-      ::grpc::Service::MarkMethodRaw(2);
+      ::grpc::Service::MarkMethodRaw(4);
     }
     ~WithRawMethod_ListModules() override {
       BaseClassMustBeDerivedFromService(this);
@@ -498,7 +907,7 @@ class ForthicRuntime final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestListModules(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -507,7 +916,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(5);
     }
     ~WithRawMethod_GetModuleInfo() override {
       BaseClassMustBeDerivedFromService(this);
@@ -518,7 +927,47 @@ class ForthicRuntime final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetModuleInfo(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_FetchRef() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFetchRef(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReleaseRefs(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -566,12 +1015,57 @@ class ForthicRuntime final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->ExecuteWordChunked(context, request); }));
+    }
+    ~WithRawCallbackMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ExecuteWordChunked(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ExecuteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExecuteStream() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ExecuteStream(context); }));
+    }
+    ~WithRawCallbackMethod_ExecuteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::forthic::StreamResponse, ::forthic::StreamRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ExecuteStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_ListModules : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ListModules() {
-      ::grpc::Service::MarkMethodRawCallback(2,
+      ::grpc::Service::MarkMethodRawCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListModules(context, request, response); }));
@@ -593,7 +1087,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetModuleInfo(context, request, response); }));
@@ -610,6 +1104,50 @@ class ForthicRuntime final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_FetchRef() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->FetchRef(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* FetchRef(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReleaseRefs(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReleaseRefs(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ExecuteWord : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -669,7 +1207,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ListModules() {
-      ::grpc::Service::MarkMethodStreamed(2,
+      ::grpc::Service::MarkMethodStreamed(4,
         new ::grpc::internal::StreamedUnaryHandler<
           ::forthic::ListModulesRequest, ::forthic::ListModulesResponse>(
             [this](::grpc::ServerContext* context,
@@ -696,7 +1234,7 @@ class ForthicRuntime final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetModuleInfo() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(5,
         new ::grpc::internal::StreamedUnaryHandler<
           ::forthic::GetModuleInfoRequest, ::forthic::GetModuleInfoResponse>(
             [this](::grpc::ServerContext* context,
@@ -717,9 +1255,90 @@ class ForthicRuntime final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetModuleInfo(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::forthic::GetModuleInfoRequest,::forthic::GetModuleInfoResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_ExecuteWord<WithStreamedUnaryMethod_ExecuteSequence<WithStreamedUnaryMethod_ListModules<WithStreamedUnaryMethod_GetModuleInfo<Service > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ExecuteWord<WithStreamedUnaryMethod_ExecuteSequence<WithStreamedUnaryMethod_ListModules<WithStreamedUnaryMethod_GetModuleInfo<Service > > > > StreamedService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_FetchRef : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_FetchRef() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::forthic::FetchRefRequest, ::forthic::FetchRefResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::forthic::FetchRefRequest, ::forthic::FetchRefResponse>* streamer) {
+                       return this->StreamedFetchRef(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_FetchRef() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status FetchRef(::grpc::ServerContext* /*context*/, const ::forthic::FetchRefRequest* /*request*/, ::forthic::FetchRefResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedFetchRef(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::forthic::FetchRefRequest,::forthic::FetchRefResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ReleaseRefs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReleaseRefs() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::forthic::ReleaseRefsRequest, ::forthic::ReleaseRefsResponse>* streamer) {
+                       return this->StreamedReleaseRefs(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReleaseRefs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReleaseRefs(::grpc::ServerContext* /*context*/, const ::forthic::ReleaseRefsRequest* /*request*/, ::forthic::ReleaseRefsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReleaseRefs(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::forthic::ReleaseRefsRequest,::forthic::ReleaseRefsResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_ExecuteWord<WithStreamedUnaryMethod_ExecuteSequence<WithStreamedUnaryMethod_ListModules<WithStreamedUnaryMethod_GetModuleInfo<WithStreamedUnaryMethod_FetchRef<WithStreamedUnaryMethod_ReleaseRefs<Service > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ExecuteWordChunked : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ExecuteWordChunked() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::forthic::ExecuteWordRequest, ::forthic::ResultChunk>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::forthic::ExecuteWordRequest, ::forthic::ResultChunk>* streamer) {
+                       return this->StreamedExecuteWordChunked(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ExecuteWordChunked() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ExecuteWordChunked(::grpc::ServerContext* /*context*/, const ::forthic::ExecuteWordRequest* /*request*/, ::grpc::ServerWriter< ::forthic::ResultChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedExecuteWordChunked(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::forthic::ExecuteWordRequest,::forthic::ResultChunk>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_ExecuteWordChunked<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_ExecuteWord<WithStreamedUnaryMethod_ExecuteSequence<WithSplitStreamingMethod_ExecuteWordChunked<WithStreamedUnaryMethod_ListModules<WithStreamedUnaryMethod_GetModuleInfo<WithStreamedUnaryMethod_FetchRef<WithStreamedUnaryMethod_ReleaseRefs<Service > > > > > > > StreamedService;
 };
 
 }  // namespace forthic
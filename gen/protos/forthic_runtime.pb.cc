@@ -34,7 +34,8 @@ inline constexpr ZonedDateTimeValue::Impl_::Impl_(
             ::_pbi::ConstantInitialized()),
         timezone_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        epoch_nanos_{::int64_t{0}} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR ZonedDateTimeValue::ZonedDateTimeValue(::_pbi::ConstantInitialized)
@@ -67,7 +68,8 @@ inline constexpr WordInfo::Impl_::Impl_(
             ::_pbi::ConstantInitialized()),
         description_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        pure_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR WordInfo::WordInfo(::_pbi::ConstantInitialized)
@@ -89,12 +91,177 @@ struct WordInfoDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WordInfoDefaultTypeInternal _WordInfo_default_instance_;
 
+inline constexpr SharedPayload::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        region_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        offset_{::uint64_t{0u}},
+        length_{::uint64_t{0u}},
+        generation_{::uint64_t{0u}} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SharedPayload::SharedPayload(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(SharedPayload_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct SharedPayloadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SharedPayloadDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SharedPayloadDefaultTypeInternal() {}
+  union {
+    SharedPayload _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SharedPayloadDefaultTypeInternal _SharedPayload_default_instance_;
+
+inline constexpr SharedMemoryOffer::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        region_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        min_bytes_{::uint64_t{0u}} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SharedMemoryOffer::SharedMemoryOffer(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(SharedMemoryOffer_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct SharedMemoryOfferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SharedMemoryOfferDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SharedMemoryOfferDefaultTypeInternal() {}
+  union {
+    SharedMemoryOffer _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SharedMemoryOfferDefaultTypeInternal _SharedMemoryOffer_default_instance_;
+
+inline constexpr ResultHeader::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        result_count_{0u},
+        supports_compact_temporal_{false} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ResultHeader::ResultHeader(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ResultHeader_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ResultHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResultHeaderDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResultHeaderDefaultTypeInternal() {}
+  union {
+    ResultHeader _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResultHeaderDefaultTypeInternal _ResultHeader_default_instance_;
+
+inline constexpr RemoteRefValue::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        handle_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        runtime_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RemoteRefValue::RemoteRefValue(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(RemoteRefValue_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RemoteRefValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RemoteRefValueDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RemoteRefValueDefaultTypeInternal() {}
+  union {
+    RemoteRefValue _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemoteRefValueDefaultTypeInternal _RemoteRefValue_default_instance_;
+
+inline constexpr ReleaseRefsResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        released_count_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReleaseRefsResponse::ReleaseRefsResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReleaseRefsResponse_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReleaseRefsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReleaseRefsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReleaseRefsResponseDefaultTypeInternal() {}
+  union {
+    ReleaseRefsResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseRefsResponseDefaultTypeInternal _ReleaseRefsResponse_default_instance_;
+
+inline constexpr ReleaseRefsRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        handle_ids_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReleaseRefsRequest::ReleaseRefsRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReleaseRefsRequest_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReleaseRefsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReleaseRefsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReleaseRefsRequestDefaultTypeInternal() {}
+  union {
+    ReleaseRefsRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseRefsRequestDefaultTypeInternal _ReleaseRefsRequest_default_instance_;
+
 inline constexpr PlainDateValue::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         iso8601_date_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        days_since_epoch_{0} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR PlainDateValue::PlainDateValue(::_pbi::ConstantInitialized)
@@ -189,7 +356,8 @@ inline constexpr InstantValue::Impl_::Impl_(
       : _cached_size_{0},
         iso8601_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        epoch_nanos_{::int64_t{0}} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR InstantValue::InstantValue(::_pbi::ConstantInitialized)
@@ -237,6 +405,34 @@ struct GetModuleInfoRequestDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetModuleInfoRequestDefaultTypeInternal _GetModuleInfoRequest_default_instance_;
+
+inline constexpr FetchRefRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        handle_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        accepts_compact_temporal_{false} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR FetchRefRequest::FetchRefRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(FetchRefRequest_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct FetchRefRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FetchRefRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FetchRefRequestDefaultTypeInternal() {}
+  union {
+    FetchRefRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FetchRefRequestDefaultTypeInternal _FetchRefRequest_default_instance_;
 template <typename>
 PROTOBUF_CONSTEXPR ErrorInfo_ContextEntry_DoNotUse::ErrorInfo_ContextEntry_DoNotUse(::_pbi::ConstantInitialized)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
@@ -259,7 +455,10 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
 inline constexpr ListModulesResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
-        modules_{} {}
+        modules_{},
+        version_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()) {}
 
 template <typename>
 PROTOBUF_CONSTEXPR ListModulesResponse::ListModulesResponse(::_pbi::ConstantInitialized)
@@ -289,6 +488,9 @@ inline constexpr GetModuleInfoResponse::Impl_::Impl_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
         description_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        version_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()) {}
 
@@ -447,12 +649,153 @@ struct StackValueDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StackValueDefaultTypeInternal _StackValue_default_instance_;
 
-inline constexpr ExecuteWordResponse::Impl_::Impl_(
+inline constexpr StreamResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         result_stack_{},
+        error_{nullptr},
+        correlation_id_{::uint64_t{0u}},
+        session_depth_{0u},
+        supports_compact_temporal_{false} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StreamResponse::StreamResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(StreamResponse_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct StreamResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamResponseDefaultTypeInternal() {}
+  union {
+    StreamResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamResponseDefaultTypeInternal _StreamResponse_default_instance_;
+
+inline constexpr StreamRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        push_{},
+        word_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        correlation_id_{::uint64_t{0u}},
+        return_count_{0u},
+        accepts_compact_temporal_{false} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StreamRequest::StreamRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(StreamRequest_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct StreamRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamRequestDefaultTypeInternal() {}
+  union {
+    StreamRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamRequestDefaultTypeInternal _StreamRequest_default_instance_;
+
+inline constexpr StackPayload::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        values_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StackPayload::StackPayload(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(StackPayload_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct StackPayloadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StackPayloadDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StackPayloadDefaultTypeInternal() {}
+  union {
+    StackPayload _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StackPayloadDefaultTypeInternal _StackPayload_default_instance_;
+
+inline constexpr ResultValueChunk::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        stack_index_{0u},
+        last_{false},
+        part_{},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ResultValueChunk::ResultValueChunk(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ResultValueChunk_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ResultValueChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResultValueChunkDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResultValueChunkDefaultTypeInternal() {}
+  union {
+    ResultValueChunk _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResultValueChunkDefaultTypeInternal _ResultValueChunk_default_instance_;
+
+inline constexpr FetchRefResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        value_{nullptr},
         error_{nullptr} {}
 
+template <typename>
+PROTOBUF_CONSTEXPR FetchRefResponse::FetchRefResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(FetchRefResponse_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct FetchRefResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FetchRefResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FetchRefResponseDefaultTypeInternal() {}
+  union {
+    FetchRefResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FetchRefResponseDefaultTypeInternal _FetchRefResponse_default_instance_;
+
+inline constexpr ExecuteWordResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        result_stack_{},
+        error_{nullptr},
+        shared_result_stack_{nullptr},
+        supports_compact_temporal_{false} {}
+
 template <typename>
 PROTOBUF_CONSTEXPR ExecuteWordResponse::ExecuteWordResponse(::_pbi::ConstantInitialized)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
@@ -479,7 +822,12 @@ inline constexpr ExecuteWordRequest::Impl_::Impl_(
         stack_{},
         word_name_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        shared_memory_{nullptr},
+        shared_stack_{nullptr},
+        accepts_compact_temporal_{false},
+        accepts_remote_refs_{false},
+        max_chunk_bytes_{0u} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR ExecuteWordRequest::ExecuteWordRequest(::_pbi::ConstantInitialized)
@@ -505,7 +853,8 @@ inline constexpr ExecuteSequenceResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         result_stack_{},
-        error_{nullptr} {}
+        error_{nullptr},
+        supports_compact_temporal_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR ExecuteSequenceResponse::ExecuteSequenceResponse(::_pbi::ConstantInitialized)
@@ -531,7 +880,9 @@ inline constexpr ExecuteSequenceRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         word_names_{},
-        stack_{} {}
+        stack_{},
+        accepts_compact_temporal_{false},
+        accepts_remote_refs_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR ExecuteSequenceRequest::ExecuteSequenceRequest(::_pbi::ConstantInitialized)
@@ -552,6 +903,32 @@ struct ExecuteSequenceRequestDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExecuteSequenceRequestDefaultTypeInternal _ExecuteSequenceRequest_default_instance_;
+
+inline constexpr ResultChunk::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : chunk_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ResultChunk::ResultChunk(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ResultChunk_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ResultChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResultChunkDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResultChunkDefaultTypeInternal() {}
+  union {
+    ResultChunk _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResultChunkDefaultTypeInternal _ResultChunk_default_instance_;
 }  // namespace forthic
 static constexpr const ::_pb::EnumDescriptor* PROTOBUF_NONNULL* PROTOBUF_NULLABLE
     file_level_enum_descriptors_protos_2fforthic_5fruntime_2eproto = nullptr;
@@ -562,32 +939,127 @@ const ::uint32_t
         protodesc_cold) = {
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_._has_bits_),
-        5, // hasbit index offset
+        10, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.word_name_),
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.stack_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.accepts_compact_temporal_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.accepts_remote_refs_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.max_chunk_bytes_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.shared_memory_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordRequest, _impl_.shared_stack_),
         1,
         0,
+        4,
+        5,
+        6,
+        2,
+        3,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordResponse, _impl_._has_bits_),
-        5, // hasbit index offset
+        7, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordResponse, _impl_.result_stack_),
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordResponse, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordResponse, _impl_.supports_compact_temporal_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteWordResponse, _impl_.shared_result_stack_),
         0,
         1,
+        3,
+        2,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceRequest, _impl_._has_bits_),
-        5, // hasbit index offset
+        7, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceRequest, _impl_.word_names_),
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceRequest, _impl_.stack_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceRequest, _impl_.accepts_compact_temporal_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceRequest, _impl_.accepts_remote_refs_),
         0,
         1,
+        2,
+        3,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceResponse, _impl_._has_bits_),
-        5, // hasbit index offset
+        6, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceResponse, _impl_.result_stack_),
         PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceResponse, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ExecuteSequenceResponse, _impl_.supports_compact_temporal_),
+        0,
+        1,
+        2,
+        0x004, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_._oneof_case_[0]),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_.chunk_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_.chunk_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_.chunk_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_.chunk_),
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultHeader, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultHeader, _impl_.result_count_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultHeader, _impl_.supports_compact_temporal_),
+        0,
+        1,
+        0x085, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_._has_bits_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_._oneof_case_[0]),
+        9, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_.stack_index_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_.part_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_.part_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_.last_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_.part_),
+        0,
+        ~0u,
+        ~0u,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedMemoryOffer, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedMemoryOffer, _impl_.region_),
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedMemoryOffer, _impl_.min_bytes_),
+        0,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedPayload, _impl_._has_bits_),
+        7, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedPayload, _impl_.region_),
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedPayload, _impl_.offset_),
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedPayload, _impl_.length_),
+        PROTOBUF_FIELD_OFFSET(::forthic::SharedPayload, _impl_.generation_),
+        0,
+        1,
+        2,
+        3,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::StackPayload, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::StackPayload, _impl_.values_),
+        0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_._has_bits_),
+        8, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_.correlation_id_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_.word_name_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_.push_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_.return_count_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamRequest, _impl_.accepts_compact_temporal_),
+        2,
+        1,
+        0,
+        3,
+        4,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_._has_bits_),
+        8, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_.correlation_id_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_.result_stack_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_.session_depth_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StreamResponse, _impl_.supports_compact_temporal_),
+        2,
         0,
         1,
+        3,
+        4,
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_._oneof_case_[0]),
         PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_.value_),
@@ -601,6 +1073,7 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_.value_),
         PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_.value_),
         PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_.value_),
+        PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_.value_),
         0x000, // bitmap
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ArrayValue, _impl_._has_bits_),
@@ -621,22 +1094,59 @@ const ::uint32_t
         0,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::InstantValue, _impl_._has_bits_),
-        4, // hasbit index offset
+        5, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::InstantValue, _impl_.iso8601_),
+        PROTOBUF_FIELD_OFFSET(::forthic::InstantValue, _impl_.epoch_nanos_),
         0,
+        1,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::PlainDateValue, _impl_._has_bits_),
-        4, // hasbit index offset
+        5, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::PlainDateValue, _impl_.iso8601_date_),
+        PROTOBUF_FIELD_OFFSET(::forthic::PlainDateValue, _impl_.days_since_epoch_),
         0,
+        1,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ZonedDateTimeValue, _impl_._has_bits_),
-        5, // hasbit index offset
+        6, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ZonedDateTimeValue, _impl_.iso8601_),
         PROTOBUF_FIELD_OFFSET(::forthic::ZonedDateTimeValue, _impl_.timezone_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ZonedDateTimeValue, _impl_.epoch_nanos_),
+        0,
+        1,
+        2,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::RemoteRefValue, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::RemoteRefValue, _impl_.handle_id_),
+        PROTOBUF_FIELD_OFFSET(::forthic::RemoteRefValue, _impl_.runtime_),
+        0,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefRequest, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefRequest, _impl_.handle_id_),
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefRequest, _impl_.accepts_compact_temporal_),
+        0,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefResponse, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefResponse, _impl_.value_),
+        PROTOBUF_FIELD_OFFSET(::forthic::FetchRefResponse, _impl_.error_),
         0,
         1,
         0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::ReleaseRefsRequest, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::ReleaseRefsRequest, _impl_.handle_ids_),
+        0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::forthic::ReleaseRefsResponse, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::forthic::ReleaseRefsResponse, _impl_.released_count_),
+        0,
+        0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ErrorInfo_ContextEntry_DoNotUse, _impl_._has_bits_),
         5, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ErrorInfo_ContextEntry_DoNotUse, _impl_.key_),
@@ -663,9 +1173,11 @@ const ::uint32_t
         0x000, // bitmap
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ListModulesResponse, _impl_._has_bits_),
-        4, // hasbit index offset
+        5, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::ListModulesResponse, _impl_.modules_),
+        PROTOBUF_FIELD_OFFSET(::forthic::ListModulesResponse, _impl_.version_),
         0,
+        1,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::ModuleSummary, _impl_._has_bits_),
         7, // hasbit index offset
@@ -684,52 +1196,77 @@ const ::uint32_t
         0,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::GetModuleInfoResponse, _impl_._has_bits_),
-        6, // hasbit index offset
+        7, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::GetModuleInfoResponse, _impl_.name_),
         PROTOBUF_FIELD_OFFSET(::forthic::GetModuleInfoResponse, _impl_.description_),
         PROTOBUF_FIELD_OFFSET(::forthic::GetModuleInfoResponse, _impl_.words_),
+        PROTOBUF_FIELD_OFFSET(::forthic::GetModuleInfoResponse, _impl_.version_),
         1,
         2,
         0,
+        3,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::forthic::WordInfo, _impl_._has_bits_),
-        6, // hasbit index offset
+        7, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::forthic::WordInfo, _impl_.name_),
         PROTOBUF_FIELD_OFFSET(::forthic::WordInfo, _impl_.stack_effect_),
         PROTOBUF_FIELD_OFFSET(::forthic::WordInfo, _impl_.description_),
+        PROTOBUF_FIELD_OFFSET(::forthic::WordInfo, _impl_.pure_),
         0,
         1,
         2,
+        3,
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, sizeof(::forthic::ExecuteWordRequest)},
-        {7, sizeof(::forthic::ExecuteWordResponse)},
-        {14, sizeof(::forthic::ExecuteSequenceRequest)},
-        {21, sizeof(::forthic::ExecuteSequenceResponse)},
-        {28, sizeof(::forthic::StackValue)},
-        {41, sizeof(::forthic::NullValue)},
-        {42, sizeof(::forthic::ArrayValue)},
-        {47, sizeof(::forthic::RecordValue_FieldsEntry_DoNotUse)},
-        {54, sizeof(::forthic::RecordValue)},
-        {59, sizeof(::forthic::InstantValue)},
-        {64, sizeof(::forthic::PlainDateValue)},
-        {69, sizeof(::forthic::ZonedDateTimeValue)},
-        {76, sizeof(::forthic::ErrorInfo_ContextEntry_DoNotUse)},
-        {83, sizeof(::forthic::ErrorInfo)},
-        {100, sizeof(::forthic::ListModulesRequest)},
-        {101, sizeof(::forthic::ListModulesResponse)},
-        {106, sizeof(::forthic::ModuleSummary)},
-        {117, sizeof(::forthic::GetModuleInfoRequest)},
-        {122, sizeof(::forthic::GetModuleInfoResponse)},
-        {131, sizeof(::forthic::WordInfo)},
+        {17, sizeof(::forthic::ExecuteWordResponse)},
+        {28, sizeof(::forthic::ExecuteSequenceRequest)},
+        {39, sizeof(::forthic::ExecuteSequenceResponse)},
+        {48, sizeof(::forthic::ResultChunk)},
+        {54, sizeof(::forthic::ResultHeader)},
+        {61, sizeof(::forthic::ResultValueChunk)},
+        {74, sizeof(::forthic::SharedMemoryOffer)},
+        {81, sizeof(::forthic::SharedPayload)},
+        {92, sizeof(::forthic::StackPayload)},
+        {97, sizeof(::forthic::StreamRequest)},
+        {110, sizeof(::forthic::StreamResponse)},
+        {123, sizeof(::forthic::StackValue)},
+        {137, sizeof(::forthic::NullValue)},
+        {138, sizeof(::forthic::ArrayValue)},
+        {143, sizeof(::forthic::RecordValue_FieldsEntry_DoNotUse)},
+        {150, sizeof(::forthic::RecordValue)},
+        {155, sizeof(::forthic::InstantValue)},
+        {162, sizeof(::forthic::PlainDateValue)},
+        {169, sizeof(::forthic::ZonedDateTimeValue)},
+        {178, sizeof(::forthic::RemoteRefValue)},
+        {185, sizeof(::forthic::FetchRefRequest)},
+        {192, sizeof(::forthic::FetchRefResponse)},
+        {199, sizeof(::forthic::ReleaseRefsRequest)},
+        {204, sizeof(::forthic::ReleaseRefsResponse)},
+        {209, sizeof(::forthic::ErrorInfo_ContextEntry_DoNotUse)},
+        {216, sizeof(::forthic::ErrorInfo)},
+        {233, sizeof(::forthic::ListModulesRequest)},
+        {234, sizeof(::forthic::ListModulesResponse)},
+        {241, sizeof(::forthic::ModuleSummary)},
+        {252, sizeof(::forthic::GetModuleInfoRequest)},
+        {257, sizeof(::forthic::GetModuleInfoResponse)},
+        {268, sizeof(::forthic::WordInfo)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::forthic::_ExecuteWordRequest_default_instance_._instance,
     &::forthic::_ExecuteWordResponse_default_instance_._instance,
     &::forthic::_ExecuteSequenceRequest_default_instance_._instance,
     &::forthic::_ExecuteSequenceResponse_default_instance_._instance,
+    &::forthic::_ResultChunk_default_instance_._instance,
+    &::forthic::_ResultHeader_default_instance_._instance,
+    &::forthic::_ResultValueChunk_default_instance_._instance,
+    &::forthic::_SharedMemoryOffer_default_instance_._instance,
+    &::forthic::_SharedPayload_default_instance_._instance,
+    &::forthic::_StackPayload_default_instance_._instance,
+    &::forthic::_StreamRequest_default_instance_._instance,
+    &::forthic::_StreamResponse_default_instance_._instance,
     &::forthic::_StackValue_default_instance_._instance,
     &::forthic::_NullValue_default_instance_._instance,
     &::forthic::_ArrayValue_default_instance_._instance,
@@ -738,6 +1275,11 @@ static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::forthic::_InstantValue_default_instance_._instance,
     &::forthic::_PlainDateValue_default_instance_._instance,
     &::forthic::_ZonedDateTimeValue_default_instance_._instance,
+    &::forthic::_RemoteRefValue_default_instance_._instance,
+    &::forthic::_FetchRefRequest_default_instance_._instance,
+    &::forthic::_FetchRefResponse_default_instance_._instance,
+    &::forthic::_ReleaseRefsRequest_default_instance_._instance,
+    &::forthic::_ReleaseRefsResponse_default_instance_._instance,
     &::forthic::_ErrorInfo_ContextEntry_DoNotUse_default_instance_._instance,
     &::forthic::_ErrorInfo_default_instance_._instance,
     &::forthic::_ListModulesRequest_default_instance_._instance,
@@ -750,72 +1292,127 @@ static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
 const char descriptor_table_protodef_protos_2fforthic_5fruntime_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
     "\n\034protos/forthic_runtime.proto\022\007forthic\""
-    "K\n\022ExecuteWordRequest\022\021\n\tword_name\030\001 \001(\t"
-    "\022\"\n\005stack\030\002 \003(\0132\023.forthic.StackValue\"r\n\023"
-    "ExecuteWordResponse\022)\n\014result_stack\030\001 \003("
-    "\0132\023.forthic.StackValue\022&\n\005error\030\002 \001(\0132\022."
-    "forthic.ErrorInfoH\000\210\001\001B\010\n\006_error\"P\n\026Exec"
-    "uteSequenceRequest\022\022\n\nword_names\030\001 \003(\t\022\""
-    "\n\005stack\030\002 \003(\0132\023.forthic.StackValue\"v\n\027Ex"
-    "ecuteSequenceResponse\022)\n\014result_stack\030\001 "
-    "\003(\0132\023.forthic.StackValue\022&\n\005error\030\002 \001(\0132"
-    "\022.forthic.ErrorInfoH\000\210\001\001B\010\n\006_error\"\225\003\n\nS"
-    "tackValue\022\023\n\tint_value\030\001 \001(\003H\000\022\026\n\014string"
-    "_value\030\002 \001(\tH\000\022\024\n\nbool_value\030\003 \001(\010H\000\022\025\n\013"
-    "float_value\030\004 \001(\001H\000\022(\n\nnull_value\030\005 \001(\0132"
-    "\022.forthic.NullValueH\000\022*\n\013array_value\030\006 \001"
-    "(\0132\023.forthic.ArrayValueH\000\022,\n\014record_valu"
-    "e\030\007 \001(\0132\024.forthic.RecordValueH\000\022.\n\rinsta"
-    "nt_value\030\010 \001(\0132\025.forthic.InstantValueH\000\022"
-    "3\n\020plain_date_value\030\t \001(\0132\027.forthic.Plai"
-    "nDateValueH\000\022;\n\024zoned_datetime_value\030\n \001"
-    "(\0132\033.forthic.ZonedDateTimeValueH\000B\007\n\005val"
-    "ue\"\013\n\tNullValue\"0\n\nArrayValue\022\"\n\005items\030\001"
-    " \003(\0132\023.forthic.StackValue\"\203\001\n\013RecordValu"
-    "e\0220\n\006fields\030\001 \003(\0132 .forthic.RecordValue."
-    "FieldsEntry\032B\n\013FieldsEntry\022\013\n\003key\030\001 \001(\t\022"
-    "\"\n\005value\030\002 \001(\0132\023.forthic.StackValue:\0028\001\""
-    "\037\n\014InstantValue\022\017\n\007iso8601\030\001 \001(\t\"&\n\016Plai"
-    "nDateValue\022\024\n\014iso8601_date\030\001 \001(\t\"7\n\022Zone"
-    "dDateTimeValue\022\017\n\007iso8601\030\001 \001(\t\022\020\n\010timez"
-    "one\030\002 \001(\t\"\220\002\n\tErrorInfo\022\017\n\007message\030\001 \001(\t"
-    "\022\017\n\007runtime\030\002 \001(\t\022\023\n\013stack_trace\030\003 \003(\t\022\022"
-    "\n\nerror_type\030\004 \001(\t\022\032\n\rword_location\030\005 \001("
-    "\tH\000\210\001\001\022\030\n\013module_name\030\006 \001(\tH\001\210\001\001\0220\n\007cont"
-    "ext\030\007 \003(\0132\037.forthic.ErrorInfo.ContextEnt"
-    "ry\032.\n\014ContextEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value"
-    "\030\002 \001(\t:\0028\001B\020\n\016_word_locationB\016\n\014_module_"
-    "name\"\024\n\022ListModulesRequest\">\n\023ListModule"
-    "sResponse\022\'\n\007modules\030\001 \003(\0132\026.forthic.Mod"
-    "uleSummary\"`\n\rModuleSummary\022\014\n\004name\030\001 \001("
-    "\t\022\023\n\013description\030\002 \001(\t\022\022\n\nword_count\030\003 \001"
-    "(\005\022\030\n\020runtime_specific\030\004 \001(\010\"+\n\024GetModul"
-    "eInfoRequest\022\023\n\013module_name\030\001 \001(\t\"\\\n\025Get"
-    "ModuleInfoResponse\022\014\n\004name\030\001 \001(\t\022\023\n\013desc"
-    "ription\030\002 \001(\t\022 \n\005words\030\003 \003(\0132\021.forthic.W"
-    "ordInfo\"C\n\010WordInfo\022\014\n\004name\030\001 \001(\t\022\024\n\014sta"
-    "ck_effect\030\002 \001(\t\022\023\n\013description\030\003 \001(\t2\312\002\n"
-    "\016ForthicRuntime\022H\n\013ExecuteWord\022\033.forthic"
-    ".ExecuteWordRequest\032\034.forthic.ExecuteWor"
-    "dResponse\022T\n\017ExecuteSequence\022\037.forthic.E"
-    "xecuteSequenceRequest\032 .forthic.ExecuteS"
-    "equenceResponse\022H\n\013ListModules\022\033.forthic"
-    ".ListModulesRequest\032\034.forthic.ListModule"
-    "sResponse\022N\n\rGetModuleInfo\022\035.forthic.Get"
-    "ModuleInfoRequest\032\036.forthic.GetModuleInf"
-    "oResponseb\006proto3"
+    "\261\002\n\022ExecuteWordRequest\022\021\n\tword_name\030\001 \001("
+    "\t\022\"\n\005stack\030\002 \003(\0132\023.forthic.StackValue\022 \n"
+    "\030accepts_compact_temporal\030\003 \001(\010\022\033\n\023accep"
+    "ts_remote_refs\030\004 \001(\010\022\027\n\017max_chunk_bytes\030"
+    "\005 \001(\r\0226\n\rshared_memory\030\006 \001(\0132\032.forthic.S"
+    "haredMemoryOfferH\000\210\001\001\0221\n\014shared_stack\030\007 "
+    "\001(\0132\026.forthic.SharedPayloadH\001\210\001\001B\020\n\016_sha"
+    "red_memoryB\017\n\r_shared_stack\"\347\001\n\023ExecuteW"
+    "ordResponse\022)\n\014result_stack\030\001 \003(\0132\023.fort"
+    "hic.StackValue\022&\n\005error\030\002 \001(\0132\022.forthic."
+    "ErrorInfoH\000\210\001\001\022!\n\031supports_compact_tempo"
+    "ral\030\003 \001(\010\0228\n\023shared_result_stack\030\004 \001(\0132\026"
+    ".forthic.SharedPayloadH\001\210\001\001B\010\n\006_errorB\026\n"
+    "\024_shared_result_stack\"\217\001\n\026ExecuteSequenc"
+    "eRequest\022\022\n\nword_names\030\001 \003(\t\022\"\n\005stack\030\002 "
+    "\003(\0132\023.forthic.StackValue\022 \n\030accepts_comp"
+    "act_temporal\030\003 \001(\010\022\033\n\023accepts_remote_ref"
+    "s\030\004 \001(\010\"\231\001\n\027ExecuteSequenceResponse\022)\n\014r"
+    "esult_stack\030\001 \003(\0132\023.forthic.StackValue\022&"
+    "\n\005error\030\002 \001(\0132\022.forthic.ErrorInfoH\000\210\001\001\022!"
+    "\n\031supports_compact_temporal\030\003 \001(\010B\010\n\006_er"
+    "ror\"\220\001\n\013ResultChunk\022\'\n\006header\030\001 \001(\0132\025.fo"
+    "rthic.ResultHeaderH\000\022*\n\005value\030\002 \001(\0132\031.fo"
+    "rthic.ResultValueChunkH\000\022#\n\005error\030\003 \001(\0132"
+    "\022.forthic.ErrorInfoH\000B\007\n\005chunk\"G\n\014Result"
+    "Header\022\024\n\014result_count\030\001 \001(\r\022!\n\031supports"
+    "_compact_temporal\030\002 \001(\010\"\222\001\n\020ResultValueC"
+    "hunk\022\023\n\013stack_index\030\001 \001(\r\022$\n\005value\030\002 \001(\013"
+    "2\023.forthic.StackValueH\000\022-\n\016array_element"
+    "s\030\003 \001(\0132\023.forthic.ArrayValueH\000\022\014\n\004last\030\004"
+    " \001(\010B\006\n\004part\"6\n\021SharedMemoryOffer\022\016\n\006reg"
+    "ion\030\001 \001(\t\022\021\n\tmin_bytes\030\002 \001(\004\"S\n\rSharedPa"
+    "yload\022\016\n\006region\030\001 \001(\t\022\016\n\006offset\030\002 \001(\004\022\016\n"
+    "\006length\030\003 \001(\004\022\022\n\ngeneration\030\004 \001(\004\"3\n\014Sta"
+    "ckPayload\022#\n\006values\030\001 \003(\0132\023.forthic.Stac"
+    "kValue\"\253\001\n\rStreamRequest\022\026\n\016correlation_"
+    "id\030\001 \001(\004\022\021\n\tword_name\030\002 \001(\t\022!\n\004push\030\003 \003("
+    "\0132\023.forthic.StackValue\022\031\n\014return_count\030\004"
+    " \001(\rH\000\210\001\001\022 \n\030accepts_compact_temporal\030\005 "
+    "\001(\010B\017\n\r_return_count\"\277\001\n\016StreamResponse\022"
+    "\026\n\016correlation_id\030\001 \001(\004\022)\n\014result_stack\030"
+    "\002 \003(\0132\023.forthic.StackValue\022&\n\005error\030\003 \001("
+    "\0132\022.forthic.ErrorInfoH\000\210\001\001\022\025\n\rsession_de"
+    "pth\030\004 \001(\r\022!\n\031supports_compact_temporal\030\005"
+    " \001(\010B\010\n\006_error\"\312\003\n\nStackValue\022\023\n\tint_val"
+    "ue\030\001 \001(\003H\000\022\026\n\014string_value\030\002 \001(\tH\000\022\024\n\nbo"
+    "ol_value\030\003 \001(\010H\000\022\025\n\013float_value\030\004 \001(\001H\000\022"
+    "(\n\nnull_value\030\005 \001(\0132\022.forthic.NullValueH"
+    "\000\022*\n\013array_value\030\006 \001(\0132\023.forthic.ArrayVa"
+    "lueH\000\022,\n\014record_value\030\007 \001(\0132\024.forthic.Re"
+    "cordValueH\000\022.\n\rinstant_value\030\010 \001(\0132\025.for"
+    "thic.InstantValueH\000\0223\n\020plain_date_value\030"
+    "\t \001(\0132\027.forthic.PlainDateValueH\000\022;\n\024zone"
+    "d_datetime_value\030\n \001(\0132\033.forthic.ZonedDa"
+    "teTimeValueH\000\0223\n\020remote_ref_value\030\013 \001(\0132"
+    "\027.forthic.RemoteRefValueH\000B\007\n\005value\"\013\n\tN"
+    "ullValue\"0\n\nArrayValue\022\"\n\005items\030\001 \003(\0132\023."
+    "forthic.StackValue\"\203\001\n\013RecordValue\0220\n\006fi"
+    "elds\030\001 \003(\0132 .forthic.RecordValue.FieldsE"
+    "ntry\032B\n\013FieldsEntry\022\013\n\003key\030\001 \001(\t\022\"\n\005valu"
+    "e\030\002 \001(\0132\023.forthic.StackValue:\0028\001\"I\n\014Inst"
+    "antValue\022\017\n\007iso8601\030\001 \001(\t\022\030\n\013epoch_nanos"
+    "\030\002 \001(\003H\000\210\001\001B\016\n\014_epoch_nanos\"Z\n\016PlainDate"
+    "Value\022\024\n\014iso8601_date\030\001 \001(\t\022\035\n\020days_sinc"
+    "e_epoch\030\002 \001(\005H\000\210\001\001B\023\n\021_days_since_epoch\""
+    "a\n\022ZonedDateTimeValue\022\017\n\007iso8601\030\001 \001(\t\022\020"
+    "\n\010timezone\030\002 \001(\t\022\030\n\013epoch_nanos\030\003 \001(\003H\000\210"
+    "\001\001B\016\n\014_epoch_nanos\"4\n\016RemoteRefValue\022\021\n\t"
+    "handle_id\030\001 \001(\t\022\017\n\007runtime\030\002 \001(\t\"F\n\017Fetc"
+    "hRefRequest\022\021\n\thandle_id\030\001 \001(\t\022 \n\030accept"
+    "s_compact_temporal\030\002 \001(\010\"h\n\020FetchRefResp"
+    "onse\022\"\n\005value\030\001 \001(\0132\023.forthic.StackValue"
+    "\022&\n\005error\030\002 \001(\0132\022.forthic.ErrorInfoH\000\210\001\001"
+    "B\010\n\006_error\"(\n\022ReleaseRefsRequest\022\022\n\nhand"
+    "le_ids\030\001 \003(\t\"-\n\023ReleaseRefsResponse\022\026\n\016r"
+    "eleased_count\030\001 \001(\005\"\220\002\n\tErrorInfo\022\017\n\007mes"
+    "sage\030\001 \001(\t\022\017\n\007runtime\030\002 \001(\t\022\023\n\013stack_tra"
+    "ce\030\003 \003(\t\022\022\n\nerror_type\030\004 \001(\t\022\032\n\rword_loc"
+    "ation\030\005 \001(\tH\000\210\001\001\022\030\n\013module_name\030\006 \001(\tH\001\210"
+    "\001\001\0220\n\007context\030\007 \003(\0132\037.forthic.ErrorInfo."
+    "ContextEntry\032.\n\014ContextEntry\022\013\n\003key\030\001 \001("
+    "\t\022\r\n\005value\030\002 \001(\t:\0028\001B\020\n\016_word_locationB\016"
+    "\n\014_module_name\"\024\n\022ListModulesRequest\"O\n\023"
+    "ListModulesResponse\022\'\n\007modules\030\001 \003(\0132\026.f"
+    "orthic.ModuleSummary\022\017\n\007version\030\002 \001(\t\"`\n"
+    "\rModuleSummary\022\014\n\004name\030\001 \001(\t\022\023\n\013descript"
+    "ion\030\002 \001(\t\022\022\n\nword_count\030\003 \001(\005\022\030\n\020runtime"
+    "_specific\030\004 \001(\010\"+\n\024GetModuleInfoRequest\022"
+    "\023\n\013module_name\030\001 \001(\t\"m\n\025GetModuleInfoRes"
+    "ponse\022\014\n\004name\030\001 \001(\t\022\023\n\013description\030\002 \001(\t"
+    "\022 \n\005words\030\003 \003(\0132\021.forthic.WordInfo\022\017\n\007ve"
+    "rsion\030\004 \001(\t\"Q\n\010WordInfo\022\014\n\004name\030\001 \001(\t\022\024\n"
+    "\014stack_effect\030\002 \001(\t\022\023\n\013description\030\003 \001(\t"
+    "\022\014\n\004pure\030\004 \001(\0102\346\004\n\016ForthicRuntime\022H\n\013Exe"
+    "cuteWord\022\033.forthic.ExecuteWordRequest\032\034."
+    "forthic.ExecuteWordResponse\022T\n\017ExecuteSe"
+    "quence\022\037.forthic.ExecuteSequenceRequest\032"
+    " .forthic.ExecuteSequenceResponse\022I\n\022Exe"
+    "cuteWordChunked\022\033.forthic.ExecuteWordReq"
+    "uest\032\024.forthic.ResultChunk0\001\022D\n\rExecuteS"
+    "tream\022\026.forthic.StreamRequest\032\027.forthic."
+    "StreamResponse(\0010\001\022H\n\013ListModules\022\033.fort"
+    "hic.ListModulesRequest\032\034.forthic.ListMod"
+    "ulesResponse\022N\n\rGetModuleInfo\022\035.forthic."
+    "GetModuleInfoRequest\032\036.forthic.GetModule"
+    "InfoResponse\022\?\n\010FetchRef\022\030.forthic.Fetch"
+    "RefRequest\032\031.forthic.FetchRefResponse\022H\n"
+    "\013ReleaseRefs\022\033.forthic.ReleaseRefsReques"
+    "t\032\034.forthic.ReleaseRefsResponseb\006proto3"
 };
 static ::absl::once_flag descriptor_table_protos_2fforthic_5fruntime_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_protos_2fforthic_5fruntime_2eproto = {
     false,
     false,
-    2177,
+    4399,
     descriptor_table_protodef_protos_2fforthic_5fruntime_2eproto,
     "protos/forthic_runtime.proto",
     &descriptor_table_protos_2fforthic_5fruntime_2eproto_once,
     nullptr,
     0,
-    20,
+    33,
     schemas,
     file_default_instances,
     TableStruct_protos_2fforthic_5fruntime_2eproto::offsets,
@@ -864,6 +1461,20 @@ ExecuteWordRequest::ExecuteWordRequest(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.shared_memory_ = (CheckHasBit(cached_has_bits, 0x00000004U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_memory_)
+                : nullptr;
+  _impl_.shared_stack_ = (CheckHasBit(cached_has_bits, 0x00000008U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_stack_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, accepts_compact_temporal_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, accepts_compact_temporal_),
+           offsetof(Impl_, max_chunk_bytes_) -
+               offsetof(Impl_, accepts_compact_temporal_) +
+               sizeof(Impl_::max_chunk_bytes_));
 
   // @@protoc_insertion_point(copy_constructor:forthic.ExecuteWordRequest)
 }
@@ -876,6 +1487,12 @@ PROTOBUF_NDEBUG_INLINE ExecuteWordRequest::Impl_::Impl_(
 
 inline void ExecuteWordRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, shared_memory_),
+           0,
+           offsetof(Impl_, max_chunk_bytes_) -
+               offsetof(Impl_, shared_memory_) +
+               sizeof(Impl_::max_chunk_bytes_));
 }
 ExecuteWordRequest::~ExecuteWordRequest() {
   // @@protoc_insertion_point(destructor:forthic.ExecuteWordRequest)
@@ -889,6 +1506,8 @@ inline void ExecuteWordRequest::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.word_name_.Destroy();
+  delete this_._impl_.shared_memory_;
+  delete this_._impl_.shared_stack_;
   this_._impl_.~Impl_();
 }
 
@@ -947,17 +1566,17 @@ ExecuteWordRequest::GetClassData() const {
   return ExecuteWordRequest_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 44, 2>
+const ::_pbi::TcParseTable<3, 7, 3, 44, 2>
 ExecuteWordRequest::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    7, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967168,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
+    7,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     ExecuteWordRequest_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -966,14 +1585,35 @@ ExecuteWordRequest::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::ExecuteWordRequest>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // repeated .forthic.StackValue stack = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 0, 0,
-      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.stack_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // string word_name = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 1, 0,
       PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.word_name_)}},
+    // repeated .forthic.StackValue stack = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.stack_)}},
+    // bool accepts_compact_temporal = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteWordRequest, _impl_.accepts_compact_temporal_), 4>(),
+     {24, 4, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.accepts_compact_temporal_)}},
+    // bool accepts_remote_refs = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteWordRequest, _impl_.accepts_remote_refs_), 5>(),
+     {32, 5, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.accepts_remote_refs_)}},
+    // uint32 max_chunk_bytes = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ExecuteWordRequest, _impl_.max_chunk_bytes_), 6>(),
+     {40, 6, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.max_chunk_bytes_)}},
+    // optional .forthic.SharedMemoryOffer shared_memory = 6;
+    {::_pbi::TcParser::FastMtS1,
+     {50, 2, 1,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.shared_memory_)}},
+    // optional .forthic.SharedPayload shared_stack = 7;
+    {::_pbi::TcParser::FastMtS1,
+     {58, 3, 2,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.shared_stack_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -981,9 +1621,21 @@ ExecuteWordRequest::_table_ = {
     {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.word_name_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
     // repeated .forthic.StackValue stack = 2;
     {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.stack_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool accepts_compact_temporal = 3;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.accepts_compact_temporal_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // bool accepts_remote_refs = 4;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.accepts_remote_refs_), _Internal::kHasBitsOffset + 5, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // uint32 max_chunk_bytes = 5;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.max_chunk_bytes_), _Internal::kHasBitsOffset + 6, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // optional .forthic.SharedMemoryOffer shared_memory = 6;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.shared_memory_), _Internal::kHasBitsOffset + 2, 1, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .forthic.SharedPayload shared_stack = 7;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.shared_stack_), _Internal::kHasBitsOffset + 3, 2, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::SharedMemoryOffer>()},
+      {::_pbi::TcParser::GetTable<::forthic::SharedPayload>()},
   }},
   {{
     "\32\11\0\0\0\0\0\0"
@@ -999,13 +1651,26 @@ PROTOBUF_NOINLINE void ExecuteWordRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _impl_.stack_.Clear();
     }
     if (CheckHasBit(cached_has_bits, 0x00000002U)) {
       _impl_.word_name_.ClearNonDefaultToEmpty();
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      ABSL_DCHECK(_impl_.shared_memory_ != nullptr);
+      _impl_.shared_memory_->Clear();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      ABSL_DCHECK(_impl_.shared_stack_ != nullptr);
+      _impl_.shared_stack_->Clear();
+    }
+  }
+  if (BatchCheckHasBit(cached_has_bits, 0x00000070U)) {
+    ::memset(&_impl_.accepts_compact_temporal_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.max_chunk_bytes_) -
+        reinterpret_cast<char*>(&_impl_.accepts_compact_temporal_)) + sizeof(_impl_.max_chunk_bytes_));
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
@@ -1053,6 +1718,47 @@ PROTOBUF_NOINLINE void ExecuteWordRequest::Clear() {
     }
   }
 
+  // bool accepts_compact_temporal = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+    if (this_._internal_accepts_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          3, this_._internal_accepts_compact_temporal(), target);
+    }
+  }
+
+  // bool accepts_remote_refs = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000020U)) {
+    if (this_._internal_accepts_remote_refs() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_accepts_remote_refs(), target);
+    }
+  }
+
+  // uint32 max_chunk_bytes = 5;
+  if (CheckHasBit(cached_has_bits, 0x00000040U)) {
+    if (this_._internal_max_chunk_bytes() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          5, this_._internal_max_chunk_bytes(), target);
+    }
+  }
+
+  // optional .forthic.SharedMemoryOffer shared_memory = 6;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        6, *this_._impl_.shared_memory_, this_._impl_.shared_memory_->GetCachedSize(), target,
+        stream);
+  }
+
+  // optional .forthic.SharedPayload shared_stack = 7;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        7, *this_._impl_.shared_stack_, this_._impl_.shared_stack_->GetCachedSize(), target,
+        stream);
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1078,7 +1784,7 @@ PROTOBUF_NOINLINE void ExecuteWordRequest::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000007fU)) {
     // repeated .forthic.StackValue stack = 2;
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size += 1UL * this_._internal_stack_size();
@@ -1093,6 +1799,35 @@ PROTOBUF_NOINLINE void ExecuteWordRequest::Clear() {
                                         this_._internal_word_name());
       }
     }
+    // optional .forthic.SharedMemoryOffer shared_memory = 6;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.shared_memory_);
+    }
+    // optional .forthic.SharedPayload shared_stack = 7;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.shared_stack_);
+    }
+    // bool accepts_compact_temporal = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (this_._internal_accepts_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
+    // bool accepts_remote_refs = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000020U)) {
+      if (this_._internal_accepts_remote_refs() != 0) {
+        total_size += 2;
+      }
+    }
+    // uint32 max_chunk_bytes = 5;
+    if (CheckHasBit(cached_has_bits, 0x00000040U)) {
+      if (this_._internal_max_chunk_bytes() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_max_chunk_bytes());
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -1113,7 +1848,7 @@ void ExecuteWordRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000007fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _this->_internal_mutable_stack()->InternalMergeFromWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), arena,
@@ -1128,6 +1863,37 @@ void ExecuteWordRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
         }
       }
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      ABSL_DCHECK(from._impl_.shared_memory_ != nullptr);
+      if (_this->_impl_.shared_memory_ == nullptr) {
+        _this->_impl_.shared_memory_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_memory_);
+      } else {
+        _this->_impl_.shared_memory_->MergeFrom(*from._impl_.shared_memory_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      ABSL_DCHECK(from._impl_.shared_stack_ != nullptr);
+      if (_this->_impl_.shared_stack_ == nullptr) {
+        _this->_impl_.shared_stack_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_stack_);
+      } else {
+        _this->_impl_.shared_stack_->MergeFrom(*from._impl_.shared_stack_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (from._internal_accepts_compact_temporal() != 0) {
+        _this->_impl_.accepts_compact_temporal_ = from._impl_.accepts_compact_temporal_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000020U)) {
+      if (from._internal_accepts_remote_refs() != 0) {
+        _this->_impl_.accepts_remote_refs_ = from._impl_.accepts_remote_refs_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000040U)) {
+      if (from._internal_max_chunk_bytes() != 0) {
+        _this->_impl_.max_chunk_bytes_ = from._impl_.max_chunk_bytes_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -1150,6 +1916,12 @@ void ExecuteWordRequest::InternalSwap(ExecuteWordRequest* PROTOBUF_RESTRICT PROT
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.stack_.InternalSwap(&other->_impl_.stack_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.word_name_, &other->_impl_.word_name_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.max_chunk_bytes_)
+      + sizeof(ExecuteWordRequest::_impl_.max_chunk_bytes_)
+      - PROTOBUF_FIELD_OFFSET(ExecuteWordRequest, _impl_.shared_memory_)>(
+          reinterpret_cast<char*>(&_impl_.shared_memory_),
+          reinterpret_cast<char*>(&other->_impl_.shared_memory_));
 }
 
 ::google::protobuf::Metadata ExecuteWordRequest::GetMetadata() const {
@@ -1199,6 +1971,10 @@ ExecuteWordResponse::ExecuteWordResponse(
   _impl_.error_ = (CheckHasBit(cached_has_bits, 0x00000002U))
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_)
                 : nullptr;
+  _impl_.shared_result_stack_ = (CheckHasBit(cached_has_bits, 0x00000004U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_result_stack_)
+                : nullptr;
+  _impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
 
   // @@protoc_insertion_point(copy_constructor:forthic.ExecuteWordResponse)
 }
@@ -1210,7 +1986,12 @@ PROTOBUF_NDEBUG_INLINE ExecuteWordResponse::Impl_::Impl_(
 
 inline void ExecuteWordResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.error_ = {};
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, supports_compact_temporal_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::supports_compact_temporal_));
 }
 ExecuteWordResponse::~ExecuteWordResponse() {
   // @@protoc_insertion_point(destructor:forthic.ExecuteWordResponse)
@@ -1224,6 +2005,7 @@ inline void ExecuteWordResponse::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   delete this_._impl_.error_;
+  delete this_._impl_.shared_result_stack_;
   this_._impl_.~Impl_();
 }
 
@@ -1282,17 +2064,17 @@ ExecuteWordResponse::GetClassData() const {
   return ExecuteWordResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<2, 4, 3, 0, 2>
 ExecuteWordResponse::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    4,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     ExecuteWordResponse_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -1301,14 +2083,22 @@ ExecuteWordResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::ExecuteWordResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // optional .forthic.ErrorInfo error = 2;
+    // optional .forthic.SharedPayload shared_result_stack = 4;
     {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1,
-      PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.error_)}},
+     {34, 2, 2,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.shared_result_stack_)}},
     // repeated .forthic.StackValue result_stack = 1;
     {::_pbi::TcParser::FastMtR1,
      {10, 0, 0,
       PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.result_stack_)}},
+    // optional .forthic.ErrorInfo error = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.error_)}},
+    // bool supports_compact_temporal = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteWordResponse, _impl_.supports_compact_temporal_), 3>(),
+     {24, 3, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.supports_compact_temporal_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1316,10 +2106,15 @@ ExecuteWordResponse::_table_ = {
     {PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.result_stack_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
     // optional .forthic.ErrorInfo error = 2;
     {PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.error_), _Internal::kHasBitsOffset + 1, 1, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool supports_compact_temporal = 3;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.supports_compact_temporal_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // optional .forthic.SharedPayload shared_result_stack = 4;
+    {PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.shared_result_stack_), _Internal::kHasBitsOffset + 2, 2, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
       {::_pbi::TcParser::GetTable<::forthic::ErrorInfo>()},
+      {::_pbi::TcParser::GetTable<::forthic::SharedPayload>()},
   }},
   {{
   }},
@@ -1332,7 +2127,7 @@ PROTOBUF_NOINLINE void ExecuteWordResponse::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _impl_.result_stack_.Clear();
     }
@@ -1340,7 +2135,12 @@ PROTOBUF_NOINLINE void ExecuteWordResponse::Clear() {
       ABSL_DCHECK(_impl_.error_ != nullptr);
       _impl_.error_->Clear();
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      ABSL_DCHECK(_impl_.shared_result_stack_ != nullptr);
+      _impl_.shared_result_stack_->Clear();
+    }
   }
+  _impl_.supports_compact_temporal_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -1384,6 +2184,22 @@ PROTOBUF_NOINLINE void ExecuteWordResponse::Clear() {
         stream);
   }
 
+  // bool supports_compact_temporal = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (this_._internal_supports_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          3, this_._internal_supports_compact_temporal(), target);
+    }
+  }
+
+  // optional .forthic.SharedPayload shared_result_stack = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        4, *this_._impl_.shared_result_stack_, this_._impl_.shared_result_stack_->GetCachedSize(), target,
+        stream);
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1409,7 +2225,7 @@ PROTOBUF_NOINLINE void ExecuteWordResponse::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     // repeated .forthic.StackValue result_stack = 1;
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size += 1UL * this_._internal_result_stack_size();
@@ -1422,6 +2238,17 @@ PROTOBUF_NOINLINE void ExecuteWordResponse::Clear() {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.error_);
     }
+    // optional .forthic.SharedPayload shared_result_stack = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.shared_result_stack_);
+    }
+    // bool supports_compact_temporal = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (this_._internal_supports_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -1442,7 +2269,7 @@ void ExecuteWordResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _this->_internal_mutable_result_stack()->InternalMergeFromWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), arena,
@@ -1456,6 +2283,19 @@ void ExecuteWordResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
         _this->_impl_.error_->MergeFrom(*from._impl_.error_);
       }
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      ABSL_DCHECK(from._impl_.shared_result_stack_ != nullptr);
+      if (_this->_impl_.shared_result_stack_ == nullptr) {
+        _this->_impl_.shared_result_stack_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.shared_result_stack_);
+      } else {
+        _this->_impl_.shared_result_stack_->MergeFrom(*from._impl_.shared_result_stack_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (from._internal_supports_compact_temporal() != 0) {
+        _this->_impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -1475,7 +2315,12 @@ void ExecuteWordResponse::InternalSwap(ExecuteWordResponse* PROTOBUF_RESTRICT PR
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.result_stack_.InternalSwap(&other->_impl_.result_stack_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.supports_compact_temporal_)
+      + sizeof(ExecuteWordResponse::_impl_.supports_compact_temporal_)
+      - PROTOBUF_FIELD_OFFSET(ExecuteWordResponse, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
 }
 
 ::google::protobuf::Metadata ExecuteWordResponse::GetMetadata() const {
@@ -1522,6 +2367,13 @@ ExecuteSequenceRequest::ExecuteSequenceRequest(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, accepts_compact_temporal_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, accepts_compact_temporal_),
+           offsetof(Impl_, accepts_remote_refs_) -
+               offsetof(Impl_, accepts_compact_temporal_) +
+               sizeof(Impl_::accepts_remote_refs_));
 
   // @@protoc_insertion_point(copy_constructor:forthic.ExecuteSequenceRequest)
 }
@@ -1534,6 +2386,12 @@ PROTOBUF_NDEBUG_INLINE ExecuteSequenceRequest::Impl_::Impl_(
 
 inline void ExecuteSequenceRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, accepts_compact_temporal_),
+           0,
+           offsetof(Impl_, accepts_remote_refs_) -
+               offsetof(Impl_, accepts_compact_temporal_) +
+               sizeof(Impl_::accepts_remote_refs_));
 }
 ExecuteSequenceRequest::~ExecuteSequenceRequest() {
   // @@protoc_insertion_point(destructor:forthic.ExecuteSequenceRequest)
@@ -1608,16 +2466,16 @@ ExecuteSequenceRequest::GetClassData() const {
   return ExecuteSequenceRequest_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 49, 2>
+const ::_pbi::TcParseTable<2, 4, 1, 49, 2>
 ExecuteSequenceRequest::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    4,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     ExecuteSequenceRequest_class_data_.base(),
@@ -1627,14 +2485,22 @@ ExecuteSequenceRequest::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::ExecuteSequenceRequest>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // repeated .forthic.StackValue stack = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 1, 0,
-      PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.stack_)}},
+    // bool accepts_remote_refs = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteSequenceRequest, _impl_.accepts_remote_refs_), 3>(),
+     {32, 3, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_remote_refs_)}},
     // repeated string word_names = 1;
     {::_pbi::TcParser::FastUR1,
      {10, 0, 0,
       PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.word_names_)}},
+    // repeated .forthic.StackValue stack = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.stack_)}},
+    // bool accepts_compact_temporal = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteSequenceRequest, _impl_.accepts_compact_temporal_), 2>(),
+     {24, 2, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_compact_temporal_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1642,6 +2508,10 @@ ExecuteSequenceRequest::_table_ = {
     {PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.word_names_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
     // repeated .forthic.StackValue stack = 2;
     {PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.stack_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool accepts_compact_temporal = 3;
+    {PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_compact_temporal_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // bool accepts_remote_refs = 4;
+    {PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_remote_refs_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
@@ -1668,6 +2538,9 @@ PROTOBUF_NOINLINE void ExecuteSequenceRequest::Clear() {
       _impl_.stack_.Clear();
     }
   }
+  ::memset(&_impl_.accepts_compact_temporal_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.accepts_remote_refs_) -
+      reinterpret_cast<char*>(&_impl_.accepts_compact_temporal_)) + sizeof(_impl_.accepts_remote_refs_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -1714,6 +2587,24 @@ PROTOBUF_NOINLINE void ExecuteSequenceRequest::Clear() {
     }
   }
 
+  // bool accepts_compact_temporal = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_accepts_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          3, this_._internal_accepts_compact_temporal(), target);
+    }
+  }
+
+  // bool accepts_remote_refs = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (this_._internal_accepts_remote_refs() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_accepts_remote_refs(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1739,7 +2630,7 @@ PROTOBUF_NOINLINE void ExecuteSequenceRequest::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     // repeated string word_names = 1;
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size +=
@@ -1756,7 +2647,19 @@ PROTOBUF_NOINLINE void ExecuteSequenceRequest::Clear() {
         total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
       }
     }
-  }
+    // bool accepts_compact_temporal = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_accepts_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
+    // bool accepts_remote_refs = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (this_._internal_accepts_remote_refs() != 0) {
+        total_size += 2;
+      }
+    }
+  }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
 }
@@ -1776,7 +2679,7 @@ void ExecuteSequenceRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _this->_internal_mutable_word_names()->InternalMergeFromWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), arena,
@@ -1787,6 +2690,16 @@ void ExecuteSequenceRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
           ::google::protobuf::MessageLite::internal_visibility(), arena,
           from._internal_stack());
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_accepts_compact_temporal() != 0) {
+        _this->_impl_.accepts_compact_temporal_ = from._impl_.accepts_compact_temporal_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (from._internal_accepts_remote_refs() != 0) {
+        _this->_impl_.accepts_remote_refs_ = from._impl_.accepts_remote_refs_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -1807,6 +2720,12 @@ void ExecuteSequenceRequest::InternalSwap(ExecuteSequenceRequest* PROTOBUF_RESTR
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.word_names_.InternalSwap(&other->_impl_.word_names_);
   _impl_.stack_.InternalSwap(&other->_impl_.stack_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_remote_refs_)
+      + sizeof(ExecuteSequenceRequest::_impl_.accepts_remote_refs_)
+      - PROTOBUF_FIELD_OFFSET(ExecuteSequenceRequest, _impl_.accepts_compact_temporal_)>(
+          reinterpret_cast<char*>(&_impl_.accepts_compact_temporal_),
+          reinterpret_cast<char*>(&other->_impl_.accepts_compact_temporal_));
 }
 
 ::google::protobuf::Metadata ExecuteSequenceRequest::GetMetadata() const {
@@ -1856,6 +2775,7 @@ ExecuteSequenceResponse::ExecuteSequenceResponse(
   _impl_.error_ = (CheckHasBit(cached_has_bits, 0x00000002U))
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_)
                 : nullptr;
+  _impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
 
   // @@protoc_insertion_point(copy_constructor:forthic.ExecuteSequenceResponse)
 }
@@ -1867,7 +2787,12 @@ PROTOBUF_NDEBUG_INLINE ExecuteSequenceResponse::Impl_::Impl_(
 
 inline void ExecuteSequenceResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.error_ = {};
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, supports_compact_temporal_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::supports_compact_temporal_));
 }
 ExecuteSequenceResponse::~ExecuteSequenceResponse() {
   // @@protoc_insertion_point(destructor:forthic.ExecuteSequenceResponse)
@@ -1939,16 +2864,16 @@ ExecuteSequenceResponse::GetClassData() const {
   return ExecuteSequenceResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<2, 3, 2, 0, 2>
 ExecuteSequenceResponse::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    3,  // num_field_entries
     2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     ExecuteSequenceResponse_class_data_.base(),
@@ -1958,14 +2883,19 @@ ExecuteSequenceResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::ExecuteSequenceResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // optional .forthic.ErrorInfo error = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1,
-      PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.error_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // repeated .forthic.StackValue result_stack = 1;
     {::_pbi::TcParser::FastMtR1,
      {10, 0, 0,
       PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.result_stack_)}},
+    // optional .forthic.ErrorInfo error = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1,
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.error_)}},
+    // bool supports_compact_temporal = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ExecuteSequenceResponse, _impl_.supports_compact_temporal_), 2>(),
+     {24, 2, 0,
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.supports_compact_temporal_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1973,6 +2903,8 @@ ExecuteSequenceResponse::_table_ = {
     {PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.result_stack_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
     // optional .forthic.ErrorInfo error = 2;
     {PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.error_), _Internal::kHasBitsOffset + 1, 1, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool supports_compact_temporal = 3;
+    {PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.supports_compact_temporal_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
@@ -1998,6 +2930,7 @@ PROTOBUF_NOINLINE void ExecuteSequenceResponse::Clear() {
       _impl_.error_->Clear();
     }
   }
+  _impl_.supports_compact_temporal_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -2041,6 +2974,15 @@ PROTOBUF_NOINLINE void ExecuteSequenceResponse::Clear() {
         stream);
   }
 
+  // bool supports_compact_temporal = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_supports_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          3, this_._internal_supports_compact_temporal(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2066,7 +3008,7 @@ PROTOBUF_NOINLINE void ExecuteSequenceResponse::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
     // repeated .forthic.StackValue result_stack = 1;
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size += 1UL * this_._internal_result_stack_size();
@@ -2079,6 +3021,12 @@ PROTOBUF_NOINLINE void ExecuteSequenceResponse::Clear() {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.error_);
     }
+    // bool supports_compact_temporal = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_supports_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -2099,7 +3047,7 @@ void ExecuteSequenceResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _this->_internal_mutable_result_stack()->InternalMergeFromWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), arena,
@@ -2113,6 +3061,11 @@ void ExecuteSequenceResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
         _this->_impl_.error_->MergeFrom(*from._impl_.error_);
       }
     }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_supports_compact_temporal() != 0) {
+        _this->_impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -2132,7 +3085,12 @@ void ExecuteSequenceResponse::InternalSwap(ExecuteSequenceResponse* PROTOBUF_RES
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.result_stack_.InternalSwap(&other->_impl_.result_stack_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.supports_compact_temporal_)
+      + sizeof(ExecuteSequenceResponse::_impl_.supports_compact_temporal_)
+      - PROTOBUF_FIELD_OFFSET(ExecuteSequenceResponse, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
 }
 
 ::google::protobuf::Metadata ExecuteSequenceResponse::GetMetadata() const {
@@ -2140,449 +3098,286 @@ void ExecuteSequenceResponse::InternalSwap(ExecuteSequenceResponse* PROTOBUF_RES
 }
 // ===================================================================
 
-class StackValue::_Internal {
+class ResultChunk::_Internal {
  public:
   static constexpr ::int32_t kOneofCaseOffset =
-      PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_._oneof_case_);
+      PROTOBUF_FIELD_OFFSET(::forthic::ResultChunk, _impl_._oneof_case_);
 };
 
-void StackValue::set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE null_value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (null_value) {
-    ::google::protobuf::Arena* submessage_arena = null_value->GetArena();
-    if (message_arena != submessage_arena) {
-      null_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, null_value, submessage_arena);
-    }
-    set_has_null_value();
-    _impl_.value_.null_value_ = null_value;
-  }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.null_value)
-}
-void StackValue::set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE array_value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (array_value) {
-    ::google::protobuf::Arena* submessage_arena = array_value->GetArena();
-    if (message_arena != submessage_arena) {
-      array_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, array_value, submessage_arena);
-    }
-    set_has_array_value();
-    _impl_.value_.array_value_ = array_value;
-  }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.array_value)
-}
-void StackValue::set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE record_value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (record_value) {
-    ::google::protobuf::Arena* submessage_arena = record_value->GetArena();
-    if (message_arena != submessage_arena) {
-      record_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, record_value, submessage_arena);
-    }
-    set_has_record_value();
-    _impl_.value_.record_value_ = record_value;
-  }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.record_value)
-}
-void StackValue::set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE instant_value) {
+void ResultChunk::set_allocated_header(::forthic::ResultHeader* PROTOBUF_NULLABLE header) {
   ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (instant_value) {
-    ::google::protobuf::Arena* submessage_arena = instant_value->GetArena();
+  clear_chunk();
+  if (header) {
+    ::google::protobuf::Arena* submessage_arena = header->GetArena();
     if (message_arena != submessage_arena) {
-      instant_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, instant_value, submessage_arena);
+      header = ::google::protobuf::internal::GetOwnedMessage(message_arena, header, submessage_arena);
     }
-    set_has_instant_value();
-    _impl_.value_.instant_value_ = instant_value;
+    set_has_header();
+    _impl_.chunk_.header_ = header;
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.instant_value)
+  // @@protoc_insertion_point(field_set_allocated:forthic.ResultChunk.header)
 }
-void StackValue::set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE plain_date_value) {
+void ResultChunk::set_allocated_value(::forthic::ResultValueChunk* PROTOBUF_NULLABLE value) {
   ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (plain_date_value) {
-    ::google::protobuf::Arena* submessage_arena = plain_date_value->GetArena();
+  clear_chunk();
+  if (value) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
     if (message_arena != submessage_arena) {
-      plain_date_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, plain_date_value, submessage_arena);
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
     }
-    set_has_plain_date_value();
-    _impl_.value_.plain_date_value_ = plain_date_value;
+    set_has_value();
+    _impl_.chunk_.value_ = value;
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.plain_date_value)
+  // @@protoc_insertion_point(field_set_allocated:forthic.ResultChunk.value)
 }
-void StackValue::set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE zoned_datetime_value) {
+void ResultChunk::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE error) {
   ::google::protobuf::Arena* message_arena = GetArena();
-  clear_value();
-  if (zoned_datetime_value) {
-    ::google::protobuf::Arena* submessage_arena = zoned_datetime_value->GetArena();
+  clear_chunk();
+  if (error) {
+    ::google::protobuf::Arena* submessage_arena = error->GetArena();
     if (message_arena != submessage_arena) {
-      zoned_datetime_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, zoned_datetime_value, submessage_arena);
+      error = ::google::protobuf::internal::GetOwnedMessage(message_arena, error, submessage_arena);
     }
-    set_has_zoned_datetime_value();
-    _impl_.value_.zoned_datetime_value_ = zoned_datetime_value;
+    set_has_error();
+    _impl_.chunk_.error_ = error;
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.zoned_datetime_value)
+  // @@protoc_insertion_point(field_set_allocated:forthic.ResultChunk.error)
 }
-StackValue::StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+ResultChunk::ResultChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, StackValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultChunk_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.StackValue)
+  // @@protoc_insertion_point(arena_constructor:forthic.ResultChunk)
 }
-PROTOBUF_NDEBUG_INLINE StackValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ResultChunk::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::StackValue& from_msg)
-      : value_{},
+    [[maybe_unused]] const ::forthic::ResultChunk& from_msg)
+      : chunk_{},
         _cached_size_{0},
         _oneof_case_{from._oneof_case_[0]} {}
 
-StackValue::StackValue(
+ResultChunk::ResultChunk(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const StackValue& from)
+    const ResultChunk& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, StackValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultChunk_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  StackValue* const _this = this;
+  ResultChunk* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  switch (value_case()) {
-    case VALUE_NOT_SET:
+  switch (chunk_case()) {
+    case CHUNK_NOT_SET:
       break;
-      case kIntValue:
-        _impl_.value_.int_value_ = from._impl_.value_.int_value_;
-        break;
-      case kStringValue:
-        new (&_impl_.value_.string_value_) decltype(_impl_.value_.string_value_){arena, from._impl_.value_.string_value_};
-        break;
-      case kBoolValue:
-        _impl_.value_.bool_value_ = from._impl_.value_.bool_value_;
-        break;
-      case kFloatValue:
-        _impl_.value_.float_value_ = from._impl_.value_.float_value_;
-        break;
-      case kNullValue:
-        _impl_.value_.null_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.null_value_);
-        break;
-      case kArrayValue:
-        _impl_.value_.array_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.array_value_);
-        break;
-      case kRecordValue:
-        _impl_.value_.record_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.record_value_);
+      case kHeader:
+        _impl_.chunk_.header_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.header_);
         break;
-      case kInstantValue:
-        _impl_.value_.instant_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.instant_value_);
-        break;
-      case kPlainDateValue:
-        _impl_.value_.plain_date_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.plain_date_value_);
+      case kValue:
+        _impl_.chunk_.value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.value_);
         break;
-      case kZonedDatetimeValue:
-        _impl_.value_.zoned_datetime_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.zoned_datetime_value_);
+      case kError:
+        _impl_.chunk_.error_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.error_);
         break;
   }
 
-  // @@protoc_insertion_point(copy_constructor:forthic.StackValue)
+  // @@protoc_insertion_point(copy_constructor:forthic.ResultChunk)
 }
-PROTOBUF_NDEBUG_INLINE StackValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ResultChunk::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : value_{},
+      : chunk_{},
         _cached_size_{0},
         _oneof_case_{} {}
 
-inline void StackValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void ResultChunk::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
 }
-StackValue::~StackValue() {
-  // @@protoc_insertion_point(destructor:forthic.StackValue)
+ResultChunk::~ResultChunk() {
+  // @@protoc_insertion_point(destructor:forthic.ResultChunk)
   SharedDtor(*this);
 }
-inline void StackValue::SharedDtor(MessageLite& self) {
-  StackValue& this_ = static_cast<StackValue&>(self);
+inline void ResultChunk::SharedDtor(MessageLite& self) {
+  ResultChunk& this_ = static_cast<ResultChunk&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
-  if (this_.has_value()) {
-    this_.clear_value();
+  if (this_.has_chunk()) {
+    this_.clear_chunk();
   }
   this_._impl_.~Impl_();
 }
 
-void StackValue::clear_value() {
-// @@protoc_insertion_point(one_of_clear_start:forthic.StackValue)
+void ResultChunk::clear_chunk() {
+// @@protoc_insertion_point(one_of_clear_start:forthic.ResultChunk)
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  switch (value_case()) {
-    case kIntValue: {
-      // No need to clear
-      break;
-    }
-    case kStringValue: {
-      _impl_.value_.string_value_.Destroy();
-      break;
-    }
-    case kBoolValue: {
-      // No need to clear
-      break;
-    }
-    case kFloatValue: {
-      // No need to clear
-      break;
-    }
-    case kNullValue: {
-      if (GetArena() == nullptr) {
-        delete _impl_.value_.null_value_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.null_value_);
-      }
-      break;
-    }
-    case kArrayValue: {
-      if (GetArena() == nullptr) {
-        delete _impl_.value_.array_value_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.array_value_);
-      }
-      break;
-    }
-    case kRecordValue: {
-      if (GetArena() == nullptr) {
-        delete _impl_.value_.record_value_;
-      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.record_value_);
-      }
-      break;
-    }
-    case kInstantValue: {
+  switch (chunk_case()) {
+    case kHeader: {
       if (GetArena() == nullptr) {
-        delete _impl_.value_.instant_value_;
+        delete _impl_.chunk_.header_;
       } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.instant_value_);
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.header_);
       }
       break;
     }
-    case kPlainDateValue: {
+    case kValue: {
       if (GetArena() == nullptr) {
-        delete _impl_.value_.plain_date_value_;
+        delete _impl_.chunk_.value_;
       } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.plain_date_value_);
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.value_);
       }
       break;
     }
-    case kZonedDatetimeValue: {
+    case kError: {
       if (GetArena() == nullptr) {
-        delete _impl_.value_.zoned_datetime_value_;
+        delete _impl_.chunk_.error_;
       } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.zoned_datetime_value_);
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.error_);
       }
       break;
     }
-    case VALUE_NOT_SET: {
+    case CHUNK_NOT_SET: {
       break;
     }
   }
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = CHUNK_NOT_SET;
 }
 
 
-inline void* PROTOBUF_NONNULL StackValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL ResultChunk::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) StackValue(arena);
+  return ::new (mem) ResultChunk(arena);
 }
-constexpr auto StackValue::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(StackValue),
-                                            alignof(StackValue));
+constexpr auto ResultChunk::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ResultChunk),
+                                            alignof(ResultChunk));
 }
-constexpr auto StackValue::InternalGenerateClassData_() {
+constexpr auto ResultChunk::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_StackValue_default_instance_._instance,
+          &_ResultChunk_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &StackValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<StackValue>(),
+          &ResultChunk::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ResultChunk>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &StackValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<StackValue>(), &StackValue::ByteSizeLong,
-              &StackValue::_InternalSerialize,
+          &ResultChunk::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ResultChunk>(), &ResultChunk::ByteSizeLong,
+              &ResultChunk::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(StackValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(ResultChunk, _impl_._cached_size_),
           false,
       },
-      &StackValue::kDescriptorMethods,
+      &ResultChunk::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull StackValue_class_data_ =
-        StackValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull ResultChunk_class_data_ =
+        ResultChunk::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-StackValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&StackValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(StackValue_class_data_.tc_table);
-  return StackValue_class_data_.base();
+ResultChunk::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ResultChunk_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ResultChunk_class_data_.tc_table);
+  return ResultChunk_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 10, 6, 47, 2>
-StackValue::_table_ = {
+const ::_pbi::TcParseTable<0, 3, 3, 0, 2>
+ResultChunk::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    10, 0,  // max_field_number, fast_idx_mask
+    3, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294966272,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    10,  // num_field_entries
-    6,  // num_aux_entries
+    3,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    StackValue_class_data_.base(),
+    ResultChunk_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::StackValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::ResultChunk>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
     {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
-    // int64 int_value = 1;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.int_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kInt64)},
-    // string string_value = 2;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.string_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool bool_value = 3;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.bool_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kBool)},
-    // double float_value = 4;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.float_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kDouble)},
-    // .forthic.NullValue null_value = 5;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.null_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .forthic.ArrayValue array_value = 6;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.array_value_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .forthic.RecordValue record_value = 7;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.record_value_), _Internal::kOneofCaseOffset + 0, 2, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .forthic.InstantValue instant_value = 8;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.instant_value_), _Internal::kOneofCaseOffset + 0, 3, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .forthic.PlainDateValue plain_date_value = 9;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.plain_date_value_), _Internal::kOneofCaseOffset + 0, 4, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
-    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.zoned_datetime_value_), _Internal::kOneofCaseOffset + 0, 5, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ResultHeader header = 1;
+    {PROTOBUF_FIELD_OFFSET(ResultChunk, _impl_.chunk_.header_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ResultValueChunk value = 2;
+    {PROTOBUF_FIELD_OFFSET(ResultChunk, _impl_.chunk_.value_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ErrorInfo error = 3;
+    {PROTOBUF_FIELD_OFFSET(ResultChunk, _impl_.chunk_.error_), _Internal::kOneofCaseOffset + 0, 2, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
-      {::_pbi::TcParser::GetTable<::forthic::NullValue>()},
-      {::_pbi::TcParser::GetTable<::forthic::ArrayValue>()},
-      {::_pbi::TcParser::GetTable<::forthic::RecordValue>()},
-      {::_pbi::TcParser::GetTable<::forthic::InstantValue>()},
-      {::_pbi::TcParser::GetTable<::forthic::PlainDateValue>()},
-      {::_pbi::TcParser::GetTable<::forthic::ZonedDateTimeValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ResultHeader>()},
+      {::_pbi::TcParser::GetTable<::forthic::ResultValueChunk>()},
+      {::_pbi::TcParser::GetTable<::forthic::ErrorInfo>()},
   }},
   {{
-    "\22\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "forthic.StackValue"
-    "string_value"
   }},
 };
-PROTOBUF_NOINLINE void StackValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.StackValue)
+PROTOBUF_NOINLINE void ResultChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ResultChunk)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  clear_value();
+  clear_chunk();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL StackValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ResultChunk::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const StackValue& this_ = static_cast<const StackValue&>(base);
+  const ResultChunk& this_ = static_cast<const ResultChunk&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL StackValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ResultChunk::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const StackValue& this_ = *this;
+  const ResultChunk& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.StackValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ResultChunk)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  switch (this_.value_case()) {
-    case kIntValue: {
-      target =
-          ::google::protobuf::internal::WireFormatLite::WriteInt64ToArrayWithField<1>(
-              stream, this_._internal_int_value(), target);
-      break;
-    }
-    case kStringValue: {
-      const ::std::string& _s = this_._internal_string_value();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.StackValue.string_value");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-      break;
-    }
-    case kBoolValue: {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteBoolToArray(
-          3, this_._internal_bool_value(), target);
-      break;
-    }
-    case kFloatValue: {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-          4, this_._internal_float_value(), target);
-      break;
-    }
-    case kNullValue: {
-      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          5, *this_._impl_.value_.null_value_, this_._impl_.value_.null_value_->GetCachedSize(), target,
-          stream);
-      break;
-    }
-    case kArrayValue: {
-      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          6, *this_._impl_.value_.array_value_, this_._impl_.value_.array_value_->GetCachedSize(), target,
-          stream);
-      break;
-    }
-    case kRecordValue: {
-      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          7, *this_._impl_.value_.record_value_, this_._impl_.value_.record_value_->GetCachedSize(), target,
-          stream);
-      break;
-    }
-    case kInstantValue: {
+  switch (this_.chunk_case()) {
+    case kHeader: {
       target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          8, *this_._impl_.value_.instant_value_, this_._impl_.value_.instant_value_->GetCachedSize(), target,
+          1, *this_._impl_.chunk_.header_, this_._impl_.chunk_.header_->GetCachedSize(), target,
           stream);
       break;
     }
-    case kPlainDateValue: {
+    case kValue: {
       target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          9, *this_._impl_.value_.plain_date_value_, this_._impl_.value_.plain_date_value_->GetCachedSize(), target,
+          2, *this_._impl_.chunk_.value_, this_._impl_.chunk_.value_->GetCachedSize(), target,
           stream);
       break;
     }
-    case kZonedDatetimeValue: {
+    case kError: {
       target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-          10, *this_._impl_.value_.zoned_datetime_value_, this_._impl_.value_.zoned_datetime_value_->GetCachedSize(), target,
+          3, *this_._impl_.chunk_.error_, this_._impl_.chunk_.error_->GetCachedSize(), target,
           stream);
       break;
     }
@@ -2594,84 +3389,44 @@ PROTOBUF_NOINLINE void StackValue::Clear() {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.StackValue)
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ResultChunk)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t StackValue::ByteSizeLong(const MessageLite& base) {
-  const StackValue& this_ = static_cast<const StackValue&>(base);
+::size_t ResultChunk::ByteSizeLong(const MessageLite& base) {
+  const ResultChunk& this_ = static_cast<const ResultChunk&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t StackValue::ByteSizeLong() const {
-  const StackValue& this_ = *this;
+::size_t ResultChunk::ByteSizeLong() const {
+  const ResultChunk& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.StackValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ResultChunk)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-  switch (this_.value_case()) {
-    // int64 int_value = 1;
-    case kIntValue: {
-      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-          this_._internal_int_value());
-      break;
-    }
-    // string string_value = 2;
-    case kStringValue: {
-      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                      this_._internal_string_value());
-      break;
-    }
-    // bool bool_value = 3;
-    case kBoolValue: {
-      total_size += 2;
-      break;
-    }
-    // double float_value = 4;
-    case kFloatValue: {
-      total_size += 9;
-      break;
-    }
-    // .forthic.NullValue null_value = 5;
-    case kNullValue: {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.null_value_);
-      break;
-    }
-    // .forthic.ArrayValue array_value = 6;
-    case kArrayValue: {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.array_value_);
-      break;
-    }
-    // .forthic.RecordValue record_value = 7;
-    case kRecordValue: {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.record_value_);
-      break;
-    }
-    // .forthic.InstantValue instant_value = 8;
-    case kInstantValue: {
+  switch (this_.chunk_case()) {
+    // .forthic.ResultHeader header = 1;
+    case kHeader: {
       total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.instant_value_);
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.chunk_.header_);
       break;
     }
-    // .forthic.PlainDateValue plain_date_value = 9;
-    case kPlainDateValue: {
+    // .forthic.ResultValueChunk value = 2;
+    case kValue: {
       total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.plain_date_value_);
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.chunk_.value_);
       break;
     }
-    // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
-    case kZonedDatetimeValue: {
+    // .forthic.ErrorInfo error = 3;
+    case kError: {
       total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.zoned_datetime_value_);
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.chunk_.error_);
       break;
     }
-    case VALUE_NOT_SET: {
+    case CHUNK_NOT_SET: {
       break;
     }
   }
@@ -2679,16 +3434,16 @@ PROTOBUF_NOINLINE void StackValue::Clear() {
                                              &this_._impl_._cached_size_);
 }
 
-void StackValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void ResultChunk::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<StackValue*>(&to_msg);
-  auto& from = static_cast<const StackValue&>(from_msg);
+      static_cast<ResultChunk*>(&to_msg);
+  auto& from = static_cast<const ResultChunk&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
   ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.StackValue)
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ResultChunk)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
@@ -2699,80 +3454,37 @@ void StackValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
     const bool oneof_needs_init = oneof_to_case != oneof_from_case;
     if (oneof_needs_init) {
       if (oneof_to_case != 0) {
-        _this->clear_value();
+        _this->clear_chunk();
       }
       _this->_impl_._oneof_case_[0] = oneof_from_case;
     }
 
     switch (oneof_from_case) {
-      case kIntValue: {
-        _this->_impl_.value_.int_value_ = from._impl_.value_.int_value_;
-        break;
-      }
-      case kStringValue: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.string_value_.InitDefault();
-        }
-        _this->_impl_.value_.string_value_.Set(from._internal_string_value(), arena);
-        break;
-      }
-      case kBoolValue: {
-        _this->_impl_.value_.bool_value_ = from._impl_.value_.bool_value_;
-        break;
-      }
-      case kFloatValue: {
-        _this->_impl_.value_.float_value_ = from._impl_.value_.float_value_;
-        break;
-      }
-      case kNullValue: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.null_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.null_value_);
-        } else {
-          _this->_impl_.value_.null_value_->MergeFrom(*from._impl_.value_.null_value_);
-        }
-        break;
-      }
-      case kArrayValue: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.array_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.array_value_);
-        } else {
-          _this->_impl_.value_.array_value_->MergeFrom(*from._impl_.value_.array_value_);
-        }
-        break;
-      }
-      case kRecordValue: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.record_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.record_value_);
-        } else {
-          _this->_impl_.value_.record_value_->MergeFrom(*from._impl_.value_.record_value_);
-        }
-        break;
-      }
-      case kInstantValue: {
+      case kHeader: {
         if (oneof_needs_init) {
-          _this->_impl_.value_.instant_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.instant_value_);
+          _this->_impl_.chunk_.header_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.header_);
         } else {
-          _this->_impl_.value_.instant_value_->MergeFrom(*from._impl_.value_.instant_value_);
+          _this->_impl_.chunk_.header_->MergeFrom(*from._impl_.chunk_.header_);
         }
         break;
       }
-      case kPlainDateValue: {
+      case kValue: {
         if (oneof_needs_init) {
-          _this->_impl_.value_.plain_date_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.plain_date_value_);
+          _this->_impl_.chunk_.value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.value_);
         } else {
-          _this->_impl_.value_.plain_date_value_->MergeFrom(*from._impl_.value_.plain_date_value_);
+          _this->_impl_.chunk_.value_->MergeFrom(*from._impl_.chunk_.value_);
         }
         break;
       }
-      case kZonedDatetimeValue: {
+      case kError: {
         if (oneof_needs_init) {
-          _this->_impl_.value_.zoned_datetime_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.zoned_datetime_value_);
+          _this->_impl_.chunk_.error_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.chunk_.error_);
         } else {
-          _this->_impl_.value_.zoned_datetime_value_->MergeFrom(*from._impl_.value_.zoned_datetime_value_);
+          _this->_impl_.chunk_.error_->MergeFrom(*from._impl_.chunk_.error_);
         }
         break;
       }
-      case VALUE_NOT_SET:
+      case CHUNK_NOT_SET:
         break;
     }
   }
@@ -2780,353 +3492,643 @@ void StackValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
       from._internal_metadata_);
 }
 
-void StackValue::CopyFrom(const StackValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.StackValue)
+void ResultChunk::CopyFrom(const ResultChunk& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ResultChunk)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void StackValue::InternalSwap(StackValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void ResultChunk::InternalSwap(ResultChunk* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_.chunk_, other->_impl_.chunk_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata StackValue::GetMetadata() const {
+::google::protobuf::Metadata ResultChunk::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
-class NullValue::_Internal {
+class ResultHeader::_Internal {
  public:
+  using HasBits =
+      decltype(::std::declval<ResultHeader>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_._has_bits_);
 };
 
-NullValue::NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+ResultHeader::ResultHeader(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena, NullValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultHeader_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+    : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(arena_constructor:forthic.NullValue)
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.ResultHeader)
 }
-NullValue::NullValue(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const NullValue& from)
+ResultHeader::ResultHeader(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ResultHeader& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena, NullValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultHeader_class_data_.base()),
 #else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+    : ::google::protobuf::Message(arena),
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  NullValue* const _this = this;
-  (void)_this;
+      _impl_(from._impl_) {
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
+}
+PROTOBUF_NDEBUG_INLINE ResultHeader::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0} {}
 
-  // @@protoc_insertion_point(copy_constructor:forthic.NullValue)
+inline void ResultHeader::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, result_count_),
+           0,
+           offsetof(Impl_, supports_compact_temporal_) -
+               offsetof(Impl_, result_count_) +
+               sizeof(Impl_::supports_compact_temporal_));
+}
+ResultHeader::~ResultHeader() {
+  // @@protoc_insertion_point(destructor:forthic.ResultHeader)
+  SharedDtor(*this);
+}
+inline void ResultHeader::SharedDtor(MessageLite& self) {
+  ResultHeader& this_ = static_cast<ResultHeader&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL NullValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL ResultHeader::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) NullValue(arena);
+  return ::new (mem) ResultHeader(arena);
 }
-constexpr auto NullValue::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(NullValue),
-                                            alignof(NullValue));
+constexpr auto ResultHeader::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ResultHeader),
+                                            alignof(ResultHeader));
 }
-constexpr auto NullValue::InternalGenerateClassData_() {
+constexpr auto ResultHeader::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_NullValue_default_instance_._instance,
+          &_ResultHeader_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &NullValue::MergeImpl,
-          ::google::protobuf::internal::ZeroFieldsBase::GetNewImpl<NullValue>(),
+          &ResultHeader::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ResultHeader>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &NullValue::SharedDtor,
-          ::google::protobuf::internal::ZeroFieldsBase::GetClearImpl<NullValue>(), &NullValue::ByteSizeLong,
-              &NullValue::_InternalSerialize,
+          &ResultHeader::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ResultHeader>(), &ResultHeader::ByteSizeLong,
+              &ResultHeader::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(NullValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_._cached_size_),
           false,
       },
-      &NullValue::kDescriptorMethods,
+      &ResultHeader::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull NullValue_class_data_ =
-        NullValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull ResultHeader_class_data_ =
+        ResultHeader::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-NullValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&NullValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(NullValue_class_data_.tc_table);
-  return NullValue_class_data_.base();
+ResultHeader::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ResultHeader_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ResultHeader_class_data_.tc_table);
+  return ResultHeader_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 0, 0, 0, 2>
-NullValue::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2>
+ResultHeader::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_._has_bits_),
     0, // no _extensions_
-    0, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967295,  // skipmap
-    offsetof(decltype(_table_), field_names),  // no field_entries
-    0,  // num_field_entries
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    NullValue_class_data_.base(),
+    ResultHeader_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::NullValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::ResultHeader>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // bool supports_compact_temporal = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ResultHeader, _impl_.supports_compact_temporal_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.supports_compact_temporal_)}},
+    // uint32 result_count = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ResultHeader, _impl_.result_count_), 0>(),
+     {8, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.result_count_)}},
   }}, {{
     65535, 65535
-  }}, // no field_entries, or aux_entries
+  }}, {{
+    // uint32 result_count = 1;
+    {PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.result_count_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // bool supports_compact_temporal = 2;
+    {PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.supports_compact_temporal_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+  }},
+  // no aux_entries
   {{
   }},
 };
+PROTOBUF_NOINLINE void ResultHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ResultHeader)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    ::memset(&_impl_.result_count_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.supports_compact_temporal_) -
+        reinterpret_cast<char*>(&_impl_.result_count_)) + sizeof(_impl_.supports_compact_temporal_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
 
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL ResultHeader::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const ResultHeader& this_ = static_cast<const ResultHeader&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL ResultHeader::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const ResultHeader& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ResultHeader)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
 
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // uint32 result_count = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (this_._internal_result_count() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          1, this_._internal_result_count(), target);
+    }
+  }
 
+  // bool supports_compact_temporal = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_supports_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          2, this_._internal_supports_compact_temporal(), target);
+    }
+  }
 
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ResultHeader)
+  return target;
+}
 
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t ResultHeader::ByteSizeLong(const MessageLite& base) {
+  const ResultHeader& this_ = static_cast<const ResultHeader&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t ResultHeader::ByteSizeLong() const {
+  const ResultHeader& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ResultHeader)
+  ::size_t total_size = 0;
 
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
 
-::google::protobuf::Metadata NullValue::GetMetadata() const {
-  return ::google::protobuf::internal::ZeroFieldsBase::GetMetadataImpl(GetClassData()->full());
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // uint32 result_count = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (this_._internal_result_count() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_result_count());
+      }
+    }
+    // bool supports_compact_temporal = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_supports_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void ResultHeader::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<ResultHeader*>(&to_msg);
+  auto& from = static_cast<const ResultHeader&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ResultHeader)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (from._internal_result_count() != 0) {
+        _this->_impl_.result_count_ = from._impl_.result_count_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_supports_compact_temporal() != 0) {
+        _this->_impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void ResultHeader::CopyFrom(const ResultHeader& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ResultHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ResultHeader::InternalSwap(ResultHeader* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.supports_compact_temporal_)
+      + sizeof(ResultHeader::_impl_.supports_compact_temporal_)
+      - PROTOBUF_FIELD_OFFSET(ResultHeader, _impl_.result_count_)>(
+          reinterpret_cast<char*>(&_impl_.result_count_),
+          reinterpret_cast<char*>(&other->_impl_.result_count_));
+}
+
+::google::protobuf::Metadata ResultHeader::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
-class ArrayValue::_Internal {
+class ResultValueChunk::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<ArrayValue>()._impl_._has_bits_);
+      decltype(::std::declval<ResultValueChunk>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._has_bits_);
+      8 * PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+      PROTOBUF_FIELD_OFFSET(::forthic::ResultValueChunk, _impl_._oneof_case_);
 };
 
-ArrayValue::ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+void ResultValueChunk::set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_part();
+  if (value) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    set_has_value();
+    _impl_.part_.value_ = value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.ResultValueChunk.value)
+}
+void ResultValueChunk::set_allocated_array_elements(::forthic::ArrayValue* PROTOBUF_NULLABLE array_elements) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_part();
+  if (array_elements) {
+    ::google::protobuf::Arena* submessage_arena = array_elements->GetArena();
+    if (message_arena != submessage_arena) {
+      array_elements = ::google::protobuf::internal::GetOwnedMessage(message_arena, array_elements, submessage_arena);
+    }
+    set_has_array_elements();
+    _impl_.part_.array_elements_ = array_elements;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.ResultValueChunk.array_elements)
+}
+ResultValueChunk::ResultValueChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ArrayValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultValueChunk_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.ArrayValue)
+  // @@protoc_insertion_point(arena_constructor:forthic.ResultValueChunk)
 }
-PROTOBUF_NDEBUG_INLINE ArrayValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ResultValueChunk::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::ArrayValue& from_msg)
+    [[maybe_unused]] const ::forthic::ResultValueChunk& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        items_{visibility, arena, from.items_} {}
+        part_{},
+        _oneof_case_{from._oneof_case_[0]} {}
 
-ArrayValue::ArrayValue(
+ResultValueChunk::ResultValueChunk(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const ArrayValue& from)
+    const ResultValueChunk& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ArrayValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ResultValueChunk_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  ArrayValue* const _this = this;
+  ResultValueChunk* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, stack_index_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, stack_index_),
+           offsetof(Impl_, last_) -
+               offsetof(Impl_, stack_index_) +
+               sizeof(Impl_::last_));
+  switch (part_case()) {
+    case PART_NOT_SET:
+      break;
+      case kValue:
+        _impl_.part_.value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.part_.value_);
+        break;
+      case kArrayElements:
+        _impl_.part_.array_elements_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.part_.array_elements_);
+        break;
+  }
 
-  // @@protoc_insertion_point(copy_constructor:forthic.ArrayValue)
+  // @@protoc_insertion_point(copy_constructor:forthic.ResultValueChunk)
 }
-PROTOBUF_NDEBUG_INLINE ArrayValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ResultValueChunk::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        items_{visibility, arena} {}
+        part_{},
+        _oneof_case_{} {}
 
-inline void ArrayValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void ResultValueChunk::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, stack_index_),
+           0,
+           offsetof(Impl_, last_) -
+               offsetof(Impl_, stack_index_) +
+               sizeof(Impl_::last_));
 }
-ArrayValue::~ArrayValue() {
-  // @@protoc_insertion_point(destructor:forthic.ArrayValue)
+ResultValueChunk::~ResultValueChunk() {
+  // @@protoc_insertion_point(destructor:forthic.ResultValueChunk)
   SharedDtor(*this);
 }
-inline void ArrayValue::SharedDtor(MessageLite& self) {
-  ArrayValue& this_ = static_cast<ArrayValue&>(self);
+inline void ResultValueChunk::SharedDtor(MessageLite& self) {
+  ResultValueChunk& this_ = static_cast<ResultValueChunk&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
+  if (this_.has_part()) {
+    this_.clear_part();
+  }
   this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL ArrayValue::PlacementNew_(
+void ResultValueChunk::clear_part() {
+// @@protoc_insertion_point(one_of_clear_start:forthic.ResultValueChunk)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  switch (part_case()) {
+    case kValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.part_.value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.part_.value_);
+      }
+      break;
+    }
+    case kArrayElements: {
+      if (GetArena() == nullptr) {
+        delete _impl_.part_.array_elements_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.part_.array_elements_);
+      }
+      break;
+    }
+    case PART_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = PART_NOT_SET;
+}
+
+
+inline void* PROTOBUF_NONNULL ResultValueChunk::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ArrayValue(arena);
+  return ::new (mem) ResultValueChunk(arena);
 }
-constexpr auto ArrayValue::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_) +
-          decltype(ArrayValue::_impl_.items_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(ArrayValue), alignof(ArrayValue), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&ArrayValue::PlacementNew_,
-                                 sizeof(ArrayValue),
-                                 alignof(ArrayValue));
-  }
+constexpr auto ResultValueChunk::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ResultValueChunk),
+                                            alignof(ResultValueChunk));
 }
-constexpr auto ArrayValue::InternalGenerateClassData_() {
+constexpr auto ResultValueChunk::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_ArrayValue_default_instance_._instance,
+          &_ResultValueChunk_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &ArrayValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ArrayValue>(),
+          &ResultValueChunk::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ResultValueChunk>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ArrayValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ArrayValue>(), &ArrayValue::ByteSizeLong,
-              &ArrayValue::_InternalSerialize,
+          &ResultValueChunk::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ResultValueChunk>(), &ResultValueChunk::ByteSizeLong,
+              &ResultValueChunk::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_._cached_size_),
           false,
       },
-      &ArrayValue::kDescriptorMethods,
+      &ResultValueChunk::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ArrayValue_class_data_ =
-        ArrayValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull ResultValueChunk_class_data_ =
+        ResultValueChunk::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ArrayValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ArrayValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ArrayValue_class_data_.tc_table);
-  return ArrayValue_class_data_.base();
+ResultValueChunk::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ResultValueChunk_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ResultValueChunk_class_data_.tc_table);
+  return ResultValueChunk_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
-ArrayValue::_table_ = {
+const ::_pbi::TcParseTable<1, 4, 2, 0, 2>
+ResultValueChunk::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    4, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    4,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    ArrayValue_class_data_.base(),
+    ResultValueChunk_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::ArrayValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::ResultValueChunk>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // repeated .forthic.StackValue items = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 0, 0,
-      PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_)}},
+    // bool last = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ResultValueChunk, _impl_.last_), 1>(),
+     {32, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.last_)}},
+    // uint32 stack_index = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ResultValueChunk, _impl_.stack_index_), 0>(),
+     {8, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.stack_index_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // repeated .forthic.StackValue items = 1;
-    {PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint32 stack_index = 1;
+    {PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.stack_index_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // .forthic.StackValue value = 2;
+    {PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.part_.value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ArrayValue array_elements = 3;
+    {PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.part_.array_elements_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool last = 4;
+    {PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.last_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ArrayValue>()},
   }},
   {{
   }},
 };
-PROTOBUF_NOINLINE void ArrayValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.ArrayValue)
+PROTOBUF_NOINLINE void ResultValueChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ResultValueChunk)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _impl_.items_.Clear();
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    ::memset(&_impl_.stack_index_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.last_) -
+        reinterpret_cast<char*>(&_impl_.stack_index_)) + sizeof(_impl_.last_));
   }
+  clear_part();
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ArrayValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ResultValueChunk::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ArrayValue& this_ = static_cast<const ArrayValue&>(base);
+  const ResultValueChunk& this_ = static_cast<const ResultValueChunk&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ArrayValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ResultValueChunk::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ArrayValue& this_ = *this;
+  const ResultValueChunk& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.ArrayValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ResultValueChunk)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // repeated .forthic.StackValue items = 1;
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    for (unsigned i = 0, n = static_cast<unsigned>(
-                             this_._internal_items_size());
-         i < n; i++) {
-      const auto& repfield = this_._internal_items().Get(i);
-      target =
-          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-              1, repfield, repfield.GetCachedSize(),
-              target, stream);
+  // uint32 stack_index = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (this_._internal_stack_index() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          1, this_._internal_stack_index(), target);
     }
   }
 
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.ArrayValue)
-  return target;
-}
+  switch (this_.part_case()) {
+    case kValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          2, *this_._impl_.part_.value_, this_._impl_.part_.value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kArrayElements: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          3, *this_._impl_.part_.array_elements_, this_._impl_.part_.array_elements_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    default:
+      break;
+  }
+  // bool last = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_last() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_last(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ResultValueChunk)
+  return target;
+}
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ArrayValue::ByteSizeLong(const MessageLite& base) {
-  const ArrayValue& this_ = static_cast<const ArrayValue&>(base);
+::size_t ResultValueChunk::ByteSizeLong(const MessageLite& base) {
+  const ResultValueChunk& this_ = static_cast<const ResultValueChunk&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ArrayValue::ByteSizeLong() const {
-  const ArrayValue& this_ = *this;
+::size_t ResultValueChunk::ByteSizeLong() const {
+  const ResultValueChunk& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.ArrayValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ResultValueChunk)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -3134,380 +4136,4950 @@ PROTOBUF_NOINLINE void ArrayValue::Clear() {
   (void)cached_has_bits;
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-   {
-    // repeated .forthic.StackValue items = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-      total_size += 1UL * this_._internal_items_size();
-      for (const auto& msg : this_._internal_items()) {
-        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // uint32 stack_index = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (this_._internal_stack_index() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_stack_index());
+      }
+    }
+    // bool last = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_last() != 0) {
+        total_size += 2;
       }
     }
   }
+  switch (this_.part_case()) {
+    // .forthic.StackValue value = 2;
+    case kValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.part_.value_);
+      break;
+    }
+    // .forthic.ArrayValue array_elements = 3;
+    case kArrayElements: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.part_.array_elements_);
+      break;
+    }
+    case PART_NOT_SET: {
+      break;
+    }
+  }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
 }
 
-void ArrayValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void ResultValueChunk::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<ArrayValue*>(&to_msg);
-  auto& from = static_cast<const ArrayValue&>(from_msg);
+      static_cast<ResultValueChunk*>(&to_msg);
+  auto& from = static_cast<const ResultValueChunk&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
   ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ArrayValue)
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ResultValueChunk)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _this->_internal_mutable_items()->InternalMergeFromWithArena(
-        ::google::protobuf::MessageLite::internal_visibility(), arena,
-        from._internal_items());
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (from._internal_stack_index() != 0) {
+        _this->_impl_.stack_index_ = from._impl_.stack_index_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_last() != 0) {
+        _this->_impl_.last_ = from._impl_.last_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (const uint32_t oneof_from_case =
+          from._impl_._oneof_case_[0]) {
+    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
+    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
+    if (oneof_needs_init) {
+      if (oneof_to_case != 0) {
+        _this->clear_part();
+      }
+      _this->_impl_._oneof_case_[0] = oneof_from_case;
+    }
+
+    switch (oneof_from_case) {
+      case kValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.part_.value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.part_.value_);
+        } else {
+          _this->_impl_.part_.value_->MergeFrom(*from._impl_.part_.value_);
+        }
+        break;
+      }
+      case kArrayElements: {
+        if (oneof_needs_init) {
+          _this->_impl_.part_.array_elements_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.part_.array_elements_);
+        } else {
+          _this->_impl_.part_.array_elements_->MergeFrom(*from._impl_.part_.array_elements_);
+        }
+        break;
+      }
+      case PART_NOT_SET:
+        break;
+    }
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 }
 
-void ArrayValue::CopyFrom(const ArrayValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ArrayValue)
+void ResultValueChunk::CopyFrom(const ResultValueChunk& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ResultValueChunk)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void ArrayValue::InternalSwap(ArrayValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void ResultValueChunk::InternalSwap(ResultValueChunk* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.items_.InternalSwap(&other->_impl_.items_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.last_)
+      + sizeof(ResultValueChunk::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(ResultValueChunk, _impl_.stack_index_)>(
+          reinterpret_cast<char*>(&_impl_.stack_index_),
+          reinterpret_cast<char*>(&other->_impl_.stack_index_));
+  swap(_impl_.part_, other->_impl_.part_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata ArrayValue::GetMetadata() const {
+::google::protobuf::Metadata ResultValueChunk::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
+class SharedMemoryOffer::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<SharedMemoryOffer>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_._has_bits_);
+};
+
+SharedMemoryOffer::SharedMemoryOffer(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse()
-    : SuperType(RecordValue_FieldsEntry_DoNotUse_class_data_.base()) {}
-RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-    : SuperType(arena, RecordValue_FieldsEntry_DoNotUse_class_data_.base()) {}
+    : ::google::protobuf::Message(arena, SharedMemoryOffer_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
-RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse() : SuperType() {}
-RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena) : SuperType(arena) {}
+    : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-inline void* PROTOBUF_NONNULL RecordValue_FieldsEntry_DoNotUse::PlacementNew_(
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.SharedMemoryOffer)
+}
+PROTOBUF_NDEBUG_INLINE SharedMemoryOffer::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::SharedMemoryOffer& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        region_(arena, from.region_) {}
+
+SharedMemoryOffer::SharedMemoryOffer(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const SharedMemoryOffer& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SharedMemoryOffer_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedMemoryOffer* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.min_bytes_ = from._impl_.min_bytes_;
+
+  // @@protoc_insertion_point(copy_constructor:forthic.SharedMemoryOffer)
+}
+PROTOBUF_NDEBUG_INLINE SharedMemoryOffer::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        region_(arena) {}
+
+inline void SharedMemoryOffer::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.min_bytes_ = {};
+}
+SharedMemoryOffer::~SharedMemoryOffer() {
+  // @@protoc_insertion_point(destructor:forthic.SharedMemoryOffer)
+  SharedDtor(*this);
+}
+inline void SharedMemoryOffer::SharedDtor(MessageLite& self) {
+  SharedMemoryOffer& this_ = static_cast<SharedMemoryOffer&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.region_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL SharedMemoryOffer::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) RecordValue_FieldsEntry_DoNotUse(arena);
+  return ::new (mem) SharedMemoryOffer(arena);
 }
-constexpr auto RecordValue_FieldsEntry_DoNotUse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RecordValue_FieldsEntry_DoNotUse),
-                                            alignof(RecordValue_FieldsEntry_DoNotUse));
+constexpr auto SharedMemoryOffer::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SharedMemoryOffer),
+                                            alignof(SharedMemoryOffer));
 }
-constexpr auto RecordValue_FieldsEntry_DoNotUse::InternalGenerateClassData_() {
+constexpr auto SharedMemoryOffer::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_RecordValue_FieldsEntry_DoNotUse_default_instance_._instance,
+          &_SharedMemoryOffer_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &RecordValue_FieldsEntry_DoNotUse::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<RecordValue_FieldsEntry_DoNotUse>(),
+          &SharedMemoryOffer::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<SharedMemoryOffer>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &RecordValue_FieldsEntry_DoNotUse::SharedDtor,
-          static_cast<void (::google::protobuf::MessageLite::*)()>(&RecordValue_FieldsEntry_DoNotUse::ClearImpl),
-              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
-              ,
+          &SharedMemoryOffer::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<SharedMemoryOffer>(), &SharedMemoryOffer::ByteSizeLong,
+              &SharedMemoryOffer::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_._cached_size_),
           false,
       },
-      &RecordValue_FieldsEntry_DoNotUse::kDescriptorMethods,
+      &SharedMemoryOffer::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull RecordValue_FieldsEntry_DoNotUse_class_data_ =
-        RecordValue_FieldsEntry_DoNotUse::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull SharedMemoryOffer_class_data_ =
+        SharedMemoryOffer::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-RecordValue_FieldsEntry_DoNotUse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&RecordValue_FieldsEntry_DoNotUse_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(RecordValue_FieldsEntry_DoNotUse_class_data_.tc_table);
-  return RecordValue_FieldsEntry_DoNotUse_class_data_.base();
+SharedMemoryOffer::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&SharedMemoryOffer_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(SharedMemoryOffer_class_data_.tc_table);
+  return SharedMemoryOffer_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 43, 2>
-RecordValue_FieldsEntry_DoNotUse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 40, 2>
+SharedMemoryOffer::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_._has_bits_),
     0, // no _extensions_
     2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
     2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    RecordValue_FieldsEntry_DoNotUse_class_data_.base(),
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    SharedMemoryOffer_class_data_.base(),
     nullptr,  // post_loop_handler
-    ::_pbi::TcParser::DiscardEverythingFallback,  // fallback
+    ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::RecordValue_FieldsEntry_DoNotUse>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::SharedMemoryOffer>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // .forthic.StackValue value = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 0,
-      PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.value_)}},
-    // string key = 1;
+    // uint64 min_bytes = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SharedMemoryOffer, _impl_.min_bytes_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_.min_bytes_)}},
+    // string region = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 0, 0,
-      PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.key_)}},
+      PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_.region_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.key_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .forthic.StackValue value = 2;
-    {PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.value_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }},
-  {{
-      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+    // string region = 1;
+    {PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_.region_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // uint64 min_bytes = 2;
+    {PROTOBUF_FIELD_OFFSET(SharedMemoryOffer, _impl_.min_bytes_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
   }},
+  // no aux_entries
   {{
-    "\37\3\0\0\0\0\0\0"
-    "forthic.RecordValue.FieldsEntry"
-    "key"
+    "\31\6\0\0\0\0\0\0"
+    "forthic.SharedMemoryOffer"
+    "region"
   }},
 };
+PROTOBUF_NOINLINE void SharedMemoryOffer::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.SharedMemoryOffer)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    _impl_.region_.ClearNonDefaultToEmpty();
+  }
+  _impl_.min_bytes_ = ::uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL SharedMemoryOffer::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const SharedMemoryOffer& this_ = static_cast<const SharedMemoryOffer&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL SharedMemoryOffer::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const SharedMemoryOffer& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.SharedMemoryOffer)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string region = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_region().empty()) {
+      const ::std::string& _s = this_._internal_region();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.SharedMemoryOffer.region");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // uint64 min_bytes = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_min_bytes() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          2, this_._internal_min_bytes(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.SharedMemoryOffer)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t SharedMemoryOffer::ByteSizeLong(const MessageLite& base) {
+  const SharedMemoryOffer& this_ = static_cast<const SharedMemoryOffer&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t SharedMemoryOffer::ByteSizeLong() const {
+  const SharedMemoryOffer& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.SharedMemoryOffer)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // string region = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_region().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_region());
+      }
+    }
+    // uint64 min_bytes = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_min_bytes() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_min_bytes());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void SharedMemoryOffer::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<SharedMemoryOffer*>(&to_msg);
+  auto& from = static_cast<const SharedMemoryOffer&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.SharedMemoryOffer)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_region().empty()) {
+        _this->_internal_set_region(from._internal_region());
+      } else {
+        if (_this->_impl_.region_.IsDefault()) {
+          _this->_internal_set_region("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_min_bytes() != 0) {
+        _this->_impl_.min_bytes_ = from._impl_.min_bytes_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void SharedMemoryOffer::CopyFrom(const SharedMemoryOffer& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.SharedMemoryOffer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void SharedMemoryOffer::InternalSwap(SharedMemoryOffer* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.region_, &other->_impl_.region_, arena);
+  swap(_impl_.min_bytes_, other->_impl_.min_bytes_);
+}
+
+::google::protobuf::Metadata SharedMemoryOffer::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class SharedPayload::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<SharedPayload>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_._has_bits_);
+};
+
+SharedPayload::SharedPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SharedPayload_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.SharedPayload)
+}
+PROTOBUF_NDEBUG_INLINE SharedPayload::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::SharedPayload& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        region_(arena, from.region_) {}
+
+SharedPayload::SharedPayload(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const SharedPayload& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, SharedPayload_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedPayload* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, offset_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, offset_),
+           offsetof(Impl_, generation_) -
+               offsetof(Impl_, offset_) +
+               sizeof(Impl_::generation_));
+
+  // @@protoc_insertion_point(copy_constructor:forthic.SharedPayload)
+}
+PROTOBUF_NDEBUG_INLINE SharedPayload::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        region_(arena) {}
+
+inline void SharedPayload::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, offset_),
+           0,
+           offsetof(Impl_, generation_) -
+               offsetof(Impl_, offset_) +
+               sizeof(Impl_::generation_));
+}
+SharedPayload::~SharedPayload() {
+  // @@protoc_insertion_point(destructor:forthic.SharedPayload)
+  SharedDtor(*this);
+}
+inline void SharedPayload::SharedDtor(MessageLite& self) {
+  SharedPayload& this_ = static_cast<SharedPayload&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.region_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL SharedPayload::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) SharedPayload(arena);
+}
+constexpr auto SharedPayload::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SharedPayload),
+                                            alignof(SharedPayload));
+}
+constexpr auto SharedPayload::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_SharedPayload_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &SharedPayload::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<SharedPayload>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &SharedPayload::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<SharedPayload>(), &SharedPayload::ByteSizeLong,
+              &SharedPayload::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_._cached_size_),
+          false,
+      },
+      &SharedPayload::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull SharedPayload_class_data_ =
+        SharedPayload::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+SharedPayload::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&SharedPayload_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(SharedPayload_class_data_.tc_table);
+  return SharedPayload_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 36, 2>
+SharedPayload::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    SharedPayload_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::SharedPayload>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // uint64 generation = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SharedPayload, _impl_.generation_), 3>(),
+     {32, 3, 0,
+      PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.generation_)}},
+    // string region = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.region_)}},
+    // uint64 offset = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SharedPayload, _impl_.offset_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.offset_)}},
+    // uint64 length = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SharedPayload, _impl_.length_), 2>(),
+     {24, 2, 0,
+      PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.length_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string region = 1;
+    {PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.region_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // uint64 offset = 2;
+    {PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.offset_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // uint64 length = 3;
+    {PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.length_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // uint64 generation = 4;
+    {PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.generation_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\25\6\0\0\0\0\0\0"
+    "forthic.SharedPayload"
+    "region"
+  }},
+};
+PROTOBUF_NOINLINE void SharedPayload::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.SharedPayload)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    _impl_.region_.ClearNonDefaultToEmpty();
+  }
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000eU)) {
+    ::memset(&_impl_.offset_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.generation_) -
+        reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.generation_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL SharedPayload::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const SharedPayload& this_ = static_cast<const SharedPayload&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL SharedPayload::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const SharedPayload& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.SharedPayload)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string region = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_region().empty()) {
+      const ::std::string& _s = this_._internal_region();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.SharedPayload.region");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // uint64 offset = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_offset() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          2, this_._internal_offset(), target);
+    }
+  }
+
+  // uint64 length = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_length() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          3, this_._internal_length(), target);
+    }
+  }
+
+  // uint64 generation = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (this_._internal_generation() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          4, this_._internal_generation(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.SharedPayload)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t SharedPayload::ByteSizeLong(const MessageLite& base) {
+  const SharedPayload& this_ = static_cast<const SharedPayload&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t SharedPayload::ByteSizeLong() const {
+  const SharedPayload& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.SharedPayload)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
+    // string region = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_region().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_region());
+      }
+    }
+    // uint64 offset = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_offset() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_offset());
+      }
+    }
+    // uint64 length = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_length() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_length());
+      }
+    }
+    // uint64 generation = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (this_._internal_generation() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_generation());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void SharedPayload::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<SharedPayload*>(&to_msg);
+  auto& from = static_cast<const SharedPayload&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.SharedPayload)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_region().empty()) {
+        _this->_internal_set_region(from._internal_region());
+      } else {
+        if (_this->_impl_.region_.IsDefault()) {
+          _this->_internal_set_region("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_offset() != 0) {
+        _this->_impl_.offset_ = from._impl_.offset_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_length() != 0) {
+        _this->_impl_.length_ = from._impl_.length_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (from._internal_generation() != 0) {
+        _this->_impl_.generation_ = from._impl_.generation_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void SharedPayload::CopyFrom(const SharedPayload& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.SharedPayload)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void SharedPayload::InternalSwap(SharedPayload* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.region_, &other->_impl_.region_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.generation_)
+      + sizeof(SharedPayload::_impl_.generation_)
+      - PROTOBUF_FIELD_OFFSET(SharedPayload, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::google::protobuf::Metadata SharedPayload::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class StackPayload::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<StackPayload>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(StackPayload, _impl_._has_bits_);
+};
+
+StackPayload::StackPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StackPayload_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.StackPayload)
+}
+PROTOBUF_NDEBUG_INLINE StackPayload::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::StackPayload& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        values_{visibility, arena, from.values_} {}
+
+StackPayload::StackPayload(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const StackPayload& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StackPayload_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  StackPayload* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:forthic.StackPayload)
+}
+PROTOBUF_NDEBUG_INLINE StackPayload::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        values_{visibility, arena} {}
+
+inline void StackPayload::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+StackPayload::~StackPayload() {
+  // @@protoc_insertion_point(destructor:forthic.StackPayload)
+  SharedDtor(*this);
+}
+inline void StackPayload::SharedDtor(MessageLite& self) {
+  StackPayload& this_ = static_cast<StackPayload&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL StackPayload::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) StackPayload(arena);
+}
+constexpr auto StackPayload::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(StackPayload, _impl_.values_) +
+          decltype(StackPayload::_impl_.values_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(StackPayload), alignof(StackPayload), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&StackPayload::PlacementNew_,
+                                 sizeof(StackPayload),
+                                 alignof(StackPayload));
+  }
+}
+constexpr auto StackPayload::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_StackPayload_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &StackPayload::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<StackPayload>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &StackPayload::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<StackPayload>(), &StackPayload::ByteSizeLong,
+              &StackPayload::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(StackPayload, _impl_._cached_size_),
+          false,
+      },
+      &StackPayload::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull StackPayload_class_data_ =
+        StackPayload::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+StackPayload::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&StackPayload_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(StackPayload_class_data_.tc_table);
+  return StackPayload_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+StackPayload::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(StackPayload, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    StackPayload_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::StackPayload>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .forthic.StackValue values = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(StackPayload, _impl_.values_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .forthic.StackValue values = 1;
+    {PROTOBUF_FIELD_OFFSET(StackPayload, _impl_.values_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void StackPayload::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.StackPayload)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.values_.Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL StackPayload::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const StackPayload& this_ = static_cast<const StackPayload&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL StackPayload::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const StackPayload& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.StackPayload)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // repeated .forthic.StackValue values = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_values_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_values().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              1, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.StackPayload)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t StackPayload::ByteSizeLong(const MessageLite& base) {
+  const StackPayload& this_ = static_cast<const StackPayload&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t StackPayload::ByteSizeLong() const {
+  const StackPayload& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.StackPayload)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // repeated .forthic.StackValue values = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_values_size();
+      for (const auto& msg : this_._internal_values()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void StackPayload::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<StackPayload*>(&to_msg);
+  auto& from = static_cast<const StackPayload&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.StackPayload)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_internal_mutable_values()->InternalMergeFromWithArena(
+        ::google::protobuf::MessageLite::internal_visibility(), arena,
+        from._internal_values());
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void StackPayload::CopyFrom(const StackPayload& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.StackPayload)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void StackPayload::InternalSwap(StackPayload* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+}
+
+::google::protobuf::Metadata StackPayload::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class StreamRequest::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<StreamRequest>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_._has_bits_);
+};
+
+StreamRequest::StreamRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamRequest_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.StreamRequest)
+}
+PROTOBUF_NDEBUG_INLINE StreamRequest::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::StreamRequest& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        push_{visibility, arena, from.push_},
+        word_name_(arena, from.word_name_) {}
+
+StreamRequest::StreamRequest(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const StreamRequest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamRequest_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  StreamRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, correlation_id_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, correlation_id_),
+           offsetof(Impl_, accepts_compact_temporal_) -
+               offsetof(Impl_, correlation_id_) +
+               sizeof(Impl_::accepts_compact_temporal_));
+
+  // @@protoc_insertion_point(copy_constructor:forthic.StreamRequest)
+}
+PROTOBUF_NDEBUG_INLINE StreamRequest::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        push_{visibility, arena},
+        word_name_(arena) {}
+
+inline void StreamRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, correlation_id_),
+           0,
+           offsetof(Impl_, accepts_compact_temporal_) -
+               offsetof(Impl_, correlation_id_) +
+               sizeof(Impl_::accepts_compact_temporal_));
+}
+StreamRequest::~StreamRequest() {
+  // @@protoc_insertion_point(destructor:forthic.StreamRequest)
+  SharedDtor(*this);
+}
+inline void StreamRequest::SharedDtor(MessageLite& self) {
+  StreamRequest& this_ = static_cast<StreamRequest&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.word_name_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL StreamRequest::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) StreamRequest(arena);
+}
+constexpr auto StreamRequest::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.push_) +
+          decltype(StreamRequest::_impl_.push_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::CopyInit(
+        sizeof(StreamRequest), alignof(StreamRequest), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&StreamRequest::PlacementNew_,
+                                 sizeof(StreamRequest),
+                                 alignof(StreamRequest));
+  }
+}
+constexpr auto StreamRequest::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_StreamRequest_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &StreamRequest::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<StreamRequest>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &StreamRequest::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<StreamRequest>(), &StreamRequest::ByteSizeLong,
+              &StreamRequest::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_._cached_size_),
+          false,
+      },
+      &StreamRequest::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull StreamRequest_class_data_ =
+        StreamRequest::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+StreamRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&StreamRequest_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(StreamRequest_class_data_.tc_table);
+  return StreamRequest_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 1, 39, 2>
+StreamRequest::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_._has_bits_),
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    StreamRequest_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::StreamRequest>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // uint64 correlation_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(StreamRequest, _impl_.correlation_id_), 2>(),
+     {8, 2, 0,
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.correlation_id_)}},
+    // string word_name = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.word_name_)}},
+    // repeated .forthic.StackValue push = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 0, 0,
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.push_)}},
+    // optional uint32 return_count = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StreamRequest, _impl_.return_count_), 3>(),
+     {32, 3, 0,
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.return_count_)}},
+    // bool accepts_compact_temporal = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(StreamRequest, _impl_.accepts_compact_temporal_), 4>(),
+     {40, 4, 0,
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.accepts_compact_temporal_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint64 correlation_id = 1;
+    {PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.correlation_id_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // string word_name = 2;
+    {PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.word_name_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // repeated .forthic.StackValue push = 3;
+    {PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.push_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional uint32 return_count = 4;
+    {PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.return_count_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // bool accepts_compact_temporal = 5;
+    {PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.accepts_compact_temporal_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+  }},
+  {{
+    "\25\0\11\0\0\0\0\0"
+    "forthic.StreamRequest"
+    "word_name"
+  }},
+};
+PROTOBUF_NOINLINE void StreamRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.StreamRequest)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _impl_.push_.Clear();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _impl_.word_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001cU)) {
+    ::memset(&_impl_.correlation_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.accepts_compact_temporal_) -
+        reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.accepts_compact_temporal_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL StreamRequest::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const StreamRequest& this_ = static_cast<const StreamRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL StreamRequest::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const StreamRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.StreamRequest)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // uint64 correlation_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_correlation_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          1, this_._internal_correlation_id(), target);
+    }
+  }
+
+  // string word_name = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (!this_._internal_word_name().empty()) {
+      const ::std::string& _s = this_._internal_word_name();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.StreamRequest.word_name");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+    }
+  }
+
+  // repeated .forthic.StackValue push = 3;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_push_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_push().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              3, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  // optional uint32 return_count = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        4, this_._internal_return_count(), target);
+  }
+
+  // bool accepts_compact_temporal = 5;
+  if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+    if (this_._internal_accepts_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          5, this_._internal_accepts_compact_temporal(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.StreamRequest)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t StreamRequest::ByteSizeLong(const MessageLite& base) {
+  const StreamRequest& this_ = static_cast<const StreamRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t StreamRequest::ByteSizeLong() const {
+  const StreamRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.StreamRequest)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001fU)) {
+    // repeated .forthic.StackValue push = 3;
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_push_size();
+      for (const auto& msg : this_._internal_push()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+      }
+    }
+    // string word_name = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!this_._internal_word_name().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_word_name());
+      }
+    }
+    // uint64 correlation_id = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_correlation_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_correlation_id());
+      }
+    }
+    // optional uint32 return_count = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+          this_._internal_return_count());
+    }
+    // bool accepts_compact_temporal = 5;
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (this_._internal_accepts_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void StreamRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<StreamRequest*>(&to_msg);
+  auto& from = static_cast<const StreamRequest&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.StreamRequest)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001fU)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _this->_internal_mutable_push()->InternalMergeFromWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), arena,
+          from._internal_push());
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!from._internal_word_name().empty()) {
+        _this->_internal_set_word_name(from._internal_word_name());
+      } else {
+        if (_this->_impl_.word_name_.IsDefault()) {
+          _this->_internal_set_word_name("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_correlation_id() != 0) {
+        _this->_impl_.correlation_id_ = from._impl_.correlation_id_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      _this->_impl_.return_count_ = from._impl_.return_count_;
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (from._internal_accepts_compact_temporal() != 0) {
+        _this->_impl_.accepts_compact_temporal_ = from._impl_.accepts_compact_temporal_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void StreamRequest::CopyFrom(const StreamRequest& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.StreamRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void StreamRequest::InternalSwap(StreamRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.push_.InternalSwap(&other->_impl_.push_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.word_name_, &other->_impl_.word_name_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.accepts_compact_temporal_)
+      + sizeof(StreamRequest::_impl_.accepts_compact_temporal_)
+      - PROTOBUF_FIELD_OFFSET(StreamRequest, _impl_.correlation_id_)>(
+          reinterpret_cast<char*>(&_impl_.correlation_id_),
+          reinterpret_cast<char*>(&other->_impl_.correlation_id_));
+}
+
+::google::protobuf::Metadata StreamRequest::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class StreamResponse::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<StreamResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_._has_bits_);
+};
+
+StreamResponse::StreamResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamResponse_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.StreamResponse)
+}
+PROTOBUF_NDEBUG_INLINE StreamResponse::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::StreamResponse& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        result_stack_{visibility, arena, from.result_stack_} {}
+
+StreamResponse::StreamResponse(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const StreamResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamResponse_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  StreamResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.error_ = (CheckHasBit(cached_has_bits, 0x00000002U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, correlation_id_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, correlation_id_),
+           offsetof(Impl_, supports_compact_temporal_) -
+               offsetof(Impl_, correlation_id_) +
+               sizeof(Impl_::supports_compact_temporal_));
+
+  // @@protoc_insertion_point(copy_constructor:forthic.StreamResponse)
+}
+PROTOBUF_NDEBUG_INLINE StreamResponse::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        result_stack_{visibility, arena} {}
+
+inline void StreamResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, supports_compact_temporal_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::supports_compact_temporal_));
+}
+StreamResponse::~StreamResponse() {
+  // @@protoc_insertion_point(destructor:forthic.StreamResponse)
+  SharedDtor(*this);
+}
+inline void StreamResponse::SharedDtor(MessageLite& self) {
+  StreamResponse& this_ = static_cast<StreamResponse&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  delete this_._impl_.error_;
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL StreamResponse::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) StreamResponse(arena);
+}
+constexpr auto StreamResponse::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.result_stack_) +
+          decltype(StreamResponse::_impl_.result_stack_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(StreamResponse), alignof(StreamResponse), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&StreamResponse::PlacementNew_,
+                                 sizeof(StreamResponse),
+                                 alignof(StreamResponse));
+  }
+}
+constexpr auto StreamResponse::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_StreamResponse_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &StreamResponse::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<StreamResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &StreamResponse::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<StreamResponse>(), &StreamResponse::ByteSizeLong,
+              &StreamResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_._cached_size_),
+          false,
+      },
+      &StreamResponse::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull StreamResponse_class_data_ =
+        StreamResponse::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+StreamResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&StreamResponse_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(StreamResponse_class_data_.tc_table);
+  return StreamResponse_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 2, 0, 2>
+StreamResponse::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_._has_bits_),
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    StreamResponse_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::StreamResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // uint64 correlation_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(StreamResponse, _impl_.correlation_id_), 2>(),
+     {8, 2, 0,
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.correlation_id_)}},
+    // repeated .forthic.StackValue result_stack = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 0, 0,
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.result_stack_)}},
+    // optional .forthic.ErrorInfo error = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 1, 1,
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.error_)}},
+    // uint32 session_depth = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StreamResponse, _impl_.session_depth_), 3>(),
+     {32, 3, 0,
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.session_depth_)}},
+    // bool supports_compact_temporal = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(StreamResponse, _impl_.supports_compact_temporal_), 4>(),
+     {40, 4, 0,
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.supports_compact_temporal_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint64 correlation_id = 1;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.correlation_id_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // repeated .forthic.StackValue result_stack = 2;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.result_stack_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .forthic.ErrorInfo error = 3;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.error_), _Internal::kHasBitsOffset + 1, 1, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint32 session_depth = 4;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.session_depth_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // bool supports_compact_temporal = 5;
+    {PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.supports_compact_temporal_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ErrorInfo>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void StreamResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.StreamResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _impl_.result_stack_.Clear();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      ABSL_DCHECK(_impl_.error_ != nullptr);
+      _impl_.error_->Clear();
+    }
+  }
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001cU)) {
+    ::memset(&_impl_.correlation_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.supports_compact_temporal_) -
+        reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.supports_compact_temporal_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL StreamResponse::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const StreamResponse& this_ = static_cast<const StreamResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL StreamResponse::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const StreamResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.StreamResponse)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // uint64 correlation_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    if (this_._internal_correlation_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          1, this_._internal_correlation_id(), target);
+    }
+  }
+
+  // repeated .forthic.StackValue result_stack = 2;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_result_stack_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_result_stack().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              2, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  // optional .forthic.ErrorInfo error = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, *this_._impl_.error_, this_._impl_.error_->GetCachedSize(), target,
+        stream);
+  }
+
+  // uint32 session_depth = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (this_._internal_session_depth() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          4, this_._internal_session_depth(), target);
+    }
+  }
+
+  // bool supports_compact_temporal = 5;
+  if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+    if (this_._internal_supports_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          5, this_._internal_supports_compact_temporal(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.StreamResponse)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t StreamResponse::ByteSizeLong(const MessageLite& base) {
+  const StreamResponse& this_ = static_cast<const StreamResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t StreamResponse::ByteSizeLong() const {
+  const StreamResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.StreamResponse)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001fU)) {
+    // repeated .forthic.StackValue result_stack = 2;
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_result_stack_size();
+      for (const auto& msg : this_._internal_result_stack()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+      }
+    }
+    // optional .forthic.ErrorInfo error = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.error_);
+    }
+    // uint64 correlation_id = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (this_._internal_correlation_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_correlation_id());
+      }
+    }
+    // uint32 session_depth = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (this_._internal_session_depth() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_session_depth());
+      }
+    }
+    // bool supports_compact_temporal = 5;
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (this_._internal_supports_compact_temporal() != 0) {
+        total_size += 2;
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void StreamResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<StreamResponse*>(&to_msg);
+  auto& from = static_cast<const StreamResponse&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.StreamResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x0000001fU)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _this->_internal_mutable_result_stack()->InternalMergeFromWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), arena,
+          from._internal_result_stack());
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      ABSL_DCHECK(from._impl_.error_ != nullptr);
+      if (_this->_impl_.error_ == nullptr) {
+        _this->_impl_.error_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_);
+      } else {
+        _this->_impl_.error_->MergeFrom(*from._impl_.error_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      if (from._internal_correlation_id() != 0) {
+        _this->_impl_.correlation_id_ = from._impl_.correlation_id_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (from._internal_session_depth() != 0) {
+        _this->_impl_.session_depth_ = from._impl_.session_depth_;
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000010U)) {
+      if (from._internal_supports_compact_temporal() != 0) {
+        _this->_impl_.supports_compact_temporal_ = from._impl_.supports_compact_temporal_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void StreamResponse::CopyFrom(const StreamResponse& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.StreamResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void StreamResponse::InternalSwap(StreamResponse* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.result_stack_.InternalSwap(&other->_impl_.result_stack_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.supports_compact_temporal_)
+      + sizeof(StreamResponse::_impl_.supports_compact_temporal_)
+      - PROTOBUF_FIELD_OFFSET(StreamResponse, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata StreamResponse::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class StackValue::_Internal {
+ public:
+  static constexpr ::int32_t kOneofCaseOffset =
+      PROTOBUF_FIELD_OFFSET(::forthic::StackValue, _impl_._oneof_case_);
+};
+
+void StackValue::set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE null_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (null_value) {
+    ::google::protobuf::Arena* submessage_arena = null_value->GetArena();
+    if (message_arena != submessage_arena) {
+      null_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, null_value, submessage_arena);
+    }
+    set_has_null_value();
+    _impl_.value_.null_value_ = null_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.null_value)
+}
+void StackValue::set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE array_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (array_value) {
+    ::google::protobuf::Arena* submessage_arena = array_value->GetArena();
+    if (message_arena != submessage_arena) {
+      array_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, array_value, submessage_arena);
+    }
+    set_has_array_value();
+    _impl_.value_.array_value_ = array_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.array_value)
+}
+void StackValue::set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE record_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (record_value) {
+    ::google::protobuf::Arena* submessage_arena = record_value->GetArena();
+    if (message_arena != submessage_arena) {
+      record_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, record_value, submessage_arena);
+    }
+    set_has_record_value();
+    _impl_.value_.record_value_ = record_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.record_value)
+}
+void StackValue::set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE instant_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (instant_value) {
+    ::google::protobuf::Arena* submessage_arena = instant_value->GetArena();
+    if (message_arena != submessage_arena) {
+      instant_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, instant_value, submessage_arena);
+    }
+    set_has_instant_value();
+    _impl_.value_.instant_value_ = instant_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.instant_value)
+}
+void StackValue::set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE plain_date_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (plain_date_value) {
+    ::google::protobuf::Arena* submessage_arena = plain_date_value->GetArena();
+    if (message_arena != submessage_arena) {
+      plain_date_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, plain_date_value, submessage_arena);
+    }
+    set_has_plain_date_value();
+    _impl_.value_.plain_date_value_ = plain_date_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.plain_date_value)
+}
+void StackValue::set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE zoned_datetime_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (zoned_datetime_value) {
+    ::google::protobuf::Arena* submessage_arena = zoned_datetime_value->GetArena();
+    if (message_arena != submessage_arena) {
+      zoned_datetime_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, zoned_datetime_value, submessage_arena);
+    }
+    set_has_zoned_datetime_value();
+    _impl_.value_.zoned_datetime_value_ = zoned_datetime_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.zoned_datetime_value)
+}
+void StackValue::set_allocated_remote_ref_value(::forthic::RemoteRefValue* PROTOBUF_NULLABLE remote_ref_value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_value();
+  if (remote_ref_value) {
+    ::google::protobuf::Arena* submessage_arena = remote_ref_value->GetArena();
+    if (message_arena != submessage_arena) {
+      remote_ref_value = ::google::protobuf::internal::GetOwnedMessage(message_arena, remote_ref_value, submessage_arena);
+    }
+    set_has_remote_ref_value();
+    _impl_.value_.remote_ref_value_ = remote_ref_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.remote_ref_value)
+}
+StackValue::StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StackValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.StackValue)
+}
+PROTOBUF_NDEBUG_INLINE StackValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::StackValue& from_msg)
+      : value_{},
+        _cached_size_{0},
+        _oneof_case_{from._oneof_case_[0]} {}
+
+StackValue::StackValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const StackValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StackValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  StackValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  switch (value_case()) {
+    case VALUE_NOT_SET:
+      break;
+      case kIntValue:
+        _impl_.value_.int_value_ = from._impl_.value_.int_value_;
+        break;
+      case kStringValue:
+        new (&_impl_.value_.string_value_) decltype(_impl_.value_.string_value_){arena, from._impl_.value_.string_value_};
+        break;
+      case kBoolValue:
+        _impl_.value_.bool_value_ = from._impl_.value_.bool_value_;
+        break;
+      case kFloatValue:
+        _impl_.value_.float_value_ = from._impl_.value_.float_value_;
+        break;
+      case kNullValue:
+        _impl_.value_.null_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.null_value_);
+        break;
+      case kArrayValue:
+        _impl_.value_.array_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.array_value_);
+        break;
+      case kRecordValue:
+        _impl_.value_.record_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.record_value_);
+        break;
+      case kInstantValue:
+        _impl_.value_.instant_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.instant_value_);
+        break;
+      case kPlainDateValue:
+        _impl_.value_.plain_date_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.plain_date_value_);
+        break;
+      case kZonedDatetimeValue:
+        _impl_.value_.zoned_datetime_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.zoned_datetime_value_);
+        break;
+      case kRemoteRefValue:
+        _impl_.value_.remote_ref_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.remote_ref_value_);
+        break;
+  }
+
+  // @@protoc_insertion_point(copy_constructor:forthic.StackValue)
+}
+PROTOBUF_NDEBUG_INLINE StackValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : value_{},
+        _cached_size_{0},
+        _oneof_case_{} {}
+
+inline void StackValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+StackValue::~StackValue() {
+  // @@protoc_insertion_point(destructor:forthic.StackValue)
+  SharedDtor(*this);
+}
+inline void StackValue::SharedDtor(MessageLite& self) {
+  StackValue& this_ = static_cast<StackValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  if (this_.has_value()) {
+    this_.clear_value();
+  }
+  this_._impl_.~Impl_();
+}
+
+void StackValue::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:forthic.StackValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  switch (value_case()) {
+    case kIntValue: {
+      // No need to clear
+      break;
+    }
+    case kStringValue: {
+      _impl_.value_.string_value_.Destroy();
+      break;
+    }
+    case kBoolValue: {
+      // No need to clear
+      break;
+    }
+    case kFloatValue: {
+      // No need to clear
+      break;
+    }
+    case kNullValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.null_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.null_value_);
+      }
+      break;
+    }
+    case kArrayValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.array_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.array_value_);
+      }
+      break;
+    }
+    case kRecordValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.record_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.record_value_);
+      }
+      break;
+    }
+    case kInstantValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.instant_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.instant_value_);
+      }
+      break;
+    }
+    case kPlainDateValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.plain_date_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.plain_date_value_);
+      }
+      break;
+    }
+    case kZonedDatetimeValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.zoned_datetime_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.zoned_datetime_value_);
+      }
+      break;
+    }
+    case kRemoteRefValue: {
+      if (GetArena() == nullptr) {
+        delete _impl_.value_.remote_ref_value_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.remote_ref_value_);
+      }
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+inline void* PROTOBUF_NONNULL StackValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) StackValue(arena);
+}
+constexpr auto StackValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(StackValue),
+                                            alignof(StackValue));
+}
+constexpr auto StackValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_StackValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &StackValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<StackValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &StackValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<StackValue>(), &StackValue::ByteSizeLong,
+              &StackValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(StackValue, _impl_._cached_size_),
+          false,
+      },
+      &StackValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull StackValue_class_data_ =
+        StackValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+StackValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&StackValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(StackValue_class_data_.tc_table);
+  return StackValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 11, 7, 47, 2>
+StackValue::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    11, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294965248,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    11,  // num_field_entries
+    7,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    StackValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::StackValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int64 int_value = 1;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.int_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kInt64)},
+    // string string_value = 2;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.string_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bool bool_value = 3;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.bool_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kBool)},
+    // double float_value = 4;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.float_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kDouble)},
+    // .forthic.NullValue null_value = 5;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.null_value_), _Internal::kOneofCaseOffset + 0, 0, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ArrayValue array_value = 6;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.array_value_), _Internal::kOneofCaseOffset + 0, 1, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.RecordValue record_value = 7;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.record_value_), _Internal::kOneofCaseOffset + 0, 2, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.InstantValue instant_value = 8;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.instant_value_), _Internal::kOneofCaseOffset + 0, 3, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.PlainDateValue plain_date_value = 9;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.plain_date_value_), _Internal::kOneofCaseOffset + 0, 4, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.zoned_datetime_value_), _Internal::kOneofCaseOffset + 0, 5, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .forthic.RemoteRefValue remote_ref_value = 11;
+    {PROTOBUF_FIELD_OFFSET(StackValue, _impl_.value_.remote_ref_value_), _Internal::kOneofCaseOffset + 0, 6, (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::NullValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ArrayValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::RecordValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::InstantValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::PlainDateValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ZonedDateTimeValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::RemoteRefValue>()},
+  }},
+  {{
+    "\22\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "forthic.StackValue"
+    "string_value"
+  }},
+};
+PROTOBUF_NOINLINE void StackValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.StackValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_value();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL StackValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const StackValue& this_ = static_cast<const StackValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL StackValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const StackValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.StackValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  switch (this_.value_case()) {
+    case kIntValue: {
+      target =
+          ::google::protobuf::internal::WireFormatLite::WriteInt64ToArrayWithField<1>(
+              stream, this_._internal_int_value(), target);
+      break;
+    }
+    case kStringValue: {
+      const ::std::string& _s = this_._internal_string_value();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.StackValue.string_value");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+      break;
+    }
+    case kBoolValue: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          3, this_._internal_bool_value(), target);
+      break;
+    }
+    case kFloatValue: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
+          4, this_._internal_float_value(), target);
+      break;
+    }
+    case kNullValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          5, *this_._impl_.value_.null_value_, this_._impl_.value_.null_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kArrayValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          6, *this_._impl_.value_.array_value_, this_._impl_.value_.array_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kRecordValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          7, *this_._impl_.value_.record_value_, this_._impl_.value_.record_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kInstantValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          8, *this_._impl_.value_.instant_value_, this_._impl_.value_.instant_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kPlainDateValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          9, *this_._impl_.value_.plain_date_value_, this_._impl_.value_.plain_date_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kZonedDatetimeValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          10, *this_._impl_.value_.zoned_datetime_value_, this_._impl_.value_.zoned_datetime_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kRemoteRefValue: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          11, *this_._impl_.value_.remote_ref_value_, this_._impl_.value_.remote_ref_value_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    default:
+      break;
+  }
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.StackValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t StackValue::ByteSizeLong(const MessageLite& base) {
+  const StackValue& this_ = static_cast<const StackValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t StackValue::ByteSizeLong() const {
+  const StackValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.StackValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  switch (this_.value_case()) {
+    // int64 int_value = 1;
+    case kIntValue: {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+          this_._internal_int_value());
+      break;
+    }
+    // string string_value = 2;
+    case kStringValue: {
+      total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                      this_._internal_string_value());
+      break;
+    }
+    // bool bool_value = 3;
+    case kBoolValue: {
+      total_size += 2;
+      break;
+    }
+    // double float_value = 4;
+    case kFloatValue: {
+      total_size += 9;
+      break;
+    }
+    // .forthic.NullValue null_value = 5;
+    case kNullValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.null_value_);
+      break;
+    }
+    // .forthic.ArrayValue array_value = 6;
+    case kArrayValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.array_value_);
+      break;
+    }
+    // .forthic.RecordValue record_value = 7;
+    case kRecordValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.record_value_);
+      break;
+    }
+    // .forthic.InstantValue instant_value = 8;
+    case kInstantValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.instant_value_);
+      break;
+    }
+    // .forthic.PlainDateValue plain_date_value = 9;
+    case kPlainDateValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.plain_date_value_);
+      break;
+    }
+    // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
+    case kZonedDatetimeValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.zoned_datetime_value_);
+      break;
+    }
+    // .forthic.RemoteRefValue remote_ref_value = 11;
+    case kRemoteRefValue: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_.remote_ref_value_);
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void StackValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<StackValue*>(&to_msg);
+  auto& from = static_cast<const StackValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.StackValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  if (const uint32_t oneof_from_case =
+          from._impl_._oneof_case_[0]) {
+    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
+    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
+    if (oneof_needs_init) {
+      if (oneof_to_case != 0) {
+        _this->clear_value();
+      }
+      _this->_impl_._oneof_case_[0] = oneof_from_case;
+    }
+
+    switch (oneof_from_case) {
+      case kIntValue: {
+        _this->_impl_.value_.int_value_ = from._impl_.value_.int_value_;
+        break;
+      }
+      case kStringValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.string_value_.InitDefault();
+        }
+        _this->_impl_.value_.string_value_.Set(from._internal_string_value(), arena);
+        break;
+      }
+      case kBoolValue: {
+        _this->_impl_.value_.bool_value_ = from._impl_.value_.bool_value_;
+        break;
+      }
+      case kFloatValue: {
+        _this->_impl_.value_.float_value_ = from._impl_.value_.float_value_;
+        break;
+      }
+      case kNullValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.null_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.null_value_);
+        } else {
+          _this->_impl_.value_.null_value_->MergeFrom(*from._impl_.value_.null_value_);
+        }
+        break;
+      }
+      case kArrayValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.array_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.array_value_);
+        } else {
+          _this->_impl_.value_.array_value_->MergeFrom(*from._impl_.value_.array_value_);
+        }
+        break;
+      }
+      case kRecordValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.record_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.record_value_);
+        } else {
+          _this->_impl_.value_.record_value_->MergeFrom(*from._impl_.value_.record_value_);
+        }
+        break;
+      }
+      case kInstantValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.instant_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.instant_value_);
+        } else {
+          _this->_impl_.value_.instant_value_->MergeFrom(*from._impl_.value_.instant_value_);
+        }
+        break;
+      }
+      case kPlainDateValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.plain_date_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.plain_date_value_);
+        } else {
+          _this->_impl_.value_.plain_date_value_->MergeFrom(*from._impl_.value_.plain_date_value_);
+        }
+        break;
+      }
+      case kZonedDatetimeValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.zoned_datetime_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.zoned_datetime_value_);
+        } else {
+          _this->_impl_.value_.zoned_datetime_value_->MergeFrom(*from._impl_.value_.zoned_datetime_value_);
+        }
+        break;
+      }
+      case kRemoteRefValue: {
+        if (oneof_needs_init) {
+          _this->_impl_.value_.remote_ref_value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_.remote_ref_value_);
+        } else {
+          _this->_impl_.value_.remote_ref_value_->MergeFrom(*from._impl_.value_.remote_ref_value_);
+        }
+        break;
+      }
+      case VALUE_NOT_SET:
+        break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void StackValue::CopyFrom(const StackValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.StackValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void StackValue::InternalSwap(StackValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::google::protobuf::Metadata StackValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class NullValue::_Internal {
+ public:
+};
+
+NullValue::NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena, NullValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(arena_constructor:forthic.NullValue)
+}
+NullValue::NullValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const NullValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena, NullValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  NullValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:forthic.NullValue)
+}
+
+inline void* PROTOBUF_NONNULL NullValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) NullValue(arena);
+}
+constexpr auto NullValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(NullValue),
+                                            alignof(NullValue));
+}
+constexpr auto NullValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_NullValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &NullValue::MergeImpl,
+          ::google::protobuf::internal::ZeroFieldsBase::GetNewImpl<NullValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &NullValue::SharedDtor,
+          ::google::protobuf::internal::ZeroFieldsBase::GetClearImpl<NullValue>(), &NullValue::ByteSizeLong,
+              &NullValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(NullValue, _impl_._cached_size_),
+          false,
+      },
+      &NullValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull NullValue_class_data_ =
+        NullValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+NullValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&NullValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(NullValue_class_data_.tc_table);
+  return NullValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 0, 0, 0, 2>
+NullValue::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    0, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_names),  // no field_entries
+    0,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    NullValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::NullValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, // no field_entries, or aux_entries
+  {{
+  }},
+};
+
+
+
+
+
+
+
+::google::protobuf::Metadata NullValue::GetMetadata() const {
+  return ::google::protobuf::internal::ZeroFieldsBase::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ArrayValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ArrayValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._has_bits_);
+};
+
+ArrayValue::ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ArrayValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.ArrayValue)
+}
+PROTOBUF_NDEBUG_INLINE ArrayValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::ArrayValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        items_{visibility, arena, from.items_} {}
+
+ArrayValue::ArrayValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ArrayValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ArrayValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ArrayValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:forthic.ArrayValue)
+}
+PROTOBUF_NDEBUG_INLINE ArrayValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        items_{visibility, arena} {}
+
+inline void ArrayValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ArrayValue::~ArrayValue() {
+  // @@protoc_insertion_point(destructor:forthic.ArrayValue)
+  SharedDtor(*this);
+}
+inline void ArrayValue::SharedDtor(MessageLite& self) {
+  ArrayValue& this_ = static_cast<ArrayValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ArrayValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ArrayValue(arena);
+}
+constexpr auto ArrayValue::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_) +
+          decltype(ArrayValue::_impl_.items_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(ArrayValue), alignof(ArrayValue), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ArrayValue::PlacementNew_,
+                                 sizeof(ArrayValue),
+                                 alignof(ArrayValue));
+  }
+}
+constexpr auto ArrayValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ArrayValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ArrayValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ArrayValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ArrayValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ArrayValue>(), &ArrayValue::ByteSizeLong,
+              &ArrayValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._cached_size_),
+          false,
+      },
+      &ArrayValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ArrayValue_class_data_ =
+        ArrayValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ArrayValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ArrayValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ArrayValue_class_data_.tc_table);
+  return ArrayValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+ArrayValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    ArrayValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::ArrayValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .forthic.StackValue items = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .forthic.StackValue items = 1;
+    {PROTOBUF_FIELD_OFFSET(ArrayValue, _impl_.items_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void ArrayValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ArrayValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.items_.Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL ArrayValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const ArrayValue& this_ = static_cast<const ArrayValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL ArrayValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const ArrayValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ArrayValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // repeated .forthic.StackValue items = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (unsigned i = 0, n = static_cast<unsigned>(
+                             this_._internal_items_size());
+         i < n; i++) {
+      const auto& repfield = this_._internal_items().Get(i);
+      target =
+          ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+              1, repfield, repfield.GetCachedSize(),
+              target, stream);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ArrayValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t ArrayValue::ByteSizeLong(const MessageLite& base) {
+  const ArrayValue& this_ = static_cast<const ArrayValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t ArrayValue::ByteSizeLong() const {
+  const ArrayValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ArrayValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // repeated .forthic.StackValue items = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size += 1UL * this_._internal_items_size();
+      for (const auto& msg : this_._internal_items()) {
+        total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void ArrayValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<ArrayValue*>(&to_msg);
+  auto& from = static_cast<const ArrayValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ArrayValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_internal_mutable_items()->InternalMergeFromWithArena(
+        ::google::protobuf::MessageLite::internal_visibility(), arena,
+        from._internal_items());
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void ArrayValue::CopyFrom(const ArrayValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ArrayValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ArrayValue::InternalSwap(ArrayValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.items_.InternalSwap(&other->_impl_.items_);
+}
+
+::google::protobuf::Metadata ArrayValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse()
+    : SuperType(RecordValue_FieldsEntry_DoNotUse_class_data_.base()) {}
+RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+    : SuperType(arena, RecordValue_FieldsEntry_DoNotUse_class_data_.base()) {}
+#else   // PROTOBUF_CUSTOM_VTABLE
+RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse() : SuperType() {}
+RecordValue_FieldsEntry_DoNotUse::RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena) : SuperType(arena) {}
+#endif  // PROTOBUF_CUSTOM_VTABLE
+inline void* PROTOBUF_NONNULL RecordValue_FieldsEntry_DoNotUse::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) RecordValue_FieldsEntry_DoNotUse(arena);
+}
+constexpr auto RecordValue_FieldsEntry_DoNotUse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RecordValue_FieldsEntry_DoNotUse),
+                                            alignof(RecordValue_FieldsEntry_DoNotUse));
+}
+constexpr auto RecordValue_FieldsEntry_DoNotUse::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_RecordValue_FieldsEntry_DoNotUse_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &RecordValue_FieldsEntry_DoNotUse::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<RecordValue_FieldsEntry_DoNotUse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &RecordValue_FieldsEntry_DoNotUse::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&RecordValue_FieldsEntry_DoNotUse::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_._cached_size_),
+          false,
+      },
+      &RecordValue_FieldsEntry_DoNotUse::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull RecordValue_FieldsEntry_DoNotUse_class_data_ =
+        RecordValue_FieldsEntry_DoNotUse::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+RecordValue_FieldsEntry_DoNotUse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&RecordValue_FieldsEntry_DoNotUse_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(RecordValue_FieldsEntry_DoNotUse_class_data_.tc_table);
+  return RecordValue_FieldsEntry_DoNotUse_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 43, 2>
+RecordValue_FieldsEntry_DoNotUse::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    RecordValue_FieldsEntry_DoNotUse_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::DiscardEverythingFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::RecordValue_FieldsEntry_DoNotUse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // .forthic.StackValue value = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.value_)}},
+    // string key = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string key = 1;
+    {PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.key_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .forthic.StackValue value = 2;
+    {PROTOBUF_FIELD_OFFSET(RecordValue_FieldsEntry_DoNotUse, _impl_.value_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+  }},
+  {{
+    "\37\3\0\0\0\0\0\0"
+    "forthic.RecordValue.FieldsEntry"
+    "key"
+  }},
+};
+// ===================================================================
+
+class RecordValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<RecordValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._has_bits_);
+};
+
+RecordValue::RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, RecordValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.RecordValue)
+}
+PROTOBUF_NDEBUG_INLINE RecordValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::RecordValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        fields_{visibility, arena, from.fields_} {}
+
+RecordValue::RecordValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const RecordValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, RecordValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RecordValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:forthic.RecordValue)
+}
+PROTOBUF_NDEBUG_INLINE RecordValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        fields_{visibility, arena} {}
+
+inline void RecordValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RecordValue::~RecordValue() {
+  // @@protoc_insertion_point(destructor:forthic.RecordValue)
+  SharedDtor(*this);
+}
+inline void RecordValue::SharedDtor(MessageLite& self) {
+  RecordValue& this_ = static_cast<RecordValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL RecordValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) RecordValue(arena);
+}
+constexpr auto RecordValue::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(RecordValue, _impl_.fields_) +
+          decltype(RecordValue::_impl_.fields_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::CopyInit(
+        sizeof(RecordValue), alignof(RecordValue), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&RecordValue::PlacementNew_,
+                                 sizeof(RecordValue),
+                                 alignof(RecordValue));
+  }
+}
+constexpr auto RecordValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_RecordValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &RecordValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<RecordValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &RecordValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<RecordValue>(), &RecordValue::ByteSizeLong,
+              &RecordValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._cached_size_),
+          false,
+      },
+      &RecordValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull RecordValue_class_data_ =
+        RecordValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+RecordValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&RecordValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(RecordValue_class_data_.tc_table);
+  return RecordValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 2, 34, 2>
+RecordValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    RecordValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::RecordValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // map<string, .forthic.StackValue> fields = 1;
+    {PROTOBUF_FIELD_OFFSET(RecordValue, _impl_.fields_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
+  }},
+  {{
+      {::_pbi::TcParser::GetMapAuxInfo(
+          1, 0, 9, 11, 0)},
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+  }},
+  {{
+    "\23\6\0\0\0\0\0\0"
+    "forthic.RecordValue"
+    "fields"
+  }},
+};
+PROTOBUF_NOINLINE void RecordValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.RecordValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.fields_.Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL RecordValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const RecordValue& this_ = static_cast<const RecordValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL RecordValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const RecordValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.RecordValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // map<string, .forthic.StackValue> fields = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_fields().empty()) {
+      using MapType = ::google::protobuf::Map<::std::string, ::forthic::StackValue>;
+      using WireHelper = _pbi::MapEntryFuncs<::std::string, ::forthic::StackValue,
+                                     _pbi::WireFormatLite::TYPE_STRING,
+                                     _pbi::WireFormatLite::TYPE_MESSAGE>;
+      const auto& field = this_._internal_fields();
+
+      if (stream->IsSerializationDeterministic() && field.size() > 1) {
+        for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
+          target = WireHelper::InternalSerialize(
+              1, entry.first, entry.second, target, stream);
+          ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+              entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RecordValue.fields");
+        }
+      } else {
+        for (const auto& entry : field) {
+          target = WireHelper::InternalSerialize(
+              1, entry.first, entry.second, target, stream);
+          ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+              entry.first.data(), static_cast<int>(entry.first.length()),
+ ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RecordValue.fields");
+        }
+      }
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.RecordValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t RecordValue::ByteSizeLong(const MessageLite& base) {
+  const RecordValue& this_ = static_cast<const RecordValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t RecordValue::ByteSizeLong() const {
+  const RecordValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.RecordValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // map<string, .forthic.StackValue> fields = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size +=
+          1 * ::google::protobuf::internal::FromIntSize(this_._internal_fields_size());
+      for (const auto& entry : this_._internal_fields()) {
+        total_size += _pbi::MapEntryFuncs<::std::string, ::forthic::StackValue,
+                                       _pbi::WireFormatLite::TYPE_STRING,
+                                       _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void RecordValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<RecordValue*>(&to_msg);
+  auto& from = static_cast<const RecordValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.RecordValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_impl_.fields_.MergeFrom(from._impl_.fields_);
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void RecordValue::CopyFrom(const RecordValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.RecordValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RecordValue::InternalSwap(RecordValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.fields_.InternalSwap(&other->_impl_.fields_);
+}
+
+::google::protobuf::Metadata RecordValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class InstantValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<InstantValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._has_bits_);
+};
+
+InstantValue::InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, InstantValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.InstantValue)
+}
+PROTOBUF_NDEBUG_INLINE InstantValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::InstantValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        iso8601_(arena, from.iso8601_) {}
+
+InstantValue::InstantValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const InstantValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, InstantValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  InstantValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.epoch_nanos_ = from._impl_.epoch_nanos_;
+
+  // @@protoc_insertion_point(copy_constructor:forthic.InstantValue)
+}
+PROTOBUF_NDEBUG_INLINE InstantValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        iso8601_(arena) {}
+
+inline void InstantValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.epoch_nanos_ = {};
+}
+InstantValue::~InstantValue() {
+  // @@protoc_insertion_point(destructor:forthic.InstantValue)
+  SharedDtor(*this);
+}
+inline void InstantValue::SharedDtor(MessageLite& self) {
+  InstantValue& this_ = static_cast<InstantValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.iso8601_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL InstantValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) InstantValue(arena);
+}
+constexpr auto InstantValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(InstantValue),
+                                            alignof(InstantValue));
+}
+constexpr auto InstantValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_InstantValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &InstantValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<InstantValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &InstantValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<InstantValue>(), &InstantValue::ByteSizeLong,
+              &InstantValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._cached_size_),
+          false,
+      },
+      &InstantValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull InstantValue_class_data_ =
+        InstantValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+InstantValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&InstantValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(InstantValue_class_data_.tc_table);
+  return InstantValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 36, 2>
+InstantValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    InstantValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::InstantValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // optional int64 epoch_nanos = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(InstantValue, _impl_.epoch_nanos_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.epoch_nanos_)}},
+    // string iso8601 = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.iso8601_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string iso8601 = 1;
+    {PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.iso8601_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // optional int64 epoch_nanos = 2;
+    {PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.epoch_nanos_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\24\7\0\0\0\0\0\0"
+    "forthic.InstantValue"
+    "iso8601"
+  }},
+};
+PROTOBUF_NOINLINE void InstantValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.InstantValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    _impl_.iso8601_.ClearNonDefaultToEmpty();
+  }
+  _impl_.epoch_nanos_ = ::int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL InstantValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const InstantValue& this_ = static_cast<const InstantValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL InstantValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const InstantValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.InstantValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string iso8601 = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_iso8601().empty()) {
+      const ::std::string& _s = this_._internal_iso8601();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.InstantValue.iso8601");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // optional int64 epoch_nanos = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    target =
+        ::google::protobuf::internal::WireFormatLite::WriteInt64ToArrayWithField<2>(
+            stream, this_._internal_epoch_nanos(), target);
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.InstantValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t InstantValue::ByteSizeLong(const MessageLite& base) {
+  const InstantValue& this_ = static_cast<const InstantValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t InstantValue::ByteSizeLong() const {
+  const InstantValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.InstantValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // string iso8601 = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_iso8601().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_iso8601());
+      }
+    }
+    // optional int64 epoch_nanos = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+          this_._internal_epoch_nanos());
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void InstantValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<InstantValue*>(&to_msg);
+  auto& from = static_cast<const InstantValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.InstantValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_iso8601().empty()) {
+        _this->_internal_set_iso8601(from._internal_iso8601());
+      } else {
+        if (_this->_impl_.iso8601_.IsDefault()) {
+          _this->_internal_set_iso8601("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _this->_impl_.epoch_nanos_ = from._impl_.epoch_nanos_;
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void InstantValue::CopyFrom(const InstantValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.InstantValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void InstantValue::InternalSwap(InstantValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_, &other->_impl_.iso8601_, arena);
+  swap(_impl_.epoch_nanos_, other->_impl_.epoch_nanos_);
+}
+
+::google::protobuf::Metadata InstantValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class PlainDateValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<PlainDateValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._has_bits_);
+};
+
+PlainDateValue::PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, PlainDateValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.PlainDateValue)
+}
+PROTOBUF_NDEBUG_INLINE PlainDateValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::PlainDateValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        iso8601_date_(arena, from.iso8601_date_) {}
+
+PlainDateValue::PlainDateValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const PlainDateValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, PlainDateValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  PlainDateValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.days_since_epoch_ = from._impl_.days_since_epoch_;
+
+  // @@protoc_insertion_point(copy_constructor:forthic.PlainDateValue)
+}
+PROTOBUF_NDEBUG_INLINE PlainDateValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        iso8601_date_(arena) {}
+
+inline void PlainDateValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.days_since_epoch_ = {};
+}
+PlainDateValue::~PlainDateValue() {
+  // @@protoc_insertion_point(destructor:forthic.PlainDateValue)
+  SharedDtor(*this);
+}
+inline void PlainDateValue::SharedDtor(MessageLite& self) {
+  PlainDateValue& this_ = static_cast<PlainDateValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.iso8601_date_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL PlainDateValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) PlainDateValue(arena);
+}
+constexpr auto PlainDateValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(PlainDateValue),
+                                            alignof(PlainDateValue));
+}
+constexpr auto PlainDateValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_PlainDateValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &PlainDateValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<PlainDateValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &PlainDateValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<PlainDateValue>(), &PlainDateValue::ByteSizeLong,
+              &PlainDateValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._cached_size_),
+          false,
+      },
+      &PlainDateValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull PlainDateValue_class_data_ =
+        PlainDateValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+PlainDateValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&PlainDateValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(PlainDateValue_class_data_.tc_table);
+  return PlainDateValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 43, 2>
+PlainDateValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    PlainDateValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::PlainDateValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // optional int32 days_since_epoch = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PlainDateValue, _impl_.days_since_epoch_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.days_since_epoch_)}},
+    // string iso8601_date = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.iso8601_date_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string iso8601_date = 1;
+    {PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.iso8601_date_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // optional int32 days_since_epoch = 2;
+    {PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.days_since_epoch_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\26\14\0\0\0\0\0\0"
+    "forthic.PlainDateValue"
+    "iso8601_date"
+  }},
+};
+PROTOBUF_NOINLINE void PlainDateValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.PlainDateValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    _impl_.iso8601_date_.ClearNonDefaultToEmpty();
+  }
+  _impl_.days_since_epoch_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL PlainDateValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const PlainDateValue& this_ = static_cast<const PlainDateValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL PlainDateValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const PlainDateValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.PlainDateValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string iso8601_date = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_iso8601_date().empty()) {
+      const ::std::string& _s = this_._internal_iso8601_date();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.PlainDateValue.iso8601_date");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // optional int32 days_since_epoch = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    target =
+        ::google::protobuf::internal::WireFormatLite::WriteInt32ToArrayWithField<2>(
+            stream, this_._internal_days_since_epoch(), target);
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.PlainDateValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t PlainDateValue::ByteSizeLong(const MessageLite& base) {
+  const PlainDateValue& this_ = static_cast<const PlainDateValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t PlainDateValue::ByteSizeLong() const {
+  const PlainDateValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.PlainDateValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // string iso8601_date = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_iso8601_date().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_iso8601_date());
+      }
+    }
+    // optional int32 days_since_epoch = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+          this_._internal_days_since_epoch());
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void PlainDateValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<PlainDateValue*>(&to_msg);
+  auto& from = static_cast<const PlainDateValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.PlainDateValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_iso8601_date().empty()) {
+        _this->_internal_set_iso8601_date(from._internal_iso8601_date());
+      } else {
+        if (_this->_impl_.iso8601_date_.IsDefault()) {
+          _this->_internal_set_iso8601_date("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _this->_impl_.days_since_epoch_ = from._impl_.days_since_epoch_;
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void PlainDateValue::CopyFrom(const PlainDateValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.PlainDateValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void PlainDateValue::InternalSwap(PlainDateValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_date_, &other->_impl_.iso8601_date_, arena);
+  swap(_impl_.days_since_epoch_, other->_impl_.days_since_epoch_);
+}
+
+::google::protobuf::Metadata PlainDateValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ZonedDateTimeValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ZonedDateTimeValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._has_bits_);
+};
+
+ZonedDateTimeValue::ZonedDateTimeValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ZonedDateTimeValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.ZonedDateTimeValue)
+}
+PROTOBUF_NDEBUG_INLINE ZonedDateTimeValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::ZonedDateTimeValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        iso8601_(arena, from.iso8601_),
+        timezone_(arena, from.timezone_) {}
+
+ZonedDateTimeValue::ZonedDateTimeValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ZonedDateTimeValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ZonedDateTimeValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ZonedDateTimeValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.epoch_nanos_ = from._impl_.epoch_nanos_;
+
+  // @@protoc_insertion_point(copy_constructor:forthic.ZonedDateTimeValue)
+}
+PROTOBUF_NDEBUG_INLINE ZonedDateTimeValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        iso8601_(arena),
+        timezone_(arena) {}
+
+inline void ZonedDateTimeValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.epoch_nanos_ = {};
+}
+ZonedDateTimeValue::~ZonedDateTimeValue() {
+  // @@protoc_insertion_point(destructor:forthic.ZonedDateTimeValue)
+  SharedDtor(*this);
+}
+inline void ZonedDateTimeValue::SharedDtor(MessageLite& self) {
+  ZonedDateTimeValue& this_ = static_cast<ZonedDateTimeValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.iso8601_.Destroy();
+  this_._impl_.timezone_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ZonedDateTimeValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ZonedDateTimeValue(arena);
+}
+constexpr auto ZonedDateTimeValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ZonedDateTimeValue),
+                                            alignof(ZonedDateTimeValue));
+}
+constexpr auto ZonedDateTimeValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ZonedDateTimeValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ZonedDateTimeValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ZonedDateTimeValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ZonedDateTimeValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ZonedDateTimeValue>(), &ZonedDateTimeValue::ByteSizeLong,
+              &ZonedDateTimeValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._cached_size_),
+          false,
+      },
+      &ZonedDateTimeValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ZonedDateTimeValue_class_data_ =
+        ZonedDateTimeValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ZonedDateTimeValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ZonedDateTimeValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ZonedDateTimeValue_class_data_.tc_table);
+  return ZonedDateTimeValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 50, 2>
+ZonedDateTimeValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    ZonedDateTimeValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::ZonedDateTimeValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string iso8601 = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.iso8601_)}},
+    // string timezone = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.timezone_)}},
+    // optional int64 epoch_nanos = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ZonedDateTimeValue, _impl_.epoch_nanos_), 2>(),
+     {24, 2, 0,
+      PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.epoch_nanos_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string iso8601 = 1;
+    {PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.iso8601_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string timezone = 2;
+    {PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.timezone_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // optional int64 epoch_nanos = 3;
+    {PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.epoch_nanos_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\32\7\10\0\0\0\0\0"
+    "forthic.ZonedDateTimeValue"
+    "iso8601"
+    "timezone"
+  }},
+};
+PROTOBUF_NOINLINE void ZonedDateTimeValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ZonedDateTimeValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      _impl_.iso8601_.ClearNonDefaultToEmpty();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _impl_.timezone_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.epoch_nanos_ = ::int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL ZonedDateTimeValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const ZonedDateTimeValue& this_ = static_cast<const ZonedDateTimeValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL ZonedDateTimeValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const ZonedDateTimeValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ZonedDateTimeValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string iso8601 = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_iso8601().empty()) {
+      const ::std::string& _s = this_._internal_iso8601();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ZonedDateTimeValue.iso8601");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // string timezone = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (!this_._internal_timezone().empty()) {
+      const ::std::string& _s = this_._internal_timezone();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ZonedDateTimeValue.timezone");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+    }
+  }
+
+  // optional int64 epoch_nanos = 3;
+  if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+    target =
+        ::google::protobuf::internal::WireFormatLite::WriteInt64ToArrayWithField<3>(
+            stream, this_._internal_epoch_nanos(), target);
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ZonedDateTimeValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t ZonedDateTimeValue::ByteSizeLong(const MessageLite& base) {
+  const ZonedDateTimeValue& this_ = static_cast<const ZonedDateTimeValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t ZonedDateTimeValue::ByteSizeLong() const {
+  const ZonedDateTimeValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ZonedDateTimeValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    // string iso8601 = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_iso8601().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_iso8601());
+      }
+    }
+    // string timezone = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!this_._internal_timezone().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_timezone());
+      }
+    }
+    // optional int64 epoch_nanos = 3;
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+          this_._internal_epoch_nanos());
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void ZonedDateTimeValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<ZonedDateTimeValue*>(&to_msg);
+  auto& from = static_cast<const ZonedDateTimeValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ZonedDateTimeValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_iso8601().empty()) {
+        _this->_internal_set_iso8601(from._internal_iso8601());
+      } else {
+        if (_this->_impl_.iso8601_.IsDefault()) {
+          _this->_internal_set_iso8601("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!from._internal_timezone().empty()) {
+        _this->_internal_set_timezone(from._internal_timezone());
+      } else {
+        if (_this->_impl_.timezone_.IsDefault()) {
+          _this->_internal_set_timezone("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000004U)) {
+      _this->_impl_.epoch_nanos_ = from._impl_.epoch_nanos_;
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void ZonedDateTimeValue::CopyFrom(const ZonedDateTimeValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ZonedDateTimeValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ZonedDateTimeValue::InternalSwap(ZonedDateTimeValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_, &other->_impl_.iso8601_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.timezone_, &other->_impl_.timezone_, arena);
+  swap(_impl_.epoch_nanos_, other->_impl_.epoch_nanos_);
+}
+
+::google::protobuf::Metadata ZonedDateTimeValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RemoteRefValue::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<RemoteRefValue>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_._has_bits_);
+};
+
+RemoteRefValue::RemoteRefValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, RemoteRefValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:forthic.RemoteRefValue)
+}
+PROTOBUF_NDEBUG_INLINE RemoteRefValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::forthic::RemoteRefValue& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        handle_id_(arena, from.handle_id_),
+        runtime_(arena, from.runtime_) {}
+
+RemoteRefValue::RemoteRefValue(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const RemoteRefValue& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, RemoteRefValue_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RemoteRefValue* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:forthic.RemoteRefValue)
+}
+PROTOBUF_NDEBUG_INLINE RemoteRefValue::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        handle_id_(arena),
+        runtime_(arena) {}
+
+inline void RemoteRefValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RemoteRefValue::~RemoteRefValue() {
+  // @@protoc_insertion_point(destructor:forthic.RemoteRefValue)
+  SharedDtor(*this);
+}
+inline void RemoteRefValue::SharedDtor(MessageLite& self) {
+  RemoteRefValue& this_ = static_cast<RemoteRefValue&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.handle_id_.Destroy();
+  this_._impl_.runtime_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL RemoteRefValue::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) RemoteRefValue(arena);
+}
+constexpr auto RemoteRefValue::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RemoteRefValue),
+                                            alignof(RemoteRefValue));
+}
+constexpr auto RemoteRefValue::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_RemoteRefValue_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &RemoteRefValue::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<RemoteRefValue>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &RemoteRefValue::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<RemoteRefValue>(), &RemoteRefValue::ByteSizeLong,
+              &RemoteRefValue::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_._cached_size_),
+          false,
+      },
+      &RemoteRefValue::kDescriptorMethods,
+      &descriptor_table_protos_2fforthic_5fruntime_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull RemoteRefValue_class_data_ =
+        RemoteRefValue::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+RemoteRefValue::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&RemoteRefValue_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(RemoteRefValue_class_data_.tc_table);
+  return RemoteRefValue_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 47, 2>
+RemoteRefValue::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    RemoteRefValue_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::forthic::RemoteRefValue>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string runtime = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_.runtime_)}},
+    // string handle_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_.handle_id_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string handle_id = 1;
+    {PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_.handle_id_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string runtime = 2;
+    {PROTOBUF_FIELD_OFFSET(RemoteRefValue, _impl_.runtime_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\26\11\7\0\0\0\0\0"
+    "forthic.RemoteRefValue"
+    "handle_id"
+    "runtime"
+  }},
+};
+PROTOBUF_NOINLINE void RemoteRefValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.RemoteRefValue)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      _impl_.handle_id_.ClearNonDefaultToEmpty();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _impl_.runtime_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL RemoteRefValue::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const RemoteRefValue& this_ = static_cast<const RemoteRefValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL RemoteRefValue::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const RemoteRefValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.RemoteRefValue)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // string handle_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_handle_id().empty()) {
+      const ::std::string& _s = this_._internal_handle_id();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RemoteRefValue.handle_id");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
+
+  // string runtime = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (!this_._internal_runtime().empty()) {
+      const ::std::string& _s = this_._internal_runtime();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RemoteRefValue.runtime");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.RemoteRefValue)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t RemoteRefValue::ByteSizeLong(const MessageLite& base) {
+  const RemoteRefValue& this_ = static_cast<const RemoteRefValue&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t RemoteRefValue::ByteSizeLong() const {
+  const RemoteRefValue& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:forthic.RemoteRefValue)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // string handle_id = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_handle_id().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_handle_id());
+      }
+    }
+    // string runtime = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!this_._internal_runtime().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_runtime());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void RemoteRefValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+                            const ::google::protobuf::MessageLite& from_msg) {
+   auto* const _this =
+      static_cast<RemoteRefValue*>(&to_msg);
+  auto& from = static_cast<const RemoteRefValue&>(from_msg);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    from.CheckHasBitConsistency();
+  }
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.RemoteRefValue)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_handle_id().empty()) {
+        _this->_internal_set_handle_id(from._internal_handle_id());
+      } else {
+        if (_this->_impl_.handle_id_.IsDefault()) {
+          _this->_internal_set_handle_id("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!from._internal_runtime().empty()) {
+        _this->_internal_set_runtime(from._internal_runtime());
+      } else {
+        if (_this->_impl_.runtime_.IsDefault()) {
+          _this->_internal_set_runtime("");
+        }
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+
+void RemoteRefValue::CopyFrom(const RemoteRefValue& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.RemoteRefValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RemoteRefValue::InternalSwap(RemoteRefValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.handle_id_, &other->_impl_.handle_id_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.runtime_, &other->_impl_.runtime_, arena);
+}
+
+::google::protobuf::Metadata RemoteRefValue::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // ===================================================================
 
-class RecordValue::_Internal {
+class FetchRefRequest::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<RecordValue>()._impl_._has_bits_);
+      decltype(::std::declval<FetchRefRequest>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._has_bits_);
+      8 * PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_._has_bits_);
 };
 
-RecordValue::RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+FetchRefRequest::FetchRefRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, RecordValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, FetchRefRequest_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.RecordValue)
+  // @@protoc_insertion_point(arena_constructor:forthic.FetchRefRequest)
 }
-PROTOBUF_NDEBUG_INLINE RecordValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE FetchRefRequest::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::RecordValue& from_msg)
+    [[maybe_unused]] const ::forthic::FetchRefRequest& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        fields_{visibility, arena, from.fields_} {}
+        handle_id_(arena, from.handle_id_) {}
 
-RecordValue::RecordValue(
+FetchRefRequest::FetchRefRequest(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const RecordValue& from)
+    const FetchRefRequest& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, RecordValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, FetchRefRequest_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  RecordValue* const _this = this;
+  FetchRefRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.accepts_compact_temporal_ = from._impl_.accepts_compact_temporal_;
 
-  // @@protoc_insertion_point(copy_constructor:forthic.RecordValue)
+  // @@protoc_insertion_point(copy_constructor:forthic.FetchRefRequest)
 }
-PROTOBUF_NDEBUG_INLINE RecordValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE FetchRefRequest::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        fields_{visibility, arena} {}
+        handle_id_(arena) {}
 
-inline void RecordValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void FetchRefRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.accepts_compact_temporal_ = {};
 }
-RecordValue::~RecordValue() {
-  // @@protoc_insertion_point(destructor:forthic.RecordValue)
+FetchRefRequest::~FetchRefRequest() {
+  // @@protoc_insertion_point(destructor:forthic.FetchRefRequest)
   SharedDtor(*this);
 }
-inline void RecordValue::SharedDtor(MessageLite& self) {
-  RecordValue& this_ = static_cast<RecordValue&>(self);
+inline void FetchRefRequest::SharedDtor(MessageLite& self) {
+  FetchRefRequest& this_ = static_cast<FetchRefRequest&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.handle_id_.Destroy();
   this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL RecordValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL FetchRefRequest::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) RecordValue(arena);
+  return ::new (mem) FetchRefRequest(arena);
 }
-constexpr auto RecordValue::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(RecordValue, _impl_.fields_) +
-          decltype(RecordValue::_impl_.fields_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(RecordValue), alignof(RecordValue), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&RecordValue::PlacementNew_,
-                                 sizeof(RecordValue),
-                                 alignof(RecordValue));
-  }
+constexpr auto FetchRefRequest::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(FetchRefRequest),
+                                            alignof(FetchRefRequest));
 }
-constexpr auto RecordValue::InternalGenerateClassData_() {
+constexpr auto FetchRefRequest::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_RecordValue_default_instance_._instance,
+          &_FetchRefRequest_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &RecordValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<RecordValue>(),
+          &FetchRefRequest::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<FetchRefRequest>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &RecordValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<RecordValue>(), &RecordValue::ByteSizeLong,
-              &RecordValue::_InternalSerialize,
+          &FetchRefRequest::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<FetchRefRequest>(), &FetchRefRequest::ByteSizeLong,
+              &FetchRefRequest::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_._cached_size_),
           false,
       },
-      &RecordValue::kDescriptorMethods,
+      &FetchRefRequest::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull RecordValue_class_data_ =
-        RecordValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull FetchRefRequest_class_data_ =
+        FetchRefRequest::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-RecordValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&RecordValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(RecordValue_class_data_.tc_table);
-  return RecordValue_class_data_.base();
+FetchRefRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&FetchRefRequest_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(FetchRefRequest_class_data_.tc_table);
+  return FetchRefRequest_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 2, 34, 2>
-RecordValue::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 41, 2>
+FetchRefRequest::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(RecordValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    RecordValue_class_data_.base(),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    FetchRefRequest_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::RecordValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::FetchRefRequest>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // bool accepts_compact_temporal = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(FetchRefRequest, _impl_.accepts_compact_temporal_), 1>(),
+     {16, 1, 0,
+      PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_.accepts_compact_temporal_)}},
+    // string handle_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_.handle_id_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // map<string, .forthic.StackValue> fields = 1;
-    {PROTOBUF_FIELD_OFFSET(RecordValue, _impl_.fields_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMap)},
-  }},
-  {{
-      {::_pbi::TcParser::GetMapAuxInfo(
-          1, 0, 9, 11, 0)},
-      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+    // string handle_id = 1;
+    {PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_.handle_id_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bool accepts_compact_temporal = 2;
+    {PROTOBUF_FIELD_OFFSET(FetchRefRequest, _impl_.accepts_compact_temporal_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
+  // no aux_entries
   {{
-    "\23\6\0\0\0\0\0\0"
-    "forthic.RecordValue"
-    "fields"
+    "\27\11\0\0\0\0\0\0"
+    "forthic.FetchRefRequest"
+    "handle_id"
   }},
 };
-PROTOBUF_NOINLINE void RecordValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.RecordValue)
+PROTOBUF_NOINLINE void FetchRefRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.FetchRefRequest)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _impl_.fields_.Clear();
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    _impl_.handle_id_.ClearNonDefaultToEmpty();
   }
+  _impl_.accepts_compact_temporal_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL RecordValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL FetchRefRequest::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const RecordValue& this_ = static_cast<const RecordValue&>(base);
+  const FetchRefRequest& this_ = static_cast<const FetchRefRequest&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL RecordValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL FetchRefRequest::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const RecordValue& this_ = *this;
+  const FetchRefRequest& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.RecordValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.FetchRefRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // map<string, .forthic.StackValue> fields = 1;
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    if (!this_._internal_fields().empty()) {
-      using MapType = ::google::protobuf::Map<::std::string, ::forthic::StackValue>;
-      using WireHelper = _pbi::MapEntryFuncs<::std::string, ::forthic::StackValue,
-                                     _pbi::WireFormatLite::TYPE_STRING,
-                                     _pbi::WireFormatLite::TYPE_MESSAGE>;
-      const auto& field = this_._internal_fields();
+  // string handle_id = 1;
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (!this_._internal_handle_id().empty()) {
+      const ::std::string& _s = this_._internal_handle_id();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.FetchRefRequest.handle_id");
+      target = stream->WriteStringMaybeAliased(1, _s, target);
+    }
+  }
 
-      if (stream->IsSerializationDeterministic() && field.size() > 1) {
-        for (const auto& entry : ::google::protobuf::internal::MapSorterPtr<MapType>(field)) {
-          target = WireHelper::InternalSerialize(
-              1, entry.first, entry.second, target, stream);
-          ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-              entry.first.data(), static_cast<int>(entry.first.length()),
- ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RecordValue.fields");
-        }
-      } else {
-        for (const auto& entry : field) {
-          target = WireHelper::InternalSerialize(
-              1, entry.first, entry.second, target, stream);
-          ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-              entry.first.data(), static_cast<int>(entry.first.length()),
- ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.RecordValue.fields");
-        }
-      }
+  // bool accepts_compact_temporal = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (this_._internal_accepts_compact_temporal() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          2, this_._internal_accepts_compact_temporal(), target);
     }
   }
 
@@ -3516,18 +9088,18 @@ PROTOBUF_NOINLINE void RecordValue::Clear() {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.RecordValue)
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.FetchRefRequest)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t RecordValue::ByteSizeLong(const MessageLite& base) {
-  const RecordValue& this_ = static_cast<const RecordValue&>(base);
+::size_t FetchRefRequest::ByteSizeLong(const MessageLite& base) {
+  const FetchRefRequest& this_ = static_cast<const FetchRefRequest&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t RecordValue::ByteSizeLong() const {
-  const RecordValue& this_ = *this;
+::size_t FetchRefRequest::ByteSizeLong() const {
+  const FetchRefRequest& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.RecordValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.FetchRefRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -3535,16 +9107,19 @@ PROTOBUF_NOINLINE void RecordValue::Clear() {
   (void)cached_has_bits;
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-   {
-    // map<string, .forthic.StackValue> fields = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-      total_size +=
-          1 * ::google::protobuf::internal::FromIntSize(this_._internal_fields_size());
-      for (const auto& entry : this_._internal_fields()) {
-        total_size += _pbi::MapEntryFuncs<::std::string, ::forthic::StackValue,
-                                       _pbi::WireFormatLite::TYPE_STRING,
-                                       _pbi::WireFormatLite::TYPE_MESSAGE>::ByteSizeLong(entry.first, entry.second);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // string handle_id = 1;
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!this_._internal_handle_id().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_handle_id());
+      }
+    }
+    // bool accepts_compact_temporal = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (this_._internal_accepts_compact_temporal() != 0) {
+        total_size += 2;
       }
     }
   }
@@ -3552,234 +9127,279 @@ PROTOBUF_NOINLINE void RecordValue::Clear() {
                                              &this_._impl_._cached_size_);
 }
 
-void RecordValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void FetchRefRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<RecordValue*>(&to_msg);
-  auto& from = static_cast<const RecordValue&>(from_msg);
+      static_cast<FetchRefRequest*>(&to_msg);
+  auto& from = static_cast<const FetchRefRequest&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.RecordValue)
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.FetchRefRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _this->_impl_.fields_.MergeFrom(from._impl_.fields_);
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      if (!from._internal_handle_id().empty()) {
+        _this->_internal_set_handle_id(from._internal_handle_id());
+      } else {
+        if (_this->_impl_.handle_id_.IsDefault()) {
+          _this->_internal_set_handle_id("");
+        }
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (from._internal_accepts_compact_temporal() != 0) {
+        _this->_impl_.accepts_compact_temporal_ = from._impl_.accepts_compact_temporal_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 }
 
-void RecordValue::CopyFrom(const RecordValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.RecordValue)
+void FetchRefRequest::CopyFrom(const FetchRefRequest& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.FetchRefRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void RecordValue::InternalSwap(RecordValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void FetchRefRequest::InternalSwap(FetchRefRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.fields_.InternalSwap(&other->_impl_.fields_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.handle_id_, &other->_impl_.handle_id_, arena);
+  swap(_impl_.accepts_compact_temporal_, other->_impl_.accepts_compact_temporal_);
 }
 
-::google::protobuf::Metadata RecordValue::GetMetadata() const {
+::google::protobuf::Metadata FetchRefRequest::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
-class InstantValue::_Internal {
+class FetchRefResponse::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<InstantValue>()._impl_._has_bits_);
+      decltype(::std::declval<FetchRefResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._has_bits_);
+      8 * PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_._has_bits_);
 };
 
-InstantValue::InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+FetchRefResponse::FetchRefResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, InstantValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, FetchRefResponse_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.InstantValue)
+  // @@protoc_insertion_point(arena_constructor:forthic.FetchRefResponse)
 }
-PROTOBUF_NDEBUG_INLINE InstantValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE FetchRefResponse::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::InstantValue& from_msg)
+    [[maybe_unused]] const ::forthic::FetchRefResponse& from_msg)
       : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        iso8601_(arena, from.iso8601_) {}
+        _cached_size_{0} {}
 
-InstantValue::InstantValue(
+FetchRefResponse::FetchRefResponse(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const InstantValue& from)
+    const FetchRefResponse& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, InstantValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, FetchRefResponse_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  InstantValue* const _this = this;
+  FetchRefResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.value_ = (CheckHasBit(cached_has_bits, 0x00000001U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_)
+                : nullptr;
+  _impl_.error_ = (CheckHasBit(cached_has_bits, 0x00000002U))
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:forthic.InstantValue)
+  // @@protoc_insertion_point(copy_constructor:forthic.FetchRefResponse)
 }
-PROTOBUF_NDEBUG_INLINE InstantValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE FetchRefResponse::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        iso8601_(arena) {}
+      : _cached_size_{0} {}
 
-inline void InstantValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void FetchRefResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, value_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, value_) +
+               sizeof(Impl_::error_));
 }
-InstantValue::~InstantValue() {
-  // @@protoc_insertion_point(destructor:forthic.InstantValue)
+FetchRefResponse::~FetchRefResponse() {
+  // @@protoc_insertion_point(destructor:forthic.FetchRefResponse)
   SharedDtor(*this);
 }
-inline void InstantValue::SharedDtor(MessageLite& self) {
-  InstantValue& this_ = static_cast<InstantValue&>(self);
+inline void FetchRefResponse::SharedDtor(MessageLite& self) {
+  FetchRefResponse& this_ = static_cast<FetchRefResponse&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.iso8601_.Destroy();
+  delete this_._impl_.value_;
+  delete this_._impl_.error_;
   this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL InstantValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL FetchRefResponse::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) InstantValue(arena);
+  return ::new (mem) FetchRefResponse(arena);
 }
-constexpr auto InstantValue::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(InstantValue),
-                                            alignof(InstantValue));
+constexpr auto FetchRefResponse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(FetchRefResponse),
+                                            alignof(FetchRefResponse));
 }
-constexpr auto InstantValue::InternalGenerateClassData_() {
+constexpr auto FetchRefResponse::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_InstantValue_default_instance_._instance,
+          &_FetchRefResponse_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &InstantValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<InstantValue>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &InstantValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<InstantValue>(), &InstantValue::ByteSizeLong,
-              &InstantValue::_InternalSerialize,
+          nullptr,  // IsInitialized
+          &FetchRefResponse::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<FetchRefResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &FetchRefResponse::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<FetchRefResponse>(), &FetchRefResponse::ByteSizeLong,
+              &FetchRefResponse::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_._cached_size_),
           false,
       },
-      &InstantValue::kDescriptorMethods,
+      &FetchRefResponse::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull InstantValue_class_data_ =
-        InstantValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull FetchRefResponse_class_data_ =
+        FetchRefResponse::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-InstantValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&InstantValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(InstantValue_class_data_.tc_table);
-  return InstantValue_class_data_.base();
+FetchRefResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&FetchRefResponse_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(FetchRefResponse_class_data_.tc_table);
+  return FetchRefResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 36, 2>
-InstantValue::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2>
+FetchRefResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(InstantValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    InstantValue_class_data_.base(),
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    FetchRefResponse_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::InstantValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::FetchRefResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // string iso8601 = 1;
-    {::_pbi::TcParser::FastUS1,
+    // optional .forthic.ErrorInfo error = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1,
+      PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.error_)}},
+    // .forthic.StackValue value = 1;
+    {::_pbi::TcParser::FastMtS1,
      {10, 0, 0,
-      PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.iso8601_)}},
+      PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.value_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string iso8601 = 1;
-    {PROTOBUF_FIELD_OFFSET(InstantValue, _impl_.iso8601_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .forthic.StackValue value = 1;
+    {PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.value_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // optional .forthic.ErrorInfo error = 2;
+    {PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.error_), _Internal::kHasBitsOffset + 1, 1, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::forthic::StackValue>()},
+      {::_pbi::TcParser::GetTable<::forthic::ErrorInfo>()},
   }},
-  // no aux_entries
   {{
-    "\24\7\0\0\0\0\0\0"
-    "forthic.InstantValue"
-    "iso8601"
   }},
 };
-PROTOBUF_NOINLINE void InstantValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.InstantValue)
+PROTOBUF_NOINLINE void FetchRefResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.FetchRefResponse)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    _impl_.iso8601_.ClearNonDefaultToEmpty();
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      ABSL_DCHECK(_impl_.value_ != nullptr);
+      _impl_.value_->Clear();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      ABSL_DCHECK(_impl_.error_ != nullptr);
+      _impl_.error_->Clear();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL InstantValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL FetchRefResponse::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const InstantValue& this_ = static_cast<const InstantValue&>(base);
+  const FetchRefResponse& this_ = static_cast<const FetchRefResponse&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL InstantValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL FetchRefResponse::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const InstantValue& this_ = *this;
+  const FetchRefResponse& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.InstantValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.FetchRefResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // string iso8601 = 1;
+  // .forthic.StackValue value = 1;
   if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (!this_._internal_iso8601().empty()) {
-      const ::std::string& _s = this_._internal_iso8601();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.InstantValue.iso8601");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, *this_._impl_.value_, this_._impl_.value_->GetCachedSize(), target,
+        stream);
+  }
+
+  // optional .forthic.ErrorInfo error = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, *this_._impl_.error_, this_._impl_.error_->GetCachedSize(), target,
+        stream);
   }
 
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
@@ -3787,58 +9407,72 @@ PROTOBUF_NOINLINE void InstantValue::Clear() {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.InstantValue)
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.FetchRefResponse)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t InstantValue::ByteSizeLong(const MessageLite& base) {
-  const InstantValue& this_ = static_cast<const InstantValue&>(base);
+::size_t FetchRefResponse::ByteSizeLong(const MessageLite& base) {
+  const FetchRefResponse& this_ = static_cast<const FetchRefResponse&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t InstantValue::ByteSizeLong() const {
-  const InstantValue& this_ = *this;
+::size_t FetchRefResponse::ByteSizeLong() const {
+  const FetchRefResponse& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.InstantValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.FetchRefResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-   {
-    // string iso8601 = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    // .forthic.StackValue value = 1;
     if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      if (!this_._internal_iso8601().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_iso8601());
-      }
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.value_);
+    }
+    // optional .forthic.ErrorInfo error = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.error_);
     }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
 }
 
-void InstantValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void FetchRefResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<InstantValue*>(&to_msg);
-  auto& from = static_cast<const InstantValue&>(from_msg);
+      static_cast<FetchRefResponse*>(&to_msg);
+  auto& from = static_cast<const FetchRefResponse&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.InstantValue)
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.FetchRefResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (!from._internal_iso8601().empty()) {
-      _this->_internal_set_iso8601(from._internal_iso8601());
-    } else {
-      if (_this->_impl_.iso8601_.IsDefault()) {
-        _this->_internal_set_iso8601("");
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+      ABSL_DCHECK(from._impl_.value_ != nullptr);
+      if (_this->_impl_.value_ == nullptr) {
+        _this->_impl_.value_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.value_);
+      } else {
+        _this->_impl_.value_->MergeFrom(*from._impl_.value_);
+      }
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      ABSL_DCHECK(from._impl_.error_ != nullptr);
+      if (_this->_impl_.error_ == nullptr) {
+        _this->_impl_.error_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.error_);
+      } else {
+        _this->_impl_.error_->MergeFrom(*from._impl_.error_);
       }
     }
   }
@@ -3847,140 +9481,154 @@ void InstantValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
       from._internal_metadata_);
 }
 
-void InstantValue::CopyFrom(const InstantValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.InstantValue)
+void FetchRefResponse::CopyFrom(const FetchRefResponse& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.FetchRefResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void InstantValue::InternalSwap(InstantValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void FetchRefResponse::InternalSwap(FetchRefResponse* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_, &other->_impl_.iso8601_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.error_)
+      + sizeof(FetchRefResponse::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(FetchRefResponse, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
 }
 
-::google::protobuf::Metadata InstantValue::GetMetadata() const {
+::google::protobuf::Metadata FetchRefResponse::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
-class PlainDateValue::_Internal {
+class ReleaseRefsRequest::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<PlainDateValue>()._impl_._has_bits_);
+      decltype(::std::declval<ReleaseRefsRequest>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._has_bits_);
+      8 * PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_._has_bits_);
 };
 
-PlainDateValue::PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+ReleaseRefsRequest::ReleaseRefsRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, PlainDateValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ReleaseRefsRequest_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.PlainDateValue)
+  // @@protoc_insertion_point(arena_constructor:forthic.ReleaseRefsRequest)
 }
-PROTOBUF_NDEBUG_INLINE PlainDateValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ReleaseRefsRequest::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::PlainDateValue& from_msg)
+    [[maybe_unused]] const ::forthic::ReleaseRefsRequest& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        iso8601_date_(arena, from.iso8601_date_) {}
+        handle_ids_{visibility, arena, from.handle_ids_} {}
 
-PlainDateValue::PlainDateValue(
+ReleaseRefsRequest::ReleaseRefsRequest(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const PlainDateValue& from)
+    const ReleaseRefsRequest& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, PlainDateValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ReleaseRefsRequest_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  PlainDateValue* const _this = this;
+  ReleaseRefsRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
 
-  // @@protoc_insertion_point(copy_constructor:forthic.PlainDateValue)
+  // @@protoc_insertion_point(copy_constructor:forthic.ReleaseRefsRequest)
 }
-PROTOBUF_NDEBUG_INLINE PlainDateValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ReleaseRefsRequest::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        iso8601_date_(arena) {}
+        handle_ids_{visibility, arena} {}
 
-inline void PlainDateValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void ReleaseRefsRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
 }
-PlainDateValue::~PlainDateValue() {
-  // @@protoc_insertion_point(destructor:forthic.PlainDateValue)
+ReleaseRefsRequest::~ReleaseRefsRequest() {
+  // @@protoc_insertion_point(destructor:forthic.ReleaseRefsRequest)
   SharedDtor(*this);
 }
-inline void PlainDateValue::SharedDtor(MessageLite& self) {
-  PlainDateValue& this_ = static_cast<PlainDateValue&>(self);
+inline void ReleaseRefsRequest::SharedDtor(MessageLite& self) {
+  ReleaseRefsRequest& this_ = static_cast<ReleaseRefsRequest&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.iso8601_date_.Destroy();
   this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL PlainDateValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL ReleaseRefsRequest::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) PlainDateValue(arena);
+  return ::new (mem) ReleaseRefsRequest(arena);
 }
-constexpr auto PlainDateValue::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(PlainDateValue),
-                                            alignof(PlainDateValue));
+constexpr auto ReleaseRefsRequest::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_.handle_ids_) +
+          decltype(ReleaseRefsRequest::_impl_.handle_ids_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(ReleaseRefsRequest), alignof(ReleaseRefsRequest), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ReleaseRefsRequest::PlacementNew_,
+                                 sizeof(ReleaseRefsRequest),
+                                 alignof(ReleaseRefsRequest));
+  }
 }
-constexpr auto PlainDateValue::InternalGenerateClassData_() {
+constexpr auto ReleaseRefsRequest::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_PlainDateValue_default_instance_._instance,
+          &_ReleaseRefsRequest_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &PlainDateValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<PlainDateValue>(),
+          &ReleaseRefsRequest::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReleaseRefsRequest>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &PlainDateValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<PlainDateValue>(), &PlainDateValue::ByteSizeLong,
-              &PlainDateValue::_InternalSerialize,
+          &ReleaseRefsRequest::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ReleaseRefsRequest>(), &ReleaseRefsRequest::ByteSizeLong,
+              &ReleaseRefsRequest::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_._cached_size_),
           false,
       },
-      &PlainDateValue::kDescriptorMethods,
+      &ReleaseRefsRequest::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull PlainDateValue_class_data_ =
-        PlainDateValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull ReleaseRefsRequest_class_data_ =
+        ReleaseRefsRequest::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-PlainDateValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&PlainDateValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(PlainDateValue_class_data_.tc_table);
-  return PlainDateValue_class_data_.base();
+ReleaseRefsRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReleaseRefsRequest_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReleaseRefsRequest_class_data_.tc_table);
+  return ReleaseRefsRequest_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 43, 2>
-PlainDateValue::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 45, 2>
+ReleaseRefsRequest::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -3989,71 +9637,71 @@ PlainDateValue::_table_ = {
     1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    PlainDateValue_class_data_.base(),
+    ReleaseRefsRequest_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::PlainDateValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::ReleaseRefsRequest>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // string iso8601_date = 1;
-    {::_pbi::TcParser::FastUS1,
+    // repeated string handle_ids = 1;
+    {::_pbi::TcParser::FastUR1,
      {10, 0, 0,
-      PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.iso8601_date_)}},
+      PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_.handle_ids_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string iso8601_date = 1;
-    {PROTOBUF_FIELD_OFFSET(PlainDateValue, _impl_.iso8601_date_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // repeated string handle_ids = 1;
+    {PROTOBUF_FIELD_OFFSET(ReleaseRefsRequest, _impl_.handle_ids_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
   }},
   // no aux_entries
   {{
-    "\26\14\0\0\0\0\0\0"
-    "forthic.PlainDateValue"
-    "iso8601_date"
+    "\32\12\0\0\0\0\0\0"
+    "forthic.ReleaseRefsRequest"
+    "handle_ids"
   }},
 };
-PROTOBUF_NOINLINE void PlainDateValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.PlainDateValue)
+PROTOBUF_NOINLINE void ReleaseRefsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ReleaseRefsRequest)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    _impl_.iso8601_date_.ClearNonDefaultToEmpty();
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _impl_.handle_ids_.Clear();
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL PlainDateValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ReleaseRefsRequest::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const PlainDateValue& this_ = static_cast<const PlainDateValue&>(base);
+  const ReleaseRefsRequest& this_ = static_cast<const ReleaseRefsRequest&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL PlainDateValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ReleaseRefsRequest::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const PlainDateValue& this_ = *this;
+  const ReleaseRefsRequest& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.PlainDateValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ReleaseRefsRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // string iso8601_date = 1;
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (!this_._internal_iso8601_date().empty()) {
-      const ::std::string& _s = this_._internal_iso8601_date();
+  // repeated string handle_ids = 1;
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    for (int i = 0, n = this_._internal_handle_ids_size(); i < n; ++i) {
+      const auto& s = this_._internal_handle_ids().Get(i);
       ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.PlainDateValue.iso8601_date");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
+          s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ReleaseRefsRequest.handle_ids");
+      target = stream->WriteString(1, s, target);
     }
   }
 
@@ -4062,31 +9710,34 @@ PROTOBUF_NOINLINE void PlainDateValue::Clear() {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.PlainDateValue)
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ReleaseRefsRequest)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t PlainDateValue::ByteSizeLong(const MessageLite& base) {
-  const PlainDateValue& this_ = static_cast<const PlainDateValue&>(base);
+::size_t ReleaseRefsRequest::ByteSizeLong(const MessageLite& base) {
+  const ReleaseRefsRequest& this_ = static_cast<const ReleaseRefsRequest&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t PlainDateValue::ByteSizeLong() const {
-  const PlainDateValue& this_ = *this;
+::size_t ReleaseRefsRequest::ByteSizeLong() const {
+  const ReleaseRefsRequest& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.PlainDateValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ReleaseRefsRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
    {
-    // string iso8601_date = 1;
+    // repeated string handle_ids = 1;
     cached_has_bits = this_._impl_._has_bits_[0];
-    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      if (!this_._internal_iso8601_date().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_iso8601_date());
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      total_size +=
+          1 * ::google::protobuf::internal::FromIntSize(this_._internal_handle_ids().size());
+      for (int i = 0, n = this_._internal_handle_ids().size(); i < n; ++i) {
+        total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+            this_._internal_handle_ids().Get(i));
       }
     }
   }
@@ -4094,266 +9745,215 @@ PROTOBUF_NOINLINE void PlainDateValue::Clear() {
                                              &this_._impl_._cached_size_);
 }
 
-void PlainDateValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void ReleaseRefsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<PlainDateValue*>(&to_msg);
-  auto& from = static_cast<const PlainDateValue&>(from_msg);
+      static_cast<ReleaseRefsRequest*>(&to_msg);
+  auto& from = static_cast<const ReleaseRefsRequest&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.PlainDateValue)
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ReleaseRefsRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (!from._internal_iso8601_date().empty()) {
-      _this->_internal_set_iso8601_date(from._internal_iso8601_date());
-    } else {
-      if (_this->_impl_.iso8601_date_.IsDefault()) {
-        _this->_internal_set_iso8601_date("");
-      }
-    }
+  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+    _this->_internal_mutable_handle_ids()->InternalMergeFromWithArena(
+        ::google::protobuf::MessageLite::internal_visibility(), arena,
+        from._internal_handle_ids());
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 }
 
-void PlainDateValue::CopyFrom(const PlainDateValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.PlainDateValue)
+void ReleaseRefsRequest::CopyFrom(const ReleaseRefsRequest& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ReleaseRefsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void PlainDateValue::InternalSwap(PlainDateValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void ReleaseRefsRequest::InternalSwap(ReleaseRefsRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_date_, &other->_impl_.iso8601_date_, arena);
+  _impl_.handle_ids_.InternalSwap(&other->_impl_.handle_ids_);
 }
 
-::google::protobuf::Metadata PlainDateValue::GetMetadata() const {
+::google::protobuf::Metadata ReleaseRefsRequest::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
 
-class ZonedDateTimeValue::_Internal {
+class ReleaseRefsResponse::_Internal {
  public:
   using HasBits =
-      decltype(::std::declval<ZonedDateTimeValue>()._impl_._has_bits_);
+      decltype(::std::declval<ReleaseRefsResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._has_bits_);
+      8 * PROTOBUF_FIELD_OFFSET(ReleaseRefsResponse, _impl_._has_bits_);
 };
 
-ZonedDateTimeValue::ZonedDateTimeValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+ReleaseRefsResponse::ReleaseRefsResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ZonedDateTimeValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ReleaseRefsResponse_class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:forthic.ZonedDateTimeValue)
-}
-PROTOBUF_NDEBUG_INLINE ZonedDateTimeValue::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::forthic::ZonedDateTimeValue& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        iso8601_(arena, from.iso8601_),
-        timezone_(arena, from.timezone_) {}
-
-ZonedDateTimeValue::ZonedDateTimeValue(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const ZonedDateTimeValue& from)
+  // @@protoc_insertion_point(arena_constructor:forthic.ReleaseRefsResponse)
+}
+ReleaseRefsResponse::ReleaseRefsResponse(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseRefsResponse& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ZonedDateTimeValue_class_data_.base()) {
+    : ::google::protobuf::Message(arena, ReleaseRefsResponse_class_data_.base()),
 #else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
+    : ::google::protobuf::Message(arena),
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  ZonedDateTimeValue* const _this = this;
-  (void)_this;
+      _impl_(from._impl_) {
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:forthic.ZonedDateTimeValue)
 }
-PROTOBUF_NDEBUG_INLINE ZonedDateTimeValue::Impl_::Impl_(
+PROTOBUF_NDEBUG_INLINE ReleaseRefsResponse::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        iso8601_(arena),
-        timezone_(arena) {}
+      : _cached_size_{0} {}
 
-inline void ZonedDateTimeValue::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+inline void ReleaseRefsResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.released_count_ = {};
 }
-ZonedDateTimeValue::~ZonedDateTimeValue() {
-  // @@protoc_insertion_point(destructor:forthic.ZonedDateTimeValue)
+ReleaseRefsResponse::~ReleaseRefsResponse() {
+  // @@protoc_insertion_point(destructor:forthic.ReleaseRefsResponse)
   SharedDtor(*this);
 }
-inline void ZonedDateTimeValue::SharedDtor(MessageLite& self) {
-  ZonedDateTimeValue& this_ = static_cast<ZonedDateTimeValue&>(self);
+inline void ReleaseRefsResponse::SharedDtor(MessageLite& self) {
+  ReleaseRefsResponse& this_ = static_cast<ReleaseRefsResponse&>(self);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.iso8601_.Destroy();
-  this_._impl_.timezone_.Destroy();
   this_._impl_.~Impl_();
 }
 
-inline void* PROTOBUF_NONNULL ZonedDateTimeValue::PlacementNew_(
+inline void* PROTOBUF_NONNULL ReleaseRefsResponse::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ZonedDateTimeValue(arena);
+  return ::new (mem) ReleaseRefsResponse(arena);
 }
-constexpr auto ZonedDateTimeValue::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ZonedDateTimeValue),
-                                            alignof(ZonedDateTimeValue));
+constexpr auto ReleaseRefsResponse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ReleaseRefsResponse),
+                                            alignof(ReleaseRefsResponse));
 }
-constexpr auto ZonedDateTimeValue::InternalGenerateClassData_() {
+constexpr auto ReleaseRefsResponse::InternalGenerateClassData_() {
   return ::google::protobuf::internal::ClassDataFull{
       ::google::protobuf::internal::ClassData{
-          &_ZonedDateTimeValue_default_instance_._instance,
+          &_ReleaseRefsResponse_default_instance_._instance,
           &_table_.header,
           nullptr,  // OnDemandRegisterArenaDtor
           nullptr,  // IsInitialized
-          &ZonedDateTimeValue::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ZonedDateTimeValue>(),
+          &ReleaseRefsResponse::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReleaseRefsResponse>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ZonedDateTimeValue::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ZonedDateTimeValue>(), &ZonedDateTimeValue::ByteSizeLong,
-              &ZonedDateTimeValue::_InternalSerialize,
+          &ReleaseRefsResponse::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<ReleaseRefsResponse>(), &ReleaseRefsResponse::ByteSizeLong,
+              &ReleaseRefsResponse::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._cached_size_),
+          PROTOBUF_FIELD_OFFSET(ReleaseRefsResponse, _impl_._cached_size_),
           false,
       },
-      &ZonedDateTimeValue::kDescriptorMethods,
+      &ReleaseRefsResponse::kDescriptorMethods,
       &descriptor_table_protos_2fforthic_5fruntime_2eproto,
       nullptr,  // tracker
   };
 }
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ZonedDateTimeValue_class_data_ =
-        ZonedDateTimeValue::InternalGenerateClassData_();
+    ::google::protobuf::internal::ClassDataFull ReleaseRefsResponse_class_data_ =
+        ReleaseRefsResponse::InternalGenerateClassData_();
 
 PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ZonedDateTimeValue::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ZonedDateTimeValue_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ZonedDateTimeValue_class_data_.tc_table);
-  return ZonedDateTimeValue_class_data_.base();
+ReleaseRefsResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReleaseRefsResponse_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReleaseRefsResponse_class_data_.tc_table);
+  return ReleaseRefsResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 50, 2>
-ZonedDateTimeValue::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2>
+ReleaseRefsResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(ReleaseRefsResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    ZonedDateTimeValue_class_data_.base(),
+    ReleaseRefsResponse_class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::forthic::ZonedDateTimeValue>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::forthic::ReleaseRefsResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // string timezone = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 1, 0,
-      PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.timezone_)}},
-    // string iso8601 = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0,
-      PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.iso8601_)}},
+    // int32 released_count = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ReleaseRefsResponse, _impl_.released_count_), 0>(),
+     {8, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ReleaseRefsResponse, _impl_.released_count_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string iso8601 = 1;
-    {PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.iso8601_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string timezone = 2;
-    {PROTOBUF_FIELD_OFFSET(ZonedDateTimeValue, _impl_.timezone_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 released_count = 1;
+    {PROTOBUF_FIELD_OFFSET(ReleaseRefsResponse, _impl_.released_count_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
-    "\32\7\10\0\0\0\0\0"
-    "forthic.ZonedDateTimeValue"
-    "iso8601"
-    "timezone"
   }},
 };
-PROTOBUF_NOINLINE void ZonedDateTimeValue::Clear() {
-// @@protoc_insertion_point(message_clear_start:forthic.ZonedDateTimeValue)
+PROTOBUF_NOINLINE void ReleaseRefsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:forthic.ReleaseRefsResponse)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
-    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      _impl_.iso8601_.ClearNonDefaultToEmpty();
-    }
-    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
-      _impl_.timezone_.ClearNonDefaultToEmpty();
-    }
-  }
+  _impl_.released_count_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ZonedDateTimeValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ReleaseRefsResponse::_InternalSerialize(
     const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ZonedDateTimeValue& this_ = static_cast<const ZonedDateTimeValue&>(base);
+  const ReleaseRefsResponse& this_ = static_cast<const ReleaseRefsResponse&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ZonedDateTimeValue::_InternalSerialize(
+::uint8_t* PROTOBUF_NONNULL ReleaseRefsResponse::_InternalSerialize(
     ::uint8_t* PROTOBUF_NONNULL target,
     ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ZonedDateTimeValue& this_ = *this;
+  const ReleaseRefsResponse& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     this_.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(serialize_to_array_start:forthic.ZonedDateTimeValue)
+  // @@protoc_insertion_point(serialize_to_array_start:forthic.ReleaseRefsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = this_._impl_._has_bits_[0];
-  // string iso8601 = 1;
+  // int32 released_count = 1;
   if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-    if (!this_._internal_iso8601().empty()) {
-      const ::std::string& _s = this_._internal_iso8601();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ZonedDateTimeValue.iso8601");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  // string timezone = 2;
-  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
-    if (!this_._internal_timezone().empty()) {
-      const ::std::string& _s = this_._internal_timezone();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ZonedDateTimeValue.timezone");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
+    if (this_._internal_released_count() != 0) {
+      target =
+          ::google::protobuf::internal::WireFormatLite::WriteInt32ToArrayWithField<1>(
+              stream, this_._internal_released_count(), target);
     }
   }
 
@@ -4362,39 +9962,31 @@ PROTOBUF_NOINLINE void ZonedDateTimeValue::Clear() {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:forthic.ZonedDateTimeValue)
+  // @@protoc_insertion_point(serialize_to_array_end:forthic.ReleaseRefsResponse)
   return target;
 }
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ZonedDateTimeValue::ByteSizeLong(const MessageLite& base) {
-  const ZonedDateTimeValue& this_ = static_cast<const ZonedDateTimeValue&>(base);
+::size_t ReleaseRefsResponse::ByteSizeLong(const MessageLite& base) {
+  const ReleaseRefsResponse& this_ = static_cast<const ReleaseRefsResponse&>(base);
 #else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ZonedDateTimeValue::ByteSizeLong() const {
-  const ZonedDateTimeValue& this_ = *this;
+::size_t ReleaseRefsResponse::ByteSizeLong() const {
+  const ReleaseRefsResponse& this_ = *this;
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:forthic.ZonedDateTimeValue)
+  // @@protoc_insertion_point(message_byte_size_start:forthic.ReleaseRefsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
-    // string iso8601 = 1;
+   {
+    // int32 released_count = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
     if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      if (!this_._internal_iso8601().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_iso8601());
-      }
-    }
-    // string timezone = 2;
-    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
-      if (!this_._internal_timezone().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_timezone());
+      if (this_._internal_released_count() != 0) {
+        total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+            this_._internal_released_count());
       }
     }
   }
@@ -4402,38 +9994,23 @@ PROTOBUF_NOINLINE void ZonedDateTimeValue::Clear() {
                                              &this_._impl_._cached_size_);
 }
 
-void ZonedDateTimeValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
+void ReleaseRefsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
                             const ::google::protobuf::MessageLite& from_msg) {
    auto* const _this =
-      static_cast<ZonedDateTimeValue*>(&to_msg);
-  auto& from = static_cast<const ZonedDateTimeValue&>(from_msg);
+      static_cast<ReleaseRefsResponse*>(&to_msg);
+  auto& from = static_cast<const ReleaseRefsResponse&>(from_msg);
   if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
     from.CheckHasBitConsistency();
   }
-  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ZonedDateTimeValue)
+  // @@protoc_insertion_point(class_specific_merge_from_start:forthic.ReleaseRefsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
-    if (CheckHasBit(cached_has_bits, 0x00000001U)) {
-      if (!from._internal_iso8601().empty()) {
-        _this->_internal_set_iso8601(from._internal_iso8601());
-      } else {
-        if (_this->_impl_.iso8601_.IsDefault()) {
-          _this->_internal_set_iso8601("");
-        }
-      }
-    }
-    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
-      if (!from._internal_timezone().empty()) {
-        _this->_internal_set_timezone(from._internal_timezone());
-      } else {
-        if (_this->_impl_.timezone_.IsDefault()) {
-          _this->_internal_set_timezone("");
-        }
-      }
+  if (CheckHasBit(cached_has_bits, 0x00000001U)) {
+    if (from._internal_released_count() != 0) {
+      _this->_impl_.released_count_ = from._impl_.released_count_;
     }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -4441,25 +10018,22 @@ void ZonedDateTimeValue::MergeImpl(::google::protobuf::MessageLite& to_msg,
       from._internal_metadata_);
 }
 
-void ZonedDateTimeValue::CopyFrom(const ZonedDateTimeValue& from) {
-  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ZonedDateTimeValue)
+void ReleaseRefsResponse::CopyFrom(const ReleaseRefsResponse& from) {
+  // @@protoc_insertion_point(class_specific_copy_from_start:forthic.ReleaseRefsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 
-void ZonedDateTimeValue::InternalSwap(ZonedDateTimeValue* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+void ReleaseRefsResponse::InternalSwap(ReleaseRefsResponse* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.iso8601_, &other->_impl_.iso8601_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.timezone_, &other->_impl_.timezone_, arena);
+  swap(_impl_.released_count_, other->_impl_.released_count_);
 }
 
-::google::protobuf::Metadata ZonedDateTimeValue::GetMetadata() const {
+::google::protobuf::Metadata ReleaseRefsResponse::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
 // ===================================================================
@@ -5230,7 +10804,8 @@ PROTOBUF_NDEBUG_INLINE ListModulesResponse::Impl_::Impl_(
     [[maybe_unused]] const ::forthic::ListModulesResponse& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        modules_{visibility, arena, from.modules_} {}
+        modules_{visibility, arena, from.modules_},
+        version_(arena, from.version_) {}
 
 ListModulesResponse::ListModulesResponse(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -5252,7 +10827,8 @@ PROTOBUF_NDEBUG_INLINE ListModulesResponse::Impl_::Impl_(
     [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
     [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        modules_{visibility, arena} {}
+        modules_{visibility, arena},
+        version_(arena) {}
 
 inline void ListModulesResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
@@ -5268,6 +10844,7 @@ inline void ListModulesResponse::SharedDtor(MessageLite& self) {
   }
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.version_.Destroy();
   this_._impl_.~Impl_();
 }
 
@@ -5284,7 +10861,7 @@ constexpr auto ListModulesResponse::InternalNewImpl_() {
                   ::google::protobuf::Message::internal_visibility()),
   });
   if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+    return ::google::protobuf::internal::MessageCreator::CopyInit(
         sizeof(ListModulesResponse), alignof(ListModulesResponse), *arena_bits);
   } else {
     return ::google::protobuf::internal::MessageCreator(&ListModulesResponse::PlacementNew_,
@@ -5326,16 +10903,16 @@ ListModulesResponse::GetClassData() const {
   return ListModulesResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+const ::_pbi::TcParseTable<1, 2, 1, 43, 2>
 ListModulesResponse::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(ListModulesResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
+    2,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     ListModulesResponse_class_data_.base(),
@@ -5345,6 +10922,10 @@ ListModulesResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::ListModulesResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
+    // string version = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ListModulesResponse, _impl_.version_)}},
     // repeated .forthic.ModuleSummary modules = 1;
     {::_pbi::TcParser::FastMtR1,
      {10, 0, 0,
@@ -5354,11 +10935,16 @@ ListModulesResponse::_table_ = {
   }}, {{
     // repeated .forthic.ModuleSummary modules = 1;
     {PROTOBUF_FIELD_OFFSET(ListModulesResponse, _impl_.modules_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // string version = 2;
+    {PROTOBUF_FIELD_OFFSET(ListModulesResponse, _impl_.version_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::ModuleSummary>()},
   }},
   {{
+    "\33\0\7\0\0\0\0\0"
+    "forthic.ListModulesResponse"
+    "version"
   }},
 };
 PROTOBUF_NOINLINE void ListModulesResponse::Clear() {
@@ -5369,8 +10955,13 @@ PROTOBUF_NOINLINE void ListModulesResponse::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _impl_.modules_.Clear();
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _impl_.modules_.Clear();
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
@@ -5408,6 +10999,16 @@ PROTOBUF_NOINLINE void ListModulesResponse::Clear() {
     }
   }
 
+  // string version = 2;
+  if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+    if (!this_._internal_version().empty()) {
+      const ::std::string& _s = this_._internal_version();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.ListModulesResponse.version");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -5432,15 +11033,22 @@ PROTOBUF_NOINLINE void ListModulesResponse::Clear() {
   (void)cached_has_bits;
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-   {
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
     // repeated .forthic.ModuleSummary modules = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size += 1UL * this_._internal_modules_size();
       for (const auto& msg : this_._internal_modules()) {
         total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
       }
     }
+    // string version = 2;
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!this_._internal_version().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_version());
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -5461,10 +11069,21 @@ void ListModulesResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
-    _this->_internal_mutable_modules()->InternalMergeFromWithArena(
-        ::google::protobuf::MessageLite::internal_visibility(), arena,
-        from._internal_modules());
+  if (BatchCheckHasBit(cached_has_bits, 0x00000003U)) {
+    if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
+      _this->_internal_mutable_modules()->InternalMergeFromWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), arena,
+          from._internal_modules());
+    }
+    if (CheckHasBit(cached_has_bits, 0x00000002U)) {
+      if (!from._internal_version().empty()) {
+        _this->_internal_set_version(from._internal_version());
+      } else {
+        if (_this->_impl_.version_.IsDefault()) {
+          _this->_internal_set_version("");
+        }
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -5481,9 +11100,12 @@ void ListModulesResponse::CopyFrom(const ListModulesResponse& from) {
 
 void ListModulesResponse::InternalSwap(ListModulesResponse* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.modules_.InternalSwap(&other->_impl_.modules_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.version_, &other->_impl_.version_, arena);
 }
 
 ::google::protobuf::Metadata ListModulesResponse::GetMetadata() const {
@@ -6188,7 +11810,8 @@ PROTOBUF_NDEBUG_INLINE GetModuleInfoResponse::Impl_::Impl_(
         _cached_size_{0},
         words_{visibility, arena, from.words_},
         name_(arena, from.name_),
-        description_(arena, from.description_) {}
+        description_(arena, from.description_),
+        version_(arena, from.version_) {}
 
 GetModuleInfoResponse::GetModuleInfoResponse(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -6212,7 +11835,8 @@ PROTOBUF_NDEBUG_INLINE GetModuleInfoResponse::Impl_::Impl_(
       : _cached_size_{0},
         words_{visibility, arena},
         name_(arena),
-        description_(arena) {}
+        description_(arena),
+        version_(arena) {}
 
 inline void GetModuleInfoResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
@@ -6230,6 +11854,7 @@ inline void GetModuleInfoResponse::SharedDtor(MessageLite& self) {
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.name_.Destroy();
   this_._impl_.description_.Destroy();
+  this_._impl_.version_.Destroy();
   this_._impl_.~Impl_();
 }
 
@@ -6288,16 +11913,16 @@ GetModuleInfoResponse::GetClassData() const {
   return GetModuleInfoResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 53, 2>
+const ::_pbi::TcParseTable<2, 4, 1, 60, 2>
 GetModuleInfoResponse::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(GetModuleInfoResponse, _impl_._has_bits_),
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    4,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     GetModuleInfoResponse_class_data_.base(),
@@ -6307,7 +11932,10 @@ GetModuleInfoResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::GetModuleInfoResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // string version = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 3, 0,
+      PROTOBUF_FIELD_OFFSET(GetModuleInfoResponse, _impl_.version_)}},
     // string name = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 1, 0,
@@ -6329,15 +11957,18 @@ GetModuleInfoResponse::_table_ = {
     {PROTOBUF_FIELD_OFFSET(GetModuleInfoResponse, _impl_.description_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
     // repeated .forthic.WordInfo words = 3;
     {PROTOBUF_FIELD_OFFSET(GetModuleInfoResponse, _impl_.words_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // string version = 4;
+    {PROTOBUF_FIELD_OFFSET(GetModuleInfoResponse, _impl_.version_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::forthic::WordInfo>()},
   }},
   {{
-    "\35\4\13\0\0\0\0\0"
+    "\35\4\13\0\7\0\0\0"
     "forthic.GetModuleInfoResponse"
     "name"
     "description"
+    "version"
   }},
 };
 PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
@@ -6348,7 +11979,7 @@ PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _impl_.words_.Clear();
     }
@@ -6358,6 +11989,9 @@ PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
     if (CheckHasBit(cached_has_bits, 0x00000004U)) {
       _impl_.description_.ClearNonDefaultToEmpty();
     }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
@@ -6415,6 +12049,16 @@ PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
     }
   }
 
+  // string version = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (!this_._internal_version().empty()) {
+      const ::std::string& _s = this_._internal_version();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "forthic.GetModuleInfoResponse.version");
+      target = stream->WriteStringMaybeAliased(4, _s, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -6440,7 +12084,7 @@ PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     // repeated .forthic.WordInfo words = 3;
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       total_size += 1UL * this_._internal_words_size();
@@ -6462,6 +12106,13 @@ PROTOBUF_NOINLINE void GetModuleInfoResponse::Clear() {
                                         this_._internal_description());
       }
     }
+    // string version = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (!this_._internal_version().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_version());
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -6482,7 +12133,7 @@ void GetModuleInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBitForRepeated(cached_has_bits, 0x00000001U)) {
       _this->_internal_mutable_words()->InternalMergeFromWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), arena,
@@ -6506,6 +12157,15 @@ void GetModuleInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg,
         }
       }
     }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (!from._internal_version().empty()) {
+        _this->_internal_set_version(from._internal_version());
+      } else {
+        if (_this->_impl_.version_.IsDefault()) {
+          _this->_internal_set_version("");
+        }
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -6529,6 +12189,7 @@ void GetModuleInfoResponse::InternalSwap(GetModuleInfoResponse* PROTOBUF_RESTRIC
   _impl_.words_.InternalSwap(&other->_impl_.words_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.version_, &other->_impl_.version_, arena);
 }
 
 ::google::protobuf::Metadata GetModuleInfoResponse::GetMetadata() const {
@@ -6576,6 +12237,7 @@ WordInfo::WordInfo(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.pure_ = from._impl_.pure_;
 
   // @@protoc_insertion_point(copy_constructor:forthic.WordInfo)
 }
@@ -6589,6 +12251,7 @@ PROTOBUF_NDEBUG_INLINE WordInfo::Impl_::Impl_(
 
 inline void WordInfo::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.pure_ = {};
 }
 WordInfo::~WordInfo() {
   // @@protoc_insertion_point(destructor:forthic.WordInfo)
@@ -6650,16 +12313,16 @@ WordInfo::GetClassData() const {
   return WordInfo_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 52, 2>
+const ::_pbi::TcParseTable<2, 4, 0, 52, 2>
 WordInfo::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(WordInfo, _impl_._has_bits_),
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    4,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     WordInfo_class_data_.base(),
@@ -6669,7 +12332,10 @@ WordInfo::_table_ = {
     ::_pbi::TcParser::GetTable<::forthic::WordInfo>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // bool pure = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(WordInfo, _impl_.pure_), 3>(),
+     {32, 3, 0,
+      PROTOBUF_FIELD_OFFSET(WordInfo, _impl_.pure_)}},
     // string name = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 0, 0,
@@ -6691,6 +12357,8 @@ WordInfo::_table_ = {
     {PROTOBUF_FIELD_OFFSET(WordInfo, _impl_.stack_effect_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
     // string description = 3;
     {PROTOBUF_FIELD_OFFSET(WordInfo, _impl_.description_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bool pure = 4;
+    {PROTOBUF_FIELD_OFFSET(WordInfo, _impl_.pure_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   // no aux_entries
   {{
@@ -6720,6 +12388,7 @@ PROTOBUF_NOINLINE void WordInfo::Clear() {
       _impl_.description_.ClearNonDefaultToEmpty();
     }
   }
+  _impl_.pure_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -6773,6 +12442,15 @@ PROTOBUF_NOINLINE void WordInfo::Clear() {
     }
   }
 
+  // bool pure = 4;
+  if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+    if (this_._internal_pure() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_pure(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -6798,7 +12476,7 @@ PROTOBUF_NOINLINE void WordInfo::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     // string name = 1;
     if (CheckHasBit(cached_has_bits, 0x00000001U)) {
       if (!this_._internal_name().empty()) {
@@ -6820,6 +12498,12 @@ PROTOBUF_NOINLINE void WordInfo::Clear() {
                                         this_._internal_description());
       }
     }
+    // bool pure = 4;
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (this_._internal_pure() != 0) {
+        total_size += 2;
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -6839,7 +12523,7 @@ void WordInfo::MergeImpl(::google::protobuf::MessageLite& to_msg,
   (void)cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (BatchCheckHasBit(cached_has_bits, 0x00000007U)) {
+  if (BatchCheckHasBit(cached_has_bits, 0x0000000fU)) {
     if (CheckHasBit(cached_has_bits, 0x00000001U)) {
       if (!from._internal_name().empty()) {
         _this->_internal_set_name(from._internal_name());
@@ -6867,6 +12551,11 @@ void WordInfo::MergeImpl(::google::protobuf::MessageLite& to_msg,
         }
       }
     }
+    if (CheckHasBit(cached_has_bits, 0x00000008U)) {
+      if (from._internal_pure() != 0) {
+        _this->_impl_.pure_ = from._impl_.pure_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
@@ -6890,6 +12579,7 @@ void WordInfo::InternalSwap(WordInfo* PROTOBUF_RESTRICT PROTOBUF_NONNULL other)
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stack_effect_, &other->_impl_.stack_effect_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.description_, &other->_impl_.description_, arena);
+  swap(_impl_.pure_, other->_impl_.pure_);
 }
 
 ::google::protobuf::Metadata WordInfo::GetMetadata() const {
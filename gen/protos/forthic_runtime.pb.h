@@ -86,6 +86,14 @@ class ExecuteWordResponse;
 struct ExecuteWordResponseDefaultTypeInternal;
 extern ExecuteWordResponseDefaultTypeInternal _ExecuteWordResponse_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull ExecuteWordResponse_class_data_;
+class FetchRefRequest;
+struct FetchRefRequestDefaultTypeInternal;
+extern FetchRefRequestDefaultTypeInternal _FetchRefRequest_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull FetchRefRequest_class_data_;
+class FetchRefResponse;
+struct FetchRefResponseDefaultTypeInternal;
+extern FetchRefResponseDefaultTypeInternal _FetchRefResponse_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull FetchRefResponse_class_data_;
 class GetModuleInfoRequest;
 struct GetModuleInfoRequestDefaultTypeInternal;
 extern GetModuleInfoRequestDefaultTypeInternal _GetModuleInfoRequest_default_instance_;
@@ -126,10 +134,54 @@ class RecordValue_FieldsEntry_DoNotUse;
 struct RecordValue_FieldsEntry_DoNotUseDefaultTypeInternal;
 extern RecordValue_FieldsEntry_DoNotUseDefaultTypeInternal _RecordValue_FieldsEntry_DoNotUse_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull RecordValue_FieldsEntry_DoNotUse_class_data_;
+class ReleaseRefsRequest;
+struct ReleaseRefsRequestDefaultTypeInternal;
+extern ReleaseRefsRequestDefaultTypeInternal _ReleaseRefsRequest_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReleaseRefsRequest_class_data_;
+class ReleaseRefsResponse;
+struct ReleaseRefsResponseDefaultTypeInternal;
+extern ReleaseRefsResponseDefaultTypeInternal _ReleaseRefsResponse_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReleaseRefsResponse_class_data_;
+class RemoteRefValue;
+struct RemoteRefValueDefaultTypeInternal;
+extern RemoteRefValueDefaultTypeInternal _RemoteRefValue_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull RemoteRefValue_class_data_;
+class ResultChunk;
+struct ResultChunkDefaultTypeInternal;
+extern ResultChunkDefaultTypeInternal _ResultChunk_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ResultChunk_class_data_;
+class ResultHeader;
+struct ResultHeaderDefaultTypeInternal;
+extern ResultHeaderDefaultTypeInternal _ResultHeader_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ResultHeader_class_data_;
+class ResultValueChunk;
+struct ResultValueChunkDefaultTypeInternal;
+extern ResultValueChunkDefaultTypeInternal _ResultValueChunk_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ResultValueChunk_class_data_;
+class SharedMemoryOffer;
+struct SharedMemoryOfferDefaultTypeInternal;
+extern SharedMemoryOfferDefaultTypeInternal _SharedMemoryOffer_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull SharedMemoryOffer_class_data_;
+class SharedPayload;
+struct SharedPayloadDefaultTypeInternal;
+extern SharedPayloadDefaultTypeInternal _SharedPayload_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull SharedPayload_class_data_;
+class StackPayload;
+struct StackPayloadDefaultTypeInternal;
+extern StackPayloadDefaultTypeInternal _StackPayload_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull StackPayload_class_data_;
 class StackValue;
 struct StackValueDefaultTypeInternal;
 extern StackValueDefaultTypeInternal _StackValue_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull StackValue_class_data_;
+class StreamRequest;
+struct StreamRequestDefaultTypeInternal;
+extern StreamRequestDefaultTypeInternal _StreamRequest_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull StreamRequest_class_data_;
+class StreamResponse;
+struct StreamResponseDefaultTypeInternal;
+extern StreamResponseDefaultTypeInternal _StreamResponse_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull StreamResponse_class_data_;
 class WordInfo;
 struct WordInfoDefaultTypeInternal;
 extern WordInfoDefaultTypeInternal _WordInfo_default_instance_;
@@ -206,7 +258,7 @@ class ZonedDateTimeValue final : public ::google::protobuf::Message
     return *reinterpret_cast<const ZonedDateTimeValue*>(
         &_ZonedDateTimeValue_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 11;
+  static constexpr int kIndexInFileMessages = 19;
   friend void swap(ZonedDateTimeValue& a, ZonedDateTimeValue& b) { a.Swap(&b); }
   inline void Swap(ZonedDateTimeValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -295,6 +347,7 @@ class ZonedDateTimeValue final : public ::google::protobuf::Message
   enum : int {
     kIso8601FieldNumber = 1,
     kTimezoneFieldNumber = 2,
+    kEpochNanosFieldNumber = 3,
   };
   // string iso8601 = 1;
   void clear_iso8601() ;
@@ -325,12 +378,23 @@ class ZonedDateTimeValue final : public ::google::protobuf::Message
   PROTOBUF_ALWAYS_INLINE void _internal_set_timezone(const ::std::string& value);
   ::std::string* PROTOBUF_NONNULL _internal_mutable_timezone();
 
+  public:
+  // optional int64 epoch_nanos = 3;
+  bool has_epoch_nanos() const;
+  void clear_epoch_nanos() ;
+  ::int64_t epoch_nanos() const;
+  void set_epoch_nanos(::int64_t value);
+
+  private:
+  ::int64_t _internal_epoch_nanos() const;
+  void _internal_set_epoch_nanos(::int64_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:forthic.ZonedDateTimeValue)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
                                    0, 50,
                                    2>
       _table_;
@@ -354,6 +418,7 @@ class ZonedDateTimeValue final : public ::google::protobuf::Message
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::internal::ArenaStringPtr iso8601_;
     ::google::protobuf::internal::ArenaStringPtr timezone_;
+    ::int64_t epoch_nanos_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -418,7 +483,7 @@ class WordInfo final : public ::google::protobuf::Message
     return *reinterpret_cast<const WordInfo*>(
         &_WordInfo_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 19;
+  static constexpr int kIndexInFileMessages = 32;
   friend void swap(WordInfo& a, WordInfo& b) { a.Swap(&b); }
   inline void Swap(WordInfo* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -508,6 +573,7 @@ class WordInfo final : public ::google::protobuf::Message
     kNameFieldNumber = 1,
     kStackEffectFieldNumber = 2,
     kDescriptionFieldNumber = 3,
+    kPureFieldNumber = 4,
   };
   // string name = 1;
   void clear_name() ;
@@ -553,12 +619,22 @@ class WordInfo final : public ::google::protobuf::Message
   PROTOBUF_ALWAYS_INLINE void _internal_set_description(const ::std::string& value);
   ::std::string* PROTOBUF_NONNULL _internal_mutable_description();
 
+  public:
+  // bool pure = 4;
+  void clear_pure() ;
+  bool pure() const;
+  void set_pure(bool value);
+
+  private:
+  bool _internal_pure() const;
+  void _internal_set_pure(bool value);
+
   public:
   // @@protoc_insertion_point(class_scope:forthic.WordInfo)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 3,
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
                                    0, 52,
                                    2>
       _table_;
@@ -583,6 +659,7 @@ class WordInfo final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr name_;
     ::google::protobuf::internal::ArenaStringPtr stack_effect_;
     ::google::protobuf::internal::ArenaStringPtr description_;
+    bool pure_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -592,30 +669,30 @@ class WordInfo final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull WordInfo_class_data_;
 // -------------------------------------------------------------------
 
-class PlainDateValue final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.PlainDateValue) */ {
+class SharedPayload final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.SharedPayload) */ {
  public:
-  inline PlainDateValue() : PlainDateValue(nullptr) {}
-  ~PlainDateValue() PROTOBUF_FINAL;
+  inline SharedPayload() : SharedPayload(nullptr) {}
+  ~SharedPayload() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PlainDateValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(SharedPayload* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlainDateValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(SharedPayload));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PlainDateValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SharedPayload(::google::protobuf::internal::ConstantInitialized);
 
-  inline PlainDateValue(const PlainDateValue& from) : PlainDateValue(nullptr, from) {}
-  inline PlainDateValue(PlainDateValue&& from) noexcept
-      : PlainDateValue(nullptr, ::std::move(from)) {}
-  inline PlainDateValue& operator=(const PlainDateValue& from) {
+  inline SharedPayload(const SharedPayload& from) : SharedPayload(nullptr, from) {}
+  inline SharedPayload(SharedPayload&& from) noexcept
+      : SharedPayload(nullptr, ::std::move(from)) {}
+  inline SharedPayload& operator=(const SharedPayload& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PlainDateValue& operator=(PlainDateValue&& from) noexcept {
+  inline SharedPayload& operator=(SharedPayload&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -643,13 +720,13 @@ class PlainDateValue final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const PlainDateValue& default_instance() {
-    return *reinterpret_cast<const PlainDateValue*>(
-        &_PlainDateValue_default_instance_);
+  static const SharedPayload& default_instance() {
+    return *reinterpret_cast<const SharedPayload*>(
+        &_SharedPayload_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 10;
-  friend void swap(PlainDateValue& a, PlainDateValue& b) { a.Swap(&b); }
-  inline void Swap(PlainDateValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 8;
+  friend void swap(SharedPayload& a, SharedPayload& b) { a.Swap(&b); }
+  inline void Swap(SharedPayload* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -657,7 +734,7 @@ class PlainDateValue final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PlainDateValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(SharedPayload* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -665,13 +742,13 @@ class PlainDateValue final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  PlainDateValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PlainDateValue>(arena);
+  SharedPayload* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<SharedPayload>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PlainDateValue& from);
+  void CopyFrom(const SharedPayload& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PlainDateValue& from) { PlainDateValue::MergeImpl(*this, from); }
+  void MergeFrom(const SharedPayload& from) { SharedPayload::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -707,17 +784,17 @@ class PlainDateValue final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(PlainDateValue* PROTOBUF_NONNULL other);
+  void InternalSwap(SharedPayload* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.PlainDateValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.SharedPayload"; }
 
-  explicit PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const PlainDateValue& from);
-  PlainDateValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, PlainDateValue&& from) noexcept
-      : PlainDateValue(arena) {
+  explicit SharedPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  SharedPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const SharedPayload& from);
+  SharedPayload(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, SharedPayload&& from) noexcept
+      : SharedPayload(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -734,29 +811,62 @@ class PlainDateValue final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kIso8601DateFieldNumber = 1,
+    kRegionFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+    kLengthFieldNumber = 3,
+    kGenerationFieldNumber = 4,
   };
-  // string iso8601_date = 1;
-  void clear_iso8601_date() ;
-  const ::std::string& iso8601_date() const;
+  // string region = 1;
+  void clear_region() ;
+  const ::std::string& region() const;
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_iso8601_date(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_iso8601_date();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_iso8601_date();
-  void set_allocated_iso8601_date(::std::string* PROTOBUF_NULLABLE value);
+  void set_region(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_region();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_region();
+  void set_allocated_region(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::std::string& _internal_iso8601_date() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_iso8601_date(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_iso8601_date();
+  const ::std::string& _internal_region() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_region(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_region();
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.PlainDateValue)
+  // uint64 offset = 2;
+  void clear_offset() ;
+  ::uint64_t offset() const;
+  void set_offset(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_offset() const;
+  void _internal_set_offset(::uint64_t value);
+
+  public:
+  // uint64 length = 3;
+  void clear_length() ;
+  ::uint64_t length() const;
+  void set_length(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_length() const;
+  void _internal_set_length(::uint64_t value);
+
+  public:
+  // uint64 generation = 4;
+  void clear_generation() ;
+  ::uint64_t generation() const;
+  void set_generation(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_generation() const;
+  void _internal_set_generation(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.SharedPayload)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 43,
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
+                                   0, 36,
                                    2>
       _table_;
 
@@ -774,42 +884,46 @@ class PlainDateValue final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const PlainDateValue& from_msg);
+        const SharedPayload& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr iso8601_date_;
+    ::google::protobuf::internal::ArenaStringPtr region_;
+    ::uint64_t offset_;
+    ::uint64_t length_;
+    ::uint64_t generation_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull PlainDateValue_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull SharedPayload_class_data_;
 // -------------------------------------------------------------------
 
-class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
-/* @@protoc_insertion_point(class_definition:forthic.NullValue) */ {
+class SharedMemoryOffer final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.SharedMemoryOffer) */ {
  public:
-  inline NullValue() : NullValue(nullptr) {}
+  inline SharedMemoryOffer() : SharedMemoryOffer(nullptr) {}
+  ~SharedMemoryOffer() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(NullValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(SharedMemoryOffer* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(NullValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(SharedMemoryOffer));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR NullValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SharedMemoryOffer(::google::protobuf::internal::ConstantInitialized);
 
-  inline NullValue(const NullValue& from) : NullValue(nullptr, from) {}
-  inline NullValue(NullValue&& from) noexcept
-      : NullValue(nullptr, ::std::move(from)) {}
-  inline NullValue& operator=(const NullValue& from) {
+  inline SharedMemoryOffer(const SharedMemoryOffer& from) : SharedMemoryOffer(nullptr, from) {}
+  inline SharedMemoryOffer(SharedMemoryOffer&& from) noexcept
+      : SharedMemoryOffer(nullptr, ::std::move(from)) {}
+  inline SharedMemoryOffer& operator=(const SharedMemoryOffer& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NullValue& operator=(NullValue&& from) noexcept {
+  inline SharedMemoryOffer& operator=(SharedMemoryOffer&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -837,13 +951,13 @@ class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NullValue& default_instance() {
-    return *reinterpret_cast<const NullValue*>(
-        &_NullValue_default_instance_);
+  static const SharedMemoryOffer& default_instance() {
+    return *reinterpret_cast<const SharedMemoryOffer*>(
+        &_SharedMemoryOffer_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(NullValue& a, NullValue& b) { a.Swap(&b); }
-  inline void Swap(NullValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 7;
+  friend void swap(SharedMemoryOffer& a, SharedMemoryOffer& b) { a.Swap(&b); }
+  inline void Swap(SharedMemoryOffer* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -851,7 +965,7 @@ class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NullValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(SharedMemoryOffer* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -859,32 +973,59 @@ class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
 
   // implements Message ----------------------------------------------
 
-  NullValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<NullValue>(arena);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const NullValue& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const NullValue& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  SharedMemoryOffer* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<SharedMemoryOffer>(arena);
   }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const SharedMemoryOffer& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const SharedMemoryOffer& from) { SharedMemoryOffer::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
 
   public:
   bool IsInitialized() const {
     return true;
   }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(SharedMemoryOffer* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.NullValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.SharedMemoryOffer"; }
 
-  explicit NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const NullValue& from);
-  NullValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, NullValue&& from) noexcept
-      : NullValue(arena) {
+  explicit SharedMemoryOffer(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  SharedMemoryOffer(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const SharedMemoryOffer& from);
+  SharedMemoryOffer(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, SharedMemoryOffer&& from) noexcept
+      : SharedMemoryOffer(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -900,12 +1041,41 @@ class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  // @@protoc_insertion_point(class_scope:forthic.NullValue)
+  enum : int {
+    kRegionFieldNumber = 1,
+    kMinBytesFieldNumber = 2,
+  };
+  // string region = 1;
+  void clear_region() ;
+  const ::std::string& region() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_region(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_region();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_region();
+  void set_allocated_region(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_region() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_region(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_region();
+
+  public:
+  // uint64 min_bytes = 2;
+  void clear_min_bytes() ;
+  ::uint64_t min_bytes() const;
+  void set_min_bytes(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_min_bytes() const;
+  void _internal_set_min_bytes(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.SharedMemoryOffer)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 0,
-                                   0, 0,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 40,
                                    2>
       _table_;
 
@@ -915,36 +1085,52 @@ class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
   friend class ::google::protobuf::Arena::InternalHelper;
   using InternalArenaConstructable_ = void;
   using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const SharedMemoryOffer& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr region_;
+    ::uint64_t min_bytes_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull NullValue_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull SharedMemoryOffer_class_data_;
 // -------------------------------------------------------------------
 
-class ModuleSummary final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ModuleSummary) */ {
+class ResultHeader final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ResultHeader) */ {
  public:
-  inline ModuleSummary() : ModuleSummary(nullptr) {}
-  ~ModuleSummary() PROTOBUF_FINAL;
+  inline ResultHeader() : ResultHeader(nullptr) {}
+  ~ResultHeader() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ModuleSummary* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ResultHeader* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ModuleSummary));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ResultHeader));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ModuleSummary(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ResultHeader(::google::protobuf::internal::ConstantInitialized);
 
-  inline ModuleSummary(const ModuleSummary& from) : ModuleSummary(nullptr, from) {}
-  inline ModuleSummary(ModuleSummary&& from) noexcept
-      : ModuleSummary(nullptr, ::std::move(from)) {}
-  inline ModuleSummary& operator=(const ModuleSummary& from) {
+  inline ResultHeader(const ResultHeader& from) : ResultHeader(nullptr, from) {}
+  inline ResultHeader(ResultHeader&& from) noexcept
+      : ResultHeader(nullptr, ::std::move(from)) {}
+  inline ResultHeader& operator=(const ResultHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ModuleSummary& operator=(ModuleSummary&& from) noexcept {
+  inline ResultHeader& operator=(ResultHeader&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -972,13 +1158,13 @@ class ModuleSummary final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ModuleSummary& default_instance() {
-    return *reinterpret_cast<const ModuleSummary*>(
-        &_ModuleSummary_default_instance_);
+  static const ResultHeader& default_instance() {
+    return *reinterpret_cast<const ResultHeader*>(
+        &_ResultHeader_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 16;
-  friend void swap(ModuleSummary& a, ModuleSummary& b) { a.Swap(&b); }
-  inline void Swap(ModuleSummary* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 5;
+  friend void swap(ResultHeader& a, ResultHeader& b) { a.Swap(&b); }
+  inline void Swap(ResultHeader* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -986,7 +1172,7 @@ class ModuleSummary final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ModuleSummary* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ResultHeader* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -994,13 +1180,13 @@ class ModuleSummary final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ModuleSummary* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ModuleSummary>(arena);
+  ResultHeader* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ResultHeader>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ModuleSummary& from);
+  void CopyFrom(const ResultHeader& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ModuleSummary& from) { ModuleSummary::MergeImpl(*this, from); }
+  void MergeFrom(const ResultHeader& from) { ResultHeader::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1036,17 +1222,17 @@ class ModuleSummary final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ModuleSummary* PROTOBUF_NONNULL other);
+  void InternalSwap(ResultHeader* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ModuleSummary"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ResultHeader"; }
 
-  explicit ModuleSummary(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ModuleSummary(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ModuleSummary& from);
-  ModuleSummary(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ModuleSummary&& from) noexcept
-      : ModuleSummary(arena) {
+  explicit ResultHeader(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ResultHeader(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ResultHeader& from);
+  ResultHeader(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ResultHeader&& from) noexcept
+      : ResultHeader(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1063,67 +1249,35 @@ class ModuleSummary final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kNameFieldNumber = 1,
-    kDescriptionFieldNumber = 2,
-    kWordCountFieldNumber = 3,
-    kRuntimeSpecificFieldNumber = 4,
+    kResultCountFieldNumber = 1,
+    kSupportsCompactTemporalFieldNumber = 2,
   };
-  // string name = 1;
-  void clear_name() ;
-  const ::std::string& name() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_name(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_name();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_name();
-  void set_allocated_name(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_name() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_name(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_name();
-
-  public:
-  // string description = 2;
-  void clear_description() ;
-  const ::std::string& description() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_description();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_description();
-  void set_allocated_description(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_description() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_description(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_description();
-
-  public:
-  // int32 word_count = 3;
-  void clear_word_count() ;
-  ::int32_t word_count() const;
-  void set_word_count(::int32_t value);
+  // uint32 result_count = 1;
+  void clear_result_count() ;
+  ::uint32_t result_count() const;
+  void set_result_count(::uint32_t value);
 
   private:
-  ::int32_t _internal_word_count() const;
-  void _internal_set_word_count(::int32_t value);
+  ::uint32_t _internal_result_count() const;
+  void _internal_set_result_count(::uint32_t value);
 
   public:
-  // bool runtime_specific = 4;
-  void clear_runtime_specific() ;
-  bool runtime_specific() const;
-  void set_runtime_specific(bool value);
+  // bool supports_compact_temporal = 2;
+  void clear_supports_compact_temporal() ;
+  bool supports_compact_temporal() const;
+  void set_supports_compact_temporal(bool value);
 
   private:
-  bool _internal_runtime_specific() const;
-  void _internal_set_runtime_specific(bool value);
+  bool _internal_supports_compact_temporal() const;
+  void _internal_set_supports_compact_temporal(bool value);
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.ModuleSummary)
+  // @@protoc_insertion_point(class_scope:forthic.ResultHeader)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 4,
-                                   0, 45,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 0,
                                    2>
       _table_;
 
@@ -1141,45 +1295,44 @@ class ModuleSummary final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ModuleSummary& from_msg);
+        const ResultHeader& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr name_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    ::int32_t word_count_;
-    bool runtime_specific_;
+    ::uint32_t result_count_;
+    bool supports_compact_temporal_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ModuleSummary_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ResultHeader_class_data_;
 // -------------------------------------------------------------------
 
-class ListModulesRequest final : public ::google::protobuf::internal::ZeroFieldsBase
-/* @@protoc_insertion_point(class_definition:forthic.ListModulesRequest) */ {
+class RemoteRefValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.RemoteRefValue) */ {
  public:
-  inline ListModulesRequest() : ListModulesRequest(nullptr) {}
+  inline RemoteRefValue() : RemoteRefValue(nullptr) {}
+  ~RemoteRefValue() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListModulesRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(RemoteRefValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListModulesRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(RemoteRefValue));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListModulesRequest(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RemoteRefValue(::google::protobuf::internal::ConstantInitialized);
 
-  inline ListModulesRequest(const ListModulesRequest& from) : ListModulesRequest(nullptr, from) {}
-  inline ListModulesRequest(ListModulesRequest&& from) noexcept
-      : ListModulesRequest(nullptr, ::std::move(from)) {}
-  inline ListModulesRequest& operator=(const ListModulesRequest& from) {
+  inline RemoteRefValue(const RemoteRefValue& from) : RemoteRefValue(nullptr, from) {}
+  inline RemoteRefValue(RemoteRefValue&& from) noexcept
+      : RemoteRefValue(nullptr, ::std::move(from)) {}
+  inline RemoteRefValue& operator=(const RemoteRefValue& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ListModulesRequest& operator=(ListModulesRequest&& from) noexcept {
+  inline RemoteRefValue& operator=(RemoteRefValue&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1207,13 +1360,13 @@ class ListModulesRequest final : public ::google::protobuf::internal::ZeroFields
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ListModulesRequest& default_instance() {
-    return *reinterpret_cast<const ListModulesRequest*>(
-        &_ListModulesRequest_default_instance_);
+  static const RemoteRefValue& default_instance() {
+    return *reinterpret_cast<const RemoteRefValue*>(
+        &_RemoteRefValue_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 14;
-  friend void swap(ListModulesRequest& a, ListModulesRequest& b) { a.Swap(&b); }
-  inline void Swap(ListModulesRequest* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 20;
+  friend void swap(RemoteRefValue& a, RemoteRefValue& b) { a.Swap(&b); }
+  inline void Swap(RemoteRefValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1221,7 +1374,7 @@ class ListModulesRequest final : public ::google::protobuf::internal::ZeroFields
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ListModulesRequest* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(RemoteRefValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1229,32 +1382,59 @@ class ListModulesRequest final : public ::google::protobuf::internal::ZeroFields
 
   // implements Message ----------------------------------------------
 
-  ListModulesRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<ListModulesRequest>(arena);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ListModulesRequest& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ListModulesRequest& from) {
-    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  RemoteRefValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<RemoteRefValue>(arena);
   }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const RemoteRefValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const RemoteRefValue& from) { RemoteRefValue::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
 
   public:
   bool IsInitialized() const {
     return true;
   }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(RemoteRefValue* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ListModulesRequest"; }
+  static ::absl::string_view FullMessageName() { return "forthic.RemoteRefValue"; }
 
-  explicit ListModulesRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ListModulesRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ListModulesRequest& from);
-  ListModulesRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ListModulesRequest&& from) noexcept
-      : ListModulesRequest(arena) {
+  explicit RemoteRefValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  RemoteRefValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const RemoteRefValue& from);
+  RemoteRefValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, RemoteRefValue&& from) noexcept
+      : RemoteRefValue(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1270,12 +1450,46 @@ class ListModulesRequest final : public ::google::protobuf::internal::ZeroFields
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  // @@protoc_insertion_point(class_scope:forthic.ListModulesRequest)
+  enum : int {
+    kHandleIdFieldNumber = 1,
+    kRuntimeFieldNumber = 2,
+  };
+  // string handle_id = 1;
+  void clear_handle_id() ;
+  const ::std::string& handle_id() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_handle_id(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_handle_id();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_handle_id();
+  void set_allocated_handle_id(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_handle_id() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_handle_id(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_handle_id();
+
+  public:
+  // string runtime = 2;
+  void clear_runtime() ;
+  const ::std::string& runtime() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_runtime(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_runtime();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_runtime();
+  void set_allocated_runtime(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_runtime() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_runtime(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_runtime();
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.RemoteRefValue)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 0,
-                                   0, 0,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 47,
                                    2>
       _table_;
 
@@ -1285,36 +1499,52 @@ class ListModulesRequest final : public ::google::protobuf::internal::ZeroFields
   friend class ::google::protobuf::Arena::InternalHelper;
   using InternalArenaConstructable_ = void;
   using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const RemoteRefValue& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr handle_id_;
+    ::google::protobuf::internal::ArenaStringPtr runtime_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ListModulesRequest_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull RemoteRefValue_class_data_;
 // -------------------------------------------------------------------
 
-class InstantValue final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.InstantValue) */ {
+class ReleaseRefsResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ReleaseRefsResponse) */ {
  public:
-  inline InstantValue() : InstantValue(nullptr) {}
-  ~InstantValue() PROTOBUF_FINAL;
+  inline ReleaseRefsResponse() : ReleaseRefsResponse(nullptr) {}
+  ~ReleaseRefsResponse() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(InstantValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ReleaseRefsResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(InstantValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReleaseRefsResponse));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR InstantValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ReleaseRefsResponse(::google::protobuf::internal::ConstantInitialized);
 
-  inline InstantValue(const InstantValue& from) : InstantValue(nullptr, from) {}
-  inline InstantValue(InstantValue&& from) noexcept
-      : InstantValue(nullptr, ::std::move(from)) {}
-  inline InstantValue& operator=(const InstantValue& from) {
+  inline ReleaseRefsResponse(const ReleaseRefsResponse& from) : ReleaseRefsResponse(nullptr, from) {}
+  inline ReleaseRefsResponse(ReleaseRefsResponse&& from) noexcept
+      : ReleaseRefsResponse(nullptr, ::std::move(from)) {}
+  inline ReleaseRefsResponse& operator=(const ReleaseRefsResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InstantValue& operator=(InstantValue&& from) noexcept {
+  inline ReleaseRefsResponse& operator=(ReleaseRefsResponse&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1342,13 +1572,13 @@ class InstantValue final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InstantValue& default_instance() {
-    return *reinterpret_cast<const InstantValue*>(
-        &_InstantValue_default_instance_);
+  static const ReleaseRefsResponse& default_instance() {
+    return *reinterpret_cast<const ReleaseRefsResponse*>(
+        &_ReleaseRefsResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 9;
-  friend void swap(InstantValue& a, InstantValue& b) { a.Swap(&b); }
-  inline void Swap(InstantValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 24;
+  friend void swap(ReleaseRefsResponse& a, ReleaseRefsResponse& b) { a.Swap(&b); }
+  inline void Swap(ReleaseRefsResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1356,7 +1586,7 @@ class InstantValue final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InstantValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ReleaseRefsResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1364,13 +1594,13 @@ class InstantValue final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  InstantValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<InstantValue>(arena);
+  ReleaseRefsResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReleaseRefsResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const InstantValue& from);
+  void CopyFrom(const ReleaseRefsResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const InstantValue& from) { InstantValue::MergeImpl(*this, from); }
+  void MergeFrom(const ReleaseRefsResponse& from) { ReleaseRefsResponse::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1406,17 +1636,17 @@ class InstantValue final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(InstantValue* PROTOBUF_NONNULL other);
+  void InternalSwap(ReleaseRefsResponse* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.InstantValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ReleaseRefsResponse"; }
 
-  explicit InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const InstantValue& from);
-  InstantValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, InstantValue&& from) noexcept
-      : InstantValue(arena) {
+  explicit ReleaseRefsResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReleaseRefsResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseRefsResponse& from);
+  ReleaseRefsResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReleaseRefsResponse&& from) noexcept
+      : ReleaseRefsResponse(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1433,29 +1663,24 @@ class InstantValue final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kIso8601FieldNumber = 1,
+    kReleasedCountFieldNumber = 1,
   };
-  // string iso8601 = 1;
-  void clear_iso8601() ;
-  const ::std::string& iso8601() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_iso8601(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_iso8601();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_iso8601();
-  void set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value);
+  // int32 released_count = 1;
+  void clear_released_count() ;
+  ::int32_t released_count() const;
+  void set_released_count(::int32_t value);
 
   private:
-  const ::std::string& _internal_iso8601() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_iso8601(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_iso8601();
+  ::int32_t _internal_released_count() const;
+  void _internal_set_released_count(::int32_t value);
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.InstantValue)
+  // @@protoc_insertion_point(class_scope:forthic.ReleaseRefsResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 36,
+                                   0, 0,
                                    2>
       _table_;
 
@@ -1473,43 +1698,43 @@ class InstantValue final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const InstantValue& from_msg);
+        const ReleaseRefsResponse& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr iso8601_;
+    ::int32_t released_count_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull InstantValue_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ReleaseRefsResponse_class_data_;
 // -------------------------------------------------------------------
 
-class GetModuleInfoRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.GetModuleInfoRequest) */ {
+class ReleaseRefsRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ReleaseRefsRequest) */ {
  public:
-  inline GetModuleInfoRequest() : GetModuleInfoRequest(nullptr) {}
-  ~GetModuleInfoRequest() PROTOBUF_FINAL;
+  inline ReleaseRefsRequest() : ReleaseRefsRequest(nullptr) {}
+  ~ReleaseRefsRequest() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetModuleInfoRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ReleaseRefsRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetModuleInfoRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReleaseRefsRequest));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetModuleInfoRequest(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ReleaseRefsRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline GetModuleInfoRequest(const GetModuleInfoRequest& from) : GetModuleInfoRequest(nullptr, from) {}
-  inline GetModuleInfoRequest(GetModuleInfoRequest&& from) noexcept
-      : GetModuleInfoRequest(nullptr, ::std::move(from)) {}
-  inline GetModuleInfoRequest& operator=(const GetModuleInfoRequest& from) {
+  inline ReleaseRefsRequest(const ReleaseRefsRequest& from) : ReleaseRefsRequest(nullptr, from) {}
+  inline ReleaseRefsRequest(ReleaseRefsRequest&& from) noexcept
+      : ReleaseRefsRequest(nullptr, ::std::move(from)) {}
+  inline ReleaseRefsRequest& operator=(const ReleaseRefsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GetModuleInfoRequest& operator=(GetModuleInfoRequest&& from) noexcept {
+  inline ReleaseRefsRequest& operator=(ReleaseRefsRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1537,13 +1762,13 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GetModuleInfoRequest& default_instance() {
-    return *reinterpret_cast<const GetModuleInfoRequest*>(
-        &_GetModuleInfoRequest_default_instance_);
+  static const ReleaseRefsRequest& default_instance() {
+    return *reinterpret_cast<const ReleaseRefsRequest*>(
+        &_ReleaseRefsRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 17;
-  friend void swap(GetModuleInfoRequest& a, GetModuleInfoRequest& b) { a.Swap(&b); }
-  inline void Swap(GetModuleInfoRequest* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 23;
+  friend void swap(ReleaseRefsRequest& a, ReleaseRefsRequest& b) { a.Swap(&b); }
+  inline void Swap(ReleaseRefsRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1551,7 +1776,7 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GetModuleInfoRequest* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ReleaseRefsRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1559,13 +1784,13 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  GetModuleInfoRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetModuleInfoRequest>(arena);
+  ReleaseRefsRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReleaseRefsRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetModuleInfoRequest& from);
+  void CopyFrom(const ReleaseRefsRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetModuleInfoRequest& from) { GetModuleInfoRequest::MergeImpl(*this, from); }
+  void MergeFrom(const ReleaseRefsRequest& from) { ReleaseRefsRequest::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1601,17 +1826,17 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetModuleInfoRequest* PROTOBUF_NONNULL other);
+  void InternalSwap(ReleaseRefsRequest* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.GetModuleInfoRequest"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ReleaseRefsRequest"; }
 
-  explicit GetModuleInfoRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  GetModuleInfoRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const GetModuleInfoRequest& from);
-  GetModuleInfoRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, GetModuleInfoRequest&& from) noexcept
-      : GetModuleInfoRequest(arena) {
+  explicit ReleaseRefsRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReleaseRefsRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseRefsRequest& from);
+  ReleaseRefsRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReleaseRefsRequest&& from) noexcept
+      : ReleaseRefsRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1628,29 +1853,36 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kModuleNameFieldNumber = 1,
+    kHandleIdsFieldNumber = 1,
   };
-  // string module_name = 1;
-  void clear_module_name() ;
-  const ::std::string& module_name() const;
+  // repeated string handle_ids = 1;
+  int handle_ids_size() const;
+  private:
+  int _internal_handle_ids_size() const;
+
+  public:
+  void clear_handle_ids() ;
+  const ::std::string& handle_ids(int index) const;
+  ::std::string* PROTOBUF_NONNULL mutable_handle_ids(int index);
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_module_name(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_module_name();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_module_name();
-  void set_allocated_module_name(::std::string* PROTOBUF_NULLABLE value);
+  void set_handle_ids(int index, Arg_&& value, Args_... args);
+  ::std::string* PROTOBUF_NONNULL add_handle_ids();
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void add_handle_ids(Arg_&& value, Args_... args);
+  const ::google::protobuf::RepeatedPtrField<::std::string>& handle_ids() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_handle_ids();
 
   private:
-  const ::std::string& _internal_module_name() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_module_name(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_module_name();
+  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_handle_ids() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_handle_ids();
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.GetModuleInfoRequest)
+  // @@protoc_insertion_point(class_scope:forthic.ReleaseRefsRequest)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 48,
+                                   0, 45,
                                    2>
       _table_;
 
@@ -1668,90 +1900,51 @@ class GetModuleInfoRequest final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const GetModuleInfoRequest& from_msg);
+        const ReleaseRefsRequest& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr module_name_;
+    ::google::protobuf::RepeatedPtrField<::std::string> handle_ids_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull GetModuleInfoRequest_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ReleaseRefsRequest_class_data_;
 // -------------------------------------------------------------------
 
-class ErrorInfo_ContextEntry_DoNotUse final
-    : public ::google::protobuf::internal::MapEntry<::std::string, ::std::string,
-                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
+class PlainDateValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.PlainDateValue) */ {
  public:
-  using SuperType =
-      ::google::protobuf::internal::MapEntry<::std::string, ::std::string,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
-  ErrorInfo_ContextEntry_DoNotUse();
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ErrorInfo_ContextEntry_DoNotUse(::google::protobuf::internal::ConstantInitialized);
-  explicit ErrorInfo_ContextEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr const void* PROTOBUF_NONNULL internal_default_instance() {
-    return &_ErrorInfo_ContextEntry_DoNotUse_default_instance_;
+  inline PlainDateValue() : PlainDateValue(nullptr) {}
+  ~PlainDateValue() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(PlainDateValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlainDateValue));
   }
+#endif
 
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR PlainDateValue(::google::protobuf::internal::ConstantInitialized);
 
-  static constexpr auto InternalGenerateClassData_();
-
- private:
-  friend class ::google::protobuf::MessageLite;
-  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
-
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 47,
-                                   2>
-      _table_;
-
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-};
-extern const ::google::protobuf::internal::ClassDataFull ErrorInfo_ContextEntry_DoNotUse_class_data_;
-// -------------------------------------------------------------------
-
-class ListModulesResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ListModulesResponse) */ {
- public:
-  inline ListModulesResponse() : ListModulesResponse(nullptr) {}
-  ~ListModulesResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ListModulesResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListModulesResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ListModulesResponse(::google::protobuf::internal::ConstantInitialized);
-
-  inline ListModulesResponse(const ListModulesResponse& from) : ListModulesResponse(nullptr, from) {}
-  inline ListModulesResponse(ListModulesResponse&& from) noexcept
-      : ListModulesResponse(nullptr, ::std::move(from)) {}
-  inline ListModulesResponse& operator=(const ListModulesResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ListModulesResponse& operator=(ListModulesResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
+  inline PlainDateValue(const PlainDateValue& from) : PlainDateValue(nullptr, from) {}
+  inline PlainDateValue(PlainDateValue&& from) noexcept
+      : PlainDateValue(nullptr, ::std::move(from)) {}
+  inline PlainDateValue& operator=(const PlainDateValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PlainDateValue& operator=(PlainDateValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
   inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
       ABSL_ATTRIBUTE_LIFETIME_BOUND {
@@ -1771,13 +1964,13 @@ class ListModulesResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ListModulesResponse& default_instance() {
-    return *reinterpret_cast<const ListModulesResponse*>(
-        &_ListModulesResponse_default_instance_);
+  static const PlainDateValue& default_instance() {
+    return *reinterpret_cast<const PlainDateValue*>(
+        &_PlainDateValue_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 15;
-  friend void swap(ListModulesResponse& a, ListModulesResponse& b) { a.Swap(&b); }
-  inline void Swap(ListModulesResponse* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 18;
+  friend void swap(PlainDateValue& a, PlainDateValue& b) { a.Swap(&b); }
+  inline void Swap(PlainDateValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1785,7 +1978,7 @@ class ListModulesResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ListModulesResponse* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(PlainDateValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1793,13 +1986,13 @@ class ListModulesResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ListModulesResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ListModulesResponse>(arena);
+  PlainDateValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<PlainDateValue>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ListModulesResponse& from);
+  void CopyFrom(const PlainDateValue& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ListModulesResponse& from) { ListModulesResponse::MergeImpl(*this, from); }
+  void MergeFrom(const PlainDateValue& from) { PlainDateValue::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1835,17 +2028,17 @@ class ListModulesResponse final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ListModulesResponse* PROTOBUF_NONNULL other);
+  void InternalSwap(PlainDateValue* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ListModulesResponse"; }
+  static ::absl::string_view FullMessageName() { return "forthic.PlainDateValue"; }
 
-  explicit ListModulesResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ListModulesResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ListModulesResponse& from);
-  ListModulesResponse(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ListModulesResponse&& from) noexcept
-      : ListModulesResponse(arena) {
+  explicit PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  PlainDateValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const PlainDateValue& from);
+  PlainDateValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, PlainDateValue&& from) noexcept
+      : PlainDateValue(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1862,31 +2055,41 @@ class ListModulesResponse final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kModulesFieldNumber = 1,
+    kIso8601DateFieldNumber = 1,
+    kDaysSinceEpochFieldNumber = 2,
   };
-  // repeated .forthic.ModuleSummary modules = 1;
-  int modules_size() const;
+  // string iso8601_date = 1;
+  void clear_iso8601_date() ;
+  const ::std::string& iso8601_date() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_iso8601_date(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_iso8601_date();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_iso8601_date();
+  void set_allocated_iso8601_date(::std::string* PROTOBUF_NULLABLE value);
+
   private:
-  int _internal_modules_size() const;
+  const ::std::string& _internal_iso8601_date() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_iso8601_date(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_iso8601_date();
 
   public:
-  void clear_modules() ;
-  ::forthic::ModuleSummary* PROTOBUF_NONNULL mutable_modules(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>* PROTOBUF_NONNULL mutable_modules();
+  // optional int32 days_since_epoch = 2;
+  bool has_days_since_epoch() const;
+  void clear_days_since_epoch() ;
+  ::int32_t days_since_epoch() const;
+  void set_days_since_epoch(::int32_t value);
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>& _internal_modules() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>* PROTOBUF_NONNULL _internal_mutable_modules();
+  ::int32_t _internal_days_since_epoch() const;
+  void _internal_set_days_since_epoch(::int32_t value);
+
   public:
-  const ::forthic::ModuleSummary& modules(int index) const;
-  ::forthic::ModuleSummary* PROTOBUF_NONNULL add_modules();
-  const ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>& modules() const;
-  // @@protoc_insertion_point(class_scope:forthic.ListModulesResponse)
+  // @@protoc_insertion_point(class_scope:forthic.PlainDateValue)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   1, 0,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 43,
                                    2>
       _table_;
 
@@ -1904,43 +2107,43 @@ class ListModulesResponse final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ListModulesResponse& from_msg);
+        const PlainDateValue& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::ModuleSummary > modules_;
+    ::google::protobuf::internal::ArenaStringPtr iso8601_date_;
+    ::int32_t days_since_epoch_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ListModulesResponse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull PlainDateValue_class_data_;
 // -------------------------------------------------------------------
 
-class GetModuleInfoResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.GetModuleInfoResponse) */ {
+class NullValue final : public ::google::protobuf::internal::ZeroFieldsBase
+/* @@protoc_insertion_point(class_definition:forthic.NullValue) */ {
  public:
-  inline GetModuleInfoResponse() : GetModuleInfoResponse(nullptr) {}
-  ~GetModuleInfoResponse() PROTOBUF_FINAL;
+  inline NullValue() : NullValue(nullptr) {}
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GetModuleInfoResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(NullValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetModuleInfoResponse));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(NullValue));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GetModuleInfoResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR NullValue(::google::protobuf::internal::ConstantInitialized);
 
-  inline GetModuleInfoResponse(const GetModuleInfoResponse& from) : GetModuleInfoResponse(nullptr, from) {}
-  inline GetModuleInfoResponse(GetModuleInfoResponse&& from) noexcept
-      : GetModuleInfoResponse(nullptr, ::std::move(from)) {}
-  inline GetModuleInfoResponse& operator=(const GetModuleInfoResponse& from) {
+  inline NullValue(const NullValue& from) : NullValue(nullptr, from) {}
+  inline NullValue(NullValue&& from) noexcept
+      : NullValue(nullptr, ::std::move(from)) {}
+  inline NullValue& operator=(const NullValue& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GetModuleInfoResponse& operator=(GetModuleInfoResponse&& from) noexcept {
+  inline NullValue& operator=(NullValue&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1968,13 +2171,13 @@ class GetModuleInfoResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GetModuleInfoResponse& default_instance() {
-    return *reinterpret_cast<const GetModuleInfoResponse*>(
-        &_GetModuleInfoResponse_default_instance_);
+  static const NullValue& default_instance() {
+    return *reinterpret_cast<const NullValue*>(
+        &_NullValue_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 18;
-  friend void swap(GetModuleInfoResponse& a, GetModuleInfoResponse& b) { a.Swap(&b); }
-  inline void Swap(GetModuleInfoResponse* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 13;
+  friend void swap(NullValue& a, NullValue& b) { a.Swap(&b); }
+  inline void Swap(NullValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1982,7 +2185,7 @@ class GetModuleInfoResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GetModuleInfoResponse* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(NullValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1990,59 +2193,32 @@ class GetModuleInfoResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  GetModuleInfoResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GetModuleInfoResponse>(arena);
+  NullValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<NullValue>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const NullValue& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const NullValue& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GetModuleInfoResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GetModuleInfoResponse& from) { GetModuleInfoResponse::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
 
   public:
   bool IsInitialized() const {
     return true;
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(GetModuleInfoResponse* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.GetModuleInfoResponse"; }
+  static ::absl::string_view FullMessageName() { return "forthic.NullValue"; }
 
-  explicit GetModuleInfoResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  GetModuleInfoResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const GetModuleInfoResponse& from);
-  GetModuleInfoResponse(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, GetModuleInfoResponse&& from) noexcept
-      : GetModuleInfoResponse(arena) {
+  explicit NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  NullValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const NullValue& from);
+  NullValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, NullValue&& from) noexcept
+      : NullValue(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -2058,120 +2234,51 @@ class GetModuleInfoResponse final : public ::google::protobuf::Message
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  enum : int {
-    kWordsFieldNumber = 3,
-    kNameFieldNumber = 1,
-    kDescriptionFieldNumber = 2,
-  };
-  // repeated .forthic.WordInfo words = 3;
-  int words_size() const;
-  private:
-  int _internal_words_size() const;
+  // @@protoc_insertion_point(class_scope:forthic.NullValue)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 0,
+                                   0, 0,
+                                   2>
+      _table_;
 
-  public:
-  void clear_words() ;
-  ::forthic::WordInfo* PROTOBUF_NONNULL mutable_words(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>* PROTOBUF_NONNULL mutable_words();
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
 
-  private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>& _internal_words() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>* PROTOBUF_NONNULL _internal_mutable_words();
-  public:
-  const ::forthic::WordInfo& words(int index) const;
-  ::forthic::WordInfo* PROTOBUF_NONNULL add_words();
-  const ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>& words() const;
-  // string name = 1;
-  void clear_name() ;
-  const ::std::string& name() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_name(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_name();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_name();
-  void set_allocated_name(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_name() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_name(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_name();
-
-  public:
-  // string description = 2;
-  void clear_description() ;
-  const ::std::string& description() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_description(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_description();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_description();
-  void set_allocated_description(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_description() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_description(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_description();
-
-  public:
-  // @@protoc_insertion_point(class_scope:forthic.GetModuleInfoResponse)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 3,
-                                   1, 53,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const GetModuleInfoResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::WordInfo > words_;
-    ::google::protobuf::internal::ArenaStringPtr name_;
-    ::google::protobuf::internal::ArenaStringPtr description_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull GetModuleInfoResponse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull NullValue_class_data_;
 // -------------------------------------------------------------------
 
-class ErrorInfo final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ErrorInfo) */ {
+class ModuleSummary final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ModuleSummary) */ {
  public:
-  inline ErrorInfo() : ErrorInfo(nullptr) {}
-  ~ErrorInfo() PROTOBUF_FINAL;
+  inline ModuleSummary() : ModuleSummary(nullptr) {}
+  ~ModuleSummary() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ErrorInfo* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ModuleSummary* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ErrorInfo));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ModuleSummary));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ErrorInfo(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ModuleSummary(::google::protobuf::internal::ConstantInitialized);
 
-  inline ErrorInfo(const ErrorInfo& from) : ErrorInfo(nullptr, from) {}
-  inline ErrorInfo(ErrorInfo&& from) noexcept
-      : ErrorInfo(nullptr, ::std::move(from)) {}
-  inline ErrorInfo& operator=(const ErrorInfo& from) {
+  inline ModuleSummary(const ModuleSummary& from) : ModuleSummary(nullptr, from) {}
+  inline ModuleSummary(ModuleSummary&& from) noexcept
+      : ModuleSummary(nullptr, ::std::move(from)) {}
+  inline ModuleSummary& operator=(const ModuleSummary& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ErrorInfo& operator=(ErrorInfo&& from) noexcept {
+  inline ModuleSummary& operator=(ModuleSummary&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -2199,13 +2306,13 @@ class ErrorInfo final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ErrorInfo& default_instance() {
-    return *reinterpret_cast<const ErrorInfo*>(
-        &_ErrorInfo_default_instance_);
+  static const ModuleSummary& default_instance() {
+    return *reinterpret_cast<const ModuleSummary*>(
+        &_ModuleSummary_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 13;
-  friend void swap(ErrorInfo& a, ErrorInfo& b) { a.Swap(&b); }
-  inline void Swap(ErrorInfo* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 29;
+  friend void swap(ModuleSummary& a, ModuleSummary& b) { a.Swap(&b); }
+  inline void Swap(ModuleSummary* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -2213,7 +2320,7 @@ class ErrorInfo final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ErrorInfo* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ModuleSummary* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2221,13 +2328,13 @@ class ErrorInfo final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ErrorInfo* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ErrorInfo>(arena);
+  ModuleSummary* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ModuleSummary>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ErrorInfo& from);
+  void CopyFrom(const ModuleSummary& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ErrorInfo& from) { ErrorInfo::MergeImpl(*this, from); }
+  void MergeFrom(const ModuleSummary& from) { ModuleSummary::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -2263,17 +2370,17 @@ class ErrorInfo final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ErrorInfo* PROTOBUF_NONNULL other);
+  void InternalSwap(ModuleSummary* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ErrorInfo"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ModuleSummary"; }
 
-  explicit ErrorInfo(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ErrorInfo(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ErrorInfo& from);
-  ErrorInfo(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ErrorInfo&& from) noexcept
-      : ErrorInfo(arena) {
+  explicit ModuleSummary(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ModuleSummary(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ModuleSummary& from);
+  ModuleSummary(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ModuleSummary&& from) noexcept
+      : ModuleSummary(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -2290,136 +2397,69 @@ class ErrorInfo final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kStackTraceFieldNumber = 3,
-    kMessageFieldNumber = 1,
-    kRuntimeFieldNumber = 2,
-    kErrorTypeFieldNumber = 4,
-    kWordLocationFieldNumber = 5,
-    kModuleNameFieldNumber = 6,
-    kContextFieldNumber = 7,
+    kNameFieldNumber = 1,
+    kDescriptionFieldNumber = 2,
+    kWordCountFieldNumber = 3,
+    kRuntimeSpecificFieldNumber = 4,
   };
-  // repeated string stack_trace = 3;
-  int stack_trace_size() const;
-  private:
-  int _internal_stack_trace_size() const;
-
-  public:
-  void clear_stack_trace() ;
-  const ::std::string& stack_trace(int index) const;
-  ::std::string* PROTOBUF_NONNULL mutable_stack_trace(int index);
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_stack_trace(int index, Arg_&& value, Args_... args);
-  ::std::string* PROTOBUF_NONNULL add_stack_trace();
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void add_stack_trace(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<::std::string>& stack_trace() const;
-  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_stack_trace();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_stack_trace() const;
-  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_stack_trace();
-
-  public:
-  // string message = 1;
-  void clear_message() ;
-  const ::std::string& message() const;
+  // string name = 1;
+  void clear_name() ;
+  const ::std::string& name() const;
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_message();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_message();
-  void set_allocated_message(::std::string* PROTOBUF_NULLABLE value);
+  void set_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_name();
+  void set_allocated_name(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::std::string& _internal_message() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_message(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_message();
+  const ::std::string& _internal_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_name();
 
   public:
-  // string runtime = 2;
-  void clear_runtime() ;
-  const ::std::string& runtime() const;
+  // string description = 2;
+  void clear_description() ;
+  const ::std::string& description() const;
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_runtime(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_runtime();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_runtime();
-  void set_allocated_runtime(::std::string* PROTOBUF_NULLABLE value);
+  void set_description(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_description();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_description();
+  void set_allocated_description(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::std::string& _internal_runtime() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_runtime(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_runtime();
+  const ::std::string& _internal_description() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_description(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_description();
 
   public:
-  // string error_type = 4;
-  void clear_error_type() ;
-  const ::std::string& error_type() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_error_type(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_error_type();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_error_type();
-  void set_allocated_error_type(::std::string* PROTOBUF_NULLABLE value);
+  // int32 word_count = 3;
+  void clear_word_count() ;
+  ::int32_t word_count() const;
+  void set_word_count(::int32_t value);
 
   private:
-  const ::std::string& _internal_error_type() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_error_type(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_error_type();
+  ::int32_t _internal_word_count() const;
+  void _internal_set_word_count(::int32_t value);
 
   public:
-  // optional string word_location = 5;
-  bool has_word_location() const;
-  void clear_word_location() ;
-  const ::std::string& word_location() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_word_location(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_word_location();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_word_location();
-  void set_allocated_word_location(::std::string* PROTOBUF_NULLABLE value);
+  // bool runtime_specific = 4;
+  void clear_runtime_specific() ;
+  bool runtime_specific() const;
+  void set_runtime_specific(bool value);
 
   private:
-  const ::std::string& _internal_word_location() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_word_location(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_word_location();
+  bool _internal_runtime_specific() const;
+  void _internal_set_runtime_specific(bool value);
 
   public:
-  // optional string module_name = 6;
-  bool has_module_name() const;
-  void clear_module_name() ;
-  const ::std::string& module_name() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_module_name(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_module_name();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_module_name();
-  void set_allocated_module_name(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_module_name() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_module_name(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_module_name();
-
-  public:
-  // map<string, string> context = 7;
-  int context_size() const;
-  private:
-  int _internal_context_size() const;
-
-  public:
-  void clear_context() ;
-  const ::google::protobuf::Map<::std::string, ::std::string>& context() const;
-  ::google::protobuf::Map<::std::string, ::std::string>* PROTOBUF_NONNULL mutable_context();
-
-  private:
-  const ::google::protobuf::Map<::std::string, ::std::string>& _internal_context() const;
-  ::google::protobuf::Map<::std::string, ::std::string>* PROTOBUF_NONNULL _internal_mutable_context();
-
-  public:
-  // @@protoc_insertion_point(class_scope:forthic.ErrorInfo)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<3, 7,
-                                   1, 92,
-                                   2>
-      _table_;
+  // @@protoc_insertion_point(class_scope:forthic.ModuleSummary)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
+                                   0, 45,
+                                   2>
+      _table_;
 
   friend class ::google::protobuf::MessageLite;
   friend class ::google::protobuf::Arena;
@@ -2435,52 +2475,45 @@ class ErrorInfo final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ErrorInfo& from_msg);
+        const ModuleSummary& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField<::std::string> stack_trace_;
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    ::google::protobuf::internal::ArenaStringPtr runtime_;
-    ::google::protobuf::internal::ArenaStringPtr error_type_;
-    ::google::protobuf::internal::ArenaStringPtr word_location_;
-    ::google::protobuf::internal::ArenaStringPtr module_name_;
-    ::google::protobuf::internal::MapField<ErrorInfo_ContextEntry_DoNotUse, ::std::string, ::std::string,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
-        context_;
+    ::google::protobuf::internal::ArenaStringPtr name_;
+    ::google::protobuf::internal::ArenaStringPtr description_;
+    ::int32_t word_count_;
+    bool runtime_specific_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ErrorInfo_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ModuleSummary_class_data_;
 // -------------------------------------------------------------------
 
-class ArrayValue final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ArrayValue) */ {
+class ListModulesRequest final : public ::google::protobuf::internal::ZeroFieldsBase
+/* @@protoc_insertion_point(class_definition:forthic.ListModulesRequest) */ {
  public:
-  inline ArrayValue() : ArrayValue(nullptr) {}
-  ~ArrayValue() PROTOBUF_FINAL;
+  inline ListModulesRequest() : ListModulesRequest(nullptr) {}
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ArrayValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ListModulesRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ArrayValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListModulesRequest));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ArrayValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ListModulesRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline ArrayValue(const ArrayValue& from) : ArrayValue(nullptr, from) {}
-  inline ArrayValue(ArrayValue&& from) noexcept
-      : ArrayValue(nullptr, ::std::move(from)) {}
-  inline ArrayValue& operator=(const ArrayValue& from) {
+  inline ListModulesRequest(const ListModulesRequest& from) : ListModulesRequest(nullptr, from) {}
+  inline ListModulesRequest(ListModulesRequest&& from) noexcept
+      : ListModulesRequest(nullptr, ::std::move(from)) {}
+  inline ListModulesRequest& operator=(const ListModulesRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ArrayValue& operator=(ArrayValue&& from) noexcept {
+  inline ListModulesRequest& operator=(ListModulesRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -2508,13 +2541,13 @@ class ArrayValue final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ArrayValue& default_instance() {
-    return *reinterpret_cast<const ArrayValue*>(
-        &_ArrayValue_default_instance_);
+  static const ListModulesRequest& default_instance() {
+    return *reinterpret_cast<const ListModulesRequest*>(
+        &_ListModulesRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 6;
-  friend void swap(ArrayValue& a, ArrayValue& b) { a.Swap(&b); }
-  inline void Swap(ArrayValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 27;
+  friend void swap(ListModulesRequest& a, ListModulesRequest& b) { a.Swap(&b); }
+  inline void Swap(ListModulesRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -2522,7 +2555,7 @@ class ArrayValue final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ArrayValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ListModulesRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2530,59 +2563,32 @@ class ArrayValue final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ArrayValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ArrayValue>(arena);
+  ListModulesRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::internal::ZeroFieldsBase::DefaultConstruct<ListModulesRequest>(arena);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ListModulesRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ListModulesRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ArrayValue& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ArrayValue& from) { ArrayValue::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
 
   public:
   bool IsInitialized() const {
     return true;
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ArrayValue* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ArrayValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ListModulesRequest"; }
 
-  explicit ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ArrayValue& from);
-  ArrayValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ArrayValue&& from) noexcept
-      : ArrayValue(arena) {
+  explicit ListModulesRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ListModulesRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ListModulesRequest& from);
+  ListModulesRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ListModulesRequest&& from) noexcept
+      : ListModulesRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -2598,32 +2604,12 @@ class ArrayValue final : public ::google::protobuf::Message
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
-  enum : int {
-    kItemsFieldNumber = 1,
-  };
-  // repeated .forthic.StackValue items = 1;
-  int items_size() const;
-  private:
-  int _internal_items_size() const;
-
-  public:
-  void clear_items() ;
-  ::forthic::StackValue* PROTOBUF_NONNULL mutable_items(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_items();
-
-  private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_items() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_items();
-  public:
-  const ::forthic::StackValue& items(int index) const;
-  ::forthic::StackValue* PROTOBUF_NONNULL add_items();
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& items() const;
-  // @@protoc_insertion_point(class_scope:forthic.ArrayValue)
+  // @@protoc_insertion_point(class_scope:forthic.ListModulesRequest)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   1, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 0,
+                                   0, 0,
                                    2>
       _table_;
 
@@ -2633,51 +2619,36 @@ class ArrayValue final : public ::google::protobuf::Message
   friend class ::google::protobuf::Arena::InternalHelper;
   using InternalArenaConstructable_ = void;
   using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ArrayValue& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > items_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ArrayValue_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ListModulesRequest_class_data_;
 // -------------------------------------------------------------------
 
-class RecordValue final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.RecordValue) */ {
+class InstantValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.InstantValue) */ {
  public:
-  inline RecordValue() : RecordValue(nullptr) {}
-  ~RecordValue() PROTOBUF_FINAL;
+  inline InstantValue() : InstantValue(nullptr) {}
+  ~InstantValue() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(RecordValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(InstantValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(RecordValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(InstantValue));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR RecordValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR InstantValue(::google::protobuf::internal::ConstantInitialized);
 
-  inline RecordValue(const RecordValue& from) : RecordValue(nullptr, from) {}
-  inline RecordValue(RecordValue&& from) noexcept
-      : RecordValue(nullptr, ::std::move(from)) {}
-  inline RecordValue& operator=(const RecordValue& from) {
+  inline InstantValue(const InstantValue& from) : InstantValue(nullptr, from) {}
+  inline InstantValue(InstantValue&& from) noexcept
+      : InstantValue(nullptr, ::std::move(from)) {}
+  inline InstantValue& operator=(const InstantValue& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RecordValue& operator=(RecordValue&& from) noexcept {
+  inline InstantValue& operator=(InstantValue&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -2705,13 +2676,13 @@ class RecordValue final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RecordValue& default_instance() {
-    return *reinterpret_cast<const RecordValue*>(
-        &_RecordValue_default_instance_);
+  static const InstantValue& default_instance() {
+    return *reinterpret_cast<const InstantValue*>(
+        &_InstantValue_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 8;
-  friend void swap(RecordValue& a, RecordValue& b) { a.Swap(&b); }
-  inline void Swap(RecordValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 17;
+  friend void swap(InstantValue& a, InstantValue& b) { a.Swap(&b); }
+  inline void Swap(InstantValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -2719,7 +2690,7 @@ class RecordValue final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RecordValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(InstantValue* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2727,13 +2698,13 @@ class RecordValue final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  RecordValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<RecordValue>(arena);
+  InstantValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<InstantValue>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const RecordValue& from);
+  void CopyFrom(const InstantValue& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const RecordValue& from) { RecordValue::MergeImpl(*this, from); }
+  void MergeFrom(const InstantValue& from) { InstantValue::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -2769,17 +2740,17 @@ class RecordValue final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(RecordValue* PROTOBUF_NONNULL other);
+  void InternalSwap(InstantValue* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.RecordValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.InstantValue"; }
 
-  explicit RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const RecordValue& from);
-  RecordValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, RecordValue&& from) noexcept
-      : RecordValue(arena) {
+  explicit InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  InstantValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const InstantValue& from);
+  InstantValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, InstantValue&& from) noexcept
+      : InstantValue(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -2796,29 +2767,41 @@ class RecordValue final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kFieldsFieldNumber = 1,
+    kIso8601FieldNumber = 1,
+    kEpochNanosFieldNumber = 2,
   };
-  // map<string, .forthic.StackValue> fields = 1;
-  int fields_size() const;
-  private:
-  int _internal_fields_size() const;
+  // string iso8601 = 1;
+  void clear_iso8601() ;
+  const ::std::string& iso8601() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_iso8601(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_iso8601();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_iso8601();
+  void set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value);
 
-  public:
-  void clear_fields() ;
-  const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& fields() const;
-  ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL mutable_fields();
+  private:
+  const ::std::string& _internal_iso8601() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_iso8601(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_iso8601();
+
+  public:
+  // optional int64 epoch_nanos = 2;
+  bool has_epoch_nanos() const;
+  void clear_epoch_nanos() ;
+  ::int64_t epoch_nanos() const;
+  void set_epoch_nanos(::int64_t value);
 
   private:
-  const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& _internal_fields() const;
-  ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_fields();
+  ::int64_t _internal_epoch_nanos() const;
+  void _internal_set_epoch_nanos(::int64_t value);
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.RecordValue)
+  // @@protoc_insertion_point(class_scope:forthic.InstantValue)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   2, 34,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 36,
                                    2>
       _table_;
 
@@ -2836,85 +2819,44 @@ class RecordValue final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const RecordValue& from_msg);
+        const InstantValue& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::MapField<RecordValue_FieldsEntry_DoNotUse, ::std::string, ::forthic::StackValue,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
-        fields_;
+    ::google::protobuf::internal::ArenaStringPtr iso8601_;
+    ::int64_t epoch_nanos_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull RecordValue_class_data_;
-// -------------------------------------------------------------------
-
-class RecordValue_FieldsEntry_DoNotUse final
-    : public ::google::protobuf::internal::MapEntry<::std::string, ::google::protobuf::Message,
-                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                             ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
- public:
-  using SuperType =
-      ::google::protobuf::internal::MapEntry<::std::string, ::google::protobuf::Message,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
-  RecordValue_FieldsEntry_DoNotUse();
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR RecordValue_FieldsEntry_DoNotUse(::google::protobuf::internal::ConstantInitialized);
-  explicit RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr const void* PROTOBUF_NONNULL internal_default_instance() {
-    return &_RecordValue_FieldsEntry_DoNotUse_default_instance_;
-  }
-
-
-  static constexpr auto InternalGenerateClassData_();
-
- private:
-  friend class ::google::protobuf::MessageLite;
-  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
-
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   1, 43,
-                                   2>
-      _table_;
-
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-};
-extern const ::google::protobuf::internal::ClassDataFull RecordValue_FieldsEntry_DoNotUse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull InstantValue_class_data_;
 // -------------------------------------------------------------------
 
-class StackValue final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.StackValue) */ {
+class GetModuleInfoRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.GetModuleInfoRequest) */ {
  public:
-  inline StackValue() : StackValue(nullptr) {}
-  ~StackValue() PROTOBUF_FINAL;
+  inline GetModuleInfoRequest() : GetModuleInfoRequest(nullptr) {}
+  ~GetModuleInfoRequest() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(StackValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(GetModuleInfoRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(StackValue));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetModuleInfoRequest));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR StackValue(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR GetModuleInfoRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline StackValue(const StackValue& from) : StackValue(nullptr, from) {}
-  inline StackValue(StackValue&& from) noexcept
-      : StackValue(nullptr, ::std::move(from)) {}
-  inline StackValue& operator=(const StackValue& from) {
+  inline GetModuleInfoRequest(const GetModuleInfoRequest& from) : GetModuleInfoRequest(nullptr, from) {}
+  inline GetModuleInfoRequest(GetModuleInfoRequest&& from) noexcept
+      : GetModuleInfoRequest(nullptr, ::std::move(from)) {}
+  inline GetModuleInfoRequest& operator=(const GetModuleInfoRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StackValue& operator=(StackValue&& from) noexcept {
+  inline GetModuleInfoRequest& operator=(GetModuleInfoRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -2942,26 +2884,13 @@ class StackValue final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StackValue& default_instance() {
-    return *reinterpret_cast<const StackValue*>(
-        &_StackValue_default_instance_);
+  static const GetModuleInfoRequest& default_instance() {
+    return *reinterpret_cast<const GetModuleInfoRequest*>(
+        &_GetModuleInfoRequest_default_instance_);
   }
-  enum ValueCase {
-    kIntValue = 1,
-    kStringValue = 2,
-    kBoolValue = 3,
-    kFloatValue = 4,
-    kNullValue = 5,
-    kArrayValue = 6,
-    kRecordValue = 7,
-    kInstantValue = 8,
-    kPlainDateValue = 9,
-    kZonedDatetimeValue = 10,
-    VALUE_NOT_SET = 0,
-  };
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(StackValue& a, StackValue& b) { a.Swap(&b); }
-  inline void Swap(StackValue* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 30;
+  friend void swap(GetModuleInfoRequest& a, GetModuleInfoRequest& b) { a.Swap(&b); }
+  inline void Swap(GetModuleInfoRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -2969,7 +2898,7 @@ class StackValue final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StackValue* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(GetModuleInfoRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2977,13 +2906,13 @@ class StackValue final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  StackValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<StackValue>(arena);
+  GetModuleInfoRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetModuleInfoRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StackValue& from);
+  void CopyFrom(const GetModuleInfoRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const StackValue& from) { StackValue::MergeImpl(*this, from); }
+  void MergeFrom(const GetModuleInfoRequest& from) { GetModuleInfoRequest::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -3019,17 +2948,17 @@ class StackValue final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(StackValue* PROTOBUF_NONNULL other);
+  void InternalSwap(GetModuleInfoRequest* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.StackValue"; }
+  static ::absl::string_view FullMessageName() { return "forthic.GetModuleInfoRequest"; }
 
-  explicit StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StackValue& from);
-  StackValue(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StackValue&& from) noexcept
-      : StackValue(arena) {
+  explicit GetModuleInfoRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  GetModuleInfoRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const GetModuleInfoRequest& from);
+  GetModuleInfoRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, GetModuleInfoRequest&& from) noexcept
+      : GetModuleInfoRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -3046,267 +2975,83 @@ class StackValue final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kIntValueFieldNumber = 1,
-    kStringValueFieldNumber = 2,
-    kBoolValueFieldNumber = 3,
-    kFloatValueFieldNumber = 4,
-    kNullValueFieldNumber = 5,
-    kArrayValueFieldNumber = 6,
-    kRecordValueFieldNumber = 7,
-    kInstantValueFieldNumber = 8,
-    kPlainDateValueFieldNumber = 9,
-    kZonedDatetimeValueFieldNumber = 10,
+    kModuleNameFieldNumber = 1,
   };
-  // int64 int_value = 1;
-  bool has_int_value() const;
-  void clear_int_value() ;
-  ::int64_t int_value() const;
-  void set_int_value(::int64_t value);
-
-  private:
-  ::int64_t _internal_int_value() const;
-  void _internal_set_int_value(::int64_t value);
-
-  public:
-  // string string_value = 2;
-  bool has_string_value() const;
-  void clear_string_value() ;
-  const ::std::string& string_value() const;
+  // string module_name = 1;
+  void clear_module_name() ;
+  const ::std::string& module_name() const;
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_string_value(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_string_value();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_string_value();
-  void set_allocated_string_value(::std::string* PROTOBUF_NULLABLE value);
+  void set_module_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_module_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_module_name();
+  void set_allocated_module_name(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::std::string& _internal_string_value() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_string_value();
+  const ::std::string& _internal_module_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_module_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_module_name();
 
   public:
-  // bool bool_value = 3;
-  bool has_bool_value() const;
-  void clear_bool_value() ;
-  bool bool_value() const;
-  void set_bool_value(bool value);
-
-  private:
-  bool _internal_bool_value() const;
-  void _internal_set_bool_value(bool value);
+  // @@protoc_insertion_point(class_scope:forthic.GetModuleInfoRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   0, 48,
+                                   2>
+      _table_;
 
-  public:
-  // double float_value = 4;
-  bool has_float_value() const;
-  void clear_float_value() ;
-  double float_value() const;
-  void set_float_value(double value);
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const GetModuleInfoRequest& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr module_name_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
 
-  private:
-  double _internal_float_value() const;
-  void _internal_set_float_value(double value);
+extern const ::google::protobuf::internal::ClassDataFull GetModuleInfoRequest_class_data_;
+// -------------------------------------------------------------------
 
-  public:
-  // .forthic.NullValue null_value = 5;
-  bool has_null_value() const;
-  private:
-  bool _internal_has_null_value() const;
+class FetchRefRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.FetchRefRequest) */ {
+ public:
+  inline FetchRefRequest() : FetchRefRequest(nullptr) {}
+  ~FetchRefRequest() PROTOBUF_FINAL;
 
-  public:
-  void clear_null_value() ;
-  const ::forthic::NullValue& null_value() const;
-  [[nodiscard]] ::forthic::NullValue* PROTOBUF_NULLABLE release_null_value();
-  ::forthic::NullValue* PROTOBUF_NONNULL mutable_null_value();
-  void set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE value);
-  ::forthic::NullValue* PROTOBUF_NULLABLE unsafe_arena_release_null_value();
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FetchRefRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FetchRefRequest));
+  }
+#endif
 
-  private:
-  const ::forthic::NullValue& _internal_null_value() const;
-  ::forthic::NullValue* PROTOBUF_NONNULL _internal_mutable_null_value();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FetchRefRequest(::google::protobuf::internal::ConstantInitialized);
 
-  public:
-  // .forthic.ArrayValue array_value = 6;
-  bool has_array_value() const;
-  private:
-  bool _internal_has_array_value() const;
-
-  public:
-  void clear_array_value() ;
-  const ::forthic::ArrayValue& array_value() const;
-  [[nodiscard]] ::forthic::ArrayValue* PROTOBUF_NULLABLE release_array_value();
-  ::forthic::ArrayValue* PROTOBUF_NONNULL mutable_array_value();
-  void set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
-  ::forthic::ArrayValue* PROTOBUF_NULLABLE unsafe_arena_release_array_value();
-
-  private:
-  const ::forthic::ArrayValue& _internal_array_value() const;
-  ::forthic::ArrayValue* PROTOBUF_NONNULL _internal_mutable_array_value();
-
-  public:
-  // .forthic.RecordValue record_value = 7;
-  bool has_record_value() const;
-  private:
-  bool _internal_has_record_value() const;
-
-  public:
-  void clear_record_value() ;
-  const ::forthic::RecordValue& record_value() const;
-  [[nodiscard]] ::forthic::RecordValue* PROTOBUF_NULLABLE release_record_value();
-  ::forthic::RecordValue* PROTOBUF_NONNULL mutable_record_value();
-  void set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE value);
-  ::forthic::RecordValue* PROTOBUF_NULLABLE unsafe_arena_release_record_value();
-
-  private:
-  const ::forthic::RecordValue& _internal_record_value() const;
-  ::forthic::RecordValue* PROTOBUF_NONNULL _internal_mutable_record_value();
-
-  public:
-  // .forthic.InstantValue instant_value = 8;
-  bool has_instant_value() const;
-  private:
-  bool _internal_has_instant_value() const;
-
-  public:
-  void clear_instant_value() ;
-  const ::forthic::InstantValue& instant_value() const;
-  [[nodiscard]] ::forthic::InstantValue* PROTOBUF_NULLABLE release_instant_value();
-  ::forthic::InstantValue* PROTOBUF_NONNULL mutable_instant_value();
-  void set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE value);
-  ::forthic::InstantValue* PROTOBUF_NULLABLE unsafe_arena_release_instant_value();
-
-  private:
-  const ::forthic::InstantValue& _internal_instant_value() const;
-  ::forthic::InstantValue* PROTOBUF_NONNULL _internal_mutable_instant_value();
-
-  public:
-  // .forthic.PlainDateValue plain_date_value = 9;
-  bool has_plain_date_value() const;
-  private:
-  bool _internal_has_plain_date_value() const;
-
-  public:
-  void clear_plain_date_value() ;
-  const ::forthic::PlainDateValue& plain_date_value() const;
-  [[nodiscard]] ::forthic::PlainDateValue* PROTOBUF_NULLABLE release_plain_date_value();
-  ::forthic::PlainDateValue* PROTOBUF_NONNULL mutable_plain_date_value();
-  void set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE value);
-  ::forthic::PlainDateValue* PROTOBUF_NULLABLE unsafe_arena_release_plain_date_value();
-
-  private:
-  const ::forthic::PlainDateValue& _internal_plain_date_value() const;
-  ::forthic::PlainDateValue* PROTOBUF_NONNULL _internal_mutable_plain_date_value();
-
-  public:
-  // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
-  bool has_zoned_datetime_value() const;
-  private:
-  bool _internal_has_zoned_datetime_value() const;
-
-  public:
-  void clear_zoned_datetime_value() ;
-  const ::forthic::ZonedDateTimeValue& zoned_datetime_value() const;
-  [[nodiscard]] ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE release_zoned_datetime_value();
-  ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL mutable_zoned_datetime_value();
-  void set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value);
-  ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE unsafe_arena_release_zoned_datetime_value();
-
-  private:
-  const ::forthic::ZonedDateTimeValue& _internal_zoned_datetime_value() const;
-  ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL _internal_mutable_zoned_datetime_value();
-
-  public:
-  void clear_value();
-  ValueCase value_case() const;
-  // @@protoc_insertion_point(class_scope:forthic.StackValue)
- private:
-  class _Internal;
-  void set_has_int_value();
-  void set_has_string_value();
-  void set_has_bool_value();
-  void set_has_float_value();
-  void set_has_null_value();
-  void set_has_array_value();
-  void set_has_record_value();
-  void set_has_instant_value();
-  void set_has_plain_date_value();
-  void set_has_zoned_datetime_value();
-  inline bool has_value() const;
-  inline void clear_has_value();
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 10,
-                                   6, 47,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const StackValue& from_msg);
-    union ValueUnion {
-      constexpr ValueUnion() : _constinit_{} {}
-      ::google::protobuf::internal::ConstantInitialized _constinit_;
-      ::int64_t int_value_;
-      ::google::protobuf::internal::ArenaStringPtr string_value_;
-      bool bool_value_;
-      double float_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE null_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE array_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE record_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE instant_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE plain_date_value_;
-      ::google::protobuf::Message* PROTOBUF_NULLABLE zoned_datetime_value_;
-    } value_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::uint32_t _oneof_case_[1];
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull StackValue_class_data_;
-// -------------------------------------------------------------------
-
-class ExecuteWordResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ExecuteWordResponse) */ {
- public:
-  inline ExecuteWordResponse() : ExecuteWordResponse(nullptr) {}
-  ~ExecuteWordResponse() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ExecuteWordResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteWordResponse));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ExecuteWordResponse(::google::protobuf::internal::ConstantInitialized);
-
-  inline ExecuteWordResponse(const ExecuteWordResponse& from) : ExecuteWordResponse(nullptr, from) {}
-  inline ExecuteWordResponse(ExecuteWordResponse&& from) noexcept
-      : ExecuteWordResponse(nullptr, ::std::move(from)) {}
-  inline ExecuteWordResponse& operator=(const ExecuteWordResponse& from) {
+  inline FetchRefRequest(const FetchRefRequest& from) : FetchRefRequest(nullptr, from) {}
+  inline FetchRefRequest(FetchRefRequest&& from) noexcept
+      : FetchRefRequest(nullptr, ::std::move(from)) {}
+  inline FetchRefRequest& operator=(const FetchRefRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteWordResponse& operator=(ExecuteWordResponse&& from) noexcept {
+  inline FetchRefRequest& operator=(FetchRefRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -3334,13 +3079,13 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteWordResponse& default_instance() {
-    return *reinterpret_cast<const ExecuteWordResponse*>(
-        &_ExecuteWordResponse_default_instance_);
+  static const FetchRefRequest& default_instance() {
+    return *reinterpret_cast<const FetchRefRequest*>(
+        &_FetchRefRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(ExecuteWordResponse& a, ExecuteWordResponse& b) { a.Swap(&b); }
-  inline void Swap(ExecuteWordResponse* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 21;
+  friend void swap(FetchRefRequest& a, FetchRefRequest& b) { a.Swap(&b); }
+  inline void Swap(FetchRefRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -3348,7 +3093,7 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteWordResponse* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(FetchRefRequest* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3356,13 +3101,13 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ExecuteWordResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ExecuteWordResponse>(arena);
+  FetchRefRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FetchRefRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ExecuteWordResponse& from);
+  void CopyFrom(const FetchRefRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ExecuteWordResponse& from) { ExecuteWordResponse::MergeImpl(*this, from); }
+  void MergeFrom(const FetchRefRequest& from) { FetchRefRequest::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -3398,17 +3143,17 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ExecuteWordResponse* PROTOBUF_NONNULL other);
+  void InternalSwap(FetchRefRequest* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ExecuteWordResponse"; }
+  static ::absl::string_view FullMessageName() { return "forthic.FetchRefRequest"; }
 
-  explicit ExecuteWordResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ExecuteWordResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteWordResponse& from);
-  ExecuteWordResponse(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteWordResponse&& from) noexcept
-      : ExecuteWordResponse(arena) {
+  explicit FetchRefRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  FetchRefRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const FetchRefRequest& from);
+  FetchRefRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, FetchRefRequest&& from) noexcept
+      : FetchRefRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -3425,47 +3170,40 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kResultStackFieldNumber = 1,
-    kErrorFieldNumber = 2,
+    kHandleIdFieldNumber = 1,
+    kAcceptsCompactTemporalFieldNumber = 2,
   };
-  // repeated .forthic.StackValue result_stack = 1;
-  int result_stack_size() const;
-  private:
-  int _internal_result_stack_size() const;
-
-  public:
-  void clear_result_stack() ;
-  ::forthic::StackValue* PROTOBUF_NONNULL mutable_result_stack(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_result_stack();
+  // string handle_id = 1;
+  void clear_handle_id() ;
+  const ::std::string& handle_id() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_handle_id(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_handle_id();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_handle_id();
+  void set_allocated_handle_id(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_result_stack() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_result_stack();
+  const ::std::string& _internal_handle_id() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_handle_id(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_handle_id();
+
   public:
-  const ::forthic::StackValue& result_stack(int index) const;
-  ::forthic::StackValue* PROTOBUF_NONNULL add_result_stack();
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& result_stack() const;
-  // optional .forthic.ErrorInfo error = 2;
-  bool has_error() const;
-  void clear_error() ;
-  const ::forthic::ErrorInfo& error() const;
-  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
-  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
-  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
-  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+  // bool accepts_compact_temporal = 2;
+  void clear_accepts_compact_temporal() ;
+  bool accepts_compact_temporal() const;
+  void set_accepts_compact_temporal(bool value);
 
   private:
-  const ::forthic::ErrorInfo& _internal_error() const;
-  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+  bool _internal_accepts_compact_temporal() const;
+  void _internal_set_accepts_compact_temporal(bool value);
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.ExecuteWordResponse)
+  // @@protoc_insertion_point(class_scope:forthic.FetchRefRequest)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   2, 0,
+                                   0, 41,
                                    2>
       _table_;
 
@@ -3483,44 +3221,83 @@ class ExecuteWordResponse final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ExecuteWordResponse& from_msg);
+        const FetchRefRequest& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > result_stack_;
-    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    ::google::protobuf::internal::ArenaStringPtr handle_id_;
+    bool accepts_compact_temporal_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ExecuteWordResponse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull FetchRefRequest_class_data_;
 // -------------------------------------------------------------------
 
-class ExecuteWordRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ExecuteWordRequest) */ {
+class ErrorInfo_ContextEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<::std::string, ::std::string,
+                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING> {
  public:
-  inline ExecuteWordRequest() : ExecuteWordRequest(nullptr) {}
-  ~ExecuteWordRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ExecuteWordRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteWordRequest));
+  using SuperType =
+      ::google::protobuf::internal::MapEntry<::std::string, ::std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>;
+  ErrorInfo_ContextEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ErrorInfo_ContextEntry_DoNotUse(::google::protobuf::internal::ConstantInitialized);
+  explicit ErrorInfo_ContextEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr const void* PROTOBUF_NONNULL internal_default_instance() {
+    return &_ErrorInfo_ContextEntry_DoNotUse_default_instance_;
   }
-#endif
 
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ExecuteWordRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline ExecuteWordRequest(const ExecuteWordRequest& from) : ExecuteWordRequest(nullptr, from) {}
-  inline ExecuteWordRequest(ExecuteWordRequest&& from) noexcept
-      : ExecuteWordRequest(nullptr, ::std::move(from)) {}
-  inline ExecuteWordRequest& operator=(const ExecuteWordRequest& from) {
+  static constexpr auto InternalGenerateClassData_();
+
+ private:
+  friend class ::google::protobuf::MessageLite;
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 47,
+                                   2>
+      _table_;
+
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+};
+extern const ::google::protobuf::internal::ClassDataFull ErrorInfo_ContextEntry_DoNotUse_class_data_;
+// -------------------------------------------------------------------
+
+class ListModulesResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ListModulesResponse) */ {
+ public:
+  inline ListModulesResponse() : ListModulesResponse(nullptr) {}
+  ~ListModulesResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ListModulesResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListModulesResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ListModulesResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline ListModulesResponse(const ListModulesResponse& from) : ListModulesResponse(nullptr, from) {}
+  inline ListModulesResponse(ListModulesResponse&& from) noexcept
+      : ListModulesResponse(nullptr, ::std::move(from)) {}
+  inline ListModulesResponse& operator=(const ListModulesResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteWordRequest& operator=(ExecuteWordRequest&& from) noexcept {
+  inline ListModulesResponse& operator=(ListModulesResponse&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -3548,13 +3325,13 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteWordRequest& default_instance() {
-    return *reinterpret_cast<const ExecuteWordRequest*>(
-        &_ExecuteWordRequest_default_instance_);
+  static const ListModulesResponse& default_instance() {
+    return *reinterpret_cast<const ListModulesResponse*>(
+        &_ListModulesResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(ExecuteWordRequest& a, ExecuteWordRequest& b) { a.Swap(&b); }
-  inline void Swap(ExecuteWordRequest* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 28;
+  friend void swap(ListModulesResponse& a, ListModulesResponse& b) { a.Swap(&b); }
+  inline void Swap(ListModulesResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -3562,7 +3339,7 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteWordRequest* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ListModulesResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3570,13 +3347,13 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ExecuteWordRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ExecuteWordRequest>(arena);
+  ListModulesResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ListModulesResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ExecuteWordRequest& from);
+  void CopyFrom(const ListModulesResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ExecuteWordRequest& from) { ExecuteWordRequest::MergeImpl(*this, from); }
+  void MergeFrom(const ListModulesResponse& from) { ListModulesResponse::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -3612,17 +3389,17 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ExecuteWordRequest* PROTOBUF_NONNULL other);
+  void InternalSwap(ListModulesResponse* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ExecuteWordRequest"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ListModulesResponse"; }
 
-  explicit ExecuteWordRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ExecuteWordRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteWordRequest& from);
-  ExecuteWordRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteWordRequest&& from) noexcept
-      : ExecuteWordRequest(arena) {
+  explicit ListModulesResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ListModulesResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ListModulesResponse& from);
+  ListModulesResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ListModulesResponse&& from) noexcept
+      : ListModulesResponse(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -3639,47 +3416,47 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kStackFieldNumber = 2,
-    kWordNameFieldNumber = 1,
+    kModulesFieldNumber = 1,
+    kVersionFieldNumber = 2,
   };
-  // repeated .forthic.StackValue stack = 2;
-  int stack_size() const;
+  // repeated .forthic.ModuleSummary modules = 1;
+  int modules_size() const;
   private:
-  int _internal_stack_size() const;
+  int _internal_modules_size() const;
 
   public:
-  void clear_stack() ;
-  ::forthic::StackValue* PROTOBUF_NONNULL mutable_stack(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_stack();
+  void clear_modules() ;
+  ::forthic::ModuleSummary* PROTOBUF_NONNULL mutable_modules(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>* PROTOBUF_NONNULL mutable_modules();
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_stack() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>& _internal_modules() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>* PROTOBUF_NONNULL _internal_mutable_modules();
   public:
-  const ::forthic::StackValue& stack(int index) const;
-  ::forthic::StackValue* PROTOBUF_NONNULL add_stack();
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& stack() const;
-  // string word_name = 1;
-  void clear_word_name() ;
-  const ::std::string& word_name() const;
+  const ::forthic::ModuleSummary& modules(int index) const;
+  ::forthic::ModuleSummary* PROTOBUF_NONNULL add_modules();
+  const ::google::protobuf::RepeatedPtrField<::forthic::ModuleSummary>& modules() const;
+  // string version = 2;
+  void clear_version() ;
+  const ::std::string& version() const;
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_word_name(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_word_name();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_word_name();
-  void set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value);
+  void set_version(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_version();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_version();
+  void set_allocated_version(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::std::string& _internal_word_name() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_word_name(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_word_name();
+  const ::std::string& _internal_version() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_version(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_version();
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.ExecuteWordRequest)
+  // @@protoc_insertion_point(class_scope:forthic.ListModulesResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   1, 44,
+                                   1, 43,
                                    2>
       _table_;
 
@@ -3697,44 +3474,44 @@ class ExecuteWordRequest final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ExecuteWordRequest& from_msg);
+        const ListModulesResponse& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > stack_;
-    ::google::protobuf::internal::ArenaStringPtr word_name_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::ModuleSummary > modules_;
+    ::google::protobuf::internal::ArenaStringPtr version_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ExecuteWordRequest_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ListModulesResponse_class_data_;
 // -------------------------------------------------------------------
 
-class ExecuteSequenceResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ExecuteSequenceResponse) */ {
+class GetModuleInfoResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.GetModuleInfoResponse) */ {
  public:
-  inline ExecuteSequenceResponse() : ExecuteSequenceResponse(nullptr) {}
-  ~ExecuteSequenceResponse() PROTOBUF_FINAL;
+  inline GetModuleInfoResponse() : GetModuleInfoResponse(nullptr) {}
+  ~GetModuleInfoResponse() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ExecuteSequenceResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(GetModuleInfoResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteSequenceResponse));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetModuleInfoResponse));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ExecuteSequenceResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR GetModuleInfoResponse(::google::protobuf::internal::ConstantInitialized);
 
-  inline ExecuteSequenceResponse(const ExecuteSequenceResponse& from) : ExecuteSequenceResponse(nullptr, from) {}
-  inline ExecuteSequenceResponse(ExecuteSequenceResponse&& from) noexcept
-      : ExecuteSequenceResponse(nullptr, ::std::move(from)) {}
-  inline ExecuteSequenceResponse& operator=(const ExecuteSequenceResponse& from) {
+  inline GetModuleInfoResponse(const GetModuleInfoResponse& from) : GetModuleInfoResponse(nullptr, from) {}
+  inline GetModuleInfoResponse(GetModuleInfoResponse&& from) noexcept
+      : GetModuleInfoResponse(nullptr, ::std::move(from)) {}
+  inline GetModuleInfoResponse& operator=(const GetModuleInfoResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteSequenceResponse& operator=(ExecuteSequenceResponse&& from) noexcept {
+  inline GetModuleInfoResponse& operator=(GetModuleInfoResponse&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -3762,13 +3539,13 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteSequenceResponse& default_instance() {
-    return *reinterpret_cast<const ExecuteSequenceResponse*>(
-        &_ExecuteSequenceResponse_default_instance_);
+  static const GetModuleInfoResponse& default_instance() {
+    return *reinterpret_cast<const GetModuleInfoResponse*>(
+        &_GetModuleInfoResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(ExecuteSequenceResponse& a, ExecuteSequenceResponse& b) { a.Swap(&b); }
-  inline void Swap(ExecuteSequenceResponse* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 31;
+  friend void swap(GetModuleInfoResponse& a, GetModuleInfoResponse& b) { a.Swap(&b); }
+  inline void Swap(GetModuleInfoResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -3776,7 +3553,7 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteSequenceResponse* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(GetModuleInfoResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3784,13 +3561,13 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ExecuteSequenceResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ExecuteSequenceResponse>(arena);
+  GetModuleInfoResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetModuleInfoResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ExecuteSequenceResponse& from);
+  void CopyFrom(const GetModuleInfoResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ExecuteSequenceResponse& from) { ExecuteSequenceResponse::MergeImpl(*this, from); }
+  void MergeFrom(const GetModuleInfoResponse& from) { GetModuleInfoResponse::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -3826,17 +3603,17 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ExecuteSequenceResponse* PROTOBUF_NONNULL other);
+  void InternalSwap(GetModuleInfoResponse* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ExecuteSequenceResponse"; }
+  static ::absl::string_view FullMessageName() { return "forthic.GetModuleInfoResponse"; }
 
-  explicit ExecuteSequenceResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ExecuteSequenceResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteSequenceResponse& from);
-  ExecuteSequenceResponse(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteSequenceResponse&& from) noexcept
-      : ExecuteSequenceResponse(arena) {
+  explicit GetModuleInfoResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  GetModuleInfoResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const GetModuleInfoResponse& from);
+  GetModuleInfoResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, GetModuleInfoResponse&& from) noexcept
+      : GetModuleInfoResponse(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -3853,47 +3630,79 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kResultStackFieldNumber = 1,
-    kErrorFieldNumber = 2,
+    kWordsFieldNumber = 3,
+    kNameFieldNumber = 1,
+    kDescriptionFieldNumber = 2,
+    kVersionFieldNumber = 4,
   };
-  // repeated .forthic.StackValue result_stack = 1;
-  int result_stack_size() const;
+  // repeated .forthic.WordInfo words = 3;
+  int words_size() const;
   private:
-  int _internal_result_stack_size() const;
+  int _internal_words_size() const;
 
   public:
-  void clear_result_stack() ;
-  ::forthic::StackValue* PROTOBUF_NONNULL mutable_result_stack(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_result_stack();
+  void clear_words() ;
+  ::forthic::WordInfo* PROTOBUF_NONNULL mutable_words(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>* PROTOBUF_NONNULL mutable_words();
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_result_stack() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_result_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>& _internal_words() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>* PROTOBUF_NONNULL _internal_mutable_words();
   public:
-  const ::forthic::StackValue& result_stack(int index) const;
-  ::forthic::StackValue* PROTOBUF_NONNULL add_result_stack();
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& result_stack() const;
-  // optional .forthic.ErrorInfo error = 2;
-  bool has_error() const;
-  void clear_error() ;
-  const ::forthic::ErrorInfo& error() const;
-  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
-  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
-  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
-  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+  const ::forthic::WordInfo& words(int index) const;
+  ::forthic::WordInfo* PROTOBUF_NONNULL add_words();
+  const ::google::protobuf::RepeatedPtrField<::forthic::WordInfo>& words() const;
+  // string name = 1;
+  void clear_name() ;
+  const ::std::string& name() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_name();
+  void set_allocated_name(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::forthic::ErrorInfo& _internal_error() const;
-  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+  const ::std::string& _internal_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_name();
 
   public:
-  // @@protoc_insertion_point(class_scope:forthic.ExecuteSequenceResponse)
+  // string description = 2;
+  void clear_description() ;
+  const ::std::string& description() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_description(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_description();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_description();
+  void set_allocated_description(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_description() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_description(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_description();
+
+  public:
+  // string version = 4;
+  void clear_version() ;
+  const ::std::string& version() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_version(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_version();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_version();
+  void set_allocated_version(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_version() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_version(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_version();
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.GetModuleInfoResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   2, 0,
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
+                                   1, 60,
                                    2>
       _table_;
 
@@ -3911,44 +3720,46 @@ class ExecuteSequenceResponse final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ExecuteSequenceResponse& from_msg);
+        const GetModuleInfoResponse& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > result_stack_;
-    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::WordInfo > words_;
+    ::google::protobuf::internal::ArenaStringPtr name_;
+    ::google::protobuf::internal::ArenaStringPtr description_;
+    ::google::protobuf::internal::ArenaStringPtr version_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ExecuteSequenceResponse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull GetModuleInfoResponse_class_data_;
 // -------------------------------------------------------------------
 
-class ExecuteSequenceRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:forthic.ExecuteSequenceRequest) */ {
+class ErrorInfo final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ErrorInfo) */ {
  public:
-  inline ExecuteSequenceRequest() : ExecuteSequenceRequest(nullptr) {}
-  ~ExecuteSequenceRequest() PROTOBUF_FINAL;
+  inline ErrorInfo() : ErrorInfo(nullptr) {}
+  ~ErrorInfo() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ExecuteSequenceRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ErrorInfo* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteSequenceRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ErrorInfo));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ExecuteSequenceRequest(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ErrorInfo(::google::protobuf::internal::ConstantInitialized);
 
-  inline ExecuteSequenceRequest(const ExecuteSequenceRequest& from) : ExecuteSequenceRequest(nullptr, from) {}
-  inline ExecuteSequenceRequest(ExecuteSequenceRequest&& from) noexcept
-      : ExecuteSequenceRequest(nullptr, ::std::move(from)) {}
-  inline ExecuteSequenceRequest& operator=(const ExecuteSequenceRequest& from) {
+  inline ErrorInfo(const ErrorInfo& from) : ErrorInfo(nullptr, from) {}
+  inline ErrorInfo(ErrorInfo&& from) noexcept
+      : ErrorInfo(nullptr, ::std::move(from)) {}
+  inline ErrorInfo& operator=(const ErrorInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteSequenceRequest& operator=(ExecuteSequenceRequest&& from) noexcept {
+  inline ErrorInfo& operator=(ErrorInfo&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -3976,13 +3787,13 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteSequenceRequest& default_instance() {
-    return *reinterpret_cast<const ExecuteSequenceRequest*>(
-        &_ExecuteSequenceRequest_default_instance_);
+  static const ErrorInfo& default_instance() {
+    return *reinterpret_cast<const ErrorInfo*>(
+        &_ErrorInfo_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(ExecuteSequenceRequest& a, ExecuteSequenceRequest& b) { a.Swap(&b); }
-  inline void Swap(ExecuteSequenceRequest* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 26;
+  friend void swap(ErrorInfo& a, ErrorInfo& b) { a.Swap(&b); }
+  inline void Swap(ErrorInfo* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -3990,7 +3801,7 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteSequenceRequest* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ErrorInfo* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3998,13 +3809,13 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ExecuteSequenceRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ExecuteSequenceRequest>(arena);
+  ErrorInfo* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ErrorInfo>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ExecuteSequenceRequest& from);
+  void CopyFrom(const ErrorInfo& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ExecuteSequenceRequest& from) { ExecuteSequenceRequest::MergeImpl(*this, from); }
+  void MergeFrom(const ErrorInfo& from) { ErrorInfo::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -4040,17 +3851,17 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ExecuteSequenceRequest* PROTOBUF_NONNULL other);
+  void InternalSwap(ErrorInfo* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "forthic.ExecuteSequenceRequest"; }
+  static ::absl::string_view FullMessageName() { return "forthic.ErrorInfo"; }
 
-  explicit ExecuteSequenceRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ExecuteSequenceRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteSequenceRequest& from);
-  ExecuteSequenceRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteSequenceRequest&& from) noexcept
-      : ExecuteSequenceRequest(arena) {
+  explicit ErrorInfo(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ErrorInfo(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ErrorInfo& from);
+  ErrorInfo(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ErrorInfo&& from) noexcept
+      : ErrorInfo(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -4067,54 +3878,134 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kWordNamesFieldNumber = 1,
-    kStackFieldNumber = 2,
+    kStackTraceFieldNumber = 3,
+    kMessageFieldNumber = 1,
+    kRuntimeFieldNumber = 2,
+    kErrorTypeFieldNumber = 4,
+    kWordLocationFieldNumber = 5,
+    kModuleNameFieldNumber = 6,
+    kContextFieldNumber = 7,
   };
-  // repeated string word_names = 1;
-  int word_names_size() const;
+  // repeated string stack_trace = 3;
+  int stack_trace_size() const;
   private:
-  int _internal_word_names_size() const;
+  int _internal_stack_trace_size() const;
 
   public:
-  void clear_word_names() ;
-  const ::std::string& word_names(int index) const;
-  ::std::string* PROTOBUF_NONNULL mutable_word_names(int index);
+  void clear_stack_trace() ;
+  const ::std::string& stack_trace(int index) const;
+  ::std::string* PROTOBUF_NONNULL mutable_stack_trace(int index);
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_word_names(int index, Arg_&& value, Args_... args);
-  ::std::string* PROTOBUF_NONNULL add_word_names();
+  void set_stack_trace(int index, Arg_&& value, Args_... args);
+  ::std::string* PROTOBUF_NONNULL add_stack_trace();
   template <typename Arg_ = const ::std::string&, typename... Args_>
-  void add_word_names(Arg_&& value, Args_... args);
-  const ::google::protobuf::RepeatedPtrField<::std::string>& word_names() const;
-  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_word_names();
+  void add_stack_trace(Arg_&& value, Args_... args);
+  const ::google::protobuf::RepeatedPtrField<::std::string>& stack_trace() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_stack_trace();
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_word_names() const;
-  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_word_names();
+  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_stack_trace() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_stack_trace();
 
   public:
-  // repeated .forthic.StackValue stack = 2;
-  int stack_size() const;
+  // string message = 1;
+  void clear_message() ;
+  const ::std::string& message() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_message(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_message();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_message();
+  void set_allocated_message(::std::string* PROTOBUF_NULLABLE value);
+
   private:
-  int _internal_stack_size() const;
+  const ::std::string& _internal_message() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_message(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_message();
 
   public:
-  void clear_stack() ;
-  ::forthic::StackValue* PROTOBUF_NONNULL mutable_stack(int index);
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_stack();
+  // string runtime = 2;
+  void clear_runtime() ;
+  const ::std::string& runtime() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_runtime(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_runtime();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_runtime();
+  void set_allocated_runtime(::std::string* PROTOBUF_NULLABLE value);
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_stack() const;
-  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_stack();
+  const ::std::string& _internal_runtime() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_runtime(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_runtime();
+
   public:
-  const ::forthic::StackValue& stack(int index) const;
-  ::forthic::StackValue* PROTOBUF_NONNULL add_stack();
-  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& stack() const;
-  // @@protoc_insertion_point(class_scope:forthic.ExecuteSequenceRequest)
+  // string error_type = 4;
+  void clear_error_type() ;
+  const ::std::string& error_type() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_error_type(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_error_type();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_error_type();
+  void set_allocated_error_type(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_error_type() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_error_type(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_error_type();
+
+  public:
+  // optional string word_location = 5;
+  bool has_word_location() const;
+  void clear_word_location() ;
+  const ::std::string& word_location() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_word_location(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_word_location();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_word_location();
+  void set_allocated_word_location(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_word_location() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_word_location(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_word_location();
+
+  public:
+  // optional string module_name = 6;
+  bool has_module_name() const;
+  void clear_module_name() ;
+  const ::std::string& module_name() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_module_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_module_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_module_name();
+  void set_allocated_module_name(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_module_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_module_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_module_name();
+
+  public:
+  // map<string, string> context = 7;
+  int context_size() const;
+  private:
+  int _internal_context_size() const;
+
+  public:
+  void clear_context() ;
+  const ::google::protobuf::Map<::std::string, ::std::string>& context() const;
+  ::google::protobuf::Map<::std::string, ::std::string>* PROTOBUF_NONNULL mutable_context();
+
+  private:
+  const ::google::protobuf::Map<::std::string, ::std::string>& _internal_context() const;
+  ::google::protobuf::Map<::std::string, ::std::string>* PROTOBUF_NONNULL _internal_mutable_context();
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.ErrorInfo)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   1, 49,
+  static const ::google::protobuf::internal::TcParseTable<3, 7,
+                                   1, 92,
                                    2>
       _table_;
 
@@ -4132,76 +4023,5269 @@ class ExecuteSequenceRequest final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ExecuteSequenceRequest& from_msg);
+        const ErrorInfo& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::RepeatedPtrField<::std::string> word_names_;
-    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > stack_;
+    ::google::protobuf::RepeatedPtrField<::std::string> stack_trace_;
+    ::google::protobuf::internal::ArenaStringPtr message_;
+    ::google::protobuf::internal::ArenaStringPtr runtime_;
+    ::google::protobuf::internal::ArenaStringPtr error_type_;
+    ::google::protobuf::internal::ArenaStringPtr word_location_;
+    ::google::protobuf::internal::ArenaStringPtr module_name_;
+    ::google::protobuf::internal::MapField<ErrorInfo_ContextEntry_DoNotUse, ::std::string, ::std::string,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING>
+        context_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ExecuteSequenceRequest_class_data_;
-
-// ===================================================================
+extern const ::google::protobuf::internal::ClassDataFull ErrorInfo_class_data_;
+// -------------------------------------------------------------------
 
+class ArrayValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ArrayValue) */ {
+ public:
+  inline ArrayValue() : ArrayValue(nullptr) {}
+  ~ArrayValue() PROTOBUF_FINAL;
 
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ArrayValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ArrayValue));
+  }
+#endif
 
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ArrayValue(::google::protobuf::internal::ConstantInitialized);
 
-// ===================================================================
+  inline ArrayValue(const ArrayValue& from) : ArrayValue(nullptr, from) {}
+  inline ArrayValue(ArrayValue&& from) noexcept
+      : ArrayValue(nullptr, ::std::move(from)) {}
+  inline ArrayValue& operator=(const ArrayValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ArrayValue& operator=(ArrayValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ArrayValue& default_instance() {
+    return *reinterpret_cast<const ArrayValue*>(
+        &_ArrayValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 14;
+  friend void swap(ArrayValue& a, ArrayValue& b) { a.Swap(&b); }
+  inline void Swap(ArrayValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArrayValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ArrayValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ArrayValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ArrayValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ArrayValue& from) { ArrayValue::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ArrayValue* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ArrayValue"; }
+
+  explicit ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ArrayValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ArrayValue& from);
+  ArrayValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ArrayValue&& from) noexcept
+      : ArrayValue(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kItemsFieldNumber = 1,
+  };
+  // repeated .forthic.StackValue items = 1;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+
+  public:
+  void clear_items() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_items(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_items();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_items() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_items();
+  public:
+  const ::forthic::StackValue& items(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_items();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& items() const;
+  // @@protoc_insertion_point(class_scope:forthic.ArrayValue)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ArrayValue& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > items_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ArrayValue_class_data_;
+// -------------------------------------------------------------------
+
+class RecordValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.RecordValue) */ {
+ public:
+  inline RecordValue() : RecordValue(nullptr) {}
+  ~RecordValue() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(RecordValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(RecordValue));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR RecordValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline RecordValue(const RecordValue& from) : RecordValue(nullptr, from) {}
+  inline RecordValue(RecordValue&& from) noexcept
+      : RecordValue(nullptr, ::std::move(from)) {}
+  inline RecordValue& operator=(const RecordValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecordValue& operator=(RecordValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecordValue& default_instance() {
+    return *reinterpret_cast<const RecordValue*>(
+        &_RecordValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 16;
+  friend void swap(RecordValue& a, RecordValue& b) { a.Swap(&b); }
+  inline void Swap(RecordValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecordValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecordValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<RecordValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const RecordValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const RecordValue& from) { RecordValue::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(RecordValue* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.RecordValue"; }
+
+  explicit RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  RecordValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const RecordValue& from);
+  RecordValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, RecordValue&& from) noexcept
+      : RecordValue(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kFieldsFieldNumber = 1,
+  };
+  // map<string, .forthic.StackValue> fields = 1;
+  int fields_size() const;
+  private:
+  int _internal_fields_size() const;
+
+  public:
+  void clear_fields() ;
+  const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& fields() const;
+  ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL mutable_fields();
+
+  private:
+  const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& _internal_fields() const;
+  ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_fields();
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.RecordValue)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   2, 34,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const RecordValue& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::MapField<RecordValue_FieldsEntry_DoNotUse, ::std::string, ::forthic::StackValue,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>
+        fields_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull RecordValue_class_data_;
+// -------------------------------------------------------------------
+
+class RecordValue_FieldsEntry_DoNotUse final
+    : public ::google::protobuf::internal::MapEntry<::std::string, ::google::protobuf::Message,
+                             ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                             ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE> {
+ public:
+  using SuperType =
+      ::google::protobuf::internal::MapEntry<::std::string, ::google::protobuf::Message,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+                      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE>;
+  RecordValue_FieldsEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR RecordValue_FieldsEntry_DoNotUse(::google::protobuf::internal::ConstantInitialized);
+  explicit RecordValue_FieldsEntry_DoNotUse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr const void* PROTOBUF_NONNULL internal_default_instance() {
+    return &_RecordValue_FieldsEntry_DoNotUse_default_instance_;
+  }
+
+
+  static constexpr auto InternalGenerateClassData_();
+
+ private:
+  friend class ::google::protobuf::MessageLite;
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   1, 43,
+                                   2>
+      _table_;
+
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+};
+extern const ::google::protobuf::internal::ClassDataFull RecordValue_FieldsEntry_DoNotUse_class_data_;
+// -------------------------------------------------------------------
+
+class StackValue final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.StackValue) */ {
+ public:
+  inline StackValue() : StackValue(nullptr) {}
+  ~StackValue() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(StackValue* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(StackValue));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StackValue(::google::protobuf::internal::ConstantInitialized);
+
+  inline StackValue(const StackValue& from) : StackValue(nullptr, from) {}
+  inline StackValue(StackValue&& from) noexcept
+      : StackValue(nullptr, ::std::move(from)) {}
+  inline StackValue& operator=(const StackValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StackValue& operator=(StackValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StackValue& default_instance() {
+    return *reinterpret_cast<const StackValue*>(
+        &_StackValue_default_instance_);
+  }
+  enum ValueCase {
+    kIntValue = 1,
+    kStringValue = 2,
+    kBoolValue = 3,
+    kFloatValue = 4,
+    kNullValue = 5,
+    kArrayValue = 6,
+    kRecordValue = 7,
+    kInstantValue = 8,
+    kPlainDateValue = 9,
+    kZonedDatetimeValue = 10,
+    kRemoteRefValue = 11,
+    VALUE_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 12;
+  friend void swap(StackValue& a, StackValue& b) { a.Swap(&b); }
+  inline void Swap(StackValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StackValue* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StackValue* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<StackValue>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StackValue& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const StackValue& from) { StackValue::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(StackValue* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.StackValue"; }
+
+  explicit StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  StackValue(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StackValue& from);
+  StackValue(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StackValue&& from) noexcept
+      : StackValue(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kIntValueFieldNumber = 1,
+    kStringValueFieldNumber = 2,
+    kBoolValueFieldNumber = 3,
+    kFloatValueFieldNumber = 4,
+    kNullValueFieldNumber = 5,
+    kArrayValueFieldNumber = 6,
+    kRecordValueFieldNumber = 7,
+    kInstantValueFieldNumber = 8,
+    kPlainDateValueFieldNumber = 9,
+    kZonedDatetimeValueFieldNumber = 10,
+    kRemoteRefValueFieldNumber = 11,
+  };
+  // int64 int_value = 1;
+  bool has_int_value() const;
+  void clear_int_value() ;
+  ::int64_t int_value() const;
+  void set_int_value(::int64_t value);
+
+  private:
+  ::int64_t _internal_int_value() const;
+  void _internal_set_int_value(::int64_t value);
+
+  public:
+  // string string_value = 2;
+  bool has_string_value() const;
+  void clear_string_value() ;
+  const ::std::string& string_value() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_string_value(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_string_value();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_string_value();
+  void set_allocated_string_value(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_string_value() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_string_value();
+
+  public:
+  // bool bool_value = 3;
+  bool has_bool_value() const;
+  void clear_bool_value() ;
+  bool bool_value() const;
+  void set_bool_value(bool value);
+
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+
+  public:
+  // double float_value = 4;
+  bool has_float_value() const;
+  void clear_float_value() ;
+  double float_value() const;
+  void set_float_value(double value);
+
+  private:
+  double _internal_float_value() const;
+  void _internal_set_float_value(double value);
+
+  public:
+  // .forthic.NullValue null_value = 5;
+  bool has_null_value() const;
+  private:
+  bool _internal_has_null_value() const;
+
+  public:
+  void clear_null_value() ;
+  const ::forthic::NullValue& null_value() const;
+  [[nodiscard]] ::forthic::NullValue* PROTOBUF_NULLABLE release_null_value();
+  ::forthic::NullValue* PROTOBUF_NONNULL mutable_null_value();
+  void set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_null_value(::forthic::NullValue* PROTOBUF_NULLABLE value);
+  ::forthic::NullValue* PROTOBUF_NULLABLE unsafe_arena_release_null_value();
+
+  private:
+  const ::forthic::NullValue& _internal_null_value() const;
+  ::forthic::NullValue* PROTOBUF_NONNULL _internal_mutable_null_value();
+
+  public:
+  // .forthic.ArrayValue array_value = 6;
+  bool has_array_value() const;
+  private:
+  bool _internal_has_array_value() const;
+
+  public:
+  void clear_array_value() ;
+  const ::forthic::ArrayValue& array_value() const;
+  [[nodiscard]] ::forthic::ArrayValue* PROTOBUF_NULLABLE release_array_value();
+  ::forthic::ArrayValue* PROTOBUF_NONNULL mutable_array_value();
+  void set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_array_value(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
+  ::forthic::ArrayValue* PROTOBUF_NULLABLE unsafe_arena_release_array_value();
+
+  private:
+  const ::forthic::ArrayValue& _internal_array_value() const;
+  ::forthic::ArrayValue* PROTOBUF_NONNULL _internal_mutable_array_value();
+
+  public:
+  // .forthic.RecordValue record_value = 7;
+  bool has_record_value() const;
+  private:
+  bool _internal_has_record_value() const;
+
+  public:
+  void clear_record_value() ;
+  const ::forthic::RecordValue& record_value() const;
+  [[nodiscard]] ::forthic::RecordValue* PROTOBUF_NULLABLE release_record_value();
+  ::forthic::RecordValue* PROTOBUF_NONNULL mutable_record_value();
+  void set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_record_value(::forthic::RecordValue* PROTOBUF_NULLABLE value);
+  ::forthic::RecordValue* PROTOBUF_NULLABLE unsafe_arena_release_record_value();
+
+  private:
+  const ::forthic::RecordValue& _internal_record_value() const;
+  ::forthic::RecordValue* PROTOBUF_NONNULL _internal_mutable_record_value();
+
+  public:
+  // .forthic.InstantValue instant_value = 8;
+  bool has_instant_value() const;
+  private:
+  bool _internal_has_instant_value() const;
+
+  public:
+  void clear_instant_value() ;
+  const ::forthic::InstantValue& instant_value() const;
+  [[nodiscard]] ::forthic::InstantValue* PROTOBUF_NULLABLE release_instant_value();
+  ::forthic::InstantValue* PROTOBUF_NONNULL mutable_instant_value();
+  void set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_instant_value(::forthic::InstantValue* PROTOBUF_NULLABLE value);
+  ::forthic::InstantValue* PROTOBUF_NULLABLE unsafe_arena_release_instant_value();
+
+  private:
+  const ::forthic::InstantValue& _internal_instant_value() const;
+  ::forthic::InstantValue* PROTOBUF_NONNULL _internal_mutable_instant_value();
+
+  public:
+  // .forthic.PlainDateValue plain_date_value = 9;
+  bool has_plain_date_value() const;
+  private:
+  bool _internal_has_plain_date_value() const;
+
+  public:
+  void clear_plain_date_value() ;
+  const ::forthic::PlainDateValue& plain_date_value() const;
+  [[nodiscard]] ::forthic::PlainDateValue* PROTOBUF_NULLABLE release_plain_date_value();
+  ::forthic::PlainDateValue* PROTOBUF_NONNULL mutable_plain_date_value();
+  void set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_plain_date_value(::forthic::PlainDateValue* PROTOBUF_NULLABLE value);
+  ::forthic::PlainDateValue* PROTOBUF_NULLABLE unsafe_arena_release_plain_date_value();
+
+  private:
+  const ::forthic::PlainDateValue& _internal_plain_date_value() const;
+  ::forthic::PlainDateValue* PROTOBUF_NONNULL _internal_mutable_plain_date_value();
+
+  public:
+  // .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
+  bool has_zoned_datetime_value() const;
+  private:
+  bool _internal_has_zoned_datetime_value() const;
+
+  public:
+  void clear_zoned_datetime_value() ;
+  const ::forthic::ZonedDateTimeValue& zoned_datetime_value() const;
+  [[nodiscard]] ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE release_zoned_datetime_value();
+  ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL mutable_zoned_datetime_value();
+  void set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_zoned_datetime_value(::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value);
+  ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE unsafe_arena_release_zoned_datetime_value();
+
+  private:
+  const ::forthic::ZonedDateTimeValue& _internal_zoned_datetime_value() const;
+  ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL _internal_mutable_zoned_datetime_value();
+
+  public:
+  // .forthic.RemoteRefValue remote_ref_value = 11;
+  bool has_remote_ref_value() const;
+  private:
+  bool _internal_has_remote_ref_value() const;
+
+  public:
+  void clear_remote_ref_value() ;
+  const ::forthic::RemoteRefValue& remote_ref_value() const;
+  [[nodiscard]] ::forthic::RemoteRefValue* PROTOBUF_NULLABLE release_remote_ref_value();
+  ::forthic::RemoteRefValue* PROTOBUF_NONNULL mutable_remote_ref_value();
+  void set_allocated_remote_ref_value(::forthic::RemoteRefValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_remote_ref_value(::forthic::RemoteRefValue* PROTOBUF_NULLABLE value);
+  ::forthic::RemoteRefValue* PROTOBUF_NULLABLE unsafe_arena_release_remote_ref_value();
+
+  private:
+  const ::forthic::RemoteRefValue& _internal_remote_ref_value() const;
+  ::forthic::RemoteRefValue* PROTOBUF_NONNULL _internal_mutable_remote_ref_value();
+
+  public:
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:forthic.StackValue)
+ private:
+  class _Internal;
+  void set_has_int_value();
+  void set_has_string_value();
+  void set_has_bool_value();
+  void set_has_float_value();
+  void set_has_null_value();
+  void set_has_array_value();
+  void set_has_record_value();
+  void set_has_instant_value();
+  void set_has_plain_date_value();
+  void set_has_zoned_datetime_value();
+  void set_has_remote_ref_value();
+  inline bool has_value() const;
+  inline void clear_has_value();
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 11,
+                                   7, 47,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const StackValue& from_msg);
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::int64_t int_value_;
+      ::google::protobuf::internal::ArenaStringPtr string_value_;
+      bool bool_value_;
+      double float_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE null_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE array_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE record_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE instant_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE plain_date_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE zoned_datetime_value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE remote_ref_value_;
+    } value_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull StackValue_class_data_;
+// -------------------------------------------------------------------
+
+class StreamResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.StreamResponse) */ {
+ public:
+  inline StreamResponse() : StreamResponse(nullptr) {}
+  ~StreamResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(StreamResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(StreamResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StreamResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline StreamResponse(const StreamResponse& from) : StreamResponse(nullptr, from) {}
+  inline StreamResponse(StreamResponse&& from) noexcept
+      : StreamResponse(nullptr, ::std::move(from)) {}
+  inline StreamResponse& operator=(const StreamResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamResponse& operator=(StreamResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamResponse& default_instance() {
+    return *reinterpret_cast<const StreamResponse*>(
+        &_StreamResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 11;
+  friend void swap(StreamResponse& a, StreamResponse& b) { a.Swap(&b); }
+  inline void Swap(StreamResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<StreamResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StreamResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const StreamResponse& from) { StreamResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(StreamResponse* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.StreamResponse"; }
+
+  explicit StreamResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  StreamResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StreamResponse& from);
+  StreamResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StreamResponse&& from) noexcept
+      : StreamResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kResultStackFieldNumber = 2,
+    kErrorFieldNumber = 3,
+    kCorrelationIdFieldNumber = 1,
+    kSessionDepthFieldNumber = 4,
+    kSupportsCompactTemporalFieldNumber = 5,
+  };
+  // repeated .forthic.StackValue result_stack = 2;
+  int result_stack_size() const;
+  private:
+  int _internal_result_stack_size() const;
+
+  public:
+  void clear_result_stack() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_result_stack(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_result_stack();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_result_stack() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_result_stack();
+  public:
+  const ::forthic::StackValue& result_stack(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_result_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& result_stack() const;
+  // optional .forthic.ErrorInfo error = 3;
+  bool has_error() const;
+  void clear_error() ;
+  const ::forthic::ErrorInfo& error() const;
+  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
+  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+
+  private:
+  const ::forthic::ErrorInfo& _internal_error() const;
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+
+  public:
+  // uint64 correlation_id = 1;
+  void clear_correlation_id() ;
+  ::uint64_t correlation_id() const;
+  void set_correlation_id(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_correlation_id() const;
+  void _internal_set_correlation_id(::uint64_t value);
+
+  public:
+  // uint32 session_depth = 4;
+  void clear_session_depth() ;
+  ::uint32_t session_depth() const;
+  void set_session_depth(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_session_depth() const;
+  void _internal_set_session_depth(::uint32_t value);
+
+  public:
+  // bool supports_compact_temporal = 5;
+  void clear_supports_compact_temporal() ;
+  bool supports_compact_temporal() const;
+  void set_supports_compact_temporal(bool value);
+
+  private:
+  bool _internal_supports_compact_temporal() const;
+  void _internal_set_supports_compact_temporal(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.StreamResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<3, 5,
+                                   2, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const StreamResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > result_stack_;
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    ::uint64_t correlation_id_;
+    ::uint32_t session_depth_;
+    bool supports_compact_temporal_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull StreamResponse_class_data_;
+// -------------------------------------------------------------------
+
+class StreamRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.StreamRequest) */ {
+ public:
+  inline StreamRequest() : StreamRequest(nullptr) {}
+  ~StreamRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(StreamRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(StreamRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StreamRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline StreamRequest(const StreamRequest& from) : StreamRequest(nullptr, from) {}
+  inline StreamRequest(StreamRequest&& from) noexcept
+      : StreamRequest(nullptr, ::std::move(from)) {}
+  inline StreamRequest& operator=(const StreamRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamRequest& operator=(StreamRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamRequest& default_instance() {
+    return *reinterpret_cast<const StreamRequest*>(
+        &_StreamRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 10;
+  friend void swap(StreamRequest& a, StreamRequest& b) { a.Swap(&b); }
+  inline void Swap(StreamRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<StreamRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StreamRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const StreamRequest& from) { StreamRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(StreamRequest* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.StreamRequest"; }
+
+  explicit StreamRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  StreamRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StreamRequest& from);
+  StreamRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StreamRequest&& from) noexcept
+      : StreamRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kPushFieldNumber = 3,
+    kWordNameFieldNumber = 2,
+    kCorrelationIdFieldNumber = 1,
+    kReturnCountFieldNumber = 4,
+    kAcceptsCompactTemporalFieldNumber = 5,
+  };
+  // repeated .forthic.StackValue push = 3;
+  int push_size() const;
+  private:
+  int _internal_push_size() const;
+
+  public:
+  void clear_push() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_push(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_push();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_push() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_push();
+  public:
+  const ::forthic::StackValue& push(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_push();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& push() const;
+  // string word_name = 2;
+  void clear_word_name() ;
+  const ::std::string& word_name() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_word_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_word_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_word_name();
+  void set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_word_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_word_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_word_name();
+
+  public:
+  // uint64 correlation_id = 1;
+  void clear_correlation_id() ;
+  ::uint64_t correlation_id() const;
+  void set_correlation_id(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_correlation_id() const;
+  void _internal_set_correlation_id(::uint64_t value);
+
+  public:
+  // optional uint32 return_count = 4;
+  bool has_return_count() const;
+  void clear_return_count() ;
+  ::uint32_t return_count() const;
+  void set_return_count(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_return_count() const;
+  void _internal_set_return_count(::uint32_t value);
+
+  public:
+  // bool accepts_compact_temporal = 5;
+  void clear_accepts_compact_temporal() ;
+  bool accepts_compact_temporal() const;
+  void set_accepts_compact_temporal(bool value);
+
+  private:
+  bool _internal_accepts_compact_temporal() const;
+  void _internal_set_accepts_compact_temporal(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.StreamRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<3, 5,
+                                   1, 39,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const StreamRequest& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > push_;
+    ::google::protobuf::internal::ArenaStringPtr word_name_;
+    ::uint64_t correlation_id_;
+    ::uint32_t return_count_;
+    bool accepts_compact_temporal_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull StreamRequest_class_data_;
+// -------------------------------------------------------------------
+
+class StackPayload final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.StackPayload) */ {
+ public:
+  inline StackPayload() : StackPayload(nullptr) {}
+  ~StackPayload() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(StackPayload* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(StackPayload));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StackPayload(::google::protobuf::internal::ConstantInitialized);
+
+  inline StackPayload(const StackPayload& from) : StackPayload(nullptr, from) {}
+  inline StackPayload(StackPayload&& from) noexcept
+      : StackPayload(nullptr, ::std::move(from)) {}
+  inline StackPayload& operator=(const StackPayload& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StackPayload& operator=(StackPayload&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StackPayload& default_instance() {
+    return *reinterpret_cast<const StackPayload*>(
+        &_StackPayload_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 9;
+  friend void swap(StackPayload& a, StackPayload& b) { a.Swap(&b); }
+  inline void Swap(StackPayload* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StackPayload* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StackPayload* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<StackPayload>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StackPayload& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const StackPayload& from) { StackPayload::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(StackPayload* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.StackPayload"; }
+
+  explicit StackPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  StackPayload(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StackPayload& from);
+  StackPayload(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StackPayload&& from) noexcept
+      : StackPayload(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kValuesFieldNumber = 1,
+  };
+  // repeated .forthic.StackValue values = 1;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+
+  public:
+  void clear_values() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_values(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_values();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_values() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_values();
+  public:
+  const ::forthic::StackValue& values(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_values();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& values() const;
+  // @@protoc_insertion_point(class_scope:forthic.StackPayload)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const StackPayload& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > values_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull StackPayload_class_data_;
+// -------------------------------------------------------------------
+
+class ResultValueChunk final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ResultValueChunk) */ {
+ public:
+  inline ResultValueChunk() : ResultValueChunk(nullptr) {}
+  ~ResultValueChunk() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ResultValueChunk* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ResultValueChunk));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ResultValueChunk(::google::protobuf::internal::ConstantInitialized);
+
+  inline ResultValueChunk(const ResultValueChunk& from) : ResultValueChunk(nullptr, from) {}
+  inline ResultValueChunk(ResultValueChunk&& from) noexcept
+      : ResultValueChunk(nullptr, ::std::move(from)) {}
+  inline ResultValueChunk& operator=(const ResultValueChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResultValueChunk& operator=(ResultValueChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultValueChunk& default_instance() {
+    return *reinterpret_cast<const ResultValueChunk*>(
+        &_ResultValueChunk_default_instance_);
+  }
+  enum PartCase {
+    kValue = 2,
+    kArrayElements = 3,
+    PART_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 6;
+  friend void swap(ResultValueChunk& a, ResultValueChunk& b) { a.Swap(&b); }
+  inline void Swap(ResultValueChunk* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResultValueChunk* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResultValueChunk* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ResultValueChunk>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ResultValueChunk& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ResultValueChunk& from) { ResultValueChunk::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ResultValueChunk* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ResultValueChunk"; }
+
+  explicit ResultValueChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ResultValueChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ResultValueChunk& from);
+  ResultValueChunk(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ResultValueChunk&& from) noexcept
+      : ResultValueChunk(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kStackIndexFieldNumber = 1,
+    kLastFieldNumber = 4,
+    kValueFieldNumber = 2,
+    kArrayElementsFieldNumber = 3,
+  };
+  // uint32 stack_index = 1;
+  void clear_stack_index() ;
+  ::uint32_t stack_index() const;
+  void set_stack_index(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_stack_index() const;
+  void _internal_set_stack_index(::uint32_t value);
+
+  public:
+  // bool last = 4;
+  void clear_last() ;
+  bool last() const;
+  void set_last(bool value);
+
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+
+  public:
+  // .forthic.StackValue value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+
+  public:
+  void clear_value() ;
+  const ::forthic::StackValue& value() const;
+  [[nodiscard]] ::forthic::StackValue* PROTOBUF_NULLABLE release_value();
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_value();
+  void set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value);
+  ::forthic::StackValue* PROTOBUF_NULLABLE unsafe_arena_release_value();
+
+  private:
+  const ::forthic::StackValue& _internal_value() const;
+  ::forthic::StackValue* PROTOBUF_NONNULL _internal_mutable_value();
+
+  public:
+  // .forthic.ArrayValue array_elements = 3;
+  bool has_array_elements() const;
+  private:
+  bool _internal_has_array_elements() const;
+
+  public:
+  void clear_array_elements() ;
+  const ::forthic::ArrayValue& array_elements() const;
+  [[nodiscard]] ::forthic::ArrayValue* PROTOBUF_NULLABLE release_array_elements();
+  ::forthic::ArrayValue* PROTOBUF_NONNULL mutable_array_elements();
+  void set_allocated_array_elements(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_array_elements(::forthic::ArrayValue* PROTOBUF_NULLABLE value);
+  ::forthic::ArrayValue* PROTOBUF_NULLABLE unsafe_arena_release_array_elements();
+
+  private:
+  const ::forthic::ArrayValue& _internal_array_elements() const;
+  ::forthic::ArrayValue* PROTOBUF_NONNULL _internal_mutable_array_elements();
+
+  public:
+  void clear_part();
+  PartCase part_case() const;
+  // @@protoc_insertion_point(class_scope:forthic.ResultValueChunk)
+ private:
+  class _Internal;
+  void set_has_value();
+  void set_has_array_elements();
+  inline bool has_part() const;
+  inline void clear_has_part();
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<1, 4,
+                                   2, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ResultValueChunk& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t stack_index_;
+    bool last_;
+    union PartUnion {
+      constexpr PartUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::forthic::StackValue* PROTOBUF_NULLABLE value_;
+      ::forthic::ArrayValue* PROTOBUF_NULLABLE array_elements_;
+    } part_;
+    ::uint32_t _oneof_case_[1];
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ResultValueChunk_class_data_;
+// -------------------------------------------------------------------
+
+class FetchRefResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.FetchRefResponse) */ {
+ public:
+  inline FetchRefResponse() : FetchRefResponse(nullptr) {}
+  ~FetchRefResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FetchRefResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FetchRefResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FetchRefResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline FetchRefResponse(const FetchRefResponse& from) : FetchRefResponse(nullptr, from) {}
+  inline FetchRefResponse(FetchRefResponse&& from) noexcept
+      : FetchRefResponse(nullptr, ::std::move(from)) {}
+  inline FetchRefResponse& operator=(const FetchRefResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FetchRefResponse& operator=(FetchRefResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FetchRefResponse& default_instance() {
+    return *reinterpret_cast<const FetchRefResponse*>(
+        &_FetchRefResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 22;
+  friend void swap(FetchRefResponse& a, FetchRefResponse& b) { a.Swap(&b); }
+  inline void Swap(FetchRefResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FetchRefResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FetchRefResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FetchRefResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FetchRefResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const FetchRefResponse& from) { FetchRefResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(FetchRefResponse* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.FetchRefResponse"; }
+
+  explicit FetchRefResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  FetchRefResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const FetchRefResponse& from);
+  FetchRefResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, FetchRefResponse&& from) noexcept
+      : FetchRefResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kValueFieldNumber = 1,
+    kErrorFieldNumber = 2,
+  };
+  // .forthic.StackValue value = 1;
+  bool has_value() const;
+  void clear_value() ;
+  const ::forthic::StackValue& value() const;
+  [[nodiscard]] ::forthic::StackValue* PROTOBUF_NULLABLE release_value();
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_value();
+  void set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value);
+  ::forthic::StackValue* PROTOBUF_NULLABLE unsafe_arena_release_value();
+
+  private:
+  const ::forthic::StackValue& _internal_value() const;
+  ::forthic::StackValue* PROTOBUF_NONNULL _internal_mutable_value();
+
+  public:
+  // optional .forthic.ErrorInfo error = 2;
+  bool has_error() const;
+  void clear_error() ;
+  const ::forthic::ErrorInfo& error() const;
+  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
+  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+
+  private:
+  const ::forthic::ErrorInfo& _internal_error() const;
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.FetchRefResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   2, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const FetchRefResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::forthic::StackValue* PROTOBUF_NULLABLE value_;
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull FetchRefResponse_class_data_;
+// -------------------------------------------------------------------
+
+class ExecuteWordResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ExecuteWordResponse) */ {
+ public:
+  inline ExecuteWordResponse() : ExecuteWordResponse(nullptr) {}
+  ~ExecuteWordResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ExecuteWordResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteWordResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ExecuteWordResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline ExecuteWordResponse(const ExecuteWordResponse& from) : ExecuteWordResponse(nullptr, from) {}
+  inline ExecuteWordResponse(ExecuteWordResponse&& from) noexcept
+      : ExecuteWordResponse(nullptr, ::std::move(from)) {}
+  inline ExecuteWordResponse& operator=(const ExecuteWordResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecuteWordResponse& operator=(ExecuteWordResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecuteWordResponse& default_instance() {
+    return *reinterpret_cast<const ExecuteWordResponse*>(
+        &_ExecuteWordResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 1;
+  friend void swap(ExecuteWordResponse& a, ExecuteWordResponse& b) { a.Swap(&b); }
+  inline void Swap(ExecuteWordResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecuteWordResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecuteWordResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ExecuteWordResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ExecuteWordResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ExecuteWordResponse& from) { ExecuteWordResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ExecuteWordResponse* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ExecuteWordResponse"; }
+
+  explicit ExecuteWordResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ExecuteWordResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteWordResponse& from);
+  ExecuteWordResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteWordResponse&& from) noexcept
+      : ExecuteWordResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kResultStackFieldNumber = 1,
+    kErrorFieldNumber = 2,
+    kSharedResultStackFieldNumber = 4,
+    kSupportsCompactTemporalFieldNumber = 3,
+  };
+  // repeated .forthic.StackValue result_stack = 1;
+  int result_stack_size() const;
+  private:
+  int _internal_result_stack_size() const;
+
+  public:
+  void clear_result_stack() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_result_stack(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_result_stack();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_result_stack() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_result_stack();
+  public:
+  const ::forthic::StackValue& result_stack(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_result_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& result_stack() const;
+  // optional .forthic.ErrorInfo error = 2;
+  bool has_error() const;
+  void clear_error() ;
+  const ::forthic::ErrorInfo& error() const;
+  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
+  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+
+  private:
+  const ::forthic::ErrorInfo& _internal_error() const;
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+
+  public:
+  // optional .forthic.SharedPayload shared_result_stack = 4;
+  bool has_shared_result_stack() const;
+  void clear_shared_result_stack() ;
+  const ::forthic::SharedPayload& shared_result_stack() const;
+  [[nodiscard]] ::forthic::SharedPayload* PROTOBUF_NULLABLE release_shared_result_stack();
+  ::forthic::SharedPayload* PROTOBUF_NONNULL mutable_shared_result_stack();
+  void set_allocated_shared_result_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_shared_result_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value);
+  ::forthic::SharedPayload* PROTOBUF_NULLABLE unsafe_arena_release_shared_result_stack();
+
+  private:
+  const ::forthic::SharedPayload& _internal_shared_result_stack() const;
+  ::forthic::SharedPayload* PROTOBUF_NONNULL _internal_mutable_shared_result_stack();
+
+  public:
+  // bool supports_compact_temporal = 3;
+  void clear_supports_compact_temporal() ;
+  bool supports_compact_temporal() const;
+  void set_supports_compact_temporal(bool value);
+
+  private:
+  bool _internal_supports_compact_temporal() const;
+  void _internal_set_supports_compact_temporal(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.ExecuteWordResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
+                                   3, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ExecuteWordResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > result_stack_;
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    ::forthic::SharedPayload* PROTOBUF_NULLABLE shared_result_stack_;
+    bool supports_compact_temporal_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ExecuteWordResponse_class_data_;
+// -------------------------------------------------------------------
+
+class ExecuteWordRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ExecuteWordRequest) */ {
+ public:
+  inline ExecuteWordRequest() : ExecuteWordRequest(nullptr) {}
+  ~ExecuteWordRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ExecuteWordRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteWordRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ExecuteWordRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline ExecuteWordRequest(const ExecuteWordRequest& from) : ExecuteWordRequest(nullptr, from) {}
+  inline ExecuteWordRequest(ExecuteWordRequest&& from) noexcept
+      : ExecuteWordRequest(nullptr, ::std::move(from)) {}
+  inline ExecuteWordRequest& operator=(const ExecuteWordRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecuteWordRequest& operator=(ExecuteWordRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecuteWordRequest& default_instance() {
+    return *reinterpret_cast<const ExecuteWordRequest*>(
+        &_ExecuteWordRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 0;
+  friend void swap(ExecuteWordRequest& a, ExecuteWordRequest& b) { a.Swap(&b); }
+  inline void Swap(ExecuteWordRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecuteWordRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecuteWordRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ExecuteWordRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ExecuteWordRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ExecuteWordRequest& from) { ExecuteWordRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ExecuteWordRequest* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ExecuteWordRequest"; }
+
+  explicit ExecuteWordRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ExecuteWordRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteWordRequest& from);
+  ExecuteWordRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteWordRequest&& from) noexcept
+      : ExecuteWordRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kStackFieldNumber = 2,
+    kWordNameFieldNumber = 1,
+    kSharedMemoryFieldNumber = 6,
+    kSharedStackFieldNumber = 7,
+    kAcceptsCompactTemporalFieldNumber = 3,
+    kAcceptsRemoteRefsFieldNumber = 4,
+    kMaxChunkBytesFieldNumber = 5,
+  };
+  // repeated .forthic.StackValue stack = 2;
+  int stack_size() const;
+  private:
+  int _internal_stack_size() const;
+
+  public:
+  void clear_stack() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_stack(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_stack();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_stack() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_stack();
+  public:
+  const ::forthic::StackValue& stack(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& stack() const;
+  // string word_name = 1;
+  void clear_word_name() ;
+  const ::std::string& word_name() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_word_name(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_word_name();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_word_name();
+  void set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_word_name() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_word_name(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_word_name();
+
+  public:
+  // optional .forthic.SharedMemoryOffer shared_memory = 6;
+  bool has_shared_memory() const;
+  void clear_shared_memory() ;
+  const ::forthic::SharedMemoryOffer& shared_memory() const;
+  [[nodiscard]] ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE release_shared_memory();
+  ::forthic::SharedMemoryOffer* PROTOBUF_NONNULL mutable_shared_memory();
+  void set_allocated_shared_memory(::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_shared_memory(::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE value);
+  ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE unsafe_arena_release_shared_memory();
+
+  private:
+  const ::forthic::SharedMemoryOffer& _internal_shared_memory() const;
+  ::forthic::SharedMemoryOffer* PROTOBUF_NONNULL _internal_mutable_shared_memory();
+
+  public:
+  // optional .forthic.SharedPayload shared_stack = 7;
+  bool has_shared_stack() const;
+  void clear_shared_stack() ;
+  const ::forthic::SharedPayload& shared_stack() const;
+  [[nodiscard]] ::forthic::SharedPayload* PROTOBUF_NULLABLE release_shared_stack();
+  ::forthic::SharedPayload* PROTOBUF_NONNULL mutable_shared_stack();
+  void set_allocated_shared_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_shared_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value);
+  ::forthic::SharedPayload* PROTOBUF_NULLABLE unsafe_arena_release_shared_stack();
+
+  private:
+  const ::forthic::SharedPayload& _internal_shared_stack() const;
+  ::forthic::SharedPayload* PROTOBUF_NONNULL _internal_mutable_shared_stack();
+
+  public:
+  // bool accepts_compact_temporal = 3;
+  void clear_accepts_compact_temporal() ;
+  bool accepts_compact_temporal() const;
+  void set_accepts_compact_temporal(bool value);
+
+  private:
+  bool _internal_accepts_compact_temporal() const;
+  void _internal_set_accepts_compact_temporal(bool value);
+
+  public:
+  // bool accepts_remote_refs = 4;
+  void clear_accepts_remote_refs() ;
+  bool accepts_remote_refs() const;
+  void set_accepts_remote_refs(bool value);
+
+  private:
+  bool _internal_accepts_remote_refs() const;
+  void _internal_set_accepts_remote_refs(bool value);
+
+  public:
+  // uint32 max_chunk_bytes = 5;
+  void clear_max_chunk_bytes() ;
+  ::uint32_t max_chunk_bytes() const;
+  void set_max_chunk_bytes(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_max_chunk_bytes() const;
+  void _internal_set_max_chunk_bytes(::uint32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.ExecuteWordRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<3, 7,
+                                   3, 44,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ExecuteWordRequest& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > stack_;
+    ::google::protobuf::internal::ArenaStringPtr word_name_;
+    ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE shared_memory_;
+    ::forthic::SharedPayload* PROTOBUF_NULLABLE shared_stack_;
+    bool accepts_compact_temporal_;
+    bool accepts_remote_refs_;
+    ::uint32_t max_chunk_bytes_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ExecuteWordRequest_class_data_;
+// -------------------------------------------------------------------
+
+class ExecuteSequenceResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ExecuteSequenceResponse) */ {
+ public:
+  inline ExecuteSequenceResponse() : ExecuteSequenceResponse(nullptr) {}
+  ~ExecuteSequenceResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ExecuteSequenceResponse* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteSequenceResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ExecuteSequenceResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline ExecuteSequenceResponse(const ExecuteSequenceResponse& from) : ExecuteSequenceResponse(nullptr, from) {}
+  inline ExecuteSequenceResponse(ExecuteSequenceResponse&& from) noexcept
+      : ExecuteSequenceResponse(nullptr, ::std::move(from)) {}
+  inline ExecuteSequenceResponse& operator=(const ExecuteSequenceResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecuteSequenceResponse& operator=(ExecuteSequenceResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecuteSequenceResponse& default_instance() {
+    return *reinterpret_cast<const ExecuteSequenceResponse*>(
+        &_ExecuteSequenceResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(ExecuteSequenceResponse& a, ExecuteSequenceResponse& b) { a.Swap(&b); }
+  inline void Swap(ExecuteSequenceResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecuteSequenceResponse* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecuteSequenceResponse* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ExecuteSequenceResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ExecuteSequenceResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ExecuteSequenceResponse& from) { ExecuteSequenceResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ExecuteSequenceResponse* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ExecuteSequenceResponse"; }
+
+  explicit ExecuteSequenceResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ExecuteSequenceResponse(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteSequenceResponse& from);
+  ExecuteSequenceResponse(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteSequenceResponse&& from) noexcept
+      : ExecuteSequenceResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kResultStackFieldNumber = 1,
+    kErrorFieldNumber = 2,
+    kSupportsCompactTemporalFieldNumber = 3,
+  };
+  // repeated .forthic.StackValue result_stack = 1;
+  int result_stack_size() const;
+  private:
+  int _internal_result_stack_size() const;
+
+  public:
+  void clear_result_stack() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_result_stack(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_result_stack();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_result_stack() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_result_stack();
+  public:
+  const ::forthic::StackValue& result_stack(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_result_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& result_stack() const;
+  // optional .forthic.ErrorInfo error = 2;
+  bool has_error() const;
+  void clear_error() ;
+  const ::forthic::ErrorInfo& error() const;
+  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
+  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+
+  private:
+  const ::forthic::ErrorInfo& _internal_error() const;
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+
+  public:
+  // bool supports_compact_temporal = 3;
+  void clear_supports_compact_temporal() ;
+  bool supports_compact_temporal() const;
+  void set_supports_compact_temporal(bool value);
+
+  private:
+  bool _internal_supports_compact_temporal() const;
+  void _internal_set_supports_compact_temporal(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.ExecuteSequenceResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
+                                   2, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ExecuteSequenceResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > result_stack_;
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE error_;
+    bool supports_compact_temporal_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ExecuteSequenceResponse_class_data_;
+// -------------------------------------------------------------------
+
+class ExecuteSequenceRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ExecuteSequenceRequest) */ {
+ public:
+  inline ExecuteSequenceRequest() : ExecuteSequenceRequest(nullptr) {}
+  ~ExecuteSequenceRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ExecuteSequenceRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ExecuteSequenceRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ExecuteSequenceRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline ExecuteSequenceRequest(const ExecuteSequenceRequest& from) : ExecuteSequenceRequest(nullptr, from) {}
+  inline ExecuteSequenceRequest(ExecuteSequenceRequest&& from) noexcept
+      : ExecuteSequenceRequest(nullptr, ::std::move(from)) {}
+  inline ExecuteSequenceRequest& operator=(const ExecuteSequenceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecuteSequenceRequest& operator=(ExecuteSequenceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecuteSequenceRequest& default_instance() {
+    return *reinterpret_cast<const ExecuteSequenceRequest*>(
+        &_ExecuteSequenceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(ExecuteSequenceRequest& a, ExecuteSequenceRequest& b) { a.Swap(&b); }
+  inline void Swap(ExecuteSequenceRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecuteSequenceRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecuteSequenceRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ExecuteSequenceRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ExecuteSequenceRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ExecuteSequenceRequest& from) { ExecuteSequenceRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ExecuteSequenceRequest* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ExecuteSequenceRequest"; }
+
+  explicit ExecuteSequenceRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ExecuteSequenceRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ExecuteSequenceRequest& from);
+  ExecuteSequenceRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ExecuteSequenceRequest&& from) noexcept
+      : ExecuteSequenceRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kWordNamesFieldNumber = 1,
+    kStackFieldNumber = 2,
+    kAcceptsCompactTemporalFieldNumber = 3,
+    kAcceptsRemoteRefsFieldNumber = 4,
+  };
+  // repeated string word_names = 1;
+  int word_names_size() const;
+  private:
+  int _internal_word_names_size() const;
+
+  public:
+  void clear_word_names() ;
+  const ::std::string& word_names(int index) const;
+  ::std::string* PROTOBUF_NONNULL mutable_word_names(int index);
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_word_names(int index, Arg_&& value, Args_... args);
+  ::std::string* PROTOBUF_NONNULL add_word_names();
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void add_word_names(Arg_&& value, Args_... args);
+  const ::google::protobuf::RepeatedPtrField<::std::string>& word_names() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_word_names();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_word_names() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_word_names();
+
+  public:
+  // repeated .forthic.StackValue stack = 2;
+  int stack_size() const;
+  private:
+  int _internal_stack_size() const;
+
+  public:
+  void clear_stack() ;
+  ::forthic::StackValue* PROTOBUF_NONNULL mutable_stack(int index);
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL mutable_stack();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& _internal_stack() const;
+  ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL _internal_mutable_stack();
+  public:
+  const ::forthic::StackValue& stack(int index) const;
+  ::forthic::StackValue* PROTOBUF_NONNULL add_stack();
+  const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& stack() const;
+  // bool accepts_compact_temporal = 3;
+  void clear_accepts_compact_temporal() ;
+  bool accepts_compact_temporal() const;
+  void set_accepts_compact_temporal(bool value);
+
+  private:
+  bool _internal_accepts_compact_temporal() const;
+  void _internal_set_accepts_compact_temporal(bool value);
+
+  public:
+  // bool accepts_remote_refs = 4;
+  void clear_accepts_remote_refs() ;
+  bool accepts_remote_refs() const;
+  void set_accepts_remote_refs(bool value);
+
+  private:
+  bool _internal_accepts_remote_refs() const;
+  void _internal_set_accepts_remote_refs(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:forthic.ExecuteSequenceRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
+                                   1, 49,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ExecuteSequenceRequest& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField<::std::string> word_names_;
+    ::google::protobuf::RepeatedPtrField< ::forthic::StackValue > stack_;
+    bool accepts_compact_temporal_;
+    bool accepts_remote_refs_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ExecuteSequenceRequest_class_data_;
+// -------------------------------------------------------------------
+
+class ResultChunk final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:forthic.ResultChunk) */ {
+ public:
+  inline ResultChunk() : ResultChunk(nullptr) {}
+  ~ResultChunk() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ResultChunk* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ResultChunk));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ResultChunk(::google::protobuf::internal::ConstantInitialized);
+
+  inline ResultChunk(const ResultChunk& from) : ResultChunk(nullptr, from) {}
+  inline ResultChunk(ResultChunk&& from) noexcept
+      : ResultChunk(nullptr, ::std::move(from)) {}
+  inline ResultChunk& operator=(const ResultChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResultChunk& operator=(ResultChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultChunk& default_instance() {
+    return *reinterpret_cast<const ResultChunk*>(
+        &_ResultChunk_default_instance_);
+  }
+  enum ChunkCase {
+    kHeader = 1,
+    kValue = 2,
+    kError = 3,
+    CHUNK_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 4;
+  friend void swap(ResultChunk& a, ResultChunk& b) { a.Swap(&b); }
+  inline void Swap(ResultChunk* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResultChunk* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResultChunk* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ResultChunk>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ResultChunk& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ResultChunk& from) { ResultChunk::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ResultChunk* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "forthic.ResultChunk"; }
+
+  explicit ResultChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ResultChunk(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ResultChunk& from);
+  ResultChunk(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ResultChunk&& from) noexcept
+      : ResultChunk(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kErrorFieldNumber = 3,
+  };
+  // .forthic.ResultHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+
+  public:
+  void clear_header() ;
+  const ::forthic::ResultHeader& header() const;
+  [[nodiscard]] ::forthic::ResultHeader* PROTOBUF_NULLABLE release_header();
+  ::forthic::ResultHeader* PROTOBUF_NONNULL mutable_header();
+  void set_allocated_header(::forthic::ResultHeader* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_header(::forthic::ResultHeader* PROTOBUF_NULLABLE value);
+  ::forthic::ResultHeader* PROTOBUF_NULLABLE unsafe_arena_release_header();
+
+  private:
+  const ::forthic::ResultHeader& _internal_header() const;
+  ::forthic::ResultHeader* PROTOBUF_NONNULL _internal_mutable_header();
+
+  public:
+  // .forthic.ResultValueChunk value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+
+  public:
+  void clear_value() ;
+  const ::forthic::ResultValueChunk& value() const;
+  [[nodiscard]] ::forthic::ResultValueChunk* PROTOBUF_NULLABLE release_value();
+  ::forthic::ResultValueChunk* PROTOBUF_NONNULL mutable_value();
+  void set_allocated_value(::forthic::ResultValueChunk* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_value(::forthic::ResultValueChunk* PROTOBUF_NULLABLE value);
+  ::forthic::ResultValueChunk* PROTOBUF_NULLABLE unsafe_arena_release_value();
+
+  private:
+  const ::forthic::ResultValueChunk& _internal_value() const;
+  ::forthic::ResultValueChunk* PROTOBUF_NONNULL _internal_mutable_value();
+
+  public:
+  // .forthic.ErrorInfo error = 3;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+
+  public:
+  void clear_error() ;
+  const ::forthic::ErrorInfo& error() const;
+  [[nodiscard]] ::forthic::ErrorInfo* PROTOBUF_NULLABLE release_error();
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL mutable_error();
+  void set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value);
+  ::forthic::ErrorInfo* PROTOBUF_NULLABLE unsafe_arena_release_error();
+
+  private:
+  const ::forthic::ErrorInfo& _internal_error() const;
+  ::forthic::ErrorInfo* PROTOBUF_NONNULL _internal_mutable_error();
+
+  public:
+  void clear_chunk();
+  ChunkCase chunk_case() const;
+  // @@protoc_insertion_point(class_scope:forthic.ResultChunk)
+ private:
+  class _Internal;
+  void set_has_header();
+  void set_has_value();
+  void set_has_error();
+  inline bool has_chunk() const;
+  inline void clear_has_chunk();
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 3,
+                                   3, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ResultChunk& from_msg);
+    union ChunkUnion {
+      constexpr ChunkUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE header_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE value_;
+      ::google::protobuf::Message* PROTOBUF_NULLABLE error_;
+    } chunk_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protos_2fforthic_5fruntime_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ResultChunk_class_data_;
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// ExecuteWordRequest
+
+// string word_name = 1;
+inline void ExecuteWordRequest::clear_word_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.word_name_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline const ::std::string& ExecuteWordRequest::word_name() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.word_name)
+  return _internal_word_name();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void ExecuteWordRequest::set_word_name(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  _impl_.word_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.ExecuteWordRequest.word_name)
+}
+inline ::std::string* PROTOBUF_NONNULL ExecuteWordRequest::mutable_word_name()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::std::string* _s = _internal_mutable_word_name();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.word_name)
+  return _s;
+}
+inline const ::std::string& ExecuteWordRequest::_internal_word_name() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.word_name_.Get();
+}
+inline void ExecuteWordRequest::_internal_set_word_name(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.word_name_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL ExecuteWordRequest::_internal_mutable_word_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.word_name_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE ExecuteWordRequest::release_word_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteWordRequest.word_name)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  auto* released = _impl_.word_name_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.word_name_.Set("", GetArena());
+  }
+  return released;
+}
+inline void ExecuteWordRequest::set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  _impl_.word_name_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.word_name_.IsDefault()) {
+    _impl_.word_name_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordRequest.word_name)
+}
+
+// repeated .forthic.StackValue stack = 2;
+inline int ExecuteWordRequest::_internal_stack_size() const {
+  return _internal_stack().size();
+}
+inline int ExecuteWordRequest::stack_size() const {
+  return _internal_stack_size();
+}
+inline void ExecuteWordRequest::clear_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stack_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordRequest::mutable_stack(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.stack)
+  return _internal_mutable_stack()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteWordRequest::mutable_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteWordRequest.stack)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_stack();
+}
+inline const ::forthic::StackValue& ExecuteWordRequest::stack(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.stack)
+  return _internal_stack().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordRequest::add_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_stack()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ExecuteWordRequest.stack)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteWordRequest::stack() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ExecuteWordRequest.stack)
+  return _internal_stack();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+ExecuteWordRequest::_internal_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.stack_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+ExecuteWordRequest::_internal_mutable_stack() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.stack_;
+}
+
+// bool accepts_compact_temporal = 3;
+inline void ExecuteWordRequest::clear_accepts_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000010U);
+}
+inline bool ExecuteWordRequest::accepts_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.accepts_compact_temporal)
+  return _internal_accepts_compact_temporal();
+}
+inline void ExecuteWordRequest::set_accepts_compact_temporal(bool value) {
+  _internal_set_accepts_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000010U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteWordRequest.accepts_compact_temporal)
+}
+inline bool ExecuteWordRequest::_internal_accepts_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_compact_temporal_;
+}
+inline void ExecuteWordRequest::_internal_set_accepts_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = value;
+}
+
+// bool accepts_remote_refs = 4;
+inline void ExecuteWordRequest::clear_accepts_remote_refs() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_remote_refs_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000020U);
+}
+inline bool ExecuteWordRequest::accepts_remote_refs() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.accepts_remote_refs)
+  return _internal_accepts_remote_refs();
+}
+inline void ExecuteWordRequest::set_accepts_remote_refs(bool value) {
+  _internal_set_accepts_remote_refs(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000020U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteWordRequest.accepts_remote_refs)
+}
+inline bool ExecuteWordRequest::_internal_accepts_remote_refs() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_remote_refs_;
+}
+inline void ExecuteWordRequest::_internal_set_accepts_remote_refs(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_remote_refs_ = value;
+}
+
+// uint32 max_chunk_bytes = 5;
+inline void ExecuteWordRequest::clear_max_chunk_bytes() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.max_chunk_bytes_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000040U);
+}
+inline ::uint32_t ExecuteWordRequest::max_chunk_bytes() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.max_chunk_bytes)
+  return _internal_max_chunk_bytes();
+}
+inline void ExecuteWordRequest::set_max_chunk_bytes(::uint32_t value) {
+  _internal_set_max_chunk_bytes(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000040U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteWordRequest.max_chunk_bytes)
+}
+inline ::uint32_t ExecuteWordRequest::_internal_max_chunk_bytes() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.max_chunk_bytes_;
+}
+inline void ExecuteWordRequest::_internal_set_max_chunk_bytes(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.max_chunk_bytes_ = value;
+}
+
+// optional .forthic.SharedMemoryOffer shared_memory = 6;
+inline bool ExecuteWordRequest::has_shared_memory() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000004U);
+  PROTOBUF_ASSUME(!value || _impl_.shared_memory_ != nullptr);
+  return value;
+}
+inline void ExecuteWordRequest::clear_shared_memory() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_memory_ != nullptr) _impl_.shared_memory_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline const ::forthic::SharedMemoryOffer& ExecuteWordRequest::_internal_shared_memory() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::SharedMemoryOffer* p = _impl_.shared_memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::SharedMemoryOffer&>(::forthic::_SharedMemoryOffer_default_instance_);
+}
+inline const ::forthic::SharedMemoryOffer& ExecuteWordRequest::shared_memory() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.shared_memory)
+  return _internal_shared_memory();
+}
+inline void ExecuteWordRequest::unsafe_arena_set_allocated_shared_memory(
+    ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_memory_);
+  }
+  _impl_.shared_memory_ = reinterpret_cast<::forthic::SharedMemoryOffer*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteWordRequest.shared_memory)
+}
+inline ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE ExecuteWordRequest::release_shared_memory() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedMemoryOffer* released = _impl_.shared_memory_;
+  _impl_.shared_memory_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE ExecuteWordRequest::unsafe_arena_release_shared_memory() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteWordRequest.shared_memory)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedMemoryOffer* temp = _impl_.shared_memory_;
+  _impl_.shared_memory_ = nullptr;
+  return temp;
+}
+inline ::forthic::SharedMemoryOffer* PROTOBUF_NONNULL ExecuteWordRequest::_internal_mutable_shared_memory() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_memory_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::SharedMemoryOffer>(GetArena());
+    _impl_.shared_memory_ = reinterpret_cast<::forthic::SharedMemoryOffer*>(p);
+  }
+  return _impl_.shared_memory_;
+}
+inline ::forthic::SharedMemoryOffer* PROTOBUF_NONNULL ExecuteWordRequest::mutable_shared_memory()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedMemoryOffer* _msg = _internal_mutable_shared_memory();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.shared_memory)
+  return _msg;
+}
+inline void ExecuteWordRequest::set_allocated_shared_memory(::forthic::SharedMemoryOffer* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_memory_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  }
+
+  _impl_.shared_memory_ = reinterpret_cast<::forthic::SharedMemoryOffer*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordRequest.shared_memory)
+}
+
+// optional .forthic.SharedPayload shared_stack = 7;
+inline bool ExecuteWordRequest::has_shared_stack() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000008U);
+  PROTOBUF_ASSUME(!value || _impl_.shared_stack_ != nullptr);
+  return value;
+}
+inline void ExecuteWordRequest::clear_shared_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_stack_ != nullptr) _impl_.shared_stack_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline const ::forthic::SharedPayload& ExecuteWordRequest::_internal_shared_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::SharedPayload* p = _impl_.shared_stack_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::SharedPayload&>(::forthic::_SharedPayload_default_instance_);
+}
+inline const ::forthic::SharedPayload& ExecuteWordRequest::shared_stack() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.shared_stack)
+  return _internal_shared_stack();
+}
+inline void ExecuteWordRequest::unsafe_arena_set_allocated_shared_stack(
+    ::forthic::SharedPayload* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_stack_);
+  }
+  _impl_.shared_stack_ = reinterpret_cast<::forthic::SharedPayload*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteWordRequest.shared_stack)
+}
+inline ::forthic::SharedPayload* PROTOBUF_NULLABLE ExecuteWordRequest::release_shared_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  ::forthic::SharedPayload* released = _impl_.shared_stack_;
+  _impl_.shared_stack_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NULLABLE ExecuteWordRequest::unsafe_arena_release_shared_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteWordRequest.shared_stack)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  ::forthic::SharedPayload* temp = _impl_.shared_stack_;
+  _impl_.shared_stack_ = nullptr;
+  return temp;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NONNULL ExecuteWordRequest::_internal_mutable_shared_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_stack_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::SharedPayload>(GetArena());
+    _impl_.shared_stack_ = reinterpret_cast<::forthic::SharedPayload*>(p);
+  }
+  return _impl_.shared_stack_;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NONNULL ExecuteWordRequest::mutable_shared_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  ::forthic::SharedPayload* _msg = _internal_mutable_shared_stack();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.shared_stack)
+  return _msg;
+}
+inline void ExecuteWordRequest::set_allocated_shared_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_stack_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  }
+
+  _impl_.shared_stack_ = reinterpret_cast<::forthic::SharedPayload*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordRequest.shared_stack)
+}
+
+// -------------------------------------------------------------------
+
+// ExecuteWordResponse
+
+// repeated .forthic.StackValue result_stack = 1;
+inline int ExecuteWordResponse::_internal_result_stack_size() const {
+  return _internal_result_stack().size();
+}
+inline int ExecuteWordResponse::result_stack_size() const {
+  return _internal_result_stack_size();
+}
+inline void ExecuteWordResponse::clear_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.result_stack_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordResponse::mutable_result_stack(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordResponse.result_stack)
+  return _internal_mutable_result_stack()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteWordResponse::mutable_result_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteWordResponse.result_stack)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_result_stack();
+}
+inline const ::forthic::StackValue& ExecuteWordResponse::result_stack(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.result_stack)
+  return _internal_result_stack().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordResponse::add_result_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_result_stack()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ExecuteWordResponse.result_stack)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteWordResponse::result_stack() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ExecuteWordResponse.result_stack)
+  return _internal_result_stack();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+ExecuteWordResponse::_internal_result_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.result_stack_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+ExecuteWordResponse::_internal_mutable_result_stack() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.result_stack_;
+}
+
+// optional .forthic.ErrorInfo error = 2;
+inline bool ExecuteWordResponse::has_error() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
+  PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
+  return value;
+}
+inline void ExecuteWordResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.error_ != nullptr) _impl_.error_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline const ::forthic::ErrorInfo& ExecuteWordResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::ErrorInfo* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
+}
+inline const ::forthic::ErrorInfo& ExecuteWordResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.error)
+  return _internal_error();
+}
+inline void ExecuteWordResponse::unsafe_arena_set_allocated_error(
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteWordResponse.error)
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteWordResponse::release_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* released = _impl_.error_;
+  _impl_.error_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteWordResponse::unsafe_arena_release_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteWordResponse.error)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteWordResponse::_internal_mutable_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.error_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena());
+    _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(p);
+  }
+  return _impl_.error_;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteWordResponse::mutable_error()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordResponse.error)
+  return _msg;
+}
+inline void ExecuteWordResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordResponse.error)
+}
+
+// bool supports_compact_temporal = 3;
+inline void ExecuteWordResponse::clear_supports_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline bool ExecuteWordResponse::supports_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.supports_compact_temporal)
+  return _internal_supports_compact_temporal();
+}
+inline void ExecuteWordResponse::set_supports_compact_temporal(bool value) {
+  _internal_set_supports_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteWordResponse.supports_compact_temporal)
+}
+inline bool ExecuteWordResponse::_internal_supports_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.supports_compact_temporal_;
+}
+inline void ExecuteWordResponse::_internal_set_supports_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = value;
+}
+
+// optional .forthic.SharedPayload shared_result_stack = 4;
+inline bool ExecuteWordResponse::has_shared_result_stack() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000004U);
+  PROTOBUF_ASSUME(!value || _impl_.shared_result_stack_ != nullptr);
+  return value;
+}
+inline void ExecuteWordResponse::clear_shared_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_result_stack_ != nullptr) _impl_.shared_result_stack_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline const ::forthic::SharedPayload& ExecuteWordResponse::_internal_shared_result_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::SharedPayload* p = _impl_.shared_result_stack_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::SharedPayload&>(::forthic::_SharedPayload_default_instance_);
+}
+inline const ::forthic::SharedPayload& ExecuteWordResponse::shared_result_stack() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.shared_result_stack)
+  return _internal_shared_result_stack();
+}
+inline void ExecuteWordResponse::unsafe_arena_set_allocated_shared_result_stack(
+    ::forthic::SharedPayload* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_result_stack_);
+  }
+  _impl_.shared_result_stack_ = reinterpret_cast<::forthic::SharedPayload*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteWordResponse.shared_result_stack)
+}
+inline ::forthic::SharedPayload* PROTOBUF_NULLABLE ExecuteWordResponse::release_shared_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedPayload* released = _impl_.shared_result_stack_;
+  _impl_.shared_result_stack_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NULLABLE ExecuteWordResponse::unsafe_arena_release_shared_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteWordResponse.shared_result_stack)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedPayload* temp = _impl_.shared_result_stack_;
+  _impl_.shared_result_stack_ = nullptr;
+  return temp;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NONNULL ExecuteWordResponse::_internal_mutable_shared_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.shared_result_stack_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::SharedPayload>(GetArena());
+    _impl_.shared_result_stack_ = reinterpret_cast<::forthic::SharedPayload*>(p);
+  }
+  return _impl_.shared_result_stack_;
+}
+inline ::forthic::SharedPayload* PROTOBUF_NONNULL ExecuteWordResponse::mutable_shared_result_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  ::forthic::SharedPayload* _msg = _internal_mutable_shared_result_stack();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordResponse.shared_result_stack)
+  return _msg;
+}
+inline void ExecuteWordResponse::set_allocated_shared_result_stack(::forthic::SharedPayload* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.shared_result_stack_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000004U);
+  }
+
+  _impl_.shared_result_stack_ = reinterpret_cast<::forthic::SharedPayload*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordResponse.shared_result_stack)
+}
+
+// -------------------------------------------------------------------
+
+// ExecuteSequenceRequest
+
+// repeated string word_names = 1;
+inline int ExecuteSequenceRequest::_internal_word_names_size() const {
+  return _internal_word_names().size();
+}
+inline int ExecuteSequenceRequest::word_names_size() const {
+  return _internal_word_names_size();
+}
+inline void ExecuteSequenceRequest::clear_word_names() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.word_names_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::std::string* PROTOBUF_NONNULL ExecuteSequenceRequest::add_word_names()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::std::string* _s =
+      _internal_mutable_word_names()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add_mutable:forthic.ExecuteSequenceRequest.word_names)
+  return _s;
+}
+inline const ::std::string& ExecuteSequenceRequest::word_names(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.word_names)
+  return _internal_word_names().Get(index);
+}
+inline ::std::string* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_word_names(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceRequest.word_names)
+  return _internal_mutable_word_names()->Mutable(index);
+}
+template <typename Arg_, typename... Args_>
+inline void ExecuteSequenceRequest::set_word_names(int index, Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::AssignToString(*_internal_mutable_word_names()->Mutable(index), ::std::forward<Arg_>(value),
+                        args... );
+  // @@protoc_insertion_point(field_set:forthic.ExecuteSequenceRequest.word_names)
+}
+template <typename Arg_, typename... Args_>
+inline void ExecuteSequenceRequest::add_word_names(Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::google::protobuf::internal::AddToRepeatedPtrField(
+      ::google::protobuf::MessageLite::internal_visibility(), GetArena(),
+      *_internal_mutable_word_names(), ::std::forward<Arg_>(value),
+      args... );
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceRequest.word_names)
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>& ExecuteSequenceRequest::word_names()
+    const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceRequest.word_names)
+  return _internal_word_names();
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ExecuteSequenceRequest::mutable_word_names() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceRequest.word_names)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_word_names();
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>&
+ExecuteSequenceRequest::_internal_word_names() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.word_names_;
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ExecuteSequenceRequest::_internal_mutable_word_names() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.word_names_;
+}
+
+// repeated .forthic.StackValue stack = 2;
+inline int ExecuteSequenceRequest::_internal_stack_size() const {
+  return _internal_stack().size();
+}
+inline int ExecuteSequenceRequest::stack_size() const {
+  return _internal_stack_size();
+}
+inline void ExecuteSequenceRequest::clear_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stack_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_stack(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceRequest.stack)
+  return _internal_mutable_stack()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceRequest.stack)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_stack();
+}
+inline const ::forthic::StackValue& ExecuteSequenceRequest::stack(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.stack)
+  return _internal_stack().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceRequest::add_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_stack()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceRequest.stack)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteSequenceRequest::stack() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceRequest.stack)
+  return _internal_stack();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+ExecuteSequenceRequest::_internal_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.stack_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+ExecuteSequenceRequest::_internal_mutable_stack() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.stack_;
+}
+
+// bool accepts_compact_temporal = 3;
+inline void ExecuteSequenceRequest::clear_accepts_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline bool ExecuteSequenceRequest::accepts_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.accepts_compact_temporal)
+  return _internal_accepts_compact_temporal();
+}
+inline void ExecuteSequenceRequest::set_accepts_compact_temporal(bool value) {
+  _internal_set_accepts_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteSequenceRequest.accepts_compact_temporal)
+}
+inline bool ExecuteSequenceRequest::_internal_accepts_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_compact_temporal_;
+}
+inline void ExecuteSequenceRequest::_internal_set_accepts_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = value;
+}
+
+// bool accepts_remote_refs = 4;
+inline void ExecuteSequenceRequest::clear_accepts_remote_refs() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_remote_refs_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline bool ExecuteSequenceRequest::accepts_remote_refs() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.accepts_remote_refs)
+  return _internal_accepts_remote_refs();
+}
+inline void ExecuteSequenceRequest::set_accepts_remote_refs(bool value) {
+  _internal_set_accepts_remote_refs(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteSequenceRequest.accepts_remote_refs)
+}
+inline bool ExecuteSequenceRequest::_internal_accepts_remote_refs() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_remote_refs_;
+}
+inline void ExecuteSequenceRequest::_internal_set_accepts_remote_refs(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_remote_refs_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ExecuteSequenceResponse
+
+// repeated .forthic.StackValue result_stack = 1;
+inline int ExecuteSequenceResponse::_internal_result_stack_size() const {
+  return _internal_result_stack().size();
+}
+inline int ExecuteSequenceResponse::result_stack_size() const {
+  return _internal_result_stack_size();
+}
+inline void ExecuteSequenceResponse::clear_result_stack() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.result_stack_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_result_stack(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceResponse.result_stack)
+  return _internal_mutable_result_stack()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_result_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceResponse.result_stack)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_result_stack();
+}
+inline const ::forthic::StackValue& ExecuteSequenceResponse::result_stack(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceResponse.result_stack)
+  return _internal_result_stack().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceResponse::add_result_stack()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_result_stack()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceResponse.result_stack)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteSequenceResponse::result_stack() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceResponse.result_stack)
+  return _internal_result_stack();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+ExecuteSequenceResponse::_internal_result_stack() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.result_stack_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+ExecuteSequenceResponse::_internal_mutable_result_stack() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.result_stack_;
+}
+
+// optional .forthic.ErrorInfo error = 2;
+inline bool ExecuteSequenceResponse::has_error() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
+  PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
+  return value;
+}
+inline void ExecuteSequenceResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.error_ != nullptr) _impl_.error_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline const ::forthic::ErrorInfo& ExecuteSequenceResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::ErrorInfo* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
+}
+inline const ::forthic::ErrorInfo& ExecuteSequenceResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceResponse.error)
+  return _internal_error();
+}
+inline void ExecuteSequenceResponse::unsafe_arena_set_allocated_error(
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteSequenceResponse.error)
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteSequenceResponse::release_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* released = _impl_.error_;
+  _impl_.error_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteSequenceResponse::unsafe_arena_release_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ExecuteSequenceResponse.error)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteSequenceResponse::_internal_mutable_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.error_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena());
+    _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(p);
+  }
+  return _impl_.error_;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_error()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceResponse.error)
+  return _msg;
+}
+inline void ExecuteSequenceResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteSequenceResponse.error)
+}
+
+// bool supports_compact_temporal = 3;
+inline void ExecuteSequenceResponse::clear_supports_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline bool ExecuteSequenceResponse::supports_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceResponse.supports_compact_temporal)
+  return _internal_supports_compact_temporal();
+}
+inline void ExecuteSequenceResponse::set_supports_compact_temporal(bool value) {
+  _internal_set_supports_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.ExecuteSequenceResponse.supports_compact_temporal)
+}
+inline bool ExecuteSequenceResponse::_internal_supports_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.supports_compact_temporal_;
+}
+inline void ExecuteSequenceResponse::_internal_set_supports_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ResultChunk
+
+// .forthic.ResultHeader header = 1;
+inline bool ResultChunk::has_header() const {
+  return chunk_case() == kHeader;
+}
+inline bool ResultChunk::_internal_has_header() const {
+  return chunk_case() == kHeader;
+}
+inline void ResultChunk::set_has_header() {
+  _impl_._oneof_case_[0] = kHeader;
+}
+inline void ResultChunk::clear_header() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (chunk_case() == kHeader) {
+    if (GetArena() == nullptr) {
+      delete _impl_.chunk_.header_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.header_);
+    }
+    clear_has_chunk();
+  }
+}
+inline ::forthic::ResultHeader* PROTOBUF_NULLABLE ResultChunk::release_header() {
+  // @@protoc_insertion_point(field_release:forthic.ResultChunk.header)
+  if (chunk_case() == kHeader) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ResultHeader*>(_impl_.chunk_.header_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.chunk_.header_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::forthic::ResultHeader& ResultChunk::_internal_header() const {
+  return chunk_case() == kHeader ? static_cast<const ::forthic::ResultHeader&>(*reinterpret_cast<::forthic::ResultHeader*>(_impl_.chunk_.header_))
+                     : reinterpret_cast<const ::forthic::ResultHeader&>(::forthic::_ResultHeader_default_instance_);
+}
+inline const ::forthic::ResultHeader& ResultChunk::header() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ResultChunk.header)
+  return _internal_header();
+}
+inline ::forthic::ResultHeader* PROTOBUF_NULLABLE ResultChunk::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.ResultChunk.header)
+  if (chunk_case() == kHeader) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ResultHeader*>(_impl_.chunk_.header_);
+    _impl_.chunk_.header_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ResultChunk::unsafe_arena_set_allocated_header(
+    ::forthic::ResultHeader* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_chunk();
+  if (value) {
+    set_has_header();
+    _impl_.chunk_.header_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ResultChunk.header)
+}
+inline ::forthic::ResultHeader* PROTOBUF_NONNULL ResultChunk::_internal_mutable_header() {
+  if (chunk_case() != kHeader) {
+    clear_chunk();
+    set_has_header();
+    _impl_.chunk_.header_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ResultHeader>(GetArena()));
+  }
+  return reinterpret_cast<::forthic::ResultHeader*>(_impl_.chunk_.header_);
+}
+inline ::forthic::ResultHeader* PROTOBUF_NONNULL ResultChunk::mutable_header()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::ResultHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:forthic.ResultChunk.header)
+  return _msg;
+}
+
+// .forthic.ResultValueChunk value = 2;
+inline bool ResultChunk::has_value() const {
+  return chunk_case() == kValue;
+}
+inline bool ResultChunk::_internal_has_value() const {
+  return chunk_case() == kValue;
+}
+inline void ResultChunk::set_has_value() {
+  _impl_._oneof_case_[0] = kValue;
+}
+inline void ResultChunk::clear_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (chunk_case() == kValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.chunk_.value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.value_);
+    }
+    clear_has_chunk();
+  }
+}
+inline ::forthic::ResultValueChunk* PROTOBUF_NULLABLE ResultChunk::release_value() {
+  // @@protoc_insertion_point(field_release:forthic.ResultChunk.value)
+  if (chunk_case() == kValue) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ResultValueChunk*>(_impl_.chunk_.value_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.chunk_.value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::forthic::ResultValueChunk& ResultChunk::_internal_value() const {
+  return chunk_case() == kValue ? static_cast<const ::forthic::ResultValueChunk&>(*reinterpret_cast<::forthic::ResultValueChunk*>(_impl_.chunk_.value_))
+                     : reinterpret_cast<const ::forthic::ResultValueChunk&>(::forthic::_ResultValueChunk_default_instance_);
+}
+inline const ::forthic::ResultValueChunk& ResultChunk::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ResultChunk.value)
+  return _internal_value();
+}
+inline ::forthic::ResultValueChunk* PROTOBUF_NULLABLE ResultChunk::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.ResultChunk.value)
+  if (chunk_case() == kValue) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ResultValueChunk*>(_impl_.chunk_.value_);
+    _impl_.chunk_.value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ResultChunk::unsafe_arena_set_allocated_value(
+    ::forthic::ResultValueChunk* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_chunk();
+  if (value) {
+    set_has_value();
+    _impl_.chunk_.value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ResultChunk.value)
+}
+inline ::forthic::ResultValueChunk* PROTOBUF_NONNULL ResultChunk::_internal_mutable_value() {
+  if (chunk_case() != kValue) {
+    clear_chunk();
+    set_has_value();
+    _impl_.chunk_.value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ResultValueChunk>(GetArena()));
+  }
+  return reinterpret_cast<::forthic::ResultValueChunk*>(_impl_.chunk_.value_);
+}
+inline ::forthic::ResultValueChunk* PROTOBUF_NONNULL ResultChunk::mutable_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::ResultValueChunk* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:forthic.ResultChunk.value)
+  return _msg;
+}
+
+// .forthic.ErrorInfo error = 3;
+inline bool ResultChunk::has_error() const {
+  return chunk_case() == kError;
+}
+inline bool ResultChunk::_internal_has_error() const {
+  return chunk_case() == kError;
+}
+inline void ResultChunk::set_has_error() {
+  _impl_._oneof_case_[0] = kError;
+}
+inline void ResultChunk::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (chunk_case() == kError) {
+    if (GetArena() == nullptr) {
+      delete _impl_.chunk_.error_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.chunk_.error_);
+    }
+    clear_has_chunk();
+  }
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ResultChunk::release_error() {
+  // @@protoc_insertion_point(field_release:forthic.ResultChunk.error)
+  if (chunk_case() == kError) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ErrorInfo*>(_impl_.chunk_.error_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.chunk_.error_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::forthic::ErrorInfo& ResultChunk::_internal_error() const {
+  return chunk_case() == kError ? static_cast<const ::forthic::ErrorInfo&>(*reinterpret_cast<::forthic::ErrorInfo*>(_impl_.chunk_.error_))
+                     : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
+}
+inline const ::forthic::ErrorInfo& ResultChunk::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ResultChunk.error)
+  return _internal_error();
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ResultChunk::unsafe_arena_release_error() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.ResultChunk.error)
+  if (chunk_case() == kError) {
+    clear_has_chunk();
+    auto* temp = reinterpret_cast<::forthic::ErrorInfo*>(_impl_.chunk_.error_);
+    _impl_.chunk_.error_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ResultChunk::unsafe_arena_set_allocated_error(
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_chunk();
+  if (value) {
+    set_has_error();
+    _impl_.chunk_.error_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ResultChunk.error)
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ResultChunk::_internal_mutable_error() {
+  if (chunk_case() != kError) {
+    clear_chunk();
+    set_has_error();
+    _impl_.chunk_.error_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena()));
+  }
+  return reinterpret_cast<::forthic::ErrorInfo*>(_impl_.chunk_.error_);
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ResultChunk::mutable_error()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::ErrorInfo* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:forthic.ResultChunk.error)
+  return _msg;
+}
+
+inline bool ResultChunk::has_chunk() const {
+  return chunk_case() != CHUNK_NOT_SET;
+}
+inline void ResultChunk::clear_has_chunk() {
+  _impl_._oneof_case_[0] = CHUNK_NOT_SET;
+}
+inline ResultChunk::ChunkCase ResultChunk::chunk_case() const {
+  return ResultChunk::ChunkCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ResultHeader
+
+// uint32 result_count = 1;
+inline void ResultHeader::clear_result_count() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.result_count_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::uint32_t ResultHeader::result_count() const {
+  // @@protoc_insertion_point(field_get:forthic.ResultHeader.result_count)
+  return _internal_result_count();
+}
+inline void ResultHeader::set_result_count(::uint32_t value) {
+  _internal_set_result_count(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_set:forthic.ResultHeader.result_count)
+}
+inline ::uint32_t ResultHeader::_internal_result_count() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.result_count_;
+}
+inline void ResultHeader::_internal_set_result_count(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.result_count_ = value;
+}
+
+// bool supports_compact_temporal = 2;
+inline void ResultHeader::clear_supports_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline bool ResultHeader::supports_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.ResultHeader.supports_compact_temporal)
+  return _internal_supports_compact_temporal();
+}
+inline void ResultHeader::set_supports_compact_temporal(bool value) {
+  _internal_set_supports_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.ResultHeader.supports_compact_temporal)
+}
+inline bool ResultHeader::_internal_supports_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.supports_compact_temporal_;
+}
+inline void ResultHeader::_internal_set_supports_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ResultValueChunk
+
+// uint32 stack_index = 1;
+inline void ResultValueChunk::clear_stack_index() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stack_index_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::uint32_t ResultValueChunk::stack_index() const {
+  // @@protoc_insertion_point(field_get:forthic.ResultValueChunk.stack_index)
+  return _internal_stack_index();
+}
+inline void ResultValueChunk::set_stack_index(::uint32_t value) {
+  _internal_set_stack_index(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_set:forthic.ResultValueChunk.stack_index)
+}
+inline ::uint32_t ResultValueChunk::_internal_stack_index() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.stack_index_;
+}
+inline void ResultValueChunk::_internal_set_stack_index(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stack_index_ = value;
+}
+
+// .forthic.StackValue value = 2;
+inline bool ResultValueChunk::has_value() const {
+  return part_case() == kValue;
+}
+inline bool ResultValueChunk::_internal_has_value() const {
+  return part_case() == kValue;
+}
+inline void ResultValueChunk::set_has_value() {
+  _impl_._oneof_case_[0] = kValue;
+}
+inline void ResultValueChunk::clear_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (part_case() == kValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.part_.value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.part_.value_);
+    }
+    clear_has_part();
+  }
+}
+inline ::forthic::StackValue* PROTOBUF_NULLABLE ResultValueChunk::release_value() {
+  // @@protoc_insertion_point(field_release:forthic.ResultValueChunk.value)
+  if (part_case() == kValue) {
+    clear_has_part();
+    auto* temp = _impl_.part_.value_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.part_.value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::forthic::StackValue& ResultValueChunk::_internal_value() const {
+  return part_case() == kValue ? static_cast<const ::forthic::StackValue&>(*_impl_.part_.value_)
+                     : reinterpret_cast<const ::forthic::StackValue&>(::forthic::_StackValue_default_instance_);
+}
+inline const ::forthic::StackValue& ResultValueChunk::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ResultValueChunk.value)
+  return _internal_value();
+}
+inline ::forthic::StackValue* PROTOBUF_NULLABLE ResultValueChunk::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.ResultValueChunk.value)
+  if (part_case() == kValue) {
+    clear_has_part();
+    auto* temp = _impl_.part_.value_;
+    _impl_.part_.value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ResultValueChunk::unsafe_arena_set_allocated_value(
+    ::forthic::StackValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_part();
+  if (value) {
+    set_has_value();
+    _impl_.part_.value_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ResultValueChunk.value)
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ResultValueChunk::_internal_mutable_value() {
+  if (part_case() != kValue) {
+    clear_part();
+    set_has_value();
+    _impl_.part_.value_ = 
+        ::google::protobuf::Message::DefaultConstruct<::forthic::StackValue>(GetArena());
+  }
+  return _impl_.part_.value_;
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ResultValueChunk::mutable_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::StackValue* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:forthic.ResultValueChunk.value)
+  return _msg;
+}
 
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
+// .forthic.ArrayValue array_elements = 3;
+inline bool ResultValueChunk::has_array_elements() const {
+  return part_case() == kArrayElements;
+}
+inline bool ResultValueChunk::_internal_has_array_elements() const {
+  return part_case() == kArrayElements;
+}
+inline void ResultValueChunk::set_has_array_elements() {
+  _impl_._oneof_case_[0] = kArrayElements;
+}
+inline void ResultValueChunk::clear_array_elements() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (part_case() == kArrayElements) {
+    if (GetArena() == nullptr) {
+      delete _impl_.part_.array_elements_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.part_.array_elements_);
+    }
+    clear_has_part();
+  }
+}
+inline ::forthic::ArrayValue* PROTOBUF_NULLABLE ResultValueChunk::release_array_elements() {
+  // @@protoc_insertion_point(field_release:forthic.ResultValueChunk.array_elements)
+  if (part_case() == kArrayElements) {
+    clear_has_part();
+    auto* temp = _impl_.part_.array_elements_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.part_.array_elements_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::forthic::ArrayValue& ResultValueChunk::_internal_array_elements() const {
+  return part_case() == kArrayElements ? static_cast<const ::forthic::ArrayValue&>(*_impl_.part_.array_elements_)
+                     : reinterpret_cast<const ::forthic::ArrayValue&>(::forthic::_ArrayValue_default_instance_);
+}
+inline const ::forthic::ArrayValue& ResultValueChunk::array_elements() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ResultValueChunk.array_elements)
+  return _internal_array_elements();
+}
+inline ::forthic::ArrayValue* PROTOBUF_NULLABLE ResultValueChunk::unsafe_arena_release_array_elements() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.ResultValueChunk.array_elements)
+  if (part_case() == kArrayElements) {
+    clear_has_part();
+    auto* temp = _impl_.part_.array_elements_;
+    _impl_.part_.array_elements_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ResultValueChunk::unsafe_arena_set_allocated_array_elements(
+    ::forthic::ArrayValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_part();
+  if (value) {
+    set_has_array_elements();
+    _impl_.part_.array_elements_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ResultValueChunk.array_elements)
+}
+inline ::forthic::ArrayValue* PROTOBUF_NONNULL ResultValueChunk::_internal_mutable_array_elements() {
+  if (part_case() != kArrayElements) {
+    clear_part();
+    set_has_array_elements();
+    _impl_.part_.array_elements_ = 
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ArrayValue>(GetArena());
+  }
+  return _impl_.part_.array_elements_;
+}
+inline ::forthic::ArrayValue* PROTOBUF_NONNULL ResultValueChunk::mutable_array_elements()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::ArrayValue* _msg = _internal_mutable_array_elements();
+  // @@protoc_insertion_point(field_mutable:forthic.ResultValueChunk.array_elements)
+  return _msg;
+}
+
+// bool last = 4;
+inline void ResultValueChunk::clear_last() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.last_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline bool ResultValueChunk::last() const {
+  // @@protoc_insertion_point(field_get:forthic.ResultValueChunk.last)
+  return _internal_last();
+}
+inline void ResultValueChunk::set_last(bool value) {
+  _internal_set_last(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.ResultValueChunk.last)
+}
+inline bool ResultValueChunk::_internal_last() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.last_;
+}
+inline void ResultValueChunk::_internal_set_last(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.last_ = value;
+}
+
+inline bool ResultValueChunk::has_part() const {
+  return part_case() != PART_NOT_SET;
+}
+inline void ResultValueChunk::clear_has_part() {
+  _impl_._oneof_case_[0] = PART_NOT_SET;
+}
+inline ResultValueChunk::PartCase ResultValueChunk::part_case() const {
+  return ResultValueChunk::PartCase(_impl_._oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
-// ExecuteWordRequest
+// SharedMemoryOffer
 
-// string word_name = 1;
-inline void ExecuteWordRequest::clear_word_name() {
+// string region = 1;
+inline void SharedMemoryOffer::clear_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.region_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::std::string& SharedMemoryOffer::region() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.SharedMemoryOffer.region)
+  return _internal_region();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void SharedMemoryOffer::set_region(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.region_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.SharedMemoryOffer.region)
+}
+inline ::std::string* PROTOBUF_NONNULL SharedMemoryOffer::mutable_region()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_region();
+  // @@protoc_insertion_point(field_mutable:forthic.SharedMemoryOffer.region)
+  return _s;
+}
+inline const ::std::string& SharedMemoryOffer::_internal_region() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.region_.Get();
+}
+inline void SharedMemoryOffer::_internal_set_region(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.region_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL SharedMemoryOffer::_internal_mutable_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.region_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE SharedMemoryOffer::release_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.SharedMemoryOffer.region)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.region_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.region_.Set("", GetArena());
+  }
+  return released;
+}
+inline void SharedMemoryOffer::set_allocated_region(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.region_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.SharedMemoryOffer.region)
+}
+
+// uint64 min_bytes = 2;
+inline void SharedMemoryOffer::clear_min_bytes() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.min_bytes_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::uint64_t SharedMemoryOffer::min_bytes() const {
+  // @@protoc_insertion_point(field_get:forthic.SharedMemoryOffer.min_bytes)
+  return _internal_min_bytes();
+}
+inline void SharedMemoryOffer::set_min_bytes(::uint64_t value) {
+  _internal_set_min_bytes(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.SharedMemoryOffer.min_bytes)
+}
+inline ::uint64_t SharedMemoryOffer::_internal_min_bytes() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.min_bytes_;
+}
+inline void SharedMemoryOffer::_internal_set_min_bytes(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.min_bytes_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// SharedPayload
+
+// string region = 1;
+inline void SharedPayload::clear_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.region_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::std::string& SharedPayload::region() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.SharedPayload.region)
+  return _internal_region();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void SharedPayload::set_region(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.region_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.SharedPayload.region)
+}
+inline ::std::string* PROTOBUF_NONNULL SharedPayload::mutable_region()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_region();
+  // @@protoc_insertion_point(field_mutable:forthic.SharedPayload.region)
+  return _s;
+}
+inline const ::std::string& SharedPayload::_internal_region() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.region_.Get();
+}
+inline void SharedPayload::_internal_set_region(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.region_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL SharedPayload::_internal_mutable_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.region_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE SharedPayload::release_region() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.SharedPayload.region)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.region_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.region_.Set("", GetArena());
+  }
+  return released;
+}
+inline void SharedPayload::set_allocated_region(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.region_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.SharedPayload.region)
+}
+
+// uint64 offset = 2;
+inline void SharedPayload::clear_offset() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.offset_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::uint64_t SharedPayload::offset() const {
+  // @@protoc_insertion_point(field_get:forthic.SharedPayload.offset)
+  return _internal_offset();
+}
+inline void SharedPayload::set_offset(::uint64_t value) {
+  _internal_set_offset(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.SharedPayload.offset)
+}
+inline ::uint64_t SharedPayload::_internal_offset() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.offset_;
+}
+inline void SharedPayload::_internal_set_offset(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.offset_ = value;
+}
+
+// uint64 length = 3;
+inline void SharedPayload::clear_length() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.length_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline ::uint64_t SharedPayload::length() const {
+  // @@protoc_insertion_point(field_get:forthic.SharedPayload.length)
+  return _internal_length();
+}
+inline void SharedPayload::set_length(::uint64_t value) {
+  _internal_set_length(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.SharedPayload.length)
+}
+inline ::uint64_t SharedPayload::_internal_length() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.length_;
+}
+inline void SharedPayload::_internal_set_length(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.length_ = value;
+}
+
+// uint64 generation = 4;
+inline void SharedPayload::clear_generation() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline ::uint64_t SharedPayload::generation() const {
+  // @@protoc_insertion_point(field_get:forthic.SharedPayload.generation)
+  return _internal_generation();
+}
+inline void SharedPayload::set_generation(::uint64_t value) {
+  _internal_set_generation(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.SharedPayload.generation)
+}
+inline ::uint64_t SharedPayload::_internal_generation() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.generation_;
+}
+inline void SharedPayload::_internal_set_generation(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// StackPayload
+
+// repeated .forthic.StackValue values = 1;
+inline int StackPayload::_internal_values_size() const {
+  return _internal_values().size();
+}
+inline int StackPayload::values_size() const {
+  return _internal_values_size();
+}
+inline void StackPayload::clear_values() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.values_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL StackPayload::mutable_values(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.StackPayload.values)
+  return _internal_mutable_values()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL StackPayload::mutable_values()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.StackPayload.values)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_values();
+}
+inline const ::forthic::StackValue& StackPayload::values(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackPayload.values)
+  return _internal_values().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL StackPayload::add_values()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_values()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.StackPayload.values)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& StackPayload::values() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.StackPayload.values)
+  return _internal_values();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+StackPayload::_internal_values() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.values_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+StackPayload::_internal_mutable_values() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// StreamRequest
+
+// uint64 correlation_id = 1;
+inline void StreamRequest::clear_correlation_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.correlation_id_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline ::uint64_t StreamRequest::correlation_id() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamRequest.correlation_id)
+  return _internal_correlation_id();
+}
+inline void StreamRequest::set_correlation_id(::uint64_t value) {
+  _internal_set_correlation_id(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.StreamRequest.correlation_id)
+}
+inline ::uint64_t StreamRequest::_internal_correlation_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.correlation_id_;
+}
+inline void StreamRequest::_internal_set_correlation_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.correlation_id_ = value;
+}
+
+// string word_name = 2;
+inline void StreamRequest::clear_word_name() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.word_name_.ClearToEmpty();
   ClearHasBit(_impl_._has_bits_[0],
                   0x00000002U);
 }
-inline const ::std::string& ExecuteWordRequest::word_name() const
+inline const ::std::string& StreamRequest::word_name() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.word_name)
+  // @@protoc_insertion_point(field_get:forthic.StreamRequest.word_name)
   return _internal_word_name();
 }
 template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ExecuteWordRequest::set_word_name(Arg_&& arg, Args_... args) {
+PROTOBUF_ALWAYS_INLINE void StreamRequest::set_word_name(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   SetHasBit(_impl_._has_bits_[0], 0x00000002U);
   _impl_.word_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.ExecuteWordRequest.word_name)
+  // @@protoc_insertion_point(field_set:forthic.StreamRequest.word_name)
 }
-inline ::std::string* PROTOBUF_NONNULL ExecuteWordRequest::mutable_word_name()
+inline ::std::string* PROTOBUF_NONNULL StreamRequest::mutable_word_name()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBit(_impl_._has_bits_[0], 0x00000002U);
   ::std::string* _s = _internal_mutable_word_name();
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.word_name)
+  // @@protoc_insertion_point(field_mutable:forthic.StreamRequest.word_name)
   return _s;
 }
-inline const ::std::string& ExecuteWordRequest::_internal_word_name() const {
+inline const ::std::string& StreamRequest::_internal_word_name() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return _impl_.word_name_.Get();
 }
-inline void ExecuteWordRequest::_internal_set_word_name(const ::std::string& value) {
+inline void StreamRequest::_internal_set_word_name(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.word_name_.Set(value, GetArena());
 }
-inline ::std::string* PROTOBUF_NONNULL ExecuteWordRequest::_internal_mutable_word_name() {
+inline ::std::string* PROTOBUF_NONNULL StreamRequest::_internal_mutable_word_name() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   return _impl_.word_name_.Mutable( GetArena());
 }
-inline ::std::string* PROTOBUF_NULLABLE ExecuteWordRequest::release_word_name() {
+inline ::std::string* PROTOBUF_NULLABLE StreamRequest::release_word_name() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.ExecuteWordRequest.word_name)
+  // @@protoc_insertion_point(field_release:forthic.StreamRequest.word_name)
   if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
     return nullptr;
   }
@@ -4212,7 +9296,7 @@ inline ::std::string* PROTOBUF_NULLABLE ExecuteWordRequest::release_word_name()
   }
   return released;
 }
-inline void ExecuteWordRequest::set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value) {
+inline void StreamRequest::set_allocated_word_name(::std::string* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (value != nullptr) {
     SetHasBit(_impl_._has_bits_[0], 0x00000002U);
@@ -4223,147 +9307,226 @@ inline void ExecuteWordRequest::set_allocated_word_name(::std::string* PROTOBUF_
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.word_name_.IsDefault()) {
     _impl_.word_name_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordRequest.word_name)
+  // @@protoc_insertion_point(field_set_allocated:forthic.StreamRequest.word_name)
 }
 
-// repeated .forthic.StackValue stack = 2;
-inline int ExecuteWordRequest::_internal_stack_size() const {
-  return _internal_stack().size();
+// repeated .forthic.StackValue push = 3;
+inline int StreamRequest::_internal_push_size() const {
+  return _internal_push().size();
 }
-inline int ExecuteWordRequest::stack_size() const {
-  return _internal_stack_size();
+inline int StreamRequest::push_size() const {
+  return _internal_push_size();
 }
-inline void ExecuteWordRequest::clear_stack() {
+inline void StreamRequest::clear_push() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stack_.Clear();
+  _impl_.push_.Clear();
   ClearHasBitForRepeated(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordRequest::mutable_stack(int index)
+inline ::forthic::StackValue* PROTOBUF_NONNULL StreamRequest::mutable_push(int index)
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordRequest.stack)
-  return _internal_mutable_stack()->Mutable(index);
+  // @@protoc_insertion_point(field_mutable:forthic.StreamRequest.push)
+  return _internal_mutable_push()->Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteWordRequest::mutable_stack()
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL StreamRequest::mutable_push()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteWordRequest.stack)
+  // @@protoc_insertion_point(field_mutable_list:forthic.StreamRequest.push)
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_stack();
+  return _internal_mutable_push();
 }
-inline const ::forthic::StackValue& ExecuteWordRequest::stack(int index) const
+inline const ::forthic::StackValue& StreamRequest::push(int index) const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteWordRequest.stack)
-  return _internal_stack().Get(index);
+  // @@protoc_insertion_point(field_get:forthic.StreamRequest.push)
+  return _internal_push().Get(index);
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordRequest::add_stack()
+inline ::forthic::StackValue* PROTOBUF_NONNULL StreamRequest::add_push()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::forthic::StackValue* _add =
-      _internal_mutable_stack()->InternalAddWithArena(
+      _internal_mutable_push()->InternalAddWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), GetArena());
   SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add:forthic.ExecuteWordRequest.stack)
+  // @@protoc_insertion_point(field_add:forthic.StreamRequest.push)
   return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteWordRequest::stack() const
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& StreamRequest::push() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ExecuteWordRequest.stack)
-  return _internal_stack();
+  // @@protoc_insertion_point(field_list:forthic.StreamRequest.push)
+  return _internal_push();
 }
 inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
-ExecuteWordRequest::_internal_stack() const {
+StreamRequest::_internal_push() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stack_;
+  return _impl_.push_;
 }
 inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
-ExecuteWordRequest::_internal_mutable_stack() {
+StreamRequest::_internal_mutable_push() {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.stack_;
+  return &_impl_.push_;
+}
+
+// optional uint32 return_count = 4;
+inline bool StreamRequest::has_return_count() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000008U);
+  return value;
+}
+inline void StreamRequest::clear_return_count() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.return_count_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline ::uint32_t StreamRequest::return_count() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamRequest.return_count)
+  return _internal_return_count();
+}
+inline void StreamRequest::set_return_count(::uint32_t value) {
+  _internal_set_return_count(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.StreamRequest.return_count)
+}
+inline ::uint32_t StreamRequest::_internal_return_count() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.return_count_;
+}
+inline void StreamRequest::_internal_set_return_count(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.return_count_ = value;
+}
+
+// bool accepts_compact_temporal = 5;
+inline void StreamRequest::clear_accepts_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000010U);
+}
+inline bool StreamRequest::accepts_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamRequest.accepts_compact_temporal)
+  return _internal_accepts_compact_temporal();
+}
+inline void StreamRequest::set_accepts_compact_temporal(bool value) {
+  _internal_set_accepts_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000010U);
+  // @@protoc_insertion_point(field_set:forthic.StreamRequest.accepts_compact_temporal)
+}
+inline bool StreamRequest::_internal_accepts_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_compact_temporal_;
+}
+inline void StreamRequest::_internal_set_accepts_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// ExecuteWordResponse
+// StreamResponse
 
-// repeated .forthic.StackValue result_stack = 1;
-inline int ExecuteWordResponse::_internal_result_stack_size() const {
+// uint64 correlation_id = 1;
+inline void StreamResponse::clear_correlation_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.correlation_id_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
+}
+inline ::uint64_t StreamResponse::correlation_id() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamResponse.correlation_id)
+  return _internal_correlation_id();
+}
+inline void StreamResponse::set_correlation_id(::uint64_t value) {
+  _internal_set_correlation_id(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.StreamResponse.correlation_id)
+}
+inline ::uint64_t StreamResponse::_internal_correlation_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.correlation_id_;
+}
+inline void StreamResponse::_internal_set_correlation_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.correlation_id_ = value;
+}
+
+// repeated .forthic.StackValue result_stack = 2;
+inline int StreamResponse::_internal_result_stack_size() const {
   return _internal_result_stack().size();
 }
-inline int ExecuteWordResponse::result_stack_size() const {
+inline int StreamResponse::result_stack_size() const {
   return _internal_result_stack_size();
 }
-inline void ExecuteWordResponse::clear_result_stack() {
+inline void StreamResponse::clear_result_stack() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.result_stack_.Clear();
   ClearHasBitForRepeated(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordResponse::mutable_result_stack(int index)
+inline ::forthic::StackValue* PROTOBUF_NONNULL StreamResponse::mutable_result_stack(int index)
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordResponse.result_stack)
+  // @@protoc_insertion_point(field_mutable:forthic.StreamResponse.result_stack)
   return _internal_mutable_result_stack()->Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteWordResponse::mutable_result_stack()
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL StreamResponse::mutable_result_stack()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteWordResponse.result_stack)
+  // @@protoc_insertion_point(field_mutable_list:forthic.StreamResponse.result_stack)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   return _internal_mutable_result_stack();
 }
-inline const ::forthic::StackValue& ExecuteWordResponse::result_stack(int index) const
+inline const ::forthic::StackValue& StreamResponse::result_stack(int index) const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.result_stack)
+  // @@protoc_insertion_point(field_get:forthic.StreamResponse.result_stack)
   return _internal_result_stack().Get(index);
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteWordResponse::add_result_stack()
+inline ::forthic::StackValue* PROTOBUF_NONNULL StreamResponse::add_result_stack()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::forthic::StackValue* _add =
       _internal_mutable_result_stack()->InternalAddWithArena(
           ::google::protobuf::MessageLite::internal_visibility(), GetArena());
   SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add:forthic.ExecuteWordResponse.result_stack)
+  // @@protoc_insertion_point(field_add:forthic.StreamResponse.result_stack)
   return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteWordResponse::result_stack() const
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& StreamResponse::result_stack() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ExecuteWordResponse.result_stack)
+  // @@protoc_insertion_point(field_list:forthic.StreamResponse.result_stack)
   return _internal_result_stack();
 }
 inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
-ExecuteWordResponse::_internal_result_stack() const {
+StreamResponse::_internal_result_stack() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return _impl_.result_stack_;
 }
 inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
-ExecuteWordResponse::_internal_mutable_result_stack() {
+StreamResponse::_internal_mutable_result_stack() {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return &_impl_.result_stack_;
 }
 
-// optional .forthic.ErrorInfo error = 2;
-inline bool ExecuteWordResponse::has_error() const {
+// optional .forthic.ErrorInfo error = 3;
+inline bool StreamResponse::has_error() const {
   bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
   PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
   return value;
 }
-inline void ExecuteWordResponse::clear_error() {
+inline void StreamResponse::clear_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (_impl_.error_ != nullptr) _impl_.error_->Clear();
   ClearHasBit(_impl_._has_bits_[0],
                   0x00000002U);
 }
-inline const ::forthic::ErrorInfo& ExecuteWordResponse::_internal_error() const {
+inline const ::forthic::ErrorInfo& StreamResponse::_internal_error() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   const ::forthic::ErrorInfo* p = _impl_.error_;
   return p != nullptr ? *p : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
 }
-inline const ::forthic::ErrorInfo& ExecuteWordResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteWordResponse.error)
+inline const ::forthic::ErrorInfo& StreamResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StreamResponse.error)
   return _internal_error();
 }
-inline void ExecuteWordResponse::unsafe_arena_set_allocated_error(
+inline void StreamResponse::unsafe_arena_set_allocated_error(
     ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (GetArena() == nullptr) {
@@ -4375,9 +9538,9 @@ inline void ExecuteWordResponse::unsafe_arena_set_allocated_error(
   } else {
     ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteWordResponse.error)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StreamResponse.error)
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteWordResponse::release_error() {
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE StreamResponse::release_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
 
   ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
@@ -4396,16 +9559,16 @@ inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteWordResponse::release_erro
   }
   return released;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteWordResponse::unsafe_arena_release_error() {
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE StreamResponse::unsafe_arena_release_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.ExecuteWordResponse.error)
+  // @@protoc_insertion_point(field_release:forthic.StreamResponse.error)
 
   ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
   ::forthic::ErrorInfo* temp = _impl_.error_;
   _impl_.error_ = nullptr;
   return temp;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteWordResponse::_internal_mutable_error() {
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL StreamResponse::_internal_mutable_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (_impl_.error_ == nullptr) {
     auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena());
@@ -4413,14 +9576,14 @@ inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteWordResponse::_internal_mut
   }
   return _impl_.error_;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteWordResponse::mutable_error()
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL StreamResponse::mutable_error()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBit(_impl_._has_bits_[0], 0x00000002U);
   ::forthic::ErrorInfo* _msg = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteWordResponse.error)
+  // @@protoc_insertion_point(field_mutable:forthic.StreamResponse.error)
   return _msg;
 }
-inline void ExecuteWordResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+inline void StreamResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
   ::google::protobuf::Arena* message_arena = GetArena();
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (message_arena == nullptr) {
@@ -4438,1355 +9601,1818 @@ inline void ExecuteWordResponse::set_allocated_error(::forthic::ErrorInfo* PROTO
   }
 
   _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
-  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteWordResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:forthic.StreamResponse.error)
+}
+
+// uint32 session_depth = 4;
+inline void StreamResponse::clear_session_depth() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.session_depth_ = 0u;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline ::uint32_t StreamResponse::session_depth() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamResponse.session_depth)
+  return _internal_session_depth();
+}
+inline void StreamResponse::set_session_depth(::uint32_t value) {
+  _internal_set_session_depth(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.StreamResponse.session_depth)
+}
+inline ::uint32_t StreamResponse::_internal_session_depth() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.session_depth_;
+}
+inline void StreamResponse::_internal_set_session_depth(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.session_depth_ = value;
+}
+
+// bool supports_compact_temporal = 5;
+inline void StreamResponse::clear_supports_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000010U);
+}
+inline bool StreamResponse::supports_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.StreamResponse.supports_compact_temporal)
+  return _internal_supports_compact_temporal();
+}
+inline void StreamResponse::set_supports_compact_temporal(bool value) {
+  _internal_set_supports_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000010U);
+  // @@protoc_insertion_point(field_set:forthic.StreamResponse.supports_compact_temporal)
+}
+inline bool StreamResponse::_internal_supports_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.supports_compact_temporal_;
+}
+inline void StreamResponse::_internal_set_supports_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.supports_compact_temporal_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// ExecuteSequenceRequest
+// StackValue
 
-// repeated string word_names = 1;
-inline int ExecuteSequenceRequest::_internal_word_names_size() const {
-  return _internal_word_names().size();
+// int64 int_value = 1;
+inline bool StackValue::has_int_value() const {
+  return value_case() == kIntValue;
 }
-inline int ExecuteSequenceRequest::word_names_size() const {
-  return _internal_word_names_size();
+inline void StackValue::set_has_int_value() {
+  _impl_._oneof_case_[0] = kIntValue;
 }
-inline void ExecuteSequenceRequest::clear_word_names() {
+inline void StackValue::clear_int_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.word_names_.Clear();
-  ClearHasBitForRepeated(_impl_._has_bits_[0],
-                  0x00000001U);
+  if (value_case() == kIntValue) {
+    _impl_.value_.int_value_ = ::int64_t{0};
+    clear_has_value();
+  }
 }
-inline ::std::string* PROTOBUF_NONNULL ExecuteSequenceRequest::add_word_names()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::std::string* _s =
-      _internal_mutable_word_names()->InternalAddWithArena(
-          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add_mutable:forthic.ExecuteSequenceRequest.word_names)
-  return _s;
+inline ::int64_t StackValue::int_value() const {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.int_value)
+  return _internal_int_value();
 }
-inline const ::std::string& ExecuteSequenceRequest::word_names(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.word_names)
-  return _internal_word_names().Get(index);
+inline void StackValue::set_int_value(::int64_t value) {
+  if (value_case() != kIntValue) {
+    clear_value();
+    set_has_int_value();
+  }
+  _impl_.value_.int_value_ = value;
+  // @@protoc_insertion_point(field_set:forthic.StackValue.int_value)
 }
-inline ::std::string* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_word_names(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceRequest.word_names)
-  return _internal_mutable_word_names()->Mutable(index);
+inline ::int64_t StackValue::_internal_int_value() const {
+  if (value_case() == kIntValue) {
+    return _impl_.value_.int_value_;
+  }
+  return ::int64_t{0};
 }
-template <typename Arg_, typename... Args_>
-inline void ExecuteSequenceRequest::set_word_names(int index, Arg_&& value, Args_... args) {
-  ::google::protobuf::internal::AssignToString(*_internal_mutable_word_names()->Mutable(index), ::std::forward<Arg_>(value),
-                        args... );
-  // @@protoc_insertion_point(field_set:forthic.ExecuteSequenceRequest.word_names)
+
+// string string_value = 2;
+inline bool StackValue::has_string_value() const {
+  return value_case() == kStringValue;
+}
+inline void StackValue::set_has_string_value() {
+  _impl_._oneof_case_[0] = kStringValue;
+}
+inline void StackValue::clear_string_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value_case() == kStringValue) {
+    _impl_.value_.string_value_.Destroy();
+    clear_has_value();
+  }
+}
+inline const ::std::string& StackValue::string_value() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.string_value)
+  return _internal_string_value();
 }
 template <typename Arg_, typename... Args_>
-inline void ExecuteSequenceRequest::add_word_names(Arg_&& value, Args_... args) {
+PROTOBUF_ALWAYS_INLINE void StackValue::set_string_value(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::google::protobuf::internal::AddToRepeatedPtrField(
-      ::google::protobuf::MessageLite::internal_visibility(), GetArena(),
-      *_internal_mutable_word_names(), ::std::forward<Arg_>(value),
-      args... );
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceRequest.word_names)
+  if (value_case() != kStringValue) {
+    clear_value();
+
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.StackValue.string_value)
 }
-inline const ::google::protobuf::RepeatedPtrField<::std::string>& ExecuteSequenceRequest::word_names()
-    const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceRequest.word_names)
-  return _internal_word_names();
+inline ::std::string* PROTOBUF_NONNULL StackValue::mutable_string_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  if (value_case() != kStringValue) {
+    clear_value();
+
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  ::std::string* _s = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.string_value)
+  return _s;
 }
-inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
-ExecuteSequenceRequest::mutable_word_names() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceRequest.word_names)
+inline const ::std::string& StackValue::_internal_string_value() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  if (value_case() != kStringValue) {
+    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.value_.string_value_.Get();
+}
+inline void StackValue::_internal_set_string_value(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.value_.string_value_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL StackValue::_internal_mutable_string_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_word_names();
+  return _impl_.value_.string_value_.Mutable( GetArena());
 }
-inline const ::google::protobuf::RepeatedPtrField<::std::string>&
-ExecuteSequenceRequest::_internal_word_names() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.word_names_;
+inline ::std::string* PROTOBUF_NULLABLE StackValue::release_string_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.StackValue.string_value)
+  if (value_case() != kStringValue) {
+    return nullptr;
+  }
+  clear_has_value();
+  return _impl_.value_.string_value_.Release();
 }
-inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
-ExecuteSequenceRequest::_internal_mutable_word_names() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.word_names_;
+inline void StackValue::set_allocated_string_value(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (has_value()) {
+    clear_value();
+  }
+  if (value != nullptr) {
+    set_has_string_value();
+    _impl_.value_.string_value_.InitAllocated(value, GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.string_value)
 }
 
-// repeated .forthic.StackValue stack = 2;
-inline int ExecuteSequenceRequest::_internal_stack_size() const {
-  return _internal_stack().size();
+// bool bool_value = 3;
+inline bool StackValue::has_bool_value() const {
+  return value_case() == kBoolValue;
 }
-inline int ExecuteSequenceRequest::stack_size() const {
-  return _internal_stack_size();
+inline void StackValue::set_has_bool_value() {
+  _impl_._oneof_case_[0] = kBoolValue;
 }
-inline void ExecuteSequenceRequest::clear_stack() {
+inline void StackValue::clear_bool_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.stack_.Clear();
-  ClearHasBitForRepeated(_impl_._has_bits_[0],
-                  0x00000002U);
+  if (value_case() == kBoolValue) {
+    _impl_.value_.bool_value_ = false;
+    clear_has_value();
+  }
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_stack(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceRequest.stack)
-  return _internal_mutable_stack()->Mutable(index);
+inline bool StackValue::bool_value() const {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.bool_value)
+  return _internal_bool_value();
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteSequenceRequest::mutable_stack()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000002U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceRequest.stack)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_stack();
+inline void StackValue::set_bool_value(bool value) {
+  if (value_case() != kBoolValue) {
+    clear_value();
+    set_has_bool_value();
+  }
+  _impl_.value_.bool_value_ = value;
+  // @@protoc_insertion_point(field_set:forthic.StackValue.bool_value)
 }
-inline const ::forthic::StackValue& ExecuteSequenceRequest::stack(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceRequest.stack)
-  return _internal_stack().Get(index);
+inline bool StackValue::_internal_bool_value() const {
+  if (value_case() == kBoolValue) {
+    return _impl_.value_.bool_value_;
+  }
+  return false;
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceRequest::add_stack()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+
+// double float_value = 4;
+inline bool StackValue::has_float_value() const {
+  return value_case() == kFloatValue;
+}
+inline void StackValue::set_has_float_value() {
+  _impl_._oneof_case_[0] = kFloatValue;
+}
+inline void StackValue::clear_float_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::forthic::StackValue* _add =
-      _internal_mutable_stack()->InternalAddWithArena(
-          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000002U);
-  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceRequest.stack)
-  return _add;
+  if (value_case() == kFloatValue) {
+    _impl_.value_.float_value_ = 0;
+    clear_has_value();
+  }
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteSequenceRequest::stack() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceRequest.stack)
-  return _internal_stack();
+inline double StackValue::float_value() const {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.float_value)
+  return _internal_float_value();
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
-ExecuteSequenceRequest::_internal_stack() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.stack_;
+inline void StackValue::set_float_value(double value) {
+  if (value_case() != kFloatValue) {
+    clear_value();
+    set_has_float_value();
+  }
+  _impl_.value_.float_value_ = value;
+  // @@protoc_insertion_point(field_set:forthic.StackValue.float_value)
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
-ExecuteSequenceRequest::_internal_mutable_stack() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.stack_;
+inline double StackValue::_internal_float_value() const {
+  if (value_case() == kFloatValue) {
+    return _impl_.value_.float_value_;
+  }
+  return 0;
 }
 
-// -------------------------------------------------------------------
-
-// ExecuteSequenceResponse
-
-// repeated .forthic.StackValue result_stack = 1;
-inline int ExecuteSequenceResponse::_internal_result_stack_size() const {
-  return _internal_result_stack().size();
-}
-inline int ExecuteSequenceResponse::result_stack_size() const {
-  return _internal_result_stack_size();
+// .forthic.NullValue null_value = 5;
+inline bool StackValue::has_null_value() const {
+  return value_case() == kNullValue;
 }
-inline void ExecuteSequenceResponse::clear_result_stack() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.result_stack_.Clear();
-  ClearHasBitForRepeated(_impl_._has_bits_[0],
-                  0x00000001U);
+inline bool StackValue::_internal_has_null_value() const {
+  return value_case() == kNullValue;
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_result_stack(int index)
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceResponse.result_stack)
-  return _internal_mutable_result_stack()->Mutable(index);
+inline void StackValue::set_has_null_value() {
+  _impl_._oneof_case_[0] = kNullValue;
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_result_stack()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ExecuteSequenceResponse.result_stack)
+inline void StackValue::clear_null_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_result_stack();
+  if (value_case() == kNullValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.value_.null_value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.null_value_);
+    }
+    clear_has_value();
+  }
 }
-inline const ::forthic::StackValue& ExecuteSequenceResponse::result_stack(int index) const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceResponse.result_stack)
-  return _internal_result_stack().Get(index);
+inline ::forthic::NullValue* PROTOBUF_NULLABLE StackValue::release_null_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.null_value)
+  if (value_case() == kNullValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.null_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ExecuteSequenceResponse::add_result_stack()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::forthic::StackValue* _add =
-      _internal_mutable_result_stack()->InternalAddWithArena(
-          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add:forthic.ExecuteSequenceResponse.result_stack)
-  return _add;
+inline const ::forthic::NullValue& StackValue::_internal_null_value() const {
+  return value_case() == kNullValue ? static_cast<const ::forthic::NullValue&>(*reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_))
+                     : reinterpret_cast<const ::forthic::NullValue&>(::forthic::_NullValue_default_instance_);
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ExecuteSequenceResponse::result_stack() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ExecuteSequenceResponse.result_stack)
-  return _internal_result_stack();
+inline const ::forthic::NullValue& StackValue::null_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.null_value)
+  return _internal_null_value();
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
-ExecuteSequenceResponse::_internal_result_stack() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.result_stack_;
+inline ::forthic::NullValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_null_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.null_value)
+  if (value_case() == kNullValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
+    _impl_.value_.null_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
-ExecuteSequenceResponse::_internal_mutable_result_stack() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.result_stack_;
+inline void StackValue::unsafe_arena_set_allocated_null_value(
+    ::forthic::NullValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_value();
+  if (value) {
+    set_has_null_value();
+    _impl_.value_.null_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.null_value)
 }
-
-// optional .forthic.ErrorInfo error = 2;
-inline bool ExecuteSequenceResponse::has_error() const {
-  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
-  PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
-  return value;
+inline ::forthic::NullValue* PROTOBUF_NONNULL StackValue::_internal_mutable_null_value() {
+  if (value_case() != kNullValue) {
+    clear_value();
+    set_has_null_value();
+    _impl_.value_.null_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::NullValue>(GetArena()));
+  }
+  return reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
 }
-inline void ExecuteSequenceResponse::clear_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.error_ != nullptr) _impl_.error_->Clear();
-  ClearHasBit(_impl_._has_bits_[0],
-                  0x00000002U);
+inline ::forthic::NullValue* PROTOBUF_NONNULL StackValue::mutable_null_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::NullValue* _msg = _internal_mutable_null_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.null_value)
+  return _msg;
 }
-inline const ::forthic::ErrorInfo& ExecuteSequenceResponse::_internal_error() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::forthic::ErrorInfo* p = _impl_.error_;
-  return p != nullptr ? *p : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
+
+// .forthic.ArrayValue array_value = 6;
+inline bool StackValue::has_array_value() const {
+  return value_case() == kArrayValue;
 }
-inline const ::forthic::ErrorInfo& ExecuteSequenceResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ExecuteSequenceResponse.error)
-  return _internal_error();
+inline bool StackValue::_internal_has_array_value() const {
+  return value_case() == kArrayValue;
 }
-inline void ExecuteSequenceResponse::unsafe_arena_set_allocated_error(
-    ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
-  }
-  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
-  if (value != nullptr) {
-    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
-  } else {
-    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.ExecuteSequenceResponse.error)
+inline void StackValue::set_has_array_value() {
+  _impl_._oneof_case_[0] = kArrayValue;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteSequenceResponse::release_error() {
+inline void StackValue::clear_array_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-
-  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
-  ::forthic::ErrorInfo* released = _impl_.error_;
-  _impl_.error_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (value_case() == kArrayValue) {
     if (GetArena() == nullptr) {
-      delete old;
+      delete _impl_.value_.array_value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.array_value_);
     }
-  } else {
+    clear_has_value();
+  }
+}
+inline ::forthic::ArrayValue* PROTOBUF_NULLABLE StackValue::release_array_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.array_value)
+  if (value_case() == kArrayValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
     if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
     }
+    _impl_.value_.array_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return released;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE ExecuteSequenceResponse::unsafe_arena_release_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.ExecuteSequenceResponse.error)
-
-  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
-  ::forthic::ErrorInfo* temp = _impl_.error_;
-  _impl_.error_ = nullptr;
-  return temp;
+inline const ::forthic::ArrayValue& StackValue::_internal_array_value() const {
+  return value_case() == kArrayValue ? static_cast<const ::forthic::ArrayValue&>(*reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_))
+                     : reinterpret_cast<const ::forthic::ArrayValue&>(::forthic::_ArrayValue_default_instance_);
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteSequenceResponse::_internal_mutable_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.error_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena());
-    _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(p);
+inline const ::forthic::ArrayValue& StackValue::array_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.array_value)
+  return _internal_array_value();
+}
+inline ::forthic::ArrayValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_array_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.array_value)
+  if (value_case() == kArrayValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
+    _impl_.value_.array_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return _impl_.error_;
 }
-inline ::forthic::ErrorInfo* PROTOBUF_NONNULL ExecuteSequenceResponse::mutable_error()
+inline void StackValue::unsafe_arena_set_allocated_array_value(
+    ::forthic::ArrayValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_value();
+  if (value) {
+    set_has_array_value();
+    _impl_.value_.array_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.array_value)
+}
+inline ::forthic::ArrayValue* PROTOBUF_NONNULL StackValue::_internal_mutable_array_value() {
+  if (value_case() != kArrayValue) {
+    clear_value();
+    set_has_array_value();
+    _impl_.value_.array_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ArrayValue>(GetArena()));
+  }
+  return reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
+}
+inline ::forthic::ArrayValue* PROTOBUF_NONNULL StackValue::mutable_array_value()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
-  ::forthic::ErrorInfo* _msg = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:forthic.ExecuteSequenceResponse.error)
+  ::forthic::ArrayValue* _msg = _internal_mutable_array_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.array_value)
   return _msg;
 }
-inline void ExecuteSequenceResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
+
+// .forthic.RecordValue record_value = 7;
+inline bool StackValue::has_record_value() const {
+  return value_case() == kRecordValue;
+}
+inline bool StackValue::_internal_has_record_value() const {
+  return value_case() == kRecordValue;
+}
+inline void StackValue::set_has_record_value() {
+  _impl_._oneof_case_[0] = kRecordValue;
+}
+inline void StackValue::clear_record_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  if (value_case() == kRecordValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.value_.record_value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.record_value_);
+    }
+    clear_has_value();
   }
-
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = value->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+}
+inline ::forthic::RecordValue* PROTOBUF_NULLABLE StackValue::release_record_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.record_value)
+  if (value_case() == kRecordValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
     }
-    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+    _impl_.value_.record_value_ = nullptr;
+    return temp;
   } else {
-    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+    return nullptr;
   }
-
-  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
-  // @@protoc_insertion_point(field_set_allocated:forthic.ExecuteSequenceResponse.error)
 }
-
-// -------------------------------------------------------------------
-
-// StackValue
-
-// int64 int_value = 1;
-inline bool StackValue::has_int_value() const {
-  return value_case() == kIntValue;
+inline const ::forthic::RecordValue& StackValue::_internal_record_value() const {
+  return value_case() == kRecordValue ? static_cast<const ::forthic::RecordValue&>(*reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_))
+                     : reinterpret_cast<const ::forthic::RecordValue&>(::forthic::_RecordValue_default_instance_);
 }
-inline void StackValue::set_has_int_value() {
-  _impl_._oneof_case_[0] = kIntValue;
+inline const ::forthic::RecordValue& StackValue::record_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.record_value)
+  return _internal_record_value();
 }
-inline void StackValue::clear_int_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kIntValue) {
-    _impl_.value_.int_value_ = ::int64_t{0};
+inline ::forthic::RecordValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_record_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.record_value)
+  if (value_case() == kRecordValue) {
     clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
+    _impl_.value_.record_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
 }
-inline ::int64_t StackValue::int_value() const {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.int_value)
-  return _internal_int_value();
+inline void StackValue::unsafe_arena_set_allocated_record_value(
+    ::forthic::RecordValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_value();
+  if (value) {
+    set_has_record_value();
+    _impl_.value_.record_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.record_value)
 }
-inline void StackValue::set_int_value(::int64_t value) {
-  if (value_case() != kIntValue) {
+inline ::forthic::RecordValue* PROTOBUF_NONNULL StackValue::_internal_mutable_record_value() {
+  if (value_case() != kRecordValue) {
     clear_value();
-    set_has_int_value();
+    set_has_record_value();
+    _impl_.value_.record_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::RecordValue>(GetArena()));
   }
-  _impl_.value_.int_value_ = value;
-  // @@protoc_insertion_point(field_set:forthic.StackValue.int_value)
+  return reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
 }
-inline ::int64_t StackValue::_internal_int_value() const {
-  if (value_case() == kIntValue) {
-    return _impl_.value_.int_value_;
-  }
-  return ::int64_t{0};
+inline ::forthic::RecordValue* PROTOBUF_NONNULL StackValue::mutable_record_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::RecordValue* _msg = _internal_mutable_record_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.record_value)
+  return _msg;
 }
 
-// string string_value = 2;
-inline bool StackValue::has_string_value() const {
-  return value_case() == kStringValue;
-}
-inline void StackValue::set_has_string_value() {
-  _impl_._oneof_case_[0] = kStringValue;
-}
-inline void StackValue::clear_string_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kStringValue) {
-    _impl_.value_.string_value_.Destroy();
-    clear_has_value();
-  }
+// .forthic.InstantValue instant_value = 8;
+inline bool StackValue::has_instant_value() const {
+  return value_case() == kInstantValue;
 }
-inline const ::std::string& StackValue::string_value() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.string_value)
-  return _internal_string_value();
+inline bool StackValue::_internal_has_instant_value() const {
+  return value_case() == kInstantValue;
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void StackValue::set_string_value(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() != kStringValue) {
-    clear_value();
-
-    set_has_string_value();
-    _impl_.value_.string_value_.InitDefault();
-  }
-  _impl_.value_.string_value_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.StackValue.string_value)
+inline void StackValue::set_has_instant_value() {
+  _impl_._oneof_case_[0] = kInstantValue;
 }
-inline ::std::string* PROTOBUF_NONNULL StackValue::mutable_string_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  if (value_case() != kStringValue) {
-    clear_value();
-
-    set_has_string_value();
-    _impl_.value_.string_value_.InitDefault();
+inline void StackValue::clear_instant_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value_case() == kInstantValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.value_.instant_value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.instant_value_);
+    }
+    clear_has_value();
   }
-  ::std::string* _s = _internal_mutable_string_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.string_value)
-  return _s;
 }
-inline const ::std::string& StackValue::_internal_string_value() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  if (value_case() != kStringValue) {
-    return ::google::protobuf::internal::GetEmptyStringAlreadyInited();
+inline ::forthic::InstantValue* PROTOBUF_NULLABLE StackValue::release_instant_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.instant_value)
+  if (value_case() == kInstantValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.instant_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return _impl_.value_.string_value_.Get();
 }
-inline void StackValue::_internal_set_string_value(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.value_.string_value_.Set(value, GetArena());
+inline const ::forthic::InstantValue& StackValue::_internal_instant_value() const {
+  return value_case() == kInstantValue ? static_cast<const ::forthic::InstantValue&>(*reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_))
+                     : reinterpret_cast<const ::forthic::InstantValue&>(::forthic::_InstantValue_default_instance_);
 }
-inline ::std::string* PROTOBUF_NONNULL StackValue::_internal_mutable_string_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.value_.string_value_.Mutable( GetArena());
+inline const ::forthic::InstantValue& StackValue::instant_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.instant_value)
+  return _internal_instant_value();
 }
-inline ::std::string* PROTOBUF_NULLABLE StackValue::release_string_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.StackValue.string_value)
-  if (value_case() != kStringValue) {
+inline ::forthic::InstantValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_instant_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.instant_value)
+  if (value_case() == kInstantValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
+    _impl_.value_.instant_value_ = nullptr;
+    return temp;
+  } else {
     return nullptr;
   }
-  clear_has_value();
-  return _impl_.value_.string_value_.Release();
 }
-inline void StackValue::set_allocated_string_value(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (has_value()) {
-    clear_value();
+inline void StackValue::unsafe_arena_set_allocated_instant_value(
+    ::forthic::InstantValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_value();
+  if (value) {
+    set_has_instant_value();
+    _impl_.value_.instant_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
   }
-  if (value != nullptr) {
-    set_has_string_value();
-    _impl_.value_.string_value_.InitAllocated(value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.instant_value)
+}
+inline ::forthic::InstantValue* PROTOBUF_NONNULL StackValue::_internal_mutable_instant_value() {
+  if (value_case() != kInstantValue) {
+    clear_value();
+    set_has_instant_value();
+    _impl_.value_.instant_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::InstantValue>(GetArena()));
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.StackValue.string_value)
+  return reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
+}
+inline ::forthic::InstantValue* PROTOBUF_NONNULL StackValue::mutable_instant_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::InstantValue* _msg = _internal_mutable_instant_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.instant_value)
+  return _msg;
 }
 
-// bool bool_value = 3;
-inline bool StackValue::has_bool_value() const {
-  return value_case() == kBoolValue;
+// .forthic.PlainDateValue plain_date_value = 9;
+inline bool StackValue::has_plain_date_value() const {
+  return value_case() == kPlainDateValue;
 }
-inline void StackValue::set_has_bool_value() {
-  _impl_._oneof_case_[0] = kBoolValue;
+inline bool StackValue::_internal_has_plain_date_value() const {
+  return value_case() == kPlainDateValue;
 }
-inline void StackValue::clear_bool_value() {
+inline void StackValue::set_has_plain_date_value() {
+  _impl_._oneof_case_[0] = kPlainDateValue;
+}
+inline void StackValue::clear_plain_date_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kBoolValue) {
-    _impl_.value_.bool_value_ = false;
+  if (value_case() == kPlainDateValue) {
+    if (GetArena() == nullptr) {
+      delete _impl_.value_.plain_date_value_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.plain_date_value_);
+    }
     clear_has_value();
   }
 }
-inline bool StackValue::bool_value() const {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.bool_value)
-  return _internal_bool_value();
-}
-inline void StackValue::set_bool_value(bool value) {
-  if (value_case() != kBoolValue) {
-    clear_value();
-    set_has_bool_value();
-  }
-  _impl_.value_.bool_value_ = value;
-  // @@protoc_insertion_point(field_set:forthic.StackValue.bool_value)
-}
-inline bool StackValue::_internal_bool_value() const {
-  if (value_case() == kBoolValue) {
-    return _impl_.value_.bool_value_;
+inline ::forthic::PlainDateValue* PROTOBUF_NULLABLE StackValue::release_plain_date_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.plain_date_value)
+  if (value_case() == kPlainDateValue) {
+    clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.plain_date_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return false;
 }
-
-// double float_value = 4;
-inline bool StackValue::has_float_value() const {
-  return value_case() == kFloatValue;
+inline const ::forthic::PlainDateValue& StackValue::_internal_plain_date_value() const {
+  return value_case() == kPlainDateValue ? static_cast<const ::forthic::PlainDateValue&>(*reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_))
+                     : reinterpret_cast<const ::forthic::PlainDateValue&>(::forthic::_PlainDateValue_default_instance_);
 }
-inline void StackValue::set_has_float_value() {
-  _impl_._oneof_case_[0] = kFloatValue;
+inline const ::forthic::PlainDateValue& StackValue::plain_date_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.plain_date_value)
+  return _internal_plain_date_value();
 }
-inline void StackValue::clear_float_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kFloatValue) {
-    _impl_.value_.float_value_ = 0;
+inline ::forthic::PlainDateValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_plain_date_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.plain_date_value)
+  if (value_case() == kPlainDateValue) {
     clear_has_value();
+    auto* temp = reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
+    _impl_.value_.plain_date_value_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
 }
-inline double StackValue::float_value() const {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.float_value)
-  return _internal_float_value();
+inline void StackValue::unsafe_arena_set_allocated_plain_date_value(
+    ::forthic::PlainDateValue* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_value();
+  if (value) {
+    set_has_plain_date_value();
+    _impl_.value_.plain_date_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.plain_date_value)
 }
-inline void StackValue::set_float_value(double value) {
-  if (value_case() != kFloatValue) {
+inline ::forthic::PlainDateValue* PROTOBUF_NONNULL StackValue::_internal_mutable_plain_date_value() {
+  if (value_case() != kPlainDateValue) {
     clear_value();
-    set_has_float_value();
+    set_has_plain_date_value();
+    _impl_.value_.plain_date_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::PlainDateValue>(GetArena()));
   }
-  _impl_.value_.float_value_ = value;
-  // @@protoc_insertion_point(field_set:forthic.StackValue.float_value)
+  return reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
 }
-inline double StackValue::_internal_float_value() const {
-  if (value_case() == kFloatValue) {
-    return _impl_.value_.float_value_;
-  }
-  return 0;
+inline ::forthic::PlainDateValue* PROTOBUF_NONNULL StackValue::mutable_plain_date_value()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::forthic::PlainDateValue* _msg = _internal_mutable_plain_date_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.plain_date_value)
+  return _msg;
 }
 
-// .forthic.NullValue null_value = 5;
-inline bool StackValue::has_null_value() const {
-  return value_case() == kNullValue;
+// .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
+inline bool StackValue::has_zoned_datetime_value() const {
+  return value_case() == kZonedDatetimeValue;
 }
-inline bool StackValue::_internal_has_null_value() const {
-  return value_case() == kNullValue;
+inline bool StackValue::_internal_has_zoned_datetime_value() const {
+  return value_case() == kZonedDatetimeValue;
 }
-inline void StackValue::set_has_null_value() {
-  _impl_._oneof_case_[0] = kNullValue;
+inline void StackValue::set_has_zoned_datetime_value() {
+  _impl_._oneof_case_[0] = kZonedDatetimeValue;
 }
-inline void StackValue::clear_null_value() {
+inline void StackValue::clear_zoned_datetime_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kNullValue) {
+  if (value_case() == kZonedDatetimeValue) {
     if (GetArena() == nullptr) {
-      delete _impl_.value_.null_value_;
+      delete _impl_.value_.zoned_datetime_value_;
     } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.null_value_);
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.zoned_datetime_value_);
     }
     clear_has_value();
   }
 }
-inline ::forthic::NullValue* PROTOBUF_NULLABLE StackValue::release_null_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.null_value)
-  if (value_case() == kNullValue) {
+inline ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE StackValue::release_zoned_datetime_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.zoned_datetime_value)
+  if (value_case() == kZonedDatetimeValue) {
     clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
+    auto* temp = reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
     if (GetArena() != nullptr) {
       temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.value_.null_value_ = nullptr;
+    _impl_.value_.zoned_datetime_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::forthic::NullValue& StackValue::_internal_null_value() const {
-  return value_case() == kNullValue ? static_cast<const ::forthic::NullValue&>(*reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_))
-                     : reinterpret_cast<const ::forthic::NullValue&>(::forthic::_NullValue_default_instance_);
+inline const ::forthic::ZonedDateTimeValue& StackValue::_internal_zoned_datetime_value() const {
+  return value_case() == kZonedDatetimeValue ? static_cast<const ::forthic::ZonedDateTimeValue&>(*reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_))
+                     : reinterpret_cast<const ::forthic::ZonedDateTimeValue&>(::forthic::_ZonedDateTimeValue_default_instance_);
 }
-inline const ::forthic::NullValue& StackValue::null_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.null_value)
-  return _internal_null_value();
+inline const ::forthic::ZonedDateTimeValue& StackValue::zoned_datetime_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.zoned_datetime_value)
+  return _internal_zoned_datetime_value();
 }
-inline ::forthic::NullValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_null_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.null_value)
-  if (value_case() == kNullValue) {
+inline ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_zoned_datetime_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.zoned_datetime_value)
+  if (value_case() == kZonedDatetimeValue) {
     clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
-    _impl_.value_.null_value_ = nullptr;
+    auto* temp = reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
+    _impl_.value_.zoned_datetime_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void StackValue::unsafe_arena_set_allocated_null_value(
-    ::forthic::NullValue* PROTOBUF_NULLABLE value) {
+inline void StackValue::unsafe_arena_set_allocated_zoned_datetime_value(
+    ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value) {
   // We rely on the oneof clear method to free the earlier contents
   // of this oneof. We can directly use the pointer we're given to
   // set the new value.
   clear_value();
   if (value) {
-    set_has_null_value();
-    _impl_.value_.null_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+    set_has_zoned_datetime_value();
+    _impl_.value_.zoned_datetime_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.null_value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.zoned_datetime_value)
 }
-inline ::forthic::NullValue* PROTOBUF_NONNULL StackValue::_internal_mutable_null_value() {
-  if (value_case() != kNullValue) {
+inline ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL StackValue::_internal_mutable_zoned_datetime_value() {
+  if (value_case() != kZonedDatetimeValue) {
     clear_value();
-    set_has_null_value();
-    _impl_.value_.null_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::NullValue>(GetArena()));
+    set_has_zoned_datetime_value();
+    _impl_.value_.zoned_datetime_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::ZonedDateTimeValue>(GetArena()));
   }
-  return reinterpret_cast<::forthic::NullValue*>(_impl_.value_.null_value_);
+  return reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
 }
-inline ::forthic::NullValue* PROTOBUF_NONNULL StackValue::mutable_null_value()
+inline ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL StackValue::mutable_zoned_datetime_value()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::NullValue* _msg = _internal_mutable_null_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.null_value)
+  ::forthic::ZonedDateTimeValue* _msg = _internal_mutable_zoned_datetime_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.zoned_datetime_value)
   return _msg;
 }
 
-// .forthic.ArrayValue array_value = 6;
-inline bool StackValue::has_array_value() const {
-  return value_case() == kArrayValue;
+// .forthic.RemoteRefValue remote_ref_value = 11;
+inline bool StackValue::has_remote_ref_value() const {
+  return value_case() == kRemoteRefValue;
 }
-inline bool StackValue::_internal_has_array_value() const {
-  return value_case() == kArrayValue;
+inline bool StackValue::_internal_has_remote_ref_value() const {
+  return value_case() == kRemoteRefValue;
 }
-inline void StackValue::set_has_array_value() {
-  _impl_._oneof_case_[0] = kArrayValue;
+inline void StackValue::set_has_remote_ref_value() {
+  _impl_._oneof_case_[0] = kRemoteRefValue;
 }
-inline void StackValue::clear_array_value() {
+inline void StackValue::clear_remote_ref_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kArrayValue) {
+  if (value_case() == kRemoteRefValue) {
     if (GetArena() == nullptr) {
-      delete _impl_.value_.array_value_;
+      delete _impl_.value_.remote_ref_value_;
     } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.array_value_);
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.remote_ref_value_);
     }
     clear_has_value();
   }
 }
-inline ::forthic::ArrayValue* PROTOBUF_NULLABLE StackValue::release_array_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.array_value)
-  if (value_case() == kArrayValue) {
+inline ::forthic::RemoteRefValue* PROTOBUF_NULLABLE StackValue::release_remote_ref_value() {
+  // @@protoc_insertion_point(field_release:forthic.StackValue.remote_ref_value)
+  if (value_case() == kRemoteRefValue) {
     clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
+    auto* temp = reinterpret_cast<::forthic::RemoteRefValue*>(_impl_.value_.remote_ref_value_);
     if (GetArena() != nullptr) {
       temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
     }
-    _impl_.value_.array_value_ = nullptr;
+    _impl_.value_.remote_ref_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::forthic::ArrayValue& StackValue::_internal_array_value() const {
-  return value_case() == kArrayValue ? static_cast<const ::forthic::ArrayValue&>(*reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_))
-                     : reinterpret_cast<const ::forthic::ArrayValue&>(::forthic::_ArrayValue_default_instance_);
+inline const ::forthic::RemoteRefValue& StackValue::_internal_remote_ref_value() const {
+  return value_case() == kRemoteRefValue ? static_cast<const ::forthic::RemoteRefValue&>(*reinterpret_cast<::forthic::RemoteRefValue*>(_impl_.value_.remote_ref_value_))
+                     : reinterpret_cast<const ::forthic::RemoteRefValue&>(::forthic::_RemoteRefValue_default_instance_);
 }
-inline const ::forthic::ArrayValue& StackValue::array_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.array_value)
-  return _internal_array_value();
+inline const ::forthic::RemoteRefValue& StackValue::remote_ref_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.StackValue.remote_ref_value)
+  return _internal_remote_ref_value();
 }
-inline ::forthic::ArrayValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_array_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.array_value)
-  if (value_case() == kArrayValue) {
+inline ::forthic::RemoteRefValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_remote_ref_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.remote_ref_value)
+  if (value_case() == kRemoteRefValue) {
     clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
-    _impl_.value_.array_value_ = nullptr;
+    auto* temp = reinterpret_cast<::forthic::RemoteRefValue*>(_impl_.value_.remote_ref_value_);
+    _impl_.value_.remote_ref_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void StackValue::unsafe_arena_set_allocated_array_value(
-    ::forthic::ArrayValue* PROTOBUF_NULLABLE value) {
+inline void StackValue::unsafe_arena_set_allocated_remote_ref_value(
+    ::forthic::RemoteRefValue* PROTOBUF_NULLABLE value) {
   // We rely on the oneof clear method to free the earlier contents
   // of this oneof. We can directly use the pointer we're given to
   // set the new value.
   clear_value();
   if (value) {
-    set_has_array_value();
-    _impl_.value_.array_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+    set_has_remote_ref_value();
+    _impl_.value_.remote_ref_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.array_value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.remote_ref_value)
 }
-inline ::forthic::ArrayValue* PROTOBUF_NONNULL StackValue::_internal_mutable_array_value() {
-  if (value_case() != kArrayValue) {
+inline ::forthic::RemoteRefValue* PROTOBUF_NONNULL StackValue::_internal_mutable_remote_ref_value() {
+  if (value_case() != kRemoteRefValue) {
     clear_value();
-    set_has_array_value();
-    _impl_.value_.array_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::ArrayValue>(GetArena()));
+    set_has_remote_ref_value();
+    _impl_.value_.remote_ref_value_ = reinterpret_cast<::google::protobuf::Message*>(
+        ::google::protobuf::Message::DefaultConstruct<::forthic::RemoteRefValue>(GetArena()));
   }
-  return reinterpret_cast<::forthic::ArrayValue*>(_impl_.value_.array_value_);
+  return reinterpret_cast<::forthic::RemoteRefValue*>(_impl_.value_.remote_ref_value_);
 }
-inline ::forthic::ArrayValue* PROTOBUF_NONNULL StackValue::mutable_array_value()
+inline ::forthic::RemoteRefValue* PROTOBUF_NONNULL StackValue::mutable_remote_ref_value()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::ArrayValue* _msg = _internal_mutable_array_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.array_value)
+  ::forthic::RemoteRefValue* _msg = _internal_mutable_remote_ref_value();
+  // @@protoc_insertion_point(field_mutable:forthic.StackValue.remote_ref_value)
   return _msg;
 }
 
-// .forthic.RecordValue record_value = 7;
-inline bool StackValue::has_record_value() const {
-  return value_case() == kRecordValue;
+inline bool StackValue::has_value() const {
+  return value_case() != VALUE_NOT_SET;
 }
-inline bool StackValue::_internal_has_record_value() const {
-  return value_case() == kRecordValue;
+inline void StackValue::clear_has_value() {
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
-inline void StackValue::set_has_record_value() {
-  _impl_._oneof_case_[0] = kRecordValue;
+inline StackValue::ValueCase StackValue::value_case() const {
+  return StackValue::ValueCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// NullValue
+
+// -------------------------------------------------------------------
+
+// ArrayValue
+
+// repeated .forthic.StackValue items = 1;
+inline int ArrayValue::_internal_items_size() const {
+  return _internal_items().size();
+}
+inline int ArrayValue::items_size() const {
+  return _internal_items_size();
+}
+inline void ArrayValue::clear_items() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.items_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ArrayValue::mutable_items(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ArrayValue.items)
+  return _internal_mutable_items()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ArrayValue::mutable_items()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ArrayValue.items)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_items();
+}
+inline const ::forthic::StackValue& ArrayValue::items(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ArrayValue.items)
+  return _internal_items().Get(index);
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL ArrayValue::add_items()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::forthic::StackValue* _add =
+      _internal_mutable_items()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ArrayValue.items)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ArrayValue::items() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ArrayValue.items)
+  return _internal_items();
+}
+inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
+ArrayValue::_internal_items() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.items_;
+}
+inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
+ArrayValue::_internal_mutable_items() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.items_;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// RecordValue
+
+// map<string, .forthic.StackValue> fields = 1;
+inline int RecordValue::_internal_fields_size() const {
+  return _internal_fields().size();
+}
+inline int RecordValue::fields_size() const {
+  return _internal_fields_size();
+}
+inline void RecordValue::clear_fields() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.fields_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& RecordValue::_internal_fields() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.fields_.GetMap();
+}
+inline const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& RecordValue::fields() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_map:forthic.RecordValue.fields)
+  return _internal_fields();
+}
+inline ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL RecordValue::_internal_mutable_fields() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.fields_.MutableMap();
+}
+inline ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL RecordValue::mutable_fields()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_map:forthic.RecordValue.fields)
+  return _internal_mutable_fields();
+}
+
+// -------------------------------------------------------------------
+
+// InstantValue
+
+// string iso8601 = 1;
+inline void InstantValue::clear_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::std::string& InstantValue::iso8601() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.InstantValue.iso8601)
+  return _internal_iso8601();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void InstantValue::set_iso8601(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.iso8601_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.InstantValue.iso8601)
+}
+inline ::std::string* PROTOBUF_NONNULL InstantValue::mutable_iso8601()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_iso8601();
+  // @@protoc_insertion_point(field_mutable:forthic.InstantValue.iso8601)
+  return _s;
+}
+inline const ::std::string& InstantValue::_internal_iso8601() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.iso8601_.Get();
+}
+inline void InstantValue::_internal_set_iso8601(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL InstantValue::_internal_mutable_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.iso8601_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE InstantValue::release_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.InstantValue.iso8601)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.iso8601_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.iso8601_.Set("", GetArena());
+  }
+  return released;
+}
+inline void InstantValue::set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.iso8601_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_.IsDefault()) {
+    _impl_.iso8601_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.InstantValue.iso8601)
 }
-inline void StackValue::clear_record_value() {
+
+// optional int64 epoch_nanos = 2;
+inline bool InstantValue::has_epoch_nanos() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
+  return value;
+}
+inline void InstantValue::clear_epoch_nanos() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kRecordValue) {
-    if (GetArena() == nullptr) {
-      delete _impl_.value_.record_value_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.record_value_);
-    }
-    clear_has_value();
-  }
+  _impl_.epoch_nanos_ = ::int64_t{0};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
 }
-inline ::forthic::RecordValue* PROTOBUF_NULLABLE StackValue::release_record_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.record_value)
-  if (value_case() == kRecordValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.record_value_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::int64_t InstantValue::epoch_nanos() const {
+  // @@protoc_insertion_point(field_get:forthic.InstantValue.epoch_nanos)
+  return _internal_epoch_nanos();
 }
-inline const ::forthic::RecordValue& StackValue::_internal_record_value() const {
-  return value_case() == kRecordValue ? static_cast<const ::forthic::RecordValue&>(*reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_))
-                     : reinterpret_cast<const ::forthic::RecordValue&>(::forthic::_RecordValue_default_instance_);
+inline void InstantValue::set_epoch_nanos(::int64_t value) {
+  _internal_set_epoch_nanos(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.InstantValue.epoch_nanos)
 }
-inline const ::forthic::RecordValue& StackValue::record_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.record_value)
-  return _internal_record_value();
+inline ::int64_t InstantValue::_internal_epoch_nanos() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.epoch_nanos_;
 }
-inline ::forthic::RecordValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_record_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.record_value)
-  if (value_case() == kRecordValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
-    _impl_.value_.record_value_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void InstantValue::_internal_set_epoch_nanos(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.epoch_nanos_ = value;
 }
-inline void StackValue::unsafe_arena_set_allocated_record_value(
-    ::forthic::RecordValue* PROTOBUF_NULLABLE value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_value();
-  if (value) {
-    set_has_record_value();
-    _impl_.value_.record_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.record_value)
+
+// -------------------------------------------------------------------
+
+// PlainDateValue
+
+// string iso8601_date = 1;
+inline void PlainDateValue::clear_iso8601_date() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_date_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
 }
-inline ::forthic::RecordValue* PROTOBUF_NONNULL StackValue::_internal_mutable_record_value() {
-  if (value_case() != kRecordValue) {
-    clear_value();
-    set_has_record_value();
-    _impl_.value_.record_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::RecordValue>(GetArena()));
-  }
-  return reinterpret_cast<::forthic::RecordValue*>(_impl_.value_.record_value_);
+inline const ::std::string& PlainDateValue::iso8601_date() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.PlainDateValue.iso8601_date)
+  return _internal_iso8601_date();
 }
-inline ::forthic::RecordValue* PROTOBUF_NONNULL StackValue::mutable_record_value()
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void PlainDateValue::set_iso8601_date(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.iso8601_date_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.PlainDateValue.iso8601_date)
+}
+inline ::std::string* PROTOBUF_NONNULL PlainDateValue::mutable_iso8601_date()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::RecordValue* _msg = _internal_mutable_record_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.record_value)
-  return _msg;
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_iso8601_date();
+  // @@protoc_insertion_point(field_mutable:forthic.PlainDateValue.iso8601_date)
+  return _s;
 }
-
-// .forthic.InstantValue instant_value = 8;
-inline bool StackValue::has_instant_value() const {
-  return value_case() == kInstantValue;
+inline const ::std::string& PlainDateValue::_internal_iso8601_date() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.iso8601_date_.Get();
 }
-inline bool StackValue::_internal_has_instant_value() const {
-  return value_case() == kInstantValue;
+inline void PlainDateValue::_internal_set_iso8601_date(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_date_.Set(value, GetArena());
 }
-inline void StackValue::set_has_instant_value() {
-  _impl_._oneof_case_[0] = kInstantValue;
+inline ::std::string* PROTOBUF_NONNULL PlainDateValue::_internal_mutable_iso8601_date() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.iso8601_date_.Mutable( GetArena());
 }
-inline void StackValue::clear_instant_value() {
+inline ::std::string* PROTOBUF_NULLABLE PlainDateValue::release_iso8601_date() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kInstantValue) {
-    if (GetArena() == nullptr) {
-      delete _impl_.value_.instant_value_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.instant_value_);
-    }
-    clear_has_value();
+  // @@protoc_insertion_point(field_release:forthic.PlainDateValue.iso8601_date)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.iso8601_date_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.iso8601_date_.Set("", GetArena());
   }
+  return released;
 }
-inline ::forthic::InstantValue* PROTOBUF_NULLABLE StackValue::release_instant_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.instant_value)
-  if (value_case() == kInstantValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.instant_value_ = nullptr;
-    return temp;
+inline void PlainDateValue::set_allocated_iso8601_date(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
   } else {
-    return nullptr;
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.iso8601_date_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_date_.IsDefault()) {
+    _impl_.iso8601_date_.Set("", GetArena());
   }
+  // @@protoc_insertion_point(field_set_allocated:forthic.PlainDateValue.iso8601_date)
 }
-inline const ::forthic::InstantValue& StackValue::_internal_instant_value() const {
-  return value_case() == kInstantValue ? static_cast<const ::forthic::InstantValue&>(*reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_))
-                     : reinterpret_cast<const ::forthic::InstantValue&>(::forthic::_InstantValue_default_instance_);
+
+// optional int32 days_since_epoch = 2;
+inline bool PlainDateValue::has_days_since_epoch() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
+  return value;
 }
-inline const ::forthic::InstantValue& StackValue::instant_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.instant_value)
-  return _internal_instant_value();
+inline void PlainDateValue::clear_days_since_epoch() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.days_since_epoch_ = 0;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
 }
-inline ::forthic::InstantValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_instant_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.instant_value)
-  if (value_case() == kInstantValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
-    _impl_.value_.instant_value_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::int32_t PlainDateValue::days_since_epoch() const {
+  // @@protoc_insertion_point(field_get:forthic.PlainDateValue.days_since_epoch)
+  return _internal_days_since_epoch();
 }
-inline void StackValue::unsafe_arena_set_allocated_instant_value(
-    ::forthic::InstantValue* PROTOBUF_NULLABLE value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_value();
-  if (value) {
-    set_has_instant_value();
-    _impl_.value_.instant_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.instant_value)
+inline void PlainDateValue::set_days_since_epoch(::int32_t value) {
+  _internal_set_days_since_epoch(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.PlainDateValue.days_since_epoch)
 }
-inline ::forthic::InstantValue* PROTOBUF_NONNULL StackValue::_internal_mutable_instant_value() {
-  if (value_case() != kInstantValue) {
-    clear_value();
-    set_has_instant_value();
-    _impl_.value_.instant_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::InstantValue>(GetArena()));
-  }
-  return reinterpret_cast<::forthic::InstantValue*>(_impl_.value_.instant_value_);
+inline ::int32_t PlainDateValue::_internal_days_since_epoch() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.days_since_epoch_;
 }
-inline ::forthic::InstantValue* PROTOBUF_NONNULL StackValue::mutable_instant_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::InstantValue* _msg = _internal_mutable_instant_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.instant_value)
-  return _msg;
+inline void PlainDateValue::_internal_set_days_since_epoch(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.days_since_epoch_ = value;
 }
 
-// .forthic.PlainDateValue plain_date_value = 9;
-inline bool StackValue::has_plain_date_value() const {
-  return value_case() == kPlainDateValue;
-}
-inline bool StackValue::_internal_has_plain_date_value() const {
-  return value_case() == kPlainDateValue;
+// -------------------------------------------------------------------
+
+// ZonedDateTimeValue
+
+// string iso8601 = 1;
+inline void ZonedDateTimeValue::clear_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
 }
-inline void StackValue::set_has_plain_date_value() {
-  _impl_._oneof_case_[0] = kPlainDateValue;
+inline const ::std::string& ZonedDateTimeValue::iso8601() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ZonedDateTimeValue.iso8601)
+  return _internal_iso8601();
 }
-inline void StackValue::clear_plain_date_value() {
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void ZonedDateTimeValue::set_iso8601(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kPlainDateValue) {
-    if (GetArena() == nullptr) {
-      delete _impl_.value_.plain_date_value_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.plain_date_value_);
-    }
-    clear_has_value();
-  }
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.iso8601_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.ZonedDateTimeValue.iso8601)
 }
-inline ::forthic::PlainDateValue* PROTOBUF_NULLABLE StackValue::release_plain_date_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.plain_date_value)
-  if (value_case() == kPlainDateValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.plain_date_value_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::mutable_iso8601()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_iso8601();
+  // @@protoc_insertion_point(field_mutable:forthic.ZonedDateTimeValue.iso8601)
+  return _s;
 }
-inline const ::forthic::PlainDateValue& StackValue::_internal_plain_date_value() const {
-  return value_case() == kPlainDateValue ? static_cast<const ::forthic::PlainDateValue&>(*reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_))
-                     : reinterpret_cast<const ::forthic::PlainDateValue&>(::forthic::_PlainDateValue_default_instance_);
+inline const ::std::string& ZonedDateTimeValue::_internal_iso8601() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.iso8601_.Get();
 }
-inline const ::forthic::PlainDateValue& StackValue::plain_date_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.plain_date_value)
-  return _internal_plain_date_value();
+inline void ZonedDateTimeValue::_internal_set_iso8601(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.iso8601_.Set(value, GetArena());
 }
-inline ::forthic::PlainDateValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_plain_date_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.plain_date_value)
-  if (value_case() == kPlainDateValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
-    _impl_.value_.plain_date_value_ = nullptr;
-    return temp;
-  } else {
+inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::_internal_mutable_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.iso8601_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE ZonedDateTimeValue::release_iso8601() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ZonedDateTimeValue.iso8601)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
     return nullptr;
   }
-}
-inline void StackValue::unsafe_arena_set_allocated_plain_date_value(
-    ::forthic::PlainDateValue* PROTOBUF_NULLABLE value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_value();
-  if (value) {
-    set_has_plain_date_value();
-    _impl_.value_.plain_date_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.iso8601_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.iso8601_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.plain_date_value)
+  return released;
 }
-inline ::forthic::PlainDateValue* PROTOBUF_NONNULL StackValue::_internal_mutable_plain_date_value() {
-  if (value_case() != kPlainDateValue) {
-    clear_value();
-    set_has_plain_date_value();
-    _impl_.value_.plain_date_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::PlainDateValue>(GetArena()));
+inline void ZonedDateTimeValue::set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
   }
-  return reinterpret_cast<::forthic::PlainDateValue*>(_impl_.value_.plain_date_value_);
+  _impl_.iso8601_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_.IsDefault()) {
+    _impl_.iso8601_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.ZonedDateTimeValue.iso8601)
 }
-inline ::forthic::PlainDateValue* PROTOBUF_NONNULL StackValue::mutable_plain_date_value()
+
+// string timezone = 2;
+inline void ZonedDateTimeValue::clear_timezone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.timezone_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline const ::std::string& ZonedDateTimeValue::timezone() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::PlainDateValue* _msg = _internal_mutable_plain_date_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.plain_date_value)
-  return _msg;
+  // @@protoc_insertion_point(field_get:forthic.ZonedDateTimeValue.timezone)
+  return _internal_timezone();
 }
-
-// .forthic.ZonedDateTimeValue zoned_datetime_value = 10;
-inline bool StackValue::has_zoned_datetime_value() const {
-  return value_case() == kZonedDatetimeValue;
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void ZonedDateTimeValue::set_timezone(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  _impl_.timezone_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.ZonedDateTimeValue.timezone)
 }
-inline bool StackValue::_internal_has_zoned_datetime_value() const {
-  return value_case() == kZonedDatetimeValue;
+inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::mutable_timezone()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::std::string* _s = _internal_mutable_timezone();
+  // @@protoc_insertion_point(field_mutable:forthic.ZonedDateTimeValue.timezone)
+  return _s;
 }
-inline void StackValue::set_has_zoned_datetime_value() {
-  _impl_._oneof_case_[0] = kZonedDatetimeValue;
+inline const ::std::string& ZonedDateTimeValue::_internal_timezone() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.timezone_.Get();
 }
-inline void StackValue::clear_zoned_datetime_value() {
+inline void ZonedDateTimeValue::_internal_set_timezone(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value_case() == kZonedDatetimeValue) {
-    if (GetArena() == nullptr) {
-      delete _impl_.value_.zoned_datetime_value_;
-    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
-      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.value_.zoned_datetime_value_);
-    }
-    clear_has_value();
-  }
+  _impl_.timezone_.Set(value, GetArena());
 }
-inline ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE StackValue::release_zoned_datetime_value() {
-  // @@protoc_insertion_point(field_release:forthic.StackValue.zoned_datetime_value)
-  if (value_case() == kZonedDatetimeValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
-    if (GetArena() != nullptr) {
-      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.value_.zoned_datetime_value_ = nullptr;
-    return temp;
-  } else {
+inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::_internal_mutable_timezone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.timezone_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE ZonedDateTimeValue::release_timezone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ZonedDateTimeValue.timezone)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
     return nullptr;
   }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  auto* released = _impl_.timezone_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.timezone_.Set("", GetArena());
+  }
+  return released;
 }
-inline const ::forthic::ZonedDateTimeValue& StackValue::_internal_zoned_datetime_value() const {
-  return value_case() == kZonedDatetimeValue ? static_cast<const ::forthic::ZonedDateTimeValue&>(*reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_))
-                     : reinterpret_cast<const ::forthic::ZonedDateTimeValue&>(::forthic::_ZonedDateTimeValue_default_instance_);
-}
-inline const ::forthic::ZonedDateTimeValue& StackValue::zoned_datetime_value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.StackValue.zoned_datetime_value)
-  return _internal_zoned_datetime_value();
-}
-inline ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE StackValue::unsafe_arena_release_zoned_datetime_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:forthic.StackValue.zoned_datetime_value)
-  if (value_case() == kZonedDatetimeValue) {
-    clear_has_value();
-    auto* temp = reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
-    _impl_.value_.zoned_datetime_value_ = nullptr;
-    return temp;
+inline void ZonedDateTimeValue::set_allocated_timezone(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
   } else {
-    return nullptr;
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
   }
-}
-inline void StackValue::unsafe_arena_set_allocated_zoned_datetime_value(
-    ::forthic::ZonedDateTimeValue* PROTOBUF_NULLABLE value) {
-  // We rely on the oneof clear method to free the earlier contents
-  // of this oneof. We can directly use the pointer we're given to
-  // set the new value.
-  clear_value();
-  if (value) {
-    set_has_zoned_datetime_value();
-    _impl_.value_.zoned_datetime_value_ = reinterpret_cast<::google::protobuf::Message*>(value);
+  _impl_.timezone_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.timezone_.IsDefault()) {
+    _impl_.timezone_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.StackValue.zoned_datetime_value)
+  // @@protoc_insertion_point(field_set_allocated:forthic.ZonedDateTimeValue.timezone)
 }
-inline ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL StackValue::_internal_mutable_zoned_datetime_value() {
-  if (value_case() != kZonedDatetimeValue) {
-    clear_value();
-    set_has_zoned_datetime_value();
-    _impl_.value_.zoned_datetime_value_ = reinterpret_cast<::google::protobuf::Message*>(
-        ::google::protobuf::Message::DefaultConstruct<::forthic::ZonedDateTimeValue>(GetArena()));
-  }
-  return reinterpret_cast<::forthic::ZonedDateTimeValue*>(_impl_.value_.zoned_datetime_value_);
+
+// optional int64 epoch_nanos = 3;
+inline bool ZonedDateTimeValue::has_epoch_nanos() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000004U);
+  return value;
 }
-inline ::forthic::ZonedDateTimeValue* PROTOBUF_NONNULL StackValue::mutable_zoned_datetime_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::forthic::ZonedDateTimeValue* _msg = _internal_mutable_zoned_datetime_value();
-  // @@protoc_insertion_point(field_mutable:forthic.StackValue.zoned_datetime_value)
-  return _msg;
+inline void ZonedDateTimeValue::clear_epoch_nanos() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.epoch_nanos_ = ::int64_t{0};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000004U);
 }
-
-inline bool StackValue::has_value() const {
-  return value_case() != VALUE_NOT_SET;
+inline ::int64_t ZonedDateTimeValue::epoch_nanos() const {
+  // @@protoc_insertion_point(field_get:forthic.ZonedDateTimeValue.epoch_nanos)
+  return _internal_epoch_nanos();
 }
-inline void StackValue::clear_has_value() {
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+inline void ZonedDateTimeValue::set_epoch_nanos(::int64_t value) {
+  _internal_set_epoch_nanos(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000004U);
+  // @@protoc_insertion_point(field_set:forthic.ZonedDateTimeValue.epoch_nanos)
 }
-inline StackValue::ValueCase StackValue::value_case() const {
-  return StackValue::ValueCase(_impl_._oneof_case_[0]);
+inline ::int64_t ZonedDateTimeValue::_internal_epoch_nanos() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.epoch_nanos_;
+}
+inline void ZonedDateTimeValue::_internal_set_epoch_nanos(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.epoch_nanos_ = value;
 }
-// -------------------------------------------------------------------
-
-// NullValue
 
 // -------------------------------------------------------------------
 
-// ArrayValue
+// RemoteRefValue
 
-// repeated .forthic.StackValue items = 1;
-inline int ArrayValue::_internal_items_size() const {
-  return _internal_items().size();
-}
-inline int ArrayValue::items_size() const {
-  return _internal_items_size();
-}
-inline void ArrayValue::clear_items() {
+// string handle_id = 1;
+inline void RemoteRefValue::clear_handle_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.items_.Clear();
-  ClearHasBitForRepeated(_impl_._has_bits_[0],
+  _impl_.handle_id_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ArrayValue::mutable_items(int index)
+inline const ::std::string& RemoteRefValue::handle_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable:forthic.ArrayValue.items)
-  return _internal_mutable_items()->Mutable(index);
+  // @@protoc_insertion_point(field_get:forthic.RemoteRefValue.handle_id)
+  return _internal_handle_id();
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL ArrayValue::mutable_items()
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void RemoteRefValue::set_handle_id(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.handle_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.RemoteRefValue.handle_id)
+}
+inline ::std::string* PROTOBUF_NONNULL RemoteRefValue::mutable_handle_id()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_list:forthic.ArrayValue.items)
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_handle_id();
+  // @@protoc_insertion_point(field_mutable:forthic.RemoteRefValue.handle_id)
+  return _s;
+}
+inline const ::std::string& RemoteRefValue::_internal_handle_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.handle_id_.Get();
+}
+inline void RemoteRefValue::_internal_set_handle_id(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_items();
+  _impl_.handle_id_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL RemoteRefValue::_internal_mutable_handle_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.handle_id_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE RemoteRefValue::release_handle_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.RemoteRefValue.handle_id)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.handle_id_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.handle_id_.Set("", GetArena());
+  }
+  return released;
+}
+inline void RemoteRefValue::set_allocated_handle_id(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.handle_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.handle_id_.IsDefault()) {
+    _impl_.handle_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.RemoteRefValue.handle_id)
+}
+
+// string runtime = 2;
+inline void RemoteRefValue::clear_runtime() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.runtime_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
 }
-inline const ::forthic::StackValue& ArrayValue::items(int index) const
+inline const ::std::string& RemoteRefValue::runtime() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ArrayValue.items)
-  return _internal_items().Get(index);
+  // @@protoc_insertion_point(field_get:forthic.RemoteRefValue.runtime)
+  return _internal_runtime();
 }
-inline ::forthic::StackValue* PROTOBUF_NONNULL ArrayValue::add_items()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void RemoteRefValue::set_runtime(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::forthic::StackValue* _add =
-      _internal_mutable_items()->InternalAddWithArena(
-          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_add:forthic.ArrayValue.items)
-  return _add;
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  _impl_.runtime_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.RemoteRefValue.runtime)
 }
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>& ArrayValue::items() const
+inline ::std::string* PROTOBUF_NONNULL RemoteRefValue::mutable_runtime()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:forthic.ArrayValue.items)
-  return _internal_items();
-}
-inline const ::google::protobuf::RepeatedPtrField<::forthic::StackValue>&
-ArrayValue::_internal_items() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.items_;
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::std::string* _s = _internal_mutable_runtime();
+  // @@protoc_insertion_point(field_mutable:forthic.RemoteRefValue.runtime)
+  return _s;
 }
-inline ::google::protobuf::RepeatedPtrField<::forthic::StackValue>* PROTOBUF_NONNULL
-ArrayValue::_internal_mutable_items() {
+inline const ::std::string& RemoteRefValue::_internal_runtime() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.items_;
-}
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// RecordValue
-
-// map<string, .forthic.StackValue> fields = 1;
-inline int RecordValue::_internal_fields_size() const {
-  return _internal_fields().size();
-}
-inline int RecordValue::fields_size() const {
-  return _internal_fields_size();
+  return _impl_.runtime_.Get();
 }
-inline void RecordValue::clear_fields() {
+inline void RemoteRefValue::_internal_set_runtime(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.fields_.Clear();
-  ClearHasBitForRepeated(_impl_._has_bits_[0],
-                  0x00000001U);
-}
-inline const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& RecordValue::_internal_fields() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.fields_.GetMap();
+  _impl_.runtime_.Set(value, GetArena());
 }
-inline const ::google::protobuf::Map<::std::string, ::forthic::StackValue>& RecordValue::fields() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_map:forthic.RecordValue.fields)
-  return _internal_fields();
+inline ::std::string* PROTOBUF_NONNULL RemoteRefValue::_internal_mutable_runtime() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.runtime_.Mutable( GetArena());
 }
-inline ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL RecordValue::_internal_mutable_fields() {
+inline ::std::string* PROTOBUF_NULLABLE RemoteRefValue::release_runtime() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.fields_.MutableMap();
+  // @@protoc_insertion_point(field_release:forthic.RemoteRefValue.runtime)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  auto* released = _impl_.runtime_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.runtime_.Set("", GetArena());
+  }
+  return released;
 }
-inline ::google::protobuf::Map<::std::string, ::forthic::StackValue>* PROTOBUF_NONNULL RecordValue::mutable_fields()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
-  // @@protoc_insertion_point(field_mutable_map:forthic.RecordValue.fields)
-  return _internal_mutable_fields();
+inline void RemoteRefValue::set_allocated_runtime(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  _impl_.runtime_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.runtime_.IsDefault()) {
+    _impl_.runtime_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.RemoteRefValue.runtime)
 }
 
 // -------------------------------------------------------------------
 
-// InstantValue
+// FetchRefRequest
 
-// string iso8601 = 1;
-inline void InstantValue::clear_iso8601() {
+// string handle_id = 1;
+inline void FetchRefRequest::clear_handle_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_.ClearToEmpty();
+  _impl_.handle_id_.ClearToEmpty();
   ClearHasBit(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline const ::std::string& InstantValue::iso8601() const
+inline const ::std::string& FetchRefRequest::handle_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.InstantValue.iso8601)
-  return _internal_iso8601();
+  // @@protoc_insertion_point(field_get:forthic.FetchRefRequest.handle_id)
+  return _internal_handle_id();
 }
 template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void InstantValue::set_iso8601(Arg_&& arg, Args_... args) {
+PROTOBUF_ALWAYS_INLINE void FetchRefRequest::set_handle_id(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  _impl_.iso8601_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.InstantValue.iso8601)
+  _impl_.handle_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.FetchRefRequest.handle_id)
 }
-inline ::std::string* PROTOBUF_NONNULL InstantValue::mutable_iso8601()
+inline ::std::string* PROTOBUF_NONNULL FetchRefRequest::mutable_handle_id()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  ::std::string* _s = _internal_mutable_iso8601();
-  // @@protoc_insertion_point(field_mutable:forthic.InstantValue.iso8601)
+  ::std::string* _s = _internal_mutable_handle_id();
+  // @@protoc_insertion_point(field_mutable:forthic.FetchRefRequest.handle_id)
   return _s;
 }
-inline const ::std::string& InstantValue::_internal_iso8601() const {
+inline const ::std::string& FetchRefRequest::_internal_handle_id() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.iso8601_.Get();
+  return _impl_.handle_id_.Get();
 }
-inline void InstantValue::_internal_set_iso8601(const ::std::string& value) {
+inline void FetchRefRequest::_internal_set_handle_id(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_.Set(value, GetArena());
+  _impl_.handle_id_.Set(value, GetArena());
 }
-inline ::std::string* PROTOBUF_NONNULL InstantValue::_internal_mutable_iso8601() {
+inline ::std::string* PROTOBUF_NONNULL FetchRefRequest::_internal_mutable_handle_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.iso8601_.Mutable( GetArena());
+  return _impl_.handle_id_.Mutable( GetArena());
 }
-inline ::std::string* PROTOBUF_NULLABLE InstantValue::release_iso8601() {
+inline ::std::string* PROTOBUF_NULLABLE FetchRefRequest::release_handle_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.InstantValue.iso8601)
+  // @@protoc_insertion_point(field_release:forthic.FetchRefRequest.handle_id)
   if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
     return nullptr;
   }
   ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
-  auto* released = _impl_.iso8601_.Release();
+  auto* released = _impl_.handle_id_.Release();
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.iso8601_.Set("", GetArena());
+    _impl_.handle_id_.Set("", GetArena());
   }
   return released;
 }
-inline void InstantValue::set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value) {
+inline void FetchRefRequest::set_allocated_handle_id(::std::string* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (value != nullptr) {
     SetHasBit(_impl_._has_bits_[0], 0x00000001U);
   } else {
     ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
   }
-  _impl_.iso8601_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_.IsDefault()) {
-    _impl_.iso8601_.Set("", GetArena());
+  _impl_.handle_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.handle_id_.IsDefault()) {
+    _impl_.handle_id_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.InstantValue.iso8601)
+  // @@protoc_insertion_point(field_set_allocated:forthic.FetchRefRequest.handle_id)
+}
+
+// bool accepts_compact_temporal = 2;
+inline void FetchRefRequest::clear_accepts_compact_temporal() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline bool FetchRefRequest::accepts_compact_temporal() const {
+  // @@protoc_insertion_point(field_get:forthic.FetchRefRequest.accepts_compact_temporal)
+  return _internal_accepts_compact_temporal();
+}
+inline void FetchRefRequest::set_accepts_compact_temporal(bool value) {
+  _internal_set_accepts_compact_temporal(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:forthic.FetchRefRequest.accepts_compact_temporal)
+}
+inline bool FetchRefRequest::_internal_accepts_compact_temporal() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.accepts_compact_temporal_;
+}
+inline void FetchRefRequest::_internal_set_accepts_compact_temporal(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.accepts_compact_temporal_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// PlainDateValue
+// FetchRefResponse
 
-// string iso8601_date = 1;
-inline void PlainDateValue::clear_iso8601_date() {
+// .forthic.StackValue value = 1;
+inline bool FetchRefResponse::has_value() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000001U);
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline void FetchRefResponse::clear_value() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_date_.ClearToEmpty();
+  if (_impl_.value_ != nullptr) _impl_.value_->Clear();
   ClearHasBit(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline const ::std::string& PlainDateValue::iso8601_date() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.PlainDateValue.iso8601_date)
-  return _internal_iso8601_date();
+inline const ::forthic::StackValue& FetchRefResponse::_internal_value() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::StackValue* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::StackValue&>(::forthic::_StackValue_default_instance_);
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void PlainDateValue::set_iso8601_date(Arg_&& arg, Args_... args) {
+inline const ::forthic::StackValue& FetchRefResponse::value() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.FetchRefResponse.value)
+  return _internal_value();
+}
+inline void FetchRefResponse::unsafe_arena_set_allocated_value(
+    ::forthic::StackValue* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  _impl_.iso8601_date_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.PlainDateValue.iso8601_date)
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = reinterpret_cast<::forthic::StackValue*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.FetchRefResponse.value)
 }
-inline ::std::string* PROTOBUF_NONNULL PlainDateValue::mutable_iso8601_date()
+inline ::forthic::StackValue* PROTOBUF_NULLABLE FetchRefResponse::release_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::forthic::StackValue* released = _impl_.value_;
+  _impl_.value_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::forthic::StackValue* PROTOBUF_NULLABLE FetchRefResponse::unsafe_arena_release_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.FetchRefResponse.value)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::forthic::StackValue* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL FetchRefResponse::_internal_mutable_value() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.value_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::StackValue>(GetArena());
+    _impl_.value_ = reinterpret_cast<::forthic::StackValue*>(p);
+  }
+  return _impl_.value_;
+}
+inline ::forthic::StackValue* PROTOBUF_NONNULL FetchRefResponse::mutable_value()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
   SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  ::std::string* _s = _internal_mutable_iso8601_date();
-  // @@protoc_insertion_point(field_mutable:forthic.PlainDateValue.iso8601_date)
-  return _s;
+  ::forthic::StackValue* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:forthic.FetchRefResponse.value)
+  return _msg;
 }
-inline const ::std::string& PlainDateValue::_internal_iso8601_date() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.iso8601_date_.Get();
+inline void FetchRefResponse::set_allocated_value(::forthic::StackValue* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.value_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+
+  _impl_.value_ = reinterpret_cast<::forthic::StackValue*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.FetchRefResponse.value)
 }
-inline void PlainDateValue::_internal_set_iso8601_date(const ::std::string& value) {
+
+// optional .forthic.ErrorInfo error = 2;
+inline bool FetchRefResponse::has_error() const {
+  bool value = CheckHasBit(_impl_._has_bits_[0], 0x00000002U);
+  PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
+  return value;
+}
+inline void FetchRefResponse::clear_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_date_.Set(value, GetArena());
+  if (_impl_.error_ != nullptr) _impl_.error_->Clear();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
 }
-inline ::std::string* PROTOBUF_NONNULL PlainDateValue::_internal_mutable_iso8601_date() {
+inline const ::forthic::ErrorInfo& FetchRefResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::forthic::ErrorInfo* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::forthic::ErrorInfo&>(::forthic::_ErrorInfo_default_instance_);
+}
+inline const ::forthic::ErrorInfo& FetchRefResponse::error() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.FetchRefResponse.error)
+  return _internal_error();
+}
+inline void FetchRefResponse::unsafe_arena_set_allocated_error(
+    ::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.iso8601_date_.Mutable( GetArena());
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:forthic.FetchRefResponse.error)
 }
-inline ::std::string* PROTOBUF_NULLABLE PlainDateValue::release_iso8601_date() {
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE FetchRefResponse::release_error() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.PlainDateValue.iso8601_date)
-  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
-    return nullptr;
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* released = _impl_.error_;
+  _impl_.error_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
   }
-  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
-  auto* released = _impl_.iso8601_date_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.iso8601_date_.Set("", GetArena());
+  return released;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NULLABLE FetchRefResponse::unsafe_arena_release_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.FetchRefResponse.error)
+
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL FetchRefResponse::_internal_mutable_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.error_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::forthic::ErrorInfo>(GetArena());
+    _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(p);
   }
-  return released;
+  return _impl_.error_;
 }
-inline void PlainDateValue::set_allocated_iso8601_date(::std::string* PROTOBUF_NULLABLE value) {
+inline ::forthic::ErrorInfo* PROTOBUF_NONNULL FetchRefResponse::mutable_error()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::forthic::ErrorInfo* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:forthic.FetchRefResponse.error)
+  return _msg;
+}
+inline void FetchRefResponse::set_allocated_error(::forthic::ErrorInfo* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
   ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.error_);
+  }
+
   if (value != nullptr) {
-    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
   } else {
-    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
-  }
-  _impl_.iso8601_date_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_date_.IsDefault()) {
-    _impl_.iso8601_date_.Set("", GetArena());
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
   }
-  // @@protoc_insertion_point(field_set_allocated:forthic.PlainDateValue.iso8601_date)
+
+  _impl_.error_ = reinterpret_cast<::forthic::ErrorInfo*>(value);
+  // @@protoc_insertion_point(field_set_allocated:forthic.FetchRefResponse.error)
 }
 
 // -------------------------------------------------------------------
 
-// ZonedDateTimeValue
+// ReleaseRefsRequest
 
-// string iso8601 = 1;
-inline void ZonedDateTimeValue::clear_iso8601() {
+// repeated string handle_ids = 1;
+inline int ReleaseRefsRequest::_internal_handle_ids_size() const {
+  return _internal_handle_ids().size();
+}
+inline int ReleaseRefsRequest::handle_ids_size() const {
+  return _internal_handle_ids_size();
+}
+inline void ReleaseRefsRequest::clear_handle_ids() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_.ClearToEmpty();
-  ClearHasBit(_impl_._has_bits_[0],
+  _impl_.handle_ids_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
                   0x00000001U);
 }
-inline const ::std::string& ZonedDateTimeValue::iso8601() const
+inline ::std::string* PROTOBUF_NONNULL ReleaseRefsRequest::add_handle_ids()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ZonedDateTimeValue.iso8601)
-  return _internal_iso8601();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ZonedDateTimeValue::set_iso8601(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  _impl_.iso8601_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.ZonedDateTimeValue.iso8601)
+  ::std::string* _s =
+      _internal_mutable_handle_ids()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add_mutable:forthic.ReleaseRefsRequest.handle_ids)
+  return _s;
 }
-inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::mutable_iso8601()
+inline const ::std::string& ReleaseRefsRequest::handle_ids(int index) const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  ::std::string* _s = _internal_mutable_iso8601();
-  // @@protoc_insertion_point(field_mutable:forthic.ZonedDateTimeValue.iso8601)
-  return _s;
+  // @@protoc_insertion_point(field_get:forthic.ReleaseRefsRequest.handle_ids)
+  return _internal_handle_ids().Get(index);
 }
-inline const ::std::string& ZonedDateTimeValue::_internal_iso8601() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.iso8601_.Get();
+inline ::std::string* PROTOBUF_NONNULL ReleaseRefsRequest::mutable_handle_ids(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:forthic.ReleaseRefsRequest.handle_ids)
+  return _internal_mutable_handle_ids()->Mutable(index);
 }
-inline void ZonedDateTimeValue::_internal_set_iso8601(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.iso8601_.Set(value, GetArena());
+template <typename Arg_, typename... Args_>
+inline void ReleaseRefsRequest::set_handle_ids(int index, Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::AssignToString(*_internal_mutable_handle_ids()->Mutable(index), ::std::forward<Arg_>(value),
+                        args... );
+  // @@protoc_insertion_point(field_set:forthic.ReleaseRefsRequest.handle_ids)
 }
-inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::_internal_mutable_iso8601() {
+template <typename Arg_, typename... Args_>
+inline void ReleaseRefsRequest::add_handle_ids(Arg_&& value, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.iso8601_.Mutable( GetArena());
+  ::google::protobuf::internal::AddToRepeatedPtrField(
+      ::google::protobuf::MessageLite::internal_visibility(), GetArena(),
+      *_internal_mutable_handle_ids(), ::std::forward<Arg_>(value),
+      args... );
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:forthic.ReleaseRefsRequest.handle_ids)
 }
-inline ::std::string* PROTOBUF_NULLABLE ZonedDateTimeValue::release_iso8601() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.ZonedDateTimeValue.iso8601)
-  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
-    return nullptr;
-  }
-  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
-  auto* released = _impl_.iso8601_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.iso8601_.Set("", GetArena());
-  }
-  return released;
+inline const ::google::protobuf::RepeatedPtrField<::std::string>& ReleaseRefsRequest::handle_ids()
+    const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:forthic.ReleaseRefsRequest.handle_ids)
+  return _internal_handle_ids();
 }
-inline void ZonedDateTimeValue::set_allocated_iso8601(::std::string* PROTOBUF_NULLABLE value) {
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ReleaseRefsRequest::mutable_handle_ids() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:forthic.ReleaseRefsRequest.handle_ids)
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
-  } else {
-    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
-  }
-  _impl_.iso8601_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.iso8601_.IsDefault()) {
-    _impl_.iso8601_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:forthic.ZonedDateTimeValue.iso8601)
+  return _internal_mutable_handle_ids();
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>&
+ReleaseRefsRequest::_internal_handle_ids() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.handle_ids_;
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ReleaseRefsRequest::_internal_mutable_handle_ids() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.handle_ids_;
 }
 
-// string timezone = 2;
-inline void ZonedDateTimeValue::clear_timezone() {
+// -------------------------------------------------------------------
+
+// ReleaseRefsResponse
+
+// int32 released_count = 1;
+inline void ReleaseRefsResponse::clear_released_count() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timezone_.ClearToEmpty();
+  _impl_.released_count_ = 0;
   ClearHasBit(_impl_._has_bits_[0],
-                  0x00000002U);
-}
-inline const ::std::string& ZonedDateTimeValue::timezone() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:forthic.ZonedDateTimeValue.timezone)
-  return _internal_timezone();
+                  0x00000001U);
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ZonedDateTimeValue::set_timezone(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
-  _impl_.timezone_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:forthic.ZonedDateTimeValue.timezone)
+inline ::int32_t ReleaseRefsResponse::released_count() const {
+  // @@protoc_insertion_point(field_get:forthic.ReleaseRefsResponse.released_count)
+  return _internal_released_count();
 }
-inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::mutable_timezone()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
-  ::std::string* _s = _internal_mutable_timezone();
-  // @@protoc_insertion_point(field_mutable:forthic.ZonedDateTimeValue.timezone)
-  return _s;
+inline void ReleaseRefsResponse::set_released_count(::int32_t value) {
+  _internal_set_released_count(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_set:forthic.ReleaseRefsResponse.released_count)
 }
-inline const ::std::string& ZonedDateTimeValue::_internal_timezone() const {
+inline ::int32_t ReleaseRefsResponse::_internal_released_count() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.timezone_.Get();
-}
-inline void ZonedDateTimeValue::_internal_set_timezone(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timezone_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL ZonedDateTimeValue::_internal_mutable_timezone() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.timezone_.Mutable( GetArena());
+  return _impl_.released_count_;
 }
-inline ::std::string* PROTOBUF_NULLABLE ZonedDateTimeValue::release_timezone() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:forthic.ZonedDateTimeValue.timezone)
-  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
-    return nullptr;
-  }
-  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
-  auto* released = _impl_.timezone_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.timezone_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ZonedDateTimeValue::set_allocated_timezone(::std::string* PROTOBUF_NULLABLE value) {
+inline void ReleaseRefsResponse::_internal_set_released_count(::int32_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
-  } else {
-    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
-  }
-  _impl_.timezone_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.timezone_.IsDefault()) {
-    _impl_.timezone_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:forthic.ZonedDateTimeValue.timezone)
+  _impl_.released_count_ = value;
 }
 
 // -------------------------------------------------------------------
@@ -6296,6 +11922,71 @@ ListModulesResponse::_internal_mutable_modules() {
   return &_impl_.modules_;
 }
 
+// string version = 2;
+inline void ListModulesResponse::clear_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline const ::std::string& ListModulesResponse::version() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.ListModulesResponse.version)
+  return _internal_version();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void ListModulesResponse::set_version(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  _impl_.version_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.ListModulesResponse.version)
+}
+inline ::std::string* PROTOBUF_NONNULL ListModulesResponse::mutable_version()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  ::std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:forthic.ListModulesResponse.version)
+  return _s;
+}
+inline const ::std::string& ListModulesResponse::_internal_version() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.version_.Get();
+}
+inline void ListModulesResponse::_internal_set_version(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL ListModulesResponse::_internal_mutable_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.version_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE ListModulesResponse::release_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.ListModulesResponse.version)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000002U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  auto* released = _impl_.version_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.version_.Set("", GetArena());
+  }
+  return released;
+}
+inline void ListModulesResponse::set_allocated_version(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000002U);
+  }
+  _impl_.version_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.ListModulesResponse.version)
+}
+
 // -------------------------------------------------------------------
 
 // ModuleSummary
@@ -6739,6 +12430,71 @@ GetModuleInfoResponse::_internal_mutable_words() {
   return &_impl_.words_;
 }
 
+// string version = 4;
+inline void GetModuleInfoResponse::clear_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline const ::std::string& GetModuleInfoResponse::version() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:forthic.GetModuleInfoResponse.version)
+  return _internal_version();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void GetModuleInfoResponse::set_version(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  _impl_.version_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:forthic.GetModuleInfoResponse.version)
+}
+inline ::std::string* PROTOBUF_NONNULL GetModuleInfoResponse::mutable_version()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  ::std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:forthic.GetModuleInfoResponse.version)
+  return _s;
+}
+inline const ::std::string& GetModuleInfoResponse::_internal_version() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.version_.Get();
+}
+inline void GetModuleInfoResponse::_internal_set_version(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.version_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL GetModuleInfoResponse::_internal_mutable_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.version_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE GetModuleInfoResponse::release_version() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:forthic.GetModuleInfoResponse.version)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000008U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  auto* released = _impl_.version_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.version_.Set("", GetArena());
+  }
+  return released;
+}
+inline void GetModuleInfoResponse::set_allocated_version(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000008U);
+  }
+  _impl_.version_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:forthic.GetModuleInfoResponse.version)
+}
+
 // -------------------------------------------------------------------
 
 // WordInfo
@@ -6938,6 +12694,31 @@ inline void WordInfo::set_allocated_description(::std::string* PROTOBUF_NULLABLE
   // @@protoc_insertion_point(field_set_allocated:forthic.WordInfo.description)
 }
 
+// bool pure = 4;
+inline void WordInfo::clear_pure() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.pure_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline bool WordInfo::pure() const {
+  // @@protoc_insertion_point(field_get:forthic.WordInfo.pure)
+  return _internal_pure();
+}
+inline void WordInfo::set_pure(bool value) {
+  _internal_set_pure(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:forthic.WordInfo.pure)
+}
+inline bool WordInfo::_internal_pure() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.pure_;
+}
+inline void WordInfo::_internal_set_pure(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.pure_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -18,6 +18,7 @@ pub const ForthicErrorType = error{
     InvalidVariableName,
     OutOfMemory,
     InvalidFormat,
+    InstructionBudgetExceeded,
 };
 
 /// ============================================================================
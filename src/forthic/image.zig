@@ -0,0 +1,812 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const ArrayList = std.ArrayList;
+
+const interpreter_mod = @import("interpreter.zig");
+const Interpreter = interpreter_mod.Interpreter;
+const module_mod = @import("module.zig");
+const Module = module_mod.Module;
+const ModuleMemoWord = module_mod.ModuleMemoWord;
+const ModuleMemoBangWord = module_mod.ModuleMemoBangWord;
+const ModuleMemoBangAtWord = module_mod.ModuleMemoBangAtWord;
+const word_mod = @import("word.zig");
+const Word = word_mod.Word;
+const PushValueWord = word_mod.PushValueWord;
+const DefinitionWord = word_mod.DefinitionWord;
+const Value = @import("value.zig").Value;
+const WordTable = @import("word_table.zig").WordTable;
+
+/// ============================================================================
+/// Image - Precompiled interpreter state for fast startup
+/// ============================================================================
+
+// An image snapshots what Forthic code built in an interpreter: the app
+// module and every registered module made only of Forthic definitions -
+// their words, compiled definition bodies, memo values, variables and
+// imported word tables - plus the app module's module registrations. Loading it skips tokenizing
+// and compiling that code, and memo words come back with the values they
+// had when saved.
+//
+// Native words are Zig function pointers, so the image refers to them by
+// module and word name and load re-links them against the modules
+// registered with the interpreter. Register the same native modules before
+// load; the image holds what importing them added. Words an image cannot name - remote words,
+// words built by Zig code - fail save with UnsupportedWord.
+//
+// Load maps the file read-only: word, variable and module names point into
+// the mapping, so worker processes loading the same image share its pages.
+
+const magic = "FTHIMG";
+const format_version: u16 = 3;
+
+pub const ImageError = error{
+    /// Save needs an interpreter at rest: app module only on the module
+    /// stack, no definition being compiled
+    InterpreterBusy,
+    UnsupportedWord,
+    InvalidImage,
+};
+
+const EntryKind = enum(u8) { native, alias, definition, memo, memo_bang, memo_bang_at };
+const ItemKind = enum(u8) { push, local, native };
+const ValueKind = enum(u8) { null, bool, int, float, string, array, record, datetime };
+
+/// A word of an image module: module index (0 = app module) and word index
+const Loc = struct {
+    module: u32,
+    word: u32,
+};
+
+/// A native word, resolved by name at load
+const NativeRef = struct {
+    module: []const u8,
+    word: []const u8,
+};
+
+// =============================================================================
+// Save
+// =============================================================================
+
+/// Write interp's image to dir/sub_path, replacing it atomically
+pub fn save(interp: *Interpreter, dir: std.fs.Dir, sub_path: []const u8) !void {
+    const bytes = try encode(interp.allocator, interp);
+    defer interp.allocator.free(bytes);
+
+    var tmp_buf: [std.fs.max_path_bytes]u8 = undefined;
+    const tmp_path = try std.fmt.bufPrint(&tmp_buf, "{s}.{x}.tmp", .{ sub_path, std.crypto.random.int(u64) });
+    errdefer dir.deleteFile(tmp_path) catch {};
+
+    try dir.writeFile(.{ .sub_path = tmp_path, .data = bytes });
+    try dir.rename(tmp_path, sub_path);
+}
+
+/// interp's image as bytes; caller owns them
+pub fn encode(allocator: Allocator, interp: *Interpreter) ![]u8 {
+    if (interp.is_compiling or interp.module_stack.items.len != 1) {
+        return ImageError.InterpreterBusy;
+    }
+
+    var encoder = Encoder{ .allocator = allocator };
+    defer encoder.deinit();
+    try encoder.collect(interp);
+    try encoder.writeImage(interp);
+    return encoder.out.toOwnedSlice(allocator);
+}
+
+const Encoder = struct {
+    allocator: Allocator,
+    out: ArrayList(u8) = .{},
+    /// modules[0] is the app module; the rest are code modules, by name
+    modules: ArrayList(*Module) = .{},
+    /// Forthic-defined words, by the module position that defined them
+    defined: std.AutoHashMapUnmanaged(*anyopaque, Loc) = .{},
+    natives: std.AutoHashMapUnmanaged(*anyopaque, NativeRef) = .{},
+    /// Static word tables, by the name of a module built on them
+    tables: std.AutoHashMapUnmanaged(*const WordTable, []const u8) = .{},
+
+    fn deinit(self: *Encoder) void {
+        self.out.deinit(self.allocator);
+        self.modules.deinit(self.allocator);
+        self.defined.deinit(self.allocator);
+        self.natives.deinit(self.allocator);
+        self.tables.deinit(self.allocator);
+    }
+
+    fn collect(self: *Encoder, interp: *Interpreter) !void {
+        try self.modules.append(self.allocator, &interp.app_module);
+
+        var module_iter = interp.registered_modules.valueIterator();
+        while (module_iter.next()) |module_ptr| {
+            const module = module_ptr.*;
+            if (module == &interp.app_module) continue;
+            if (isCodeModule(module)) {
+                try self.modules.append(self.allocator, module);
+                continue;
+            }
+            try self.addNatives(module, module.words.items);
+            if (module.static_words) |table| {
+                const gop = try self.tables.getOrPut(self.allocator, table);
+                if (!gop.found_existing) gop.value_ptr.* = module.name;
+                try self.addNatives(module, table.words);
+            }
+        }
+
+        // Same bytes for the same interpreter state
+        std.mem.sort(*Module, self.modules.items[1..], {}, struct {
+            fn lessThan(_: void, a: *Module, b: *Module) bool {
+                return std.mem.lessThan(u8, a.name, b.name);
+            }
+        }.lessThan);
+
+        // A word imported into another module becomes an alias of its first
+        // occurrence
+        for (self.modules.items, 0..) |module, mi| {
+            for (module.words.items, 0..) |w, wi| {
+                if (!isDefined(w)) continue;
+                const gop = try self.defined.getOrPut(self.allocator, w.ptr);
+                if (!gop.found_existing) {
+                    gop.value_ptr.* = .{ .module = @intCast(mi), .word = @intCast(wi) };
+                }
+            }
+        }
+    }
+
+    fn addNatives(self: *Encoder, module: *const Module, words: []const Word) !void {
+        for (words) |w| {
+            const gop = try self.natives.getOrPut(self.allocator, w.ptr);
+            if (!gop.found_existing) {
+                gop.value_ptr.* = .{ .module = module.name, .word = w.getName() };
+            }
+        }
+    }
+
+    fn writeImage(self: *Encoder, interp: *Interpreter) !void {
+        try self.out.appendSlice(self.allocator, magic);
+        try self.writeInt(u16, format_version);
+        try self.writeInt(u32, @intCast(self.modules.items.len));
+
+        for (self.modules.items, 0..) |module, mi| {
+            try self.writeStr(module.name);
+
+            try self.writeInt(u32, @intCast(module.words.items.len));
+            for (module.words.items, 0..) |w, wi| {
+                try self.writeEntry(.{ .module = @intCast(mi), .word = @intCast(wi) }, w);
+            }
+
+            try self.writeInt(u32, @intCast(module.variables.count()));
+            var var_iter = module.variables.iterator();
+            while (var_iter.next()) |entry| {
+                try self.writeStr(entry.key_ptr.*);
+                try self.writeValue(entry.value_ptr.value);
+            }
+
+            try self.writeInt(u32, @intCast(module.imported_tables.items.len));
+            for (module.imported_tables.items) |imported| {
+                try self.writeStr(self.tables.get(imported.table) orelse return ImageError.UnsupportedWord);
+                try self.writeInt(u32, @intCast(imported.word_count));
+            }
+        }
+
+        const app = &interp.app_module;
+        var registrations: u32 = 0;
+        var count_iter = app.module_prefixes.valueIterator();
+        while (count_iter.next()) |prefixes| registrations += @intCast(prefixes.items.len);
+
+        try self.writeInt(u32, registrations);
+        var prefix_iter = app.module_prefixes.iterator();
+        while (prefix_iter.next()) |entry| {
+            for (entry.value_ptr.items) |prefix| {
+                try self.writeStr(entry.key_ptr.*);
+                try self.writeStr(prefix);
+            }
+        }
+    }
+
+    fn writeEntry(self: *Encoder, loc: Loc, w: Word) !void {
+        if (self.defined.get(w.ptr)) |first| {
+            if (first.module != loc.module or first.word != loc.word) {
+                try self.writeKind(EntryKind.alias);
+                return self.writeLoc(first);
+            }
+        }
+
+        if (w.vtable == &DefinitionWord.vtable) {
+            try self.writeKind(EntryKind.definition);
+            try self.writeStr(w.getName());
+            try self.writeBody(@ptrCast(@alignCast(w.ptr)));
+        } else if (w.vtable == &ModuleMemoWord.vtable) {
+            const memo: *ModuleMemoWord = @ptrCast(@alignCast(w.ptr));
+            if (memo.word.vtable != &DefinitionWord.vtable) return ImageError.UnsupportedWord;
+
+            try self.writeKind(EntryKind.memo);
+            try self.writeStr(w.getName());
+            try self.writeBody(@ptrCast(@alignCast(memo.word.ptr)));
+            try self.writeInt(u8, @intFromBool(memo.has_value));
+            if (memo.has_value) try self.writeValue(memo.value);
+        } else if (w.vtable == &ModuleMemoBangWord.vtable) {
+            const bang: *ModuleMemoBangWord = @ptrCast(@alignCast(w.ptr));
+            try self.writeKind(EntryKind.memo_bang);
+            try self.writeStr(bang.name);
+            try self.writeLoc(self.defined.get(bang.memo_word) orelse return ImageError.UnsupportedWord);
+        } else if (w.vtable == &ModuleMemoBangAtWord.vtable) {
+            const bang_at: *ModuleMemoBangAtWord = @ptrCast(@alignCast(w.ptr));
+            try self.writeKind(EntryKind.memo_bang_at);
+            try self.writeStr(bang_at.name);
+            try self.writeLoc(self.defined.get(bang_at.memo_word) orelse return ImageError.UnsupportedWord);
+        } else if (self.natives.get(w.ptr)) |ref| {
+            try self.writeKind(EntryKind.native);
+            try self.writeStr(ref.module);
+            try self.writeStr(ref.word);
+        } else {
+            return ImageError.UnsupportedWord;
+        }
+    }
+
+    fn writeBody(self: *Encoder, def: *const DefinitionWord) !void {
+        // Error handlers are Zig function pointers
+        if (def.error_handlers.items.len > 0) return ImageError.UnsupportedWord;
+
+        try self.writeInt(u32, @intCast(def.words.items.len));
+        for (def.words.items) |w| {
+            if (w.vtable == &PushValueWord.vtable) {
+                const push: *const PushValueWord = @ptrCast(@alignCast(w.ptr));
+                try self.writeKind(ItemKind.push);
+                try self.writeStr(push.name);
+                try self.writeValue(push.value);
+            } else if (self.defined.get(w.ptr)) |loc| {
+                try self.writeKind(ItemKind.local);
+                try self.writeLoc(loc);
+            } else if (self.natives.get(w.ptr)) |ref| {
+                try self.writeKind(ItemKind.native);
+                try self.writeStr(ref.module);
+                try self.writeStr(ref.word);
+            } else {
+                return ImageError.UnsupportedWord;
+            }
+        }
+    }
+
+    fn writeValue(self: *Encoder, value: Value) !void {
+        switch (value) {
+            .null_value => try self.writeKind(ValueKind.null),
+            .bool_value => |b| {
+                try self.writeKind(ValueKind.bool);
+                try self.writeInt(u8, @intFromBool(b));
+            },
+            .int_value => |i| {
+                try self.writeKind(ValueKind.int);
+                try self.writeInt(i64, i);
+            },
+            .float_value => |f| {
+                try self.writeKind(ValueKind.float);
+                try self.writeInt(u64, @bitCast(f));
+            },
+            .string_value => |s| {
+                try self.writeKind(ValueKind.string);
+                try self.writeStr(s);
+            },
+            .array_value => |arr| {
+                try self.writeKind(ValueKind.array);
+                try self.writeInt(u32, @intCast(arr.items.len));
+                for (arr.items) |item| try self.writeValue(item);
+            },
+            .record_value => |rec| {
+                try self.writeKind(ValueKind.record);
+                try self.writeInt(u32, @intCast(rec.count()));
+                var iter = rec.iterator();
+                while (iter.next()) |entry| {
+                    try self.writeStr(entry.key_ptr.*);
+                    try self.writeValue(entry.value_ptr.*);
+                }
+            },
+            .datetime_value => |dt| {
+                try self.writeKind(ValueKind.datetime);
+                try self.writeInt(i32, dt.year);
+                try self.out.appendSlice(self.allocator, &.{ dt.month, dt.day, dt.hour, dt.minute, dt.second });
+            },
+            // Handles belong to a remote runtime's session
+            .remote_ref_value => return ImageError.UnsupportedWord,
+        }
+    }
+
+    fn writeKind(self: *Encoder, kind: anytype) !void {
+        try self.out.append(self.allocator, @intFromEnum(kind));
+    }
+
+    fn writeLoc(self: *Encoder, loc: Loc) !void {
+        try self.writeInt(u32, loc.module);
+        try self.writeInt(u32, loc.word);
+    }
+
+    fn writeStr(self: *Encoder, s: []const u8) !void {
+        try self.writeInt(u32, @intCast(s.len));
+        try self.out.appendSlice(self.allocator, s);
+    }
+
+    fn writeInt(self: *Encoder, comptime T: type, v: T) !void {
+        var buf: [@sizeOf(T)]u8 = undefined;
+        std.mem.writeInt(T, &buf, v, .little);
+        try self.out.appendSlice(self.allocator, &buf);
+    }
+
+    fn isDefined(w: Word) bool {
+        return w.vtable == &DefinitionWord.vtable or
+            w.vtable == &ModuleMemoWord.vtable or
+            w.vtable == &ModuleMemoBangWord.vtable or
+            w.vtable == &ModuleMemoBangAtWord.vtable;
+    }
+
+    /// Registered modules whose words all came from Forthic code
+    fn isCodeModule(module: *const Module) bool {
+        if (module.static_words != null) return false;
+        for (module.words.items) |w| {
+            if (!isDefined(w)) return false;
+        }
+        return true;
+    }
+};
+
+// =============================================================================
+// Load
+// =============================================================================
+
+/// A loaded image: owns the mapping and every word it installed
+///
+/// Keep it alive as long as the interpreter runs those words; deinit it
+/// after the interpreter.
+pub const Image = struct {
+    allocator: Allocator,
+    mapping: []align(std.heap.page_size_min) const u8,
+    /// Definitions, literals and word shells
+    arena: *std.heap.ArenaAllocator,
+    /// Code modules the image created (not ones already registered)
+    created: ArrayList(*Module),
+    /// Every memo the image built; their values, cached at load or computed
+    /// since, are freed with the image
+    memos: ArrayList(*ModuleMemoWord),
+
+    const Self = @This();
+
+    /// Install dir/sub_path into interp
+    ///
+    /// interp must have the image's native modules registered. A bad or
+    /// stale image fails before interp changes; running out of memory while
+    /// installing leaves interp unusable.
+    pub fn load(interp: *Interpreter, dir: std.fs.Dir, sub_path: []const u8) !Self {
+        const allocator = interp.allocator;
+
+        const file = try dir.openFile(sub_path, .{});
+        defer file.close();
+        const size = (try file.stat()).size;
+        if (size < magic.len + @sizeOf(u16)) return ImageError.InvalidImage;
+        const mapping = try std.posix.mmap(null, size, std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, file.handle, 0);
+
+        // From here on deinit releases the mapping
+        const arena = allocator.create(std.heap.ArenaAllocator) catch |err| {
+            std.posix.munmap(mapping);
+            return err;
+        };
+        arena.* = std.heap.ArenaAllocator.init(allocator);
+        var self = Self{
+            .allocator = allocator,
+            .mapping = mapping,
+            .arena = arena,
+            .created = .{},
+            .memos = .{},
+        };
+        errdefer {
+            self.unregisterCreated(interp);
+            self.deinit();
+        }
+
+        var decoder = Decoder{ .arena = arena.allocator(), .reader = .{ .bytes = mapping } };
+        const modules = try decoder.decodeImage();
+        try self.link(interp, modules);
+        try self.install(interp, modules, decoder.registrations);
+        return self;
+    }
+
+    pub fn deinit(self: *Self) void {
+        for (self.memos.items) |memo| {
+            if (memo.has_value) memo.value.deinit(self.allocator);
+        }
+        for (self.created.items) |module| {
+            module.deinit();
+            self.allocator.destroy(module);
+        }
+        self.created.deinit(self.allocator);
+        self.memos.deinit(self.allocator);
+        self.arena.deinit();
+        self.allocator.destroy(self.arena);
+        std.posix.munmap(self.mapping);
+    }
+
+    /// Build every word: shells first so bodies can refer forward
+    fn link(self: *Self, interp: *Interpreter, modules: []DecodedModule) !void {
+        const arena = self.arena.allocator();
+
+        for (modules) |*module| {
+            module.words = try arena.alloc(Word, module.entries.len);
+            module.memos = try arena.alloc(?*ModuleMemoWord, module.entries.len);
+            @memset(module.memos, null);
+
+            for (module.entries, 0..) |entry, i| {
+                switch (entry) {
+                    .definition => |def| {
+                        const def_word = try arena.create(DefinitionWord);
+                        def_word.* = DefinitionWord.init(arena, def.name);
+                        module.words[i] = def_word.asWord();
+                    },
+                    .memo => |def| {
+                        const def_word = try arena.create(DefinitionWord);
+                        def_word.* = DefinitionWord.init(arena, def.name);
+                        const memo = try arena.create(ModuleMemoWord);
+                        memo.* = ModuleMemoWord.init(def_word.asWord());
+                        try self.memos.append(self.allocator, memo);
+                        module.memos[i] = memo;
+                        module.words[i] = memo.asWord();
+                    },
+                    .native => |ref| module.words[i] = try findNative(interp, ref),
+                    else => {},
+                }
+            }
+        }
+
+        for (modules) |*module| {
+            for (module.entries, 0..) |entry, i| {
+                switch (entry) {
+                    .alias => |loc| module.words[i] = try wordAt(modules, loc),
+                    .memo_bang => |bang| {
+                        const w = try arena.create(ModuleMemoBangWord);
+                        w.* = ModuleMemoBangWord.init(try memoAt(modules, bang.memo), bang.name);
+                        module.words[i] = w.asWord();
+                    },
+                    .memo_bang_at => |bang| {
+                        const w = try arena.create(ModuleMemoBangAtWord);
+                        w.* = ModuleMemoBangAtWord.init(try memoAt(modules, bang.memo), bang.name);
+                        module.words[i] = w.asWord();
+                    },
+                    else => {},
+                }
+            }
+        }
+
+        for (modules) |*module| {
+            for (module.entries, 0..) |entry, i| {
+                const body = switch (entry) {
+                    .definition => |def| def.body,
+                    .memo => |def| def.body,
+                    else => continue,
+                };
+                const def_word: *DefinitionWord = if (module.memos[i]) |memo|
+                    @ptrCast(@alignCast(memo.word.ptr))
+                else
+                    @ptrCast(@alignCast(module.words[i].ptr));
+
+                try def_word.words.ensureTotalCapacity(arena, body.len);
+                for (body) |item| {
+                    const w = switch (item) {
+                        .push => |push| blk: {
+                            const push_word = try arena.create(PushValueWord);
+                            push_word.* = PushValueWord.init(push.name, push.value);
+                            break :blk push_word.asWord();
+                        },
+                        .local => |loc| try wordAt(modules, loc),
+                        .native => |ref| try findNative(interp, ref),
+                    };
+                    def_word.words.appendAssumeCapacity(w);
+                }
+            }
+        }
+    }
+
+    /// Undo what a failed install registered of the modules it created, so
+    /// that deinit can free them
+    fn unregisterCreated(self: *Self, interp: *Interpreter) void {
+        const app = &interp.app_module;
+        for (self.created.items) |module| {
+            if (interp.registered_modules.get(module.name)) |registered| {
+                if (registered == module) _ = interp.registered_modules.remove(module.name);
+            }
+            const app_entry = app.modules.get(module.name) orelse continue;
+            if (app_entry != module) continue;
+            _ = app.modules.remove(module.name);
+            if (app.module_prefixes.fetchRemove(module.name)) |entry| {
+                var prefixes = entry.value;
+                prefixes.deinit(app.allocator);
+            }
+        }
+    }
+
+    fn install(self: *Self, interp: *Interpreter, modules: []DecodedModule, registrations: []const Registration) !void {
+        const allocator = self.allocator;
+
+        // Everything that can fail on bad input happens before interp changes
+        for (registrations) |reg| {
+            if (findImageModule(modules, reg.module) == null and !interp.registered_modules.contains(reg.module)) {
+                return error.UnknownModule;
+            }
+        }
+        for (modules) |module| {
+            for (module.imports) |imported| _ = try findTable(interp, imported.name);
+        }
+
+        try self.created.ensureTotalCapacity(allocator, modules.len);
+        const targets = try self.arena.allocator().alloc(*Module, modules.len);
+        for (modules, targets, 0..) |module, *target, mi| {
+            if (mi == 0) {
+                target.* = &interp.app_module;
+            } else if (interp.registered_modules.get(module.name)) |existing| {
+                target.* = existing;
+            } else {
+                const created = try allocator.create(Module);
+                created.* = Module.init(allocator, module.name, "");
+                self.created.appendAssumeCapacity(created);
+                created.setInterp(interp);
+                try interp.registerModule(created);
+                target.* = created;
+            }
+        }
+
+        for (modules, targets) |module, target| {
+            const base = target.words.items.len;
+            try target.words.appendSlice(allocator, module.words);
+            for (module.imports) |imported| {
+                try target.imported_tables.append(allocator, .{
+                    .table = findTable(interp, imported.name) catch unreachable,
+                    .word_count = base + imported.word_count,
+                });
+            }
+            for (module.memos, module.entries) |maybe_memo, entry| {
+                const memo = maybe_memo orelse continue;
+                const value = entry.memo.value orelse continue;
+                memo.value = try value.clone(allocator);
+                memo.has_value = true;
+            }
+            for (module.variables) |variable| {
+                var value = try variable.value.clone(allocator);
+                errdefer value.deinit(allocator);
+                try target.setVariable(variable.name, value);
+            }
+        }
+
+        for (registrations) |reg| {
+            const module = if (findImageModule(modules, reg.module)) |mi|
+                targets[mi]
+            else
+                interp.registered_modules.get(reg.module).?;
+            try interp.app_module.registerModule(reg.module, reg.prefix, module);
+        }
+    }
+
+    fn findTable(interp: *Interpreter, module_name: []const u8) !*const WordTable {
+        const module = try interp.findModule(module_name);
+        return module.static_words orelse error.UnknownModule;
+    }
+
+    fn findNative(interp: *Interpreter, ref: NativeRef) !Word {
+        const module = try interp.findModule(ref.module);
+        return module.findDictionaryWord(ref.word) orelse error.UnknownWord;
+    }
+
+    fn wordAt(modules: []DecodedModule, loc: Loc) !Word {
+        if (loc.module >= modules.len) return ImageError.InvalidImage;
+        const module = modules[loc.module];
+        if (loc.word >= module.entries.len) return ImageError.InvalidImage;
+        return switch (module.entries[loc.word]) {
+            .definition, .memo, .native, .memo_bang, .memo_bang_at => module.words[loc.word],
+            // The encoder always points at a word's first occurrence
+            .alias => ImageError.InvalidImage,
+        };
+    }
+
+    fn memoAt(modules: []DecodedModule, loc: Loc) !*ModuleMemoWord {
+        if (loc.module >= modules.len) return ImageError.InvalidImage;
+        const module = modules[loc.module];
+        if (loc.word >= module.entries.len) return ImageError.InvalidImage;
+        return module.memos[loc.word] orelse ImageError.InvalidImage;
+    }
+
+    fn findImageModule(modules: []const DecodedModule, name: []const u8) ?usize {
+        for (modules[1..], 1..) |module, mi| {
+            if (std.mem.eql(u8, module.name, name)) return mi;
+        }
+        return null;
+    }
+};
+
+const Item = union(enum) {
+    push: struct { name: []const u8, value: Value },
+    local: Loc,
+    native: NativeRef,
+};
+
+const Entry = union(enum) {
+    native: NativeRef,
+    alias: Loc,
+    definition: struct { name: []const u8, body: []Item },
+    memo: struct { name: []const u8, body: []Item, value: ?Value },
+    memo_bang: struct { name: []const u8, memo: Loc },
+    memo_bang_at: struct { name: []const u8, memo: Loc },
+};
+
+const DecodedModule = struct {
+    name: []const u8,
+    entries: []Entry,
+    variables: []DecodedVariable,
+    /// Modules whose word tables were imported, in order
+    imports: []const DecodedImport,
+    /// Filled in by Image.link
+    words: []Word = undefined,
+    memos: []?*ModuleMemoWord = undefined,
+};
+
+const DecodedImport = struct {
+    name: []const u8,
+    /// Words the module had when the table was imported
+    word_count: usize,
+};
+
+const DecodedVariable = struct {
+    name: []const u8,
+    value: Value,
+};
+
+const Registration = struct {
+    module: []const u8,
+    prefix: []const u8,
+};
+
+/// Decodes into arena-allocated structures; strings point into the mapping
+const Decoder = struct {
+    arena: Allocator,
+    reader: Reader,
+    registrations: []const Registration = &.{},
+
+    fn decodeImage(self: *Decoder) ![]DecodedModule {
+        const r = &self.reader;
+        if (!std.mem.eql(u8, try r.take(magic.len), magic)) return ImageError.InvalidImage;
+        if (try r.int(u16) != format_version) return ImageError.InvalidImage;
+
+        const modules = try self.arena.alloc(DecodedModule, try r.count());
+        if (modules.len == 0) return ImageError.InvalidImage;
+        for (modules) |*module| {
+            module.* = .{ .name = try r.str(), .entries = undefined, .variables = undefined, .imports = undefined };
+
+            module.entries = try self.arena.alloc(Entry, try r.count());
+            for (module.entries) |*entry| entry.* = try self.decodeEntry();
+
+            module.variables = try self.arena.alloc(DecodedVariable, try r.count());
+            for (module.variables) |*variable| {
+                variable.* = .{ .name = try r.str(), .value = try self.decodeValue() };
+            }
+
+            const imports = try self.arena.alloc(DecodedImport, try r.count());
+            for (imports) |*imported| {
+                imported.* = .{ .name = try r.str(), .word_count = try r.int(u32) };
+                if (imported.word_count > module.entries.len) return ImageError.InvalidImage;
+            }
+            module.imports = imports;
+        }
+
+        const registrations = try self.arena.alloc(Registration, try r.count());
+        for (registrations) |*reg| {
+            reg.* = .{ .module = try r.str(), .prefix = try r.str() };
+        }
+        self.registrations = registrations;
+
+        if (r.pos != r.bytes.len) return ImageError.InvalidImage;
+        return modules;
+    }
+
+    fn decodeEntry(self: *Decoder) !Entry {
+        const r = &self.reader;
+        return switch (try r.kind(EntryKind)) {
+            .native => .{ .native = .{ .module = try r.str(), .word = try r.str() } },
+            .alias => .{ .alias = try r.loc() },
+            .definition => .{ .definition = .{ .name = try r.str(), .body = try self.decodeBody() } },
+            .memo => .{ .memo = .{
+                .name = try r.str(),
+                .body = try self.decodeBody(),
+                .value = if (try r.int(u8) != 0) try self.decodeValue() else null,
+            } },
+            .memo_bang => .{ .memo_bang = .{ .name = try r.str(), .memo = try r.loc() } },
+            .memo_bang_at => .{ .memo_bang_at = .{ .name = try r.str(), .memo = try r.loc() } },
+        };
+    }
+
+    fn decodeBody(self: *Decoder) ![]Item {
+        const r = &self.reader;
+        const items = try self.arena.alloc(Item, try r.count());
+        for (items) |*item| {
+            item.* = switch (try r.kind(ItemKind)) {
+                .push => .{ .push = .{ .name = try r.str(), .value = try self.decodeValue() } },
+                .local => .{ .local = try r.loc() },
+                .native => .{ .native = .{ .module = try r.str(), .word = try r.str() } },
+            };
+        }
+        return items;
+    }
+
+    /// Literal values: PushValueWord clones on execute, so strings and
+    /// record keys stay in the mapping
+    fn decodeValue(self: *Decoder) !Value {
+        const r = &self.reader;
+        return switch (try r.kind(ValueKind)) {
+            .null => Value.initNull(),
+            .bool => Value.initBool(try r.int(u8) != 0),
+            .int => Value.initInt(try r.int(i64)),
+            .float => Value.initFloat(@bitCast(try r.int(u64))),
+            .string => Value.initString(try r.str()),
+            .array => blk: {
+                var arr: ArrayList(Value) = .{};
+                const n = try r.count();
+                try arr.ensureTotalCapacity(self.arena, n);
+                for (0..n) |_| arr.appendAssumeCapacity(try self.decodeValue());
+                break :blk .{ .array_value = arr };
+            },
+            .record => blk: {
+                var rec = std.StringHashMap(Value).init(self.arena);
+                const n = try r.count();
+                try rec.ensureTotalCapacity(@intCast(n));
+                for (0..n) |_| {
+                    const key = try r.str();
+                    rec.putAssumeCapacity(key, try self.decodeValue());
+                }
+                break :blk .{ .record_value = rec };
+            },
+            .datetime => blk: {
+                const year = try r.int(i32);
+                const rest = try r.take(5);
+                break :blk Value.initDateTime(.{
+                    .year = year,
+                    .month = rest[0],
+                    .day = rest[1],
+                    .hour = rest[2],
+                    .minute = rest[3],
+                    .second = rest[4],
+                });
+            },
+        };
+    }
+};
+
+/// Bounds-checked little-endian reads; any overrun is InvalidImage
+const Reader = struct {
+    bytes: []const u8,
+    pos: usize = 0,
+
+    fn take(self: *Reader, n: usize) ![]const u8 {
+        if (n > self.bytes.len - self.pos) return ImageError.InvalidImage;
+        const out = self.bytes[self.pos .. self.pos + n];
+        self.pos += n;
+        return out;
+    }
+
+    fn int(self: *Reader, comptime T: type) !T {
+        const bytes = try self.take(@sizeOf(T));
+        return std.mem.readInt(T, bytes[0..@sizeOf(T)], .little);
+    }
+
+    /// An element count; each element takes at least one byte, which keeps
+    /// a corrupt count from sizing a huge allocation
+    fn count(self: *Reader) !usize {
+        const n = try self.int(u32);
+        if (n > self.bytes.len - self.pos) return ImageError.InvalidImage;
+        return n;
+    }
+
+    fn str(self: *Reader) ![]const u8 {
+        return self.take(try self.int(u32));
+    }
+
+    fn kind(self: *Reader, comptime E: type) !E {
+        const tag = try self.int(u8);
+        if (tag >= @typeInfo(E).@"enum".fields.len) return ImageError.InvalidImage;
+        return @enumFromInt(tag);
+    }
+
+    fn loc(self: *Reader) !Loc {
+        return .{ .module = try self.int(u32), .word = try self.int(u32) };
+    }
+};
@@ -6,7 +6,9 @@ const StringHashMap = std.StringHashMap;
 const errors = @import("errors.zig");
 const stack_mod = @import("stack.zig");
 const Stack = stack_mod.Stack;
-const Value = @import("value.zig").Value;
+const value_mod = @import("value.zig");
+const Value = value_mod.Value;
+const RemoteRef = value_mod.RemoteRef;
 const module_mod = @import("module.zig");
 const Module = module_mod.Module;
 const word_mod = @import("word.zig");
@@ -26,6 +28,101 @@ const LiteralValue = literals.LiteralValue;
 
 pub const LiteralHandler = *const fn (allocator: Allocator, str: []const u8) anyerror!?LiteralValue;
 
+/// ============================================================================
+/// Remote Value Handles
+/// ============================================================================
+
+/// Hooks installed by the gRPC RuntimeManager so that remote value handles
+/// stay opaque until a local word inspects them
+pub const RemoteRefHooks = struct {
+    ctx: *anyopaque,
+    /// Fetch the value behind a handle (caller owns the result)
+    resolve: *const fn (ctx: *anyopaque, ref: RemoteRef) anyerror!Value,
+    /// Record handles that just arrived from a remote runtime
+    track: *const fn (ctx: *anyopaque, values: []const Value) anyerror!void,
+};
+
+/// ============================================================================
+/// Reset Mark
+/// ============================================================================
+
+/// Interpreter state to return to with Interpreter.reset (see InterpreterPool)
+pub const Mark = struct {
+    /// The app module, every registered module and every module they
+    /// contain, with their word counts, imports and variables
+    modules: []ModuleMark,
+    /// Size of registered_modules at the mark
+    registered_count: usize,
+    /// Sizes of created_words and created_modules at the mark
+    created_word_count: usize,
+    created_module_count: usize,
+    /// Memo words of those modules, with their cached values
+    memos: []SavedMemo,
+
+    pub const ModuleMark = struct {
+        module: *Module,
+        word_count: usize,
+        exportable_count: usize,
+        imported_count: usize,
+        /// Prefix counts of the modules this one had registered
+        prefixes: []SavedPrefixes,
+        /// Variables, names and values owned by the mark
+        variables: []SavedVariable,
+
+        fn deinit(self: *ModuleMark, allocator: Allocator) void {
+            for (self.prefixes) |saved| allocator.free(saved.name);
+            allocator.free(self.prefixes);
+            for (self.variables) |*variable| {
+                allocator.free(variable.name);
+                variable.value.deinit(allocator);
+            }
+            allocator.free(self.variables);
+        }
+    };
+
+    pub const SavedPrefixes = struct {
+        name: []u8,
+        count: usize,
+    };
+
+    pub const SavedVariable = struct {
+        name: []u8,
+        value: Value,
+    };
+
+    pub const SavedMemo = struct {
+        memo: *module_mod.ModuleMemoWord,
+        has_value: bool,
+        /// Owned by the mark when has_value
+        value: Value,
+    };
+
+    pub fn deinit(self: *Mark, allocator: Allocator) void {
+        for (self.modules) |*module_mark| {
+            module_mark.deinit(allocator);
+        }
+        allocator.free(self.modules);
+        for (self.memos) |*saved| {
+            if (saved.has_value) saved.value.deinit(allocator);
+        }
+        allocator.free(self.memos);
+    }
+
+    fn find(self: *const Mark, module: *const Module) bool {
+        for (self.modules) |module_mark| {
+            if (module_mark.module == module) return true;
+        }
+        return false;
+    }
+
+    fn findPrefixes(prefixes: []const SavedPrefixes, name: []const u8) ?usize {
+        for (prefixes) |saved| {
+            if (std.mem.eql(u8, saved.name, name)) return saved.count;
+        }
+        return null;
+    }
+};
+
 /// ============================================================================
 /// Interpreter - Core Forthic interpreter
 /// ============================================================================
@@ -40,6 +137,17 @@ pub const Interpreter = struct {
     is_compiling: bool,
     is_memo_definition: bool,
     cur_definition: ?*DefinitionWord,
+    /// Words the compiler allocated (definitions, memo words, and literals
+    /// compiled into definitions) and modules created by "{name", in
+    /// creation order. Freed by deinit, or by reset past a mark
+    created_words: ArrayList(Word),
+    created_modules: ArrayList(*Module),
+    remote_ref_hooks: ?RemoteRefHooks,
+    /// Set once trackRemoteRefs has seen a handle. Until then no array or
+    /// record can hold one, so stackPop and stackPeek do not walk them
+    holds_remote_refs: bool,
+    /// Word executions left before InstructionBudgetExceeded (null = unlimited)
+    instruction_budget: ?u64,
     allocator: Allocator,
 
     pub fn init(allocator: Allocator) !Interpreter {
@@ -55,6 +163,11 @@ pub const Interpreter = struct {
             .is_compiling = false,
             .is_memo_definition = false,
             .cur_definition = null,
+            .created_words = ArrayList(Word){},
+            .created_modules = ArrayList(*Module){},
+            .remote_ref_hooks = null,
+            .holds_remote_refs = false,
+            .instruction_budget = null,
             .allocator = allocator,
         };
 
@@ -73,6 +186,9 @@ pub const Interpreter = struct {
 
     pub fn deinit(self: *Interpreter) void {
         self.stack.deinit();
+        self.destroyCreatedSince(0, 0);
+        self.created_words.deinit(self.allocator);
+        self.created_modules.deinit(self.allocator);
         self.app_module.deinit();
         self.module_stack.deinit(self.allocator);
         self.registered_modules.deinit();
@@ -88,11 +204,21 @@ pub const Interpreter = struct {
         try self.stack.push(value);
     }
 
+    /// Pop a value for inspection, materializing remote value handles first
+    /// (nested ones too - see materializeRemoteRefs)
     pub fn stackPop(self: *Interpreter) !Value {
+        try self.materializeTop();
+        return try self.stack.pop();
+    }
+
+    /// Pop a value as-is; remote value handles stay opaque
+    /// For words that only move values around (POP, DUP, SWAP, !, ...)
+    pub fn stackPopRaw(self: *Interpreter) !Value {
         return try self.stack.pop();
     }
 
-    pub fn stackPeek(self: *const Interpreter) !*const Value {
+    pub fn stackPeek(self: *Interpreter) !*const Value {
+        try self.materializeTop();
         return try self.stack.peek();
     }
 
@@ -100,6 +226,369 @@ pub const Interpreter = struct {
         return &self.stack;
     }
 
+    // ========================================================================
+    // Instruction Budget
+    // ========================================================================
+
+    /// Bound the words the next request may execute, nested words included,
+    /// so a runaway loop fails instead of holding a server thread
+    pub fn setInstructionBudget(self: *Interpreter, budget: ?u64) void {
+        self.instruction_budget = budget;
+    }
+
+    pub fn chargeInstruction(self: *Interpreter) !void {
+        if (self.instruction_budget) |*left| {
+            if (left.* == 0) return errors.ForthicErrorType.InstructionBudgetExceeded;
+            left.* -= 1;
+        }
+    }
+
+    // ========================================================================
+    // Mark and Reset
+    // ========================================================================
+
+    /// Record the dictionary as it is now, typically right after setup
+    pub fn mark(self: *Interpreter) !Mark {
+        var modules: ArrayList(*Module) = .{};
+        defer modules.deinit(self.allocator);
+        try self.collectModules(&modules);
+
+        const module_marks = try self.allocator.alloc(Mark.ModuleMark, modules.items.len);
+        var marked: usize = 0;
+        errdefer {
+            for (module_marks[0..marked]) |*module_mark| module_mark.deinit(self.allocator);
+            self.allocator.free(module_marks);
+        }
+
+        for (modules.items) |module| {
+            module_marks[marked] = try self.markModule(module);
+            marked += 1;
+        }
+
+        return Mark{
+            .modules = module_marks,
+            .registered_count = self.registered_modules.count(),
+            .created_word_count = self.created_words.items.len,
+            .created_module_count = self.created_modules.items.len,
+            .memos = try self.markMemos(modules.items),
+        };
+    }
+
+    /// The app module, every registered module and every module created
+    /// inside one of them, each once
+    fn collectModules(self: *Interpreter, out: *ArrayList(*Module)) !void {
+        try out.append(self.allocator, &self.app_module);
+        var registered = self.registered_modules.valueIterator();
+        while (registered.next()) |module| {
+            if (!containsModule(out.items, module.*)) try out.append(self.allocator, module.*);
+        }
+
+        var i: usize = 0;
+        while (i < out.items.len) : (i += 1) {
+            var nested = out.items[i].modules.valueIterator();
+            while (nested.next()) |module| {
+                if (!containsModule(out.items, module.*)) try out.append(self.allocator, module.*);
+            }
+        }
+    }
+
+    fn containsModule(modules: []const *Module, module: *const Module) bool {
+        for (modules) |candidate| {
+            if (candidate == module) return true;
+        }
+        return false;
+    }
+
+    fn markModule(self: *Interpreter, module: *Module) !Mark.ModuleMark {
+        const prefixes = try self.allocator.alloc(Mark.SavedPrefixes, module.module_prefixes.count());
+        var saved_prefixes: usize = 0;
+        errdefer {
+            for (prefixes[0..saved_prefixes]) |saved| self.allocator.free(saved.name);
+            self.allocator.free(prefixes);
+        }
+
+        var prefix_iter = module.module_prefixes.iterator();
+        while (prefix_iter.next()) |entry| {
+            prefixes[saved_prefixes] = .{
+                .name = try self.allocator.dupe(u8, entry.key_ptr.*),
+                .count = entry.value_ptr.items.len,
+            };
+            saved_prefixes += 1;
+        }
+
+        const variables = try self.allocator.alloc(Mark.SavedVariable, module.variables.count());
+        var saved_variables: usize = 0;
+        errdefer {
+            for (variables[0..saved_variables]) |*variable| {
+                self.allocator.free(variable.name);
+                variable.value.deinit(self.allocator);
+            }
+            self.allocator.free(variables);
+        }
+
+        var var_iter = module.variables.valueIterator();
+        while (var_iter.next()) |variable| {
+            const name = try self.allocator.dupe(u8, variable.name);
+            errdefer self.allocator.free(name);
+            variables[saved_variables] = .{ .name = name, .value = try variable.value.clone(self.allocator) };
+            saved_variables += 1;
+        }
+
+        return .{
+            .module = module,
+            .word_count = module.words.items.len,
+            .exportable_count = module.exportable.items.len,
+            .imported_count = module.imported_tables.items.len,
+            .prefixes = prefixes,
+            .variables = variables,
+        };
+    }
+
+    fn markMemos(self: *Interpreter, modules: []const *Module) ![]Mark.SavedMemo {
+        var memos: ArrayList(Mark.SavedMemo) = .{};
+        errdefer {
+            for (memos.items) |*saved| {
+                if (saved.has_value) saved.value.deinit(self.allocator);
+            }
+            memos.deinit(self.allocator);
+        }
+
+        for (modules) |module| {
+            words: for (module.words.items) |w| {
+                if (w.vtable != &module_mod.ModuleMemoWord.vtable) continue;
+                const memo: *module_mod.ModuleMemoWord = @ptrCast(@alignCast(w.ptr));
+
+                // Imported memos show up in more than one module
+                for (memos.items) |saved| {
+                    if (saved.memo == memo) continue :words;
+                }
+
+                var value = if (memo.has_value) try memo.value.clone(self.allocator) else Value.initNull();
+                errdefer value.deinit(self.allocator);
+                try memos.append(self.allocator, .{ .memo = memo, .has_value = memo.has_value, .value = value });
+            }
+        }
+
+        return memos.toOwnedSlice(self.allocator);
+    }
+
+    /// Return to a mark taken on this interpreter, in O(stack size) plus
+    /// whatever the last run added and the marked variables and memos:
+    /// clears the stack, drops leftover tokenizers and any unfinished
+    /// definition, restores the module stack to the app module, truncates
+    /// each marked module to its marked words, imports and module prefixes,
+    /// unregisters and frees modules and words created since, and restores
+    /// the variables and memo values of every marked module.
+    pub fn reset(self: *Interpreter, m: *const Mark) !void {
+        self.stack.clear();
+
+        for (self.tokenizer_stack.items) |tokenizer| {
+            tokenizer.deinit();
+            self.allocator.destroy(tokenizer);
+        }
+        self.tokenizer_stack.clearRetainingCapacity();
+
+        if (self.cur_definition) |definition| {
+            definition.deinit();
+            self.allocator.destroy(definition);
+        }
+        self.cur_definition = null;
+        self.is_compiling = false;
+        self.is_memo_definition = false;
+        self.instruction_budget = null;
+
+        self.module_stack.shrinkRetainingCapacity(1);
+
+        for (m.modules) |*module_mark| {
+            module_mark.module.words.shrinkRetainingCapacity(module_mark.word_count);
+            module_mark.module.exportable.shrinkRetainingCapacity(module_mark.exportable_count);
+            module_mark.module.imported_tables.shrinkRetainingCapacity(module_mark.imported_count);
+            try self.restorePrefixes(module_mark);
+            try restoreVariables(module_mark);
+        }
+
+        if (self.registered_modules.count() != m.registered_count) {
+            try self.unregisterModulesSince(m);
+        }
+
+        // Nothing marked refers to them any more
+        self.destroyCreatedSince(m.created_word_count, m.created_module_count);
+
+        try self.restoreMemos(m);
+    }
+
+    /// Free created_words and created_modules past the given counts
+    fn destroyCreatedSince(self: *Interpreter, word_count: usize, module_count: usize) void {
+        for (self.created_modules.items[module_count..]) |module| {
+            module.deinit();
+            self.allocator.destroy(module);
+        }
+        self.created_modules.shrinkRetainingCapacity(module_count);
+
+        for (self.created_words.items[word_count..]) |w| {
+            self.destroyCreatedWord(w);
+        }
+        self.created_words.shrinkRetainingCapacity(word_count);
+    }
+
+    fn destroyCreatedWord(self: *Interpreter, w: Word) void {
+        if (w.vtable == &DefinitionWord.vtable) {
+            const definition: *DefinitionWord = @ptrCast(@alignCast(w.ptr));
+            definition.deinit();
+            self.allocator.destroy(definition);
+        } else if (w.vtable == &PushValueWord.vtable) {
+            const push_word: *PushValueWord = @ptrCast(@alignCast(w.ptr));
+            w.deinit(self.allocator);
+            self.allocator.destroy(push_word);
+        } else if (w.vtable == &module_mod.ModuleMemoWord.vtable) {
+            const memo: *module_mod.ModuleMemoWord = @ptrCast(@alignCast(w.ptr));
+            w.deinit(self.allocator);
+            self.allocator.destroy(memo);
+        } else if (w.vtable == &module_mod.ModuleMemoBangWord.vtable) {
+            const bang: *module_mod.ModuleMemoBangWord = @ptrCast(@alignCast(w.ptr));
+            self.allocator.free(bang.name);
+            self.allocator.destroy(bang);
+        } else if (w.vtable == &module_mod.ModuleMemoBangAtWord.vtable) {
+            const bangat: *module_mod.ModuleMemoBangAtWord = @ptrCast(@alignCast(w.ptr));
+            self.allocator.free(bangat.name);
+            self.allocator.destroy(bangat);
+        }
+    }
+
+    fn unregisterModulesSince(self: *Interpreter, m: *const Mark) !void {
+        var added: ArrayList(*Module) = .{};
+        defer added.deinit(self.allocator);
+
+        var module_iter = self.registered_modules.valueIterator();
+        while (module_iter.next()) |module| {
+            if (!m.find(module.*)) try added.append(self.allocator, module.*);
+        }
+
+        for (added.items) |module| {
+            _ = self.registered_modules.remove(module.name);
+        }
+    }
+
+    /// Forget modules registered in a marked module since the mark, and
+    /// prefixes added for the ones it already had
+    fn restorePrefixes(self: *Interpreter, module_mark: *const Mark.ModuleMark) !void {
+        const module = module_mark.module;
+        var added: ArrayList([]const u8) = .{};
+        defer added.deinit(self.allocator);
+
+        var iter = module.module_prefixes.iterator();
+        while (iter.next()) |entry| {
+            if (Mark.findPrefixes(module_mark.prefixes, entry.key_ptr.*)) |count| {
+                entry.value_ptr.shrinkRetainingCapacity(count);
+            } else {
+                try added.append(self.allocator, entry.key_ptr.*);
+            }
+        }
+
+        for (added.items) |name| {
+            _ = module.modules.remove(name);
+            if (module.module_prefixes.fetchRemove(name)) |entry| {
+                var prefixes = entry.value;
+                prefixes.deinit(module.allocator);
+            }
+        }
+    }
+
+    fn restoreVariables(module_mark: *const Mark.ModuleMark) !void {
+        const module = module_mark.module;
+        const variables = &module.variables;
+        if (variables.count() == 0 and module_mark.variables.len == 0) return;
+
+        var iter = variables.iterator();
+        while (iter.next()) |entry| {
+            module.allocator.free(entry.key_ptr.*);
+            entry.value_ptr.deinit(module.allocator);
+        }
+        variables.clearRetainingCapacity();
+
+        for (module_mark.variables) |*saved| {
+            var value = try saved.value.clone(module.allocator);
+            errdefer value.deinit(module.allocator);
+            try module.setVariable(saved.name, value);
+        }
+    }
+
+    fn restoreMemos(self: *Interpreter, m: *const Mark) !void {
+        for (m.memos) |*saved| {
+            const memo = saved.memo;
+            if (memo.has_value) memo.value.deinit(self.allocator);
+            memo.has_value = false;
+            memo.value = Value.initNull();
+
+            if (saved.has_value) {
+                memo.value = try saved.value.clone(self.allocator);
+                memo.has_value = true;
+            }
+        }
+    }
+
+    // ========================================================================
+    // Remote Value Handles
+    // ========================================================================
+
+    pub fn setRemoteRefHooks(self: *Interpreter, hooks: ?RemoteRefHooks) void {
+        self.remote_ref_hooks = hooks;
+    }
+
+    /// Replace remote value handles with the values they refer to, including
+    /// handles nested in arrays and records. Handles owned by keep_runtime
+    /// are left opaque. No-op when no hooks are installed
+    pub fn materializeRemoteRefs(self: *Interpreter, value: *Value, keep_runtime: ?[]const u8) anyerror!void {
+        const hooks = self.remote_ref_hooks orelse return;
+
+        switch (value.*) {
+            .remote_ref_value => |ref| {
+                if (keep_runtime) |runtime| {
+                    if (std.mem.eql(u8, ref.runtime, runtime)) return;
+                }
+                const resolved = try hooks.resolve(hooks.ctx, ref);
+                value.deinit(self.allocator);
+                value.* = resolved;
+            },
+            .array_value => |*arr| {
+                for (arr.items) |*item| try self.materializeRemoteRefs(item, keep_runtime);
+            },
+            .record_value => |*rec| {
+                var iter = rec.valueIterator();
+                while (iter.next()) |item| try self.materializeRemoteRefs(item, keep_runtime);
+            },
+            else => {},
+        }
+    }
+
+    fn materializeTop(self: *Interpreter) !void {
+        const items = self.stack.items.items;
+        if (items.len == 0) return;
+        const top = &items[items.len - 1];
+        switch (top.*) {
+            .remote_ref_value => {},
+            .array_value, .record_value => if (!self.holds_remote_refs) return,
+            else => return,
+        }
+        try self.materializeRemoteRefs(top, null);
+    }
+
+    /// Report values received from a remote runtime so their handles are
+    /// tracked. Values holding handles must arrive through here: stackPop
+    /// only looks inside arrays and records once a handle has been seen.
+    pub fn trackRemoteRefs(self: *Interpreter, values: []const Value) !void {
+        const hooks = self.remote_ref_hooks orelse return;
+        if (!self.holds_remote_refs) {
+            for (values) |*value| {
+                if (value.containsRemoteRef()) {
+                    self.holds_remote_refs = true;
+                    break;
+                }
+            }
+        }
+        try hooks.track(hooks.ctx, values);
+    }
+
     // ========================================================================
     // Module Operations
     // ========================================================================
@@ -248,6 +737,7 @@ pub const Interpreter = struct {
     }
 
     fn handleStringToken(self: *Interpreter, token: Token) !void {
+        try self.reserveTempWord();
         const str_copy = try self.allocator.dupe(u8, token.string);
         errdefer self.allocator.free(str_copy);
 
@@ -262,13 +752,11 @@ pub const Interpreter = struct {
         try self.handleWord(word, token.location);
 
         // Clean up temporary word if not compiling into definition
-        if (!self.is_compiling) {
-            word.deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
-        }
+        self.releaseTempWord(word);
     }
 
     fn handleDotSymbolToken(self: *Interpreter, token: Token) !void {
+        try self.reserveTempWord();
         const str_copy = try self.allocator.dupe(u8, token.string);
         errdefer self.allocator.free(str_copy);
 
@@ -283,13 +771,12 @@ pub const Interpreter = struct {
         try self.handleWord(word, token.location);
 
         // Clean up temporary word if not compiling into definition
-        if (!self.is_compiling) {
-            word.deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
-        }
+        self.releaseTempWord(word);
     }
 
     fn handleStartArrayToken(self: *Interpreter, token: Token) !void {
+        try self.reserveTempWord();
+
         // Push a marker value onto the stack to indicate start of array
         // TODO: Use a proper marker type instead of null
         const value = Value.initNull();
@@ -303,10 +790,7 @@ pub const Interpreter = struct {
         try self.handleWord(word, token.location);
 
         // Clean up temporary word if not compiling into definition
-        if (!self.is_compiling) {
-            word.deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
-        }
+        self.releaseTempWord(word);
     }
 
     fn handleEndArrayToken(self: *Interpreter, token: Token) !void {
@@ -314,7 +798,7 @@ pub const Interpreter = struct {
         var items: std.ArrayList(Value) = .{};
 
         while (true) {
-            const item = try self.stackPop();
+            const item = try self.stackPopRaw();
 
             // Check if it's a START_ARRAY marker (null value)
             // TODO: Use a proper marker type instead of relying on null
@@ -346,8 +830,10 @@ pub const Interpreter = struct {
         var module = self.curModule().findModule(module_name);
         if (module == null) {
             // Create new module
+            try self.created_modules.ensureUnusedCapacity(self.allocator, 1);
             const new_module_ptr = try self.allocator.create(Module);
             new_module_ptr.* = Module.init(self.allocator, module_name, "");
+            self.created_modules.appendAssumeCapacity(new_module_ptr);
             try self.curModule().registerModule(module_name, module_name, new_module_ptr);
 
             // If we're at app module, also register with interpreter
@@ -398,36 +884,56 @@ pub const Interpreter = struct {
             return errors.ForthicErrorType.ExtraSemicolon;
         }
 
+        // Allocate everything first: once the definition is in
+        // created_words, cur_definition no longer owns it
+        try self.created_words.ensureUnusedCapacity(self.allocator, 4);
+        const definition = self.cur_definition.?;
+
         if (self.is_memo_definition) {
             // Add memo words
-            const def_word = self.cur_definition.?.asWord();
-            var memo_word_ptr = try self.allocator.create(module_mod.ModuleMemoWord);
-            memo_word_ptr.* = module_mod.ModuleMemoWord.init(def_word);
+            const def_word = definition.asWord();
+            const memo_word_ptr, const bang_word_ptr, const bangat_word_ptr = blk: {
+                const memo_word_ptr = try self.allocator.create(module_mod.ModuleMemoWord);
+                errdefer self.allocator.destroy(memo_word_ptr);
+                memo_word_ptr.* = module_mod.ModuleMemoWord.init(def_word);
+
+                // Create refresh variants
+                const name = definition.name;
+                const bang_name = try std.fmt.allocPrint(self.allocator, "{s}!", .{name});
+                errdefer self.allocator.free(bang_name);
+                const bangat_name = try std.fmt.allocPrint(self.allocator, "{s}!@", .{name});
+                errdefer self.allocator.free(bangat_name);
+
+                const bang_word_ptr = try self.allocator.create(module_mod.ModuleMemoBangWord);
+                errdefer self.allocator.destroy(bang_word_ptr);
+                bang_word_ptr.* = module_mod.ModuleMemoBangWord.init(memo_word_ptr, bang_name);
+
+                const bangat_word_ptr = try self.allocator.create(module_mod.ModuleMemoBangAtWord);
+                bangat_word_ptr.* = module_mod.ModuleMemoBangAtWord.init(memo_word_ptr, bangat_name);
+                break :blk .{ memo_word_ptr, bang_word_ptr, bangat_word_ptr };
+            };
+
+            self.created_words.appendAssumeCapacity(def_word);
+            self.created_words.appendAssumeCapacity(memo_word_ptr.asWord());
+            self.created_words.appendAssumeCapacity(bang_word_ptr.asWord());
+            self.created_words.appendAssumeCapacity(bangat_word_ptr.asWord());
+            self.is_compiling = false;
+            self.cur_definition = null;
 
             try self.curModule().addWord(memo_word_ptr.asWord());
-
-            // Create refresh variants
-            const name = self.cur_definition.?.name;
-            const bang_name = try std.fmt.allocPrint(self.allocator, "{s}!", .{name});
-            const bangat_name = try std.fmt.allocPrint(self.allocator, "{s}!@", .{name});
-
-            var bang_word_ptr = try self.allocator.create(module_mod.ModuleMemoBangWord);
-            bang_word_ptr.* = module_mod.ModuleMemoBangWord.init(memo_word_ptr, bang_name);
-
-            var bangat_word_ptr = try self.allocator.create(module_mod.ModuleMemoBangAtWord);
-            bangat_word_ptr.* = module_mod.ModuleMemoBangAtWord.init(memo_word_ptr, bangat_name);
-
             try self.curModule().addWord(bang_word_ptr.asWord());
             try self.curModule().addWord(bangat_word_ptr.asWord());
         } else {
-            try self.curModule().addWord(self.cur_definition.?.asWord());
-        }
+            self.created_words.appendAssumeCapacity(definition.asWord());
+            self.is_compiling = false;
+            self.cur_definition = null;
 
-        self.is_compiling = false;
-        self.cur_definition = null;
+            try self.curModule().addWord(definition.asWord());
+        }
     }
 
     fn handleWordToken(self: *Interpreter, token: Token) !void {
+        try self.reserveTempWord();
         const w = try self.findWord(token.string);
 
         // Check if this is a literal word (created in findLiteralWord)
@@ -435,12 +941,25 @@ pub const Interpreter = struct {
 
         try self.handleWord(w, token.location);
 
-        // Clean up literal words if not compiling
-        if (is_literal and !self.is_compiling) {
-            const word_ptr: *PushValueWord = @ptrCast(@alignCast(w.ptr));
-            w.deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
+        // Clean up literal words if not compiling; compiled ones belong to the definition
+        if (is_literal) self.releaseTempWord(w);
+    }
+
+    /// Room to keep a token's PushValueWord if it is compiled into cur_definition
+    fn reserveTempWord(self: *Interpreter) !void {
+        if (self.is_compiling) try self.created_words.ensureUnusedCapacity(self.allocator, 1);
+    }
+
+    /// Free a token's PushValueWord once it has run; a compiled one belongs
+    /// to cur_definition, so it joins created_words (see reserveTempWord)
+    fn releaseTempWord(self: *Interpreter, w: Word) void {
+        if (self.is_compiling) {
+            self.created_words.appendAssumeCapacity(w);
+            return;
         }
+        const word_ptr: *PushValueWord = @ptrCast(@alignCast(w.ptr));
+        w.deinit(self.allocator);
+        self.allocator.destroy(word_ptr);
     }
 
     fn handleWord(self: *Interpreter, w: Word, location: tokenizer_mod.CodeLocation) !void {
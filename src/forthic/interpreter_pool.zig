@@ -0,0 +1,151 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const ArrayList = std.ArrayList;
+
+const interpreter_mod = @import("interpreter.zig");
+const Interpreter = interpreter_mod.Interpreter;
+const Mark = interpreter_mod.Mark;
+
+/// ============================================================================
+/// InterpreterPool - Reusable interpreters for request-serving loops
+/// ============================================================================
+
+/// Building an interpreter - Interpreter.init, literal handlers, registering
+/// and importing every module - costs far more than a typical request. The
+/// pool builds interpreters up front, hands them out, and on release resets
+/// them to their post-setup state (Interpreter.reset) instead of tearing
+/// them down.
+///
+/// When every interpreter is out, acquire builds another; release keeps at
+/// most `size` idle ones. Thread-safe.
+pub const InterpreterPool = struct {
+    allocator: Allocator,
+    setup: Setup,
+    size: usize,
+    mutex: std.Thread.Mutex,
+    idle: ArrayList(*Pooled),
+    stats: PoolStats,
+
+    const Self = @This();
+
+    /// Prepares each new interpreter (register and import modules, ...)
+    /// setupFn may return per-interpreter state, handed back to teardownFn
+    pub const Setup = struct {
+        ctx: ?*anyopaque = null,
+        setupFn: ?*const fn (ctx: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque = null,
+        teardownFn: ?*const fn (ctx: ?*anyopaque, interp: *Interpreter, state: ?*anyopaque) void = null,
+    };
+
+    pub const PoolStats = struct {
+        /// Interpreters built (up front and on demand)
+        created: u64 = 0,
+        /// acquire calls served by an idle interpreter
+        reused: u64 = 0,
+        idle: usize = 0,
+    };
+
+    /// An interpreter on loan from the pool
+    pub const Pooled = struct {
+        interp: Interpreter,
+        /// Returned by Setup.setupFn
+        state: ?*anyopaque,
+        /// Post-setup state that release returns to
+        mark: Mark,
+    };
+
+    /// Build `size` interpreters now
+    pub fn init(allocator: Allocator, size: usize, setup: Setup) !Self {
+        var self = Self{
+            .allocator = allocator,
+            .setup = setup,
+            .size = size,
+            .mutex = .{},
+            .idle = .{},
+            .stats = .{},
+        };
+        errdefer self.deinit();
+
+        try self.idle.ensureTotalCapacity(allocator, size);
+        for (0..size) |_| {
+            self.idle.appendAssumeCapacity(try self.create());
+        }
+        return self;
+    }
+
+    /// Interpreters still on loan must be released first
+    pub fn deinit(self: *Self) void {
+        for (self.idle.items) |pooled| self.destroy(pooled);
+        self.idle.deinit(self.allocator);
+    }
+
+    /// An interpreter in its post-setup state
+    pub fn acquire(self: *Self) !*Pooled {
+        {
+            self.mutex.lock();
+            defer self.mutex.unlock();
+            if (self.idle.pop()) |pooled| {
+                self.stats.reused += 1;
+                return pooled;
+            }
+        }
+        return self.create();
+    }
+
+    /// Reset an interpreter and return it to the pool
+    pub fn release(self: *Self, pooled: *Pooled) void {
+        pooled.interp.reset(&pooled.mark) catch {
+            self.destroy(pooled);
+            return;
+        };
+
+        {
+            self.mutex.lock();
+            defer self.mutex.unlock();
+            // init reserved room for `size` idle interpreters
+            if (self.idle.items.len < self.size) {
+                self.idle.appendAssumeCapacity(pooled);
+                return;
+            }
+        }
+        self.destroy(pooled);
+    }
+
+    pub fn getStats(self: *Self) PoolStats {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        var stats = self.stats;
+        stats.idle = self.idle.items.len;
+        return stats;
+    }
+
+    fn create(self: *Self) !*Pooled {
+        const pooled = try self.allocator.create(Pooled);
+        errdefer self.allocator.destroy(pooled);
+
+        pooled.interp = try Interpreter.init(self.allocator);
+        errdefer pooled.interp.deinit();
+        try pooled.interp.fixupAfterMove();
+
+        pooled.state = null;
+        if (self.setup.setupFn) |setupFn| {
+            pooled.state = try setupFn(self.setup.ctx, &pooled.interp);
+        }
+        errdefer if (self.setup.teardownFn) |teardownFn| teardownFn(self.setup.ctx, &pooled.interp, pooled.state);
+
+        pooled.mark = try pooled.interp.mark();
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.stats.created += 1;
+        return pooled;
+    }
+
+    fn destroy(self: *Self, pooled: *Pooled) void {
+        if (self.setup.teardownFn) |teardownFn| {
+            teardownFn(self.setup.ctx, &pooled.interp, pooled.state);
+        }
+        pooled.mark.deinit(self.allocator);
+        pooled.interp.deinit();
+        self.allocator.destroy(pooled);
+    }
+};
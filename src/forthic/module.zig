@@ -8,6 +8,7 @@ const variable_mod = @import("variable.zig");
 const Variable = variable_mod.Variable;
 const errors = @import("errors.zig");
 const Value = @import("value.zig").Value;
+const WordTable = @import("word_table.zig").WordTable;
 
 // Forward declaration
 pub const Interpreter = @import("interpreter.zig").Interpreter;
@@ -16,6 +17,14 @@ pub const Interpreter = @import("interpreter.zig").Interpreter;
 /// Module - Container for words, variables, and imported modules
 /// ============================================================================
 
+/// A word table imported into a module
+pub const ImportedTable = struct {
+    table: *const WordTable,
+    /// The module's words.len at import; words from there on were added
+    /// later and shadow the table
+    word_count: usize,
+};
+
 pub const Module = struct {
     name: []const u8,
     forthic_code: []const u8,
@@ -24,6 +33,10 @@ pub const Module = struct {
     variables: StringHashMap(Variable),
     modules: StringHashMap(*Module),
     module_prefixes: StringHashMap(ArrayList([]const u8)),
+    /// Native words fixed at compile time, all exportable; searched last
+    static_words: ?*const WordTable,
+    /// static_words of imported modules, in import order
+    imported_tables: ArrayList(ImportedTable),
     interp: ?*Interpreter,
     allocator: Allocator,
 
@@ -36,16 +49,26 @@ pub const Module = struct {
             .variables = StringHashMap(Variable).init(allocator),
             .modules = StringHashMap(*Module).init(allocator),
             .module_prefixes = StringHashMap(ArrayList([]const u8)).init(allocator),
+            .static_words = null,
+            .imported_tables = ArrayList(ImportedTable){},
             .interp = null,
             .allocator = allocator,
         };
     }
 
+    /// Module whose native words come from a comptime WordTable
+    pub fn initStatic(allocator: Allocator, name: []const u8, table: *const WordTable) Module {
+        var module = Module.init(allocator, name, "");
+        module.static_words = table;
+        return module;
+    }
+
     pub fn deinit(self: *Module) void {
         // Note: Don't call word.deinit() here - words may be imported from other modules
         // Only the module that created the words should free them
         self.words.deinit(self.allocator);
         self.exportable.deinit(self.allocator);
+        self.imported_tables.deinit(self.allocator);
 
         // Clean up variables - free both keys and values
         var var_iter = self.variables.iterator();
@@ -102,6 +125,11 @@ pub const Module = struct {
     pub fn importModule(self: *Module, prefix: []const u8, module: *Module, interp: *Interpreter) !void {
         _ = interp; // Will be needed for creating ExecuteWords
 
+        // Static words are shared, so the table is imported rather than its words
+        if (module.static_words) |table| {
+            try self.imported_tables.append(self.allocator, .{ .table = table, .word_count = self.words.items.len });
+        }
+
         const exported_words = try module.exportableWords();
         defer module.allocator.free(exported_words);
 
@@ -136,6 +164,7 @@ pub const Module = struct {
         try self.exportable.append(self.allocator, new_word.getName());
     }
 
+    /// Exportable words from words; static_words are imported as a table
     pub fn exportableWords(self: *const Module) ![]Word {
         var result = ArrayList(Word){};
         errdefer result.deinit(self.allocator);
@@ -170,15 +199,33 @@ pub const Module = struct {
         return null;
     }
 
+    /// The last added word or imported table that defines word_name wins,
+    /// then the module's own static_words
     pub fn findDictionaryWord(self: *const Module, word_name: []const u8) ?Word {
-        // Search from end to beginning (last added word wins)
-        var i: usize = self.words.items.len;
-        while (i > 0) {
-            i -= 1;
-            const w = self.words.items[i];
-            if (std.mem.eql(u8, w.getName(), word_name)) {
+        // Words added after each table import are searched before that table
+        var end: usize = self.words.items.len;
+        var t: usize = self.imported_tables.items.len;
+        while (true) {
+            const start = if (t > 0) @min(self.imported_tables.items[t - 1].word_count, end) else 0;
+            var i: usize = end;
+            while (i > start) {
+                i -= 1;
+                const w = self.words.items[i];
+                if (std.mem.eql(u8, w.getName(), word_name)) {
+                    return w;
+                }
+            }
+
+            if (t == 0) break;
+            t -= 1;
+            if (self.imported_tables.items[t].table.find(word_name)) |w| {
                 return w;
             }
+            end = start;
+        }
+
+        if (self.static_words) |table| {
+            return table.find(word_name);
         }
         return null;
     }
@@ -261,7 +308,8 @@ pub const ExecuteWord = struct {
 
     fn execute(ptr: *anyopaque, interp: *Interpreter) !void {
         const self: *ExecuteWord = @ptrCast(@alignCast(ptr));
-        try self.target_word.execute(interp);
+        // An import alias is not charged against the instruction budget twice
+        try self.target_word.vtable.execute(self.target_word.ptr, interp);
     }
 
     fn getName(ptr: *anyopaque) []const u8 {
@@ -304,7 +352,7 @@ pub const ModuleMemoWord = struct {
         };
     }
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
@@ -366,7 +414,7 @@ pub const ModuleMemoBangWord = struct {
     name: []const u8,
     location: ?errors.CodeLocation,
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
@@ -424,7 +472,7 @@ pub const ModuleMemoBangAtWord = struct {
     name: []const u8,
     location: ?errors.CodeLocation,
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
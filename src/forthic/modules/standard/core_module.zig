@@ -7,91 +7,73 @@ const Value = @import("../../value.zig").Value;
 const Variable = @import("../../variable.zig").Variable;
 const WordOptions = @import("../../word_options.zig").WordOptions;
 const errors = @import("../../errors.zig");
-const word_mod = @import("../../word.zig");
-const ModuleWord = word_mod.ModuleWord;
+const wordTable = @import("../../word_table.zig").wordTable;
 
 pub const CoreModule = struct {
     module: Module,
     allocator: Allocator,
-    word_ptrs: ArrayList(*ModuleWord),
 
-    pub fn init(allocator: Allocator) !*CoreModule {
-        const self = try allocator.create(CoreModule);
-        self.* = .{
-            .module = Module.init(allocator, "core", ""),
-            .allocator = allocator,
-            .word_ptrs = ArrayList(*ModuleWord){},
-        };
-        try self.registerWords();
-        return self;
-    }
-
-    pub fn deinit(self: *CoreModule) void {
-        // Free word pointers
-        for (self.word_ptrs.items) |word_ptr| {
-            word_ptr.asWord().deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
-        }
-        self.word_ptrs.deinit(self.allocator);
-
-        self.module.deinit();
-        self.allocator.destroy(self);
-    }
-
-    fn addModuleWord(self: *CoreModule, name: []const u8, handler: word_mod.HandlerFn) !void {
-        const word_ptr = try self.allocator.create(ModuleWord);
-        word_ptr.* = ModuleWord.init(self.allocator, name, handler);
-        try self.word_ptrs.append(self.allocator, word_ptr);  // Track for cleanup
-        try self.module.addExportableWord(word_ptr.asWord());
-    }
-
-    fn registerWords(self: *CoreModule) !void {
+    const word_table = wordTable(&.{
         // Stack operations
-        try self.addModuleWord("POP", pop);
-        try self.addModuleWord("DUP", dup);
-        try self.addModuleWord("SWAP", swap);
+        .{ .name = "POP", .handler = pop },
+        .{ .name = "DUP", .handler = dup },
+        .{ .name = "SWAP", .handler = swap },
 
         // Variable operations
-        try self.addModuleWord("VARIABLES", variables);
-        try self.addModuleWord("!", set);
-        try self.addModuleWord("@", get);
-        try self.addModuleWord("!@", setGet);
+        .{ .name = "VARIABLES", .handler = variables },
+        .{ .name = "!", .handler = set },
+        .{ .name = "@", .handler = get },
+        .{ .name = "!@", .handler = setGet },
 
         // Module operations
-        try self.addModuleWord("EXPORT", exportWord);
-        try self.addModuleWord("USE-MODULES", useModules);
+        .{ .name = "EXPORT", .handler = exportWord },
+        .{ .name = "USE-MODULES", .handler = useModules },
 
         // Execution
-        try self.addModuleWord("INTERPRET", interpret);
+        .{ .name = "INTERPRET", .handler = interpret },
 
         // Control flow
-        try self.addModuleWord("IDENTITY", identity);
-        try self.addModuleWord("NOP", nop);
-        try self.addModuleWord("NULL", null_word);
-        try self.addModuleWord("ARRAY?", arrayCheck);
-        try self.addModuleWord("DEFAULT", default_word);
-        try self.addModuleWord("*DEFAULT", defaultStar);
+        .{ .name = "IDENTITY", .handler = identity },
+        .{ .name = "NOP", .handler = nop },
+        .{ .name = "NULL", .handler = null_word },
+        .{ .name = "ARRAY?", .handler = arrayCheck },
+        .{ .name = "DEFAULT", .handler = default_word },
+        .{ .name = "*DEFAULT", .handler = defaultStar },
 
         // Options
-        try self.addModuleWord("~>", toOptions);
+        .{ .name = "~>", .handler = toOptions },
 
         // Profiling (placeholder)
-        try self.addModuleWord("PROFILE-START", profileStart);
-        try self.addModuleWord("PROFILE-END", profileEnd);
-        try self.addModuleWord("PROFILE-TIMESTAMP", profileTimestamp);
-        try self.addModuleWord("PROFILE-DATA", profileData);
+        .{ .name = "PROFILE-START", .handler = profileStart },
+        .{ .name = "PROFILE-END", .handler = profileEnd },
+        .{ .name = "PROFILE-TIMESTAMP", .handler = profileTimestamp },
+        .{ .name = "PROFILE-DATA", .handler = profileData },
 
         // Logging (placeholder)
-        try self.addModuleWord("START-LOG", startLog);
-        try self.addModuleWord("END-LOG", endLog);
+        .{ .name = "START-LOG", .handler = startLog },
+        .{ .name = "END-LOG", .handler = endLog },
 
         // String operations
-        try self.addModuleWord("INTERPOLATE", interpolate);
-        try self.addModuleWord("PRINT", print);
+        .{ .name = "INTERPOLATE", .handler = interpolate },
+        .{ .name = "PRINT", .handler = print },
 
         // Debug
-        try self.addModuleWord("PEEK!", peek);
-        try self.addModuleWord("STACK!", stackDebug);
+        .{ .name = "PEEK!", .handler = peek },
+        .{ .name = "STACK!", .handler = stackDebug },
+    });
+
+    pub fn init(allocator: Allocator) !*CoreModule {
+        const self = try allocator.create(CoreModule);
+        self.* = .{
+            .module = Module.initStatic(allocator, "core", word_table),
+            .allocator = allocator,
+        };
+        return self;
+    }
+
+    pub fn deinit(self: *CoreModule) void {
+        self.module.deinit();
+        self.allocator.destroy(self);
     }
 
     // ========================================
@@ -121,20 +103,20 @@ pub const CoreModule = struct {
     // ========================================
 
     fn pop(interp: *Interpreter) !void {
-        var value = try interp.stackPop();
+        var value = try interp.stackPopRaw();
         value.deinit(interp.allocator);
     }
 
     fn dup(interp: *Interpreter) !void {
-        var a = try interp.stackPop();
+        var a = try interp.stackPopRaw();
         defer a.deinit(interp.allocator);
         try interp.stackPush(try a.clone(interp.allocator));
         try interp.stackPush(try a.clone(interp.allocator));
     }
 
     fn swap(interp: *Interpreter) !void {
-        const b = try interp.stackPop();
-        const a = try interp.stackPop();
+        const b = try interp.stackPopRaw();
+        const a = try interp.stackPopRaw();
         try interp.stackPush(b);
         try interp.stackPush(a);
     }
@@ -170,7 +152,7 @@ pub const CoreModule = struct {
     fn set(interp: *Interpreter) !void {
         var variable = try interp.stackPop();
         defer variable.deinit(interp.allocator);
-        var value = try interp.stackPop();
+        var value = try interp.stackPopRaw();
         defer value.deinit(interp.allocator);
 
         // Handle both string names (auto-create) and Variable objects
@@ -212,7 +194,7 @@ pub const CoreModule = struct {
     fn setGet(interp: *Interpreter) !void {
         var variable = try interp.stackPop();
         defer variable.deinit(interp.allocator);
-        var value = try interp.stackPop();
+        var value = try interp.stackPopRaw();
         defer value.deinit(interp.allocator);
 
         switch (variable) {
@@ -628,6 +610,9 @@ pub const CoreModule = struct {
                     .{ dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second },
                 );
             },
+            .remote_ref_value => |ref| {
+                return try std.fmt.allocPrint(allocator, "<RemoteRef {s}:{s}>", .{ ref.runtime, ref.handle_id });
+            },
         }
     }
 
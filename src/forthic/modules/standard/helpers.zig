@@ -14,6 +14,7 @@ pub const Helpers = struct {
             .array_value => |a| a.items.len > 0,
             .record_value => |r| r.count() > 0,
             .datetime_value => true,
+            .remote_ref_value => true,
         };
     }
 
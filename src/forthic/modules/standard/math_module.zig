@@ -5,80 +5,62 @@ const Module = @import("../../module.zig").Module;
 const Interpreter = @import("../../interpreter.zig").Interpreter;
 const Value = @import("../../value.zig").Value;
 const helpers = @import("helpers.zig");
-const word_mod = @import("../../word.zig");
-const ModuleWord = word_mod.ModuleWord;
+const wordTable = @import("../../word_table.zig").wordTable;
 
 pub const MathModule = struct {
     module: Module,
     allocator: Allocator,
-    word_ptrs: ArrayList(*ModuleWord),
+
+    const word_table = wordTable(&.{
+        // Arithmetic
+        .{ .name = "+", .handler = plus },
+        .{ .name = "ADD", .handler = plus },
+        .{ .name = "-", .handler = minus },
+        .{ .name = "SUBTRACT", .handler = minus },
+        .{ .name = "*", .handler = times },
+        .{ .name = "MULTIPLY", .handler = times },
+        .{ .name = "/", .handler = divide },
+        .{ .name = "DIVIDE", .handler = divide },
+        .{ .name = "MOD", .handler = mod },
+
+        // Aggregates
+        .{ .name = "SUM", .handler = sum },
+        .{ .name = "MEAN", .handler = mean },
+        .{ .name = "MAX", .handler = max },
+        .{ .name = "MIN", .handler = min },
+
+        // Conversions
+        .{ .name = ">INT", .handler = toInt },
+        .{ .name = ">FLOAT", .handler = toFloat },
+        .{ .name = "ROUND", .handler = round },
+        .{ .name = ">FIXED", .handler = toFixed },
+
+        // Functions
+        .{ .name = "ABS", .handler = abs },
+        .{ .name = "SQRT", .handler = sqrt },
+        .{ .name = "FLOOR", .handler = floor },
+        .{ .name = "CEIL", .handler = ceil },
+        .{ .name = "CLAMP", .handler = clamp },
+
+        // Special
+        .{ .name = "INFINITY", .handler = infinity },
+        .{ .name = "UNIFORM-RANDOM", .handler = uniformRandom },
+    });
 
     pub fn init(allocator: Allocator) !*MathModule {
         const self = try allocator.create(MathModule);
         self.* = .{
-            .module = Module.init(allocator, "math", ""),
+            .module = Module.initStatic(allocator, "math", word_table),
             .allocator = allocator,
-            .word_ptrs = ArrayList(*ModuleWord){},
         };
-        try self.registerWords();
         return self;
     }
 
     pub fn deinit(self: *MathModule) void {
-        // Free word pointers
-        for (self.word_ptrs.items) |word_ptr| {
-            word_ptr.asWord().deinit(self.allocator);
-            self.allocator.destroy(word_ptr);
-        }
-        self.word_ptrs.deinit(self.allocator);
-
         self.module.deinit();
         self.allocator.destroy(self);
     }
 
-    fn addModuleWord(self: *MathModule, name: []const u8, handler: word_mod.HandlerFn) !void {
-        const word_ptr = try self.allocator.create(ModuleWord);
-        word_ptr.* = ModuleWord.init(self.allocator, name, handler);
-        try self.word_ptrs.append(self.allocator, word_ptr);  // Track for cleanup
-        try self.module.addExportableWord(word_ptr.asWord());
-    }
-
-    fn registerWords(self: *MathModule) !void {
-        // Arithmetic
-        try self.addModuleWord("+", plus);
-        try self.addModuleWord("ADD", plus);
-        try self.addModuleWord("-", minus);
-        try self.addModuleWord("SUBTRACT", minus);
-        try self.addModuleWord("*", times);
-        try self.addModuleWord("MULTIPLY", times);
-        try self.addModuleWord("/", divide);
-        try self.addModuleWord("DIVIDE", divide);
-        try self.addModuleWord("MOD", mod);
-
-        // Aggregates
-        try self.addModuleWord("SUM", sum);
-        try self.addModuleWord("MEAN", mean);
-        try self.addModuleWord("MAX", max);
-        try self.addModuleWord("MIN", min);
-
-        // Conversions
-        try self.addModuleWord(">INT", toInt);
-        try self.addModuleWord(">FLOAT", toFloat);
-        try self.addModuleWord("ROUND", round);
-        try self.addModuleWord(">FIXED", toFixed);
-
-        // Functions
-        try self.addModuleWord("ABS", abs);
-        try self.addModuleWord("SQRT", sqrt);
-        try self.addModuleWord("FLOOR", floor);
-        try self.addModuleWord("CEIL", ceil);
-        try self.addModuleWord("CLAMP", clamp);
-
-        // Special
-        try self.addModuleWord("INFINITY", infinity);
-        try self.addModuleWord("UNIFORM-RANDOM", uniformRandom);
-    }
-
     fn plus(interp: *Interpreter) !void {
         const b = try interp.stackPop();
 
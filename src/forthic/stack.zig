@@ -62,6 +62,15 @@ pub const Stack = struct {
         self.items.clearRetainingCapacity();
     }
 
+    /// Free and remove every item above new_len, keeping the lower stack intact
+    pub fn truncate(self: *Stack, new_len: usize) void {
+        if (new_len >= self.items.items.len) return;
+        for (self.items.items[new_len..]) |*item| {
+            item.deinit(self.allocator);
+        }
+        self.items.shrinkRetainingCapacity(new_len);
+    }
+
     /// Get item at index (0 = bottom, length-1 = top)
     pub fn at(self: *const Stack, index: usize) !*const Value {
         if (index >= self.items.items.len) {
@@ -139,6 +148,23 @@ test "Stack: multiple items" {
     try std.testing.expectEqual(@as(i64, 1), pop1.int_value);
 }
 
+test "Stack: truncate" {
+    const allocator = std.testing.allocator;
+    var stack = Stack.init(allocator);
+    defer stack.deinit();
+
+    try stack.push(Value.initInt(1));
+    try stack.push(Value.initString(try allocator.dupe(u8, "dropped")));
+    try stack.push(Value.initInt(3));
+
+    stack.truncate(1);
+    try std.testing.expectEqual(@as(usize, 1), stack.length());
+    try std.testing.expectEqual(@as(i64, 1), (try stack.peek()).int_value);
+
+    stack.truncate(5); // No-op when already shorter
+    try std.testing.expectEqual(@as(usize, 1), stack.length());
+}
+
 test "Stack: clear" {
     const allocator = std.testing.allocator;
     var stack = Stack.init(allocator);
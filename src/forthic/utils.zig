@@ -427,6 +427,116 @@ pub fn parseDateTime(s: []const u8) !DateTime {
     };
 }
 
+/// Index of the '-' that ends the year of an ISO 8601 date
+/// Years outside 0000-9999 carry a sign and may run past four digits
+fn isoYearEnd(s: []const u8) !usize {
+    const digits_start: usize = if (s.len > 0 and (s[0] == '-' or s[0] == '+')) 1 else 0;
+    const year_end = std.mem.indexOfScalarPos(u8, s, digits_start, '-') orelse return error.InvalidFormat;
+    if (year_end - digits_start < 4) return error.InvalidFormat;
+    return year_end;
+}
+
+/// Parse an ISO 8601 date-time and normalize it to UTC
+/// Accepts YYYY-MM-DDTHH:MM:SS with optional fractional seconds, followed by
+/// "Z", a "+HH:MM"/"-HH:MM" offset, or nothing (treated as UTC). Anything after
+/// the offset (e.g., a "[America/New_York]" zone suffix) is ignored.
+pub fn parseDateTimeUtc(s: []const u8) !DateTime {
+    const year_end = try isoYearEnd(s);
+    var local = try parseDateTime(s[year_end - 4 ..]);
+    local.year = try std.fmt.parseInt(i32, s[0..year_end], 10);
+
+    var pos: usize = year_end + 15;
+    if (pos < s.len and s[pos] == '.') {
+        pos += 1;
+        while (pos < s.len and std.ascii.isDigit(s[pos])) pos += 1;
+    }
+
+    if (pos >= s.len or s[pos] == 'Z' or s[pos] == '[') {
+        return local;
+    }
+
+    const sign: i64 = switch (s[pos]) {
+        '+' => 1,
+        '-' => -1,
+        else => return error.InvalidFormat,
+    };
+    if (s.len < pos + 6 or s[pos + 3] != ':') return error.InvalidFormat;
+
+    const offset_hours = try std.fmt.parseInt(i64, s[pos + 1 .. pos + 3], 10);
+    const offset_minutes = try std.fmt.parseInt(i64, s[pos + 4 .. pos + 6], 10);
+    const offset_seconds = sign * (offset_hours * 3600 + offset_minutes * 60);
+
+    return dateTimeFromEpochSeconds(dateTimeToEpochSeconds(local) - offset_seconds);
+}
+
+/// Parse an ISO 8601 calendar date (YYYY-MM-DD)
+pub fn parseIsoDate(s: []const u8) !DateTime {
+    const year_end = try isoYearEnd(s);
+    const rest = s[year_end..];
+    if (rest.len < 6 or rest[3] != '-') return error.InvalidFormat;
+
+    return DateTime{
+        .year = try std.fmt.parseInt(i32, s[0..year_end], 10),
+        .month = try std.fmt.parseInt(u8, rest[1..3], 10),
+        .day = try std.fmt.parseInt(u8, rest[4..6], 10),
+        .hour = 0,
+        .minute = 0,
+        .second = 0,
+    };
+}
+
+/// Days since 1970-01-01 for a proleptic Gregorian calendar date
+pub fn daysFromCivil(year: i32, month: u8, day: u8) i64 {
+    // Shift the year to start in March so the leap day is the last day of the year
+    const y: i64 = @as(i64, year) - @as(i64, if (month <= 2) 1 else 0);
+    const era = @divFloor(y, 400);
+    const yoe = y - era * 400;
+    const mp: i64 = @mod(@as(i64, month) + 9, 12);
+    const doy = @divFloor(153 * mp + 2, 5) + @as(i64, day) - 1;
+    const doe = yoe * 365 + @divFloor(yoe, 4) - @divFloor(yoe, 100) + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/// Calendar date for a number of days since 1970-01-01 (inverse of daysFromCivil)
+pub fn civilFromDays(days: i64) DateTime {
+    const z = days + 719468;
+    const era = @divFloor(z, 146097);
+    const doe = z - era * 146097;
+    const yoe = @divFloor(doe - @divFloor(doe, 1460) + @divFloor(doe, 36524) - @divFloor(doe, 146096), 365);
+    const doy = doe - (365 * yoe + @divFloor(yoe, 4) - @divFloor(yoe, 100));
+    const mp = @divFloor(5 * doy + 2, 153);
+    const day = doy - @divFloor(153 * mp + 2, 5) + 1;
+    const month = if (mp < 10) mp + 3 else mp - 9;
+    const year = yoe + era * 400 + @as(i64, if (month <= 2) 1 else 0);
+
+    return DateTime{
+        .year = @intCast(year),
+        .month = @intCast(month),
+        .day = @intCast(day),
+        .hour = 0,
+        .minute = 0,
+        .second = 0,
+    };
+}
+
+/// Seconds since 1970-01-01T00:00:00Z, treating dt as UTC
+pub fn dateTimeToEpochSeconds(dt: DateTime) i64 {
+    return daysFromCivil(dt.year, dt.month, dt.day) * 86400 +
+        @as(i64, dt.hour) * 3600 +
+        @as(i64, dt.minute) * 60 +
+        @as(i64, dt.second);
+}
+
+/// UTC date-time for a number of seconds since 1970-01-01T00:00:00Z
+pub fn dateTimeFromEpochSeconds(secs: i64) DateTime {
+    var dt = civilFromDays(@divFloor(secs, 86400));
+    const secs_of_day = @mod(secs, 86400);
+    dt.hour = @intCast(@divFloor(secs_of_day, 3600));
+    dt.minute = @intCast(@divFloor(@mod(secs_of_day, 3600), 60));
+    dt.second = @intCast(@mod(secs_of_day, 60));
+    return dt;
+}
+
 /// Convert date to YYYYMMDD integer format
 pub fn dateToInt(dt: DateTime) i64 {
     return @as(i64, dt.year) * 10000 + @as(i64, dt.month) * 100 + @as(i64, dt.day);
@@ -4,6 +4,18 @@ const ArrayList = std.ArrayList;
 const StringHashMap = std.StringHashMap;
 const utils = @import("utils.zig");
 
+/// Handle to a value that stays resident in a remote runtime
+/// Both strings are owned by the Value that holds the handle
+pub const RemoteRef = struct {
+    handle_id: []const u8,
+    runtime: []const u8,
+
+    pub fn eql(self: RemoteRef, other: RemoteRef) bool {
+        return std.mem.eql(u8, self.handle_id, other.handle_id) and
+            std.mem.eql(u8, self.runtime, other.runtime);
+    }
+};
+
 /// Runtime value type for Forthic - idiomatic Zig tagged union
 /// Similar to std.json.Value
 pub const Value = union(enum) {
@@ -15,6 +27,7 @@ pub const Value = union(enum) {
     array_value: ArrayList(Value),
     record_value: StringHashMap(Value),
     datetime_value: utils.DateTime,
+    remote_ref_value: RemoteRef,
 
     /// Create null value
     pub fn initNull() Value {
@@ -57,6 +70,11 @@ pub const Value = union(enum) {
         return .{ .datetime_value = dt };
     }
 
+    /// Create remote value handle (takes ownership of both strings)
+    pub fn initRemoteRef(handle_id: []const u8, runtime: []const u8) Value {
+        return .{ .remote_ref_value = .{ .handle_id = handle_id, .runtime = runtime } };
+    }
+
     /// Deep copy a value
     pub fn clone(self: *const Value, allocator: Allocator) !Value {
         return switch (self.*) {
@@ -66,6 +84,11 @@ pub const Value = union(enum) {
             .float_value => |f| .{ .float_value = f },
             .string_value => |s| .{ .string_value = try allocator.dupe(u8, s) },
             .datetime_value => |dt| .{ .datetime_value = dt },
+            .remote_ref_value => |ref| {
+                const handle_id = try allocator.dupe(u8, ref.handle_id);
+                errdefer allocator.free(handle_id);
+                return initRemoteRef(handle_id, try allocator.dupe(u8, ref.runtime));
+            },
             .array_value => |arr| {
                 var new_arr: std.ArrayList(Value) = .{};
                 try new_arr.ensureTotalCapacity(allocator, arr.items.len);
@@ -92,6 +115,10 @@ pub const Value = union(enum) {
     pub fn deinit(self: *Value, allocator: Allocator) void {
         switch (self.*) {
             .string_value => |s| allocator.free(s),
+            .remote_ref_value => |ref| {
+                allocator.free(ref.handle_id);
+                allocator.free(ref.runtime);
+            },
             .array_value => |*arr| {
                 for (arr.items) |*item| {
                     item.deinit(allocator);
@@ -110,6 +137,27 @@ pub const Value = union(enum) {
         }
     }
 
+    /// Whether value is a remote value handle or holds one at any depth
+    pub fn containsRemoteRef(self: *const Value) bool {
+        switch (self.*) {
+            .remote_ref_value => return true,
+            .array_value => |arr| {
+                for (arr.items) |*item| {
+                    if (item.containsRemoteRef()) return true;
+                }
+                return false;
+            },
+            .record_value => |rec| {
+                var iter = rec.valueIterator();
+                while (iter.next()) |item| {
+                    if (item.containsRemoteRef()) return true;
+                }
+                return false;
+            },
+            else => return false,
+        }
+    }
+
     /// Check if value is truthy (for boolean operations)
     pub fn isTruthy(self: *const Value) bool {
         return switch (self.*) {
@@ -121,6 +169,7 @@ pub const Value = union(enum) {
             .array_value => |arr| arr.items.len > 0,
             .record_value => |rec| rec.count() > 0,
             .datetime_value => true,
+            .remote_ref_value => true,
         };
     }
 
@@ -161,6 +210,7 @@ pub const Value = union(enum) {
                 "{d:0>4}-{d:0>2}-{d:0>2} {d:0>2}:{d:0>2}:{d:0>2}",
                 .{ dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second },
             ),
+            .remote_ref_value => |ref| try std.fmt.allocPrint(allocator, "<RemoteRef {s}:{s}>", .{ ref.runtime, ref.handle_id }),
         };
     }
 
@@ -194,6 +244,7 @@ pub const Value = union(enum) {
                     a.day == b.day and a.hour == b.hour and
                     a.minute == b.minute and a.second == b.second;
             },
+            .remote_ref_value => |a| a.eql(other.remote_ref_value),
             .array_value => |a| {
                 const b = other.array_value;
                 if (a.items.len != b.items.len) return false;
@@ -53,6 +53,7 @@ pub const Word = struct {
     };
 
     pub fn execute(self: Word, interp: *Interpreter) !void {
+        try interp.chargeInstruction();
         return self.vtable.execute(self.ptr, interp);
     }
 
@@ -82,7 +83,7 @@ pub const PushValueWord = struct {
     value: Value,
     location: ?errors.CodeLocation,
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
@@ -144,6 +145,9 @@ pub const ModuleWord = struct {
     location: ?errors.CodeLocation,
     error_handlers: ArrayList(ErrorHandler),
     allocator: Allocator,
+    /// Part of a WordTable, shared by every interpreter in the process:
+    /// never changed after init
+    is_static: bool,
 
     pub fn init(allocator: Allocator, name: []const u8, handler: HandlerFn) ModuleWord {
         return ModuleWord{
@@ -152,14 +156,22 @@ pub const ModuleWord = struct {
             .location = null,
             .error_handlers = ArrayList(ErrorHandler){},
             .allocator = allocator,
+            .is_static = false,
         };
     }
 
+    /// A word for a WordTable; it takes no error handlers or location
+    pub fn initStatic(name: []const u8, handler: HandlerFn) ModuleWord {
+        var word = ModuleWord.init(std.heap.page_allocator, name, handler);
+        word.is_static = true;
+        return word;
+    }
+
     pub fn deinit(self: *ModuleWord) void {
         self.error_handlers.deinit(self.allocator);
     }
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
@@ -199,17 +211,22 @@ pub const ModuleWord = struct {
 
     fn setLocation(ptr: *anyopaque, loc: ?errors.CodeLocation) void {
         const self: *ModuleWord = @ptrCast(@alignCast(ptr));
+        if (self.is_static) return;
         self.location = loc;
     }
 
     fn deinitImpl(ptr: *anyopaque, allocator: Allocator) void {
         const self: *ModuleWord = @ptrCast(@alignCast(ptr));
         _ = allocator;
+        if (self.is_static) return;
         self.deinit();
         // Note: Don't destroy self here - the owning module will handle it
     }
 
+    /// Fails with StaticWord for a WordTable word, which other interpreters
+    /// may be running concurrently; wrap it in a word of your own instead
     pub fn addErrorHandler(self: *ModuleWord, handler: ErrorHandler) !void {
+        if (self.is_static) return error.StaticWord;
         try self.error_handlers.append(self.allocator, handler);
     }
 };
@@ -240,7 +257,7 @@ pub const DefinitionWord = struct {
         self.error_handlers.deinit(self.allocator);
     }
 
-    const vtable = Word.VTable{
+    pub const vtable = Word.VTable{
         .execute = execute,
         .getName = getName,
         .getLocation = getLocation,
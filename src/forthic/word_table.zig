@@ -0,0 +1,187 @@
+const std = @import("std");
+const word_mod = @import("word.zig");
+const Word = word_mod.Word;
+const ModuleWord = word_mod.ModuleWord;
+const HandlerFn = word_mod.HandlerFn;
+
+/// ============================================================================
+/// WordTable - Comptime perfect-hash dictionary for native modules
+/// ============================================================================
+
+/// A fixed set of native words, laid out at compile time
+///
+/// Lookup hashes the name once to pick a bucket and once more, with that
+/// bucket's seed, to pick a slot, then compares a single name: the cost does
+/// not grow with the table. The words are static ModuleWords, so a module
+/// built on a table (Module.initStatic) allocates nothing for them, and
+/// importing it records the table instead of copying its words.
+///
+/// Static words are shared by every module built on the same table, and so
+/// by every interpreter in the process: they reject error handlers.
+pub const WordTable = struct {
+    words: []const Word,
+    names: []const []const u8,
+    /// Per bucket: the seed that sends the bucket's names to free slots
+    seeds: []const u32,
+    /// Per slot: index into words plus one, 0 when empty
+    slots: []const u16,
+
+    pub const Spec = struct {
+        name: []const u8,
+        handler: HandlerFn,
+    };
+
+    pub fn find(self: *const WordTable, name: []const u8) ?Word {
+        const index = self.indexOf(name) orelse return null;
+        return self.words[index];
+    }
+
+    /// Position of name in words
+    pub fn indexOf(self: *const WordTable, name: []const u8) ?u32 {
+        const bucket = hash(0, name) & (self.seeds.len - 1);
+        const slot = hash(self.seeds[bucket], name) & (self.slots.len - 1);
+        const entry = self.slots[slot];
+        if (entry == 0) return null;
+        if (!std.mem.eql(u8, self.names[entry - 1], name)) return null;
+        return entry - 1;
+    }
+};
+
+/// The table for specs, built once per distinct list at compile time
+pub fn wordTable(comptime specs: []const WordTable.Spec) *const WordTable {
+    return &StaticWords(specs).table;
+}
+
+fn StaticWords(comptime specs: []const WordTable.Spec) type {
+    return struct {
+        // Process-global, so ModuleWord.initStatic keeps them read-only
+        var module_words: [specs.len]ModuleWord = blk: {
+            var words: [specs.len]ModuleWord = undefined;
+            for (specs, 0..) |spec, i| {
+                words[i] = ModuleWord.initStatic(spec.name, spec.handler);
+            }
+            break :blk words;
+        };
+
+        const words: [specs.len]Word = blk: {
+            var out: [specs.len]Word = undefined;
+            for (&out, 0..) |*w, i| {
+                w.* = .{ .ptr = &module_words[i], .vtable = &ModuleWord.vtable };
+            }
+            break :blk out;
+        };
+
+        const names: [specs.len][]const u8 = blk: {
+            var out: [specs.len][]const u8 = undefined;
+            for (specs, 0..) |spec, i| out[i] = spec.name;
+            break :blk out;
+        };
+
+        const layout = buildLayout(specs);
+
+        const table = WordTable{
+            .words = &words,
+            .names = &names,
+            .seeds = &layout.seeds,
+            .slots = &layout.slots,
+        };
+    };
+}
+
+fn Layout(comptime n: usize) type {
+    return struct {
+        seeds: [bucketCount(n)]u32,
+        slots: [slotCount(n)]u16,
+    };
+}
+
+/// About two names per bucket
+fn bucketCount(n: usize) usize {
+    return std.math.ceilPowerOfTwoAssert(usize, @max(n / 2, 1));
+}
+
+/// Load factor at most one half, which keeps the seed search short
+fn slotCount(n: usize) usize {
+    return std.math.ceilPowerOfTwoAssert(usize, @max(n * 2, 2));
+}
+
+/// Hash and displace: place the largest buckets first, trying seeds until
+/// every name of the bucket lands on a free slot
+fn buildLayout(comptime specs: []const WordTable.Spec) Layout(specs.len) {
+    const n = specs.len;
+    const bucket_count = bucketCount(n);
+    const slot_count = slotCount(n);
+    if (n >= std.math.maxInt(u16)) @compileError("word table too large");
+    @setEvalBranchQuota(2_000_000);
+
+    var layout = Layout(n){
+        .seeds = [_]u32{0} ** bucket_count,
+        .slots = [_]u16{0} ** slot_count,
+    };
+
+    var bucket_of: [n]usize = undefined;
+    var sizes = [_]usize{0} ** bucket_count;
+    for (specs, 0..) |spec, i| {
+        for (specs[0..i]) |other| {
+            if (std.mem.eql(u8, spec.name, other.name)) {
+                @compileError("duplicate word in table: " ++ spec.name);
+            }
+        }
+        bucket_of[i] = hash(0, spec.name) & (bucket_count - 1);
+        sizes[bucket_of[i]] += 1;
+    }
+
+    // Buckets by size, largest first
+    var order: [bucket_count]usize = undefined;
+    for (&order, 0..) |*b, i| b.* = i;
+    for (1..bucket_count) |i| {
+        var j = i;
+        while (j > 0 and sizes[order[j - 1]] < sizes[order[j]]) : (j -= 1) {
+            std.mem.swap(usize, &order[j - 1], &order[j]);
+        }
+    }
+
+    for (order) |bucket| {
+        if (sizes[bucket] == 0) break;
+
+        var seed: u32 = 1;
+        search: while (true) : (seed += 1) {
+            var taken: [n]usize = undefined;
+            var count: usize = 0;
+            for (specs, 0..) |spec, i| {
+                if (bucket_of[i] != bucket) continue;
+                const slot = hash(seed, spec.name) & (slot_count - 1);
+                if (layout.slots[slot] != 0) continue :search;
+                for (taken[0..count]) |t| {
+                    if (t == slot) continue :search;
+                }
+                taken[count] = slot;
+                count += 1;
+            }
+
+            var placed: usize = 0;
+            for (0..n) |i| {
+                if (bucket_of[i] != bucket) continue;
+                layout.slots[taken[placed]] = @intCast(i + 1);
+                placed += 1;
+            }
+            layout.seeds[bucket] = seed;
+            break;
+        }
+    }
+    return layout;
+}
+
+/// FNV-1a over the name, seeded, with a final mix so the low bits that pick
+/// buckets and slots depend on every byte
+fn hash(seed: u32, name: []const u8) usize {
+    var h: u64 = 0xcbf29ce484222325 ^ (@as(u64, seed) *% 0x9e3779b97f4a7c15);
+    for (name) |c| {
+        h ^= c;
+        h *%= 0x100000001b3;
+    }
+    h ^= h >> 29;
+    h *%= 0xbf58476d1ce4e5b9;
+    h ^= h >> 32;
+    return @truncate(h);
+}
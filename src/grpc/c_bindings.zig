@@ -23,6 +23,7 @@ pub const GrpcError = error{
     Unavailable,
     DataLoss,
     Unauthenticated,
+    DeadlineExceeded,
     Unknown,
 };
 
@@ -42,6 +43,7 @@ fn grpcErrorFromCode(code: c.GrpcErrorCode) GrpcError!void {
         c.GRPC_ERROR_UNAVAILABLE => error.Unavailable,
         c.GRPC_ERROR_DATA_LOSS => error.DataLoss,
         c.GRPC_ERROR_UNAUTHENTICATED => error.Unauthenticated,
+        c.GRPC_ERROR_DEADLINE_EXCEEDED => error.DeadlineExceeded,
         else => error.Unknown,
     };
 }
@@ -55,6 +57,23 @@ pub const StackValueType = c.StackValueType;
 pub const GrpcClient = c.GrpcClient;
 pub const GrpcServer = c.GrpcServer;
 pub const ErrorInfo = c.ErrorInfo;
+pub const CRecordIterator = c.RecordIterator;
+pub const GrpcServerHandler = c.GrpcServerHandler;
+pub const ResultStream = c.ResultStream;
+pub const ModuleList = c.ModuleList;
+pub const ModuleInfo = c.ModuleInfo;
+pub const GrpcWordInfo = c.GrpcWordInfo;
+pub const GrpcClientOptions = c.GrpcClientOptions;
+pub const GrpcCallOptions = c.GrpcCallOptions;
+pub const GrpcEndpointStats = c.GrpcEndpointStats;
+pub const GrpcClientStats = c.GrpcClientStats;
+pub const GrpcSharedMemoryStats = c.GrpcSharedMemoryStats;
+pub const GrpcServerLimits = c.GrpcServerLimits;
+pub const GrpcServerStats = c.GrpcServerStats;
+pub const GrpcWordMetrics = c.GrpcWordMetrics;
+pub const GrpcLatencyHistogram = c.GrpcLatencyHistogram;
+pub const GRPC_LATENCY_BUCKETS = c.GRPC_LATENCY_BUCKETS;
+pub const GRPC_STATUS_SLOTS = c.GRPC_STATUS_SLOTS;
 
 // Stack value types
 pub const STACK_VALUE_NULL = c.STACK_VALUE_NULL;
@@ -67,6 +86,21 @@ pub const STACK_VALUE_RECORD = c.STACK_VALUE_RECORD;
 pub const STACK_VALUE_INSTANT = c.STACK_VALUE_INSTANT;
 pub const STACK_VALUE_PLAIN_DATE = c.STACK_VALUE_PLAIN_DATE;
 pub const STACK_VALUE_ZONED_DATETIME = c.STACK_VALUE_ZONED_DATETIME;
+pub const STACK_VALUE_REMOTE_REF = c.STACK_VALUE_REMOTE_REF;
+
+// Load balancing policies
+pub const GrpcLbPolicy = c.GrpcLbPolicy;
+pub const GRPC_LB_ROUND_ROBIN = c.GRPC_LB_ROUND_ROBIN;
+pub const GRPC_LB_LEAST_OUTSTANDING = c.GRPC_LB_LEAST_OUTSTANDING;
+pub const GRPC_COMPRESSION_NONE = c.GRPC_COMPRESSION_NONE;
+pub const GRPC_COMPRESSION_DEFLATE = c.GRPC_COMPRESSION_DEFLATE;
+pub const GRPC_COMPRESSION_GZIP = c.GRPC_COMPRESSION_GZIP;
+
+// Result chunk kinds
+pub const ResultChunkKind = c.ResultChunkKind;
+pub const RESULT_CHUNK_END = c.RESULT_CHUNK_END;
+pub const RESULT_CHUNK_VALUE = c.RESULT_CHUNK_VALUE;
+pub const RESULT_CHUNK_ARRAY_ELEMENTS = c.RESULT_CHUNK_ARRAY_ELEMENTS;
 
 // =============================================================================
 // StackValue API
@@ -80,8 +114,10 @@ pub fn stackValueCreateInt(value: i64) ?*StackValue {
     return c.stack_value_create_int(value);
 }
 
-pub fn stackValueCreateString(value: [*:0]const u8) ?*StackValue {
-    return c.stack_value_create_string(value);
+/// Create a string stack value from a slice (no NUL terminator needed,
+/// embedded NUL bytes are preserved)
+pub fn stackValueCreateString(value: []const u8) ?*StackValue {
+    return c.stack_value_create_string_n(value.ptr, value.len);
 }
 
 pub fn stackValueCreateBool(value: bool) ?*StackValue {
@@ -96,6 +132,45 @@ pub fn stackValueCreateArray(items: []*const StackValue, len: usize) ?*StackValu
     return c.stack_value_create_array(@ptrCast(items.ptr), len);
 }
 
+pub fn stackValueCreateInstantNanos(epoch_nanos: i64) ?*StackValue {
+    return c.stack_value_create_instant_nanos(epoch_nanos);
+}
+
+pub fn stackValueCreateInstantIso(iso8601: []const u8) ?*StackValue {
+    return c.stack_value_create_instant_iso(iso8601.ptr, iso8601.len);
+}
+
+pub fn stackValueCreatePlainDateDays(days_since_epoch: i32) ?*StackValue {
+    return c.stack_value_create_plain_date_days(days_since_epoch);
+}
+
+pub fn stackValueCreatePlainDateIso(iso8601_date: []const u8) ?*StackValue {
+    return c.stack_value_create_plain_date_iso(iso8601_date.ptr, iso8601_date.len);
+}
+
+pub fn stackValueCreateZonedDateTimeNanos(epoch_nanos: i64, timezone: []const u8) ?*StackValue {
+    return c.stack_value_create_zoned_datetime_nanos(epoch_nanos, timezone.ptr, timezone.len);
+}
+
+pub fn stackValueCreateZonedDateTimeIso(iso8601: []const u8, timezone: []const u8) ?*StackValue {
+    return c.stack_value_create_zoned_datetime_iso(iso8601.ptr, iso8601.len, timezone.ptr, timezone.len);
+}
+
+pub fn stackValueCreateRemoteRef(handle_id: []const u8, runtime: []const u8) ?*StackValue {
+    return c.stack_value_create_remote_ref(handle_id.ptr, handle_id.len, runtime.ptr, runtime.len);
+}
+
+pub fn stackValueCreateRecord() ?*StackValue {
+    return c.stack_value_create_record();
+}
+
+/// Insert a field into a record stack value
+/// Takes ownership of field_value (it is destroyed even on error)
+pub fn stackValueRecordInsert(record: *StackValue, key: []const u8, field_value: *StackValue) GrpcError!void {
+    const err_code = c.stack_value_record_insert_n(record, key.ptr, key.len, field_value);
+    try grpcErrorFromCode(err_code);
+}
+
 pub fn stackValueGetType(value: *const StackValue) StackValueType {
     return c.stack_value_get_type(value);
 }
@@ -108,6 +183,13 @@ pub fn stackValueGetString(value: *const StackValue) [*:0]const u8 {
     return c.stack_value_get_string(value);
 }
 
+/// Get string value as a slice borrowed from the stack value (no NUL scan)
+pub fn stackValueGetStringSlice(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_string_view(value, &len);
+    return ptr[0..len];
+}
+
 pub fn stackValueGetBool(value: *const StackValue) bool {
     return c.stack_value_get_bool(value);
 }
@@ -145,25 +227,231 @@ pub fn stackValueGetArray(value: *const StackValue) ArrayItems {
     return ArrayItems{ .items = slice, .len = len };
 }
 
+/// Compact instant encoding, or null if only ISO 8601 is present
+pub fn stackValueGetInstantNanos(value: *const StackValue) ?i64 {
+    var nanos: i64 = 0;
+    return if (c.stack_value_get_instant_nanos(value, &nanos)) nanos else null;
+}
+
+pub fn stackValueGetInstantIso(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_instant_iso(value, &len);
+    return ptr[0..len];
+}
+
+/// Compact plain date encoding, or null if only ISO 8601 is present
+pub fn stackValueGetPlainDateDays(value: *const StackValue) ?i32 {
+    var days: i32 = 0;
+    return if (c.stack_value_get_plain_date_days(value, &days)) days else null;
+}
+
+pub fn stackValueGetPlainDateIso(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_plain_date_iso(value, &len);
+    return ptr[0..len];
+}
+
+/// Compact zoned date-time encoding, or null if only ISO 8601 is present
+pub fn stackValueGetZonedDateTimeNanos(value: *const StackValue) ?i64 {
+    var nanos: i64 = 0;
+    return if (c.stack_value_get_zoned_datetime_nanos(value, &nanos)) nanos else null;
+}
+
+pub fn stackValueGetZonedDateTimeIso(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_zoned_datetime_iso(value, &len);
+    return ptr[0..len];
+}
+
+pub fn stackValueGetZonedDateTimeTimezone(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_zoned_datetime_timezone(value, &len);
+    return ptr[0..len];
+}
+
+pub fn stackValueGetRemoteRefHandle(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_remote_ref_handle(value, &len);
+    return ptr[0..len];
+}
+
+pub fn stackValueGetRemoteRefRuntime(value: *const StackValue) []const u8 {
+    var len: usize = 0;
+    const ptr = c.stack_value_get_remote_ref_runtime(value, &len);
+    return ptr[0..len];
+}
+
+/// Borrowed view over the items of an array stack value
+/// Items point into the parent value: they must not be destroyed and are
+/// only valid while the parent is alive
+pub const ArrayView = struct {
+    parent: *const StackValue,
+    len: usize,
+
+    pub fn at(self: ArrayView, index: usize) *const StackValue {
+        const item: ?*const StackValue = c.stack_value_get_array_item(self.parent, index);
+        return item.?;
+    }
+};
+
+pub fn stackValueGetArrayView(value: *const StackValue) ArrayView {
+    return ArrayView{
+        .parent = value,
+        .len = c.stack_value_get_array_len(value),
+    };
+}
+
+pub fn stackValueGetRecordLen(value: *const StackValue) usize {
+    return c.stack_value_get_record_len(value);
+}
+
+/// A record field borrowed from its parent stack value
+pub const RecordField = struct {
+    key: []const u8,
+    value: *const StackValue,
+};
+
+/// Iterator over the fields of a record stack value (order unspecified)
+/// Fields borrow from the record, which must outlive the iterator
+pub const RecordIterator = struct {
+    c_iter: *CRecordIterator,
+
+    pub fn next(self: *RecordIterator) ?RecordField {
+        var key: [*c]const u8 = null;
+        var key_len: usize = 0;
+        var value: [*c]const StackValue = null;
+        if (!c.record_iterator_next(self.c_iter, &key, &key_len, &value)) {
+            return null;
+        }
+        return RecordField{
+            .key = key[0..key_len],
+            .value = @ptrCast(value),
+        };
+    }
+
+    pub fn deinit(self: *RecordIterator) void {
+        c.record_iterator_destroy(self.c_iter);
+    }
+};
+
+/// Returns null if value is not a record
+pub fn stackValueGetRecordIterator(value: *const StackValue) ?RecordIterator {
+    const c_iter: *CRecordIterator = c.stack_value_get_record_iterator(value) orelse return null;
+    return RecordIterator{ .c_iter = c_iter };
+}
+
+/// Hash of the deterministic wire encoding of values (record field order does not matter)
+pub fn stackValueArrayHash(values: []const *const StackValue) u64 {
+    return c.stack_value_array_hash(@ptrCast(values.ptr), values.len);
+}
+
 pub fn stackValueDestroy(value: *StackValue) void {
     c.stack_value_destroy(value);
 }
 
+/// Allocate an array for len stack values, to hand to the C side
+/// (see GrpcServerHandler.execute). Release with stackValueArrayFree.
+pub fn stackValueArrayAlloc(len: usize) ?[]?*StackValue {
+    const ptr: [*c]?*StackValue = c.stack_value_array_alloc(len);
+    if (ptr == null) return null;
+    return ptr[0..len];
+}
+
 pub fn stackValueArrayDestroy(array: []*StackValue, len: usize) void {
     c.stack_value_array_destroy(@ptrCast(array.ptr), len);
 }
 
+/// Destroy the non-null values and the array from stackValueArrayAlloc
+pub fn stackValueArrayFree(array: []?*StackValue) void {
+    c.stack_value_array_destroy(array.ptr, array.len);
+}
+
 // =============================================================================
 // Client API
 // =============================================================================
 
-pub fn grpcClientCreate(address: [*:0]const u8) GrpcError!*GrpcClient {
+pub fn grpcClientCreate(address: []const u8) GrpcError!*GrpcClient {
     var client: ?*GrpcClient = null;
-    const err_code = c.grpc_client_create(address, &client);
+    const err_code = c.grpc_client_create_n(address.ptr, address.len, &client);
     try grpcErrorFromCode(err_code);
     return client orelse return error.Internal;
 }
 
+/// Create a client balancing over several addresses of one runtime
+/// addresses[i] has length address_lens[i]; options null = defaults
+pub fn grpcClientCreateWithOptions(
+    addresses: []const [*]const u8,
+    address_lens: []const usize,
+    options: ?*const GrpcClientOptions,
+) GrpcError!*GrpcClient {
+    std.debug.assert(addresses.len == address_lens.len);
+
+    var client: ?*GrpcClient = null;
+    const err_code = c.grpc_client_create_with_options(
+        @ptrCast(addresses.ptr),
+        address_lens.ptr,
+        addresses.len,
+        options,
+        &client,
+    );
+    try grpcErrorFromCode(err_code);
+    return client orelse return error.Internal;
+}
+
+pub fn grpcClientWaitForConnected(client: *GrpcClient, timeout_ms: u32) GrpcError!void {
+    try grpcErrorFromCode(c.grpc_client_wait_for_connected(client, timeout_ms));
+}
+
+pub fn grpcClientIsConnected(client: *const GrpcClient) bool {
+    return c.grpc_client_is_connected(client);
+}
+
+pub fn grpcClientEndpointCount(client: *const GrpcClient) usize {
+    return c.grpc_client_endpoint_count(client);
+}
+
+pub fn grpcClientGetEndpointStats(client: *const GrpcClient, index: usize) GrpcError!GrpcEndpointStats {
+    var stats: GrpcEndpointStats = undefined;
+    const err_code = c.grpc_client_get_endpoint_stats(client, index, &stats);
+    try grpcErrorFromCode(err_code);
+    return stats;
+}
+
+pub fn grpcClientGetStats(client: *const GrpcClient) GrpcClientStats {
+    var stats: GrpcClientStats = undefined;
+    _ = c.grpc_client_get_stats(client, &stats);
+    return stats;
+}
+
+pub fn grpcClientGetSharedMemoryStats(client: *const GrpcClient) GrpcSharedMemoryStats {
+    var stats: GrpcSharedMemoryStats = undefined;
+    _ = c.grpc_client_get_shared_memory_stats(client, &stats);
+    return stats;
+}
+
+pub fn grpcClientMetricsWordCount(client: *const GrpcClient) usize {
+    return c.grpc_client_metrics_word_count(client);
+}
+
+pub const WordMetricsEntry = struct {
+    word_name: []const u8,
+    metrics: GrpcWordMetrics,
+};
+
+pub fn grpcClientGetWordMetrics(client: *const GrpcClient, index: usize) GrpcError!WordMetricsEntry {
+    var name_ptr: [*c]const u8 = undefined;
+    var name_len: usize = 0;
+    var entry: WordMetricsEntry = undefined;
+    const err_code = c.grpc_client_get_word_metrics(client, index, &name_ptr, &name_len, &entry.metrics);
+    try grpcErrorFromCode(err_code);
+    entry.word_name = if (name_len > 0) name_ptr[0..name_len] else "";
+    return entry;
+}
+
+pub fn grpcClientRecordSerialization(client: *GrpcClient, word_name: []const u8, elapsed_ns: u64) void {
+    c.grpc_client_record_serialization(client, word_name.ptr, word_name.len, elapsed_ns);
+}
+
 pub const ExecuteWordResult = struct {
     result_stack: []*StackValue,
     error_info: ?*ErrorInfo,
@@ -180,18 +468,30 @@ pub const ExecuteWordResult = struct {
 
 pub fn grpcClientExecuteWord(
     client: *GrpcClient,
-    word_name: [*:0]const u8,
+    word_name: []const u8,
+    stack: []*const StackValue,
+) GrpcError!ExecuteWordResult {
+    return grpcClientExecuteWordWithOptions(client, word_name, stack, null);
+}
+
+/// Execute a word with a per-call deadline and/or hedging (null = client defaults)
+pub fn grpcClientExecuteWordWithOptions(
+    client: *GrpcClient,
+    word_name: []const u8,
     stack: []*const StackValue,
+    call_options: ?*const GrpcCallOptions,
 ) GrpcError!ExecuteWordResult {
     var result_stack: [*c][*c]StackValue = null;
     var result_len: usize = 0;
     var error_info: ?*ErrorInfo = null;
 
-    const err_code = c.grpc_client_execute_word(
+    const err_code = c.grpc_client_execute_word_with_options(
         client,
-        word_name,
+        word_name.ptr,
+        word_name.len,
         @ptrCast(stack.ptr),
         stack.len,
+        call_options,
         &result_stack,
         &result_len,
         &error_info,
@@ -211,24 +511,333 @@ pub fn grpcClientExecuteWord(
     };
 }
 
+/// Execute word_names in order on one runtime stack, seeded with stack
+/// (ExecuteSequence)
+pub fn grpcClientExecuteSequence(
+    client: *GrpcClient,
+    word_names: []const [*]const u8,
+    word_name_lens: []const usize,
+    stack: []*const StackValue,
+) GrpcError!ExecuteWordResult {
+    var result_stack: [*c][*c]StackValue = null;
+    var result_len: usize = 0;
+    var error_info: ?*ErrorInfo = null;
+
+    const err_code = c.grpc_client_execute_sequence(
+        client,
+        @ptrCast(word_names.ptr),
+        word_name_lens.ptr,
+        word_names.len,
+        @ptrCast(stack.ptr),
+        stack.len,
+        &result_stack,
+        &result_len,
+        &error_info,
+    );
+
+    try grpcErrorFromCode(err_code);
+
+    const result_slice = if (result_len > 0)
+        @as([*]*StackValue, @ptrCast(result_stack))[0..result_len]
+    else
+        &[_]*StackValue{};
+
+    return ExecuteWordResult{
+        .result_stack = result_slice,
+        .error_info = error_info,
+    };
+}
+
+/// Queue a word on the client's ExecuteStream session
+/// return_count: values popped and returned afterwards (null = whole session stack)
+/// Returns the correlation id to pass to grpcClientStreamWait
+pub fn grpcClientStreamSubmit(
+    client: *GrpcClient,
+    word_name: []const u8,
+    push: []*const StackValue,
+    return_count: ?u32,
+) GrpcError!u64 {
+    var correlation_id: u64 = 0;
+    const err_code = c.grpc_client_stream_submit(
+        client,
+        word_name.ptr,
+        word_name.len,
+        @ptrCast(push.ptr),
+        push.len,
+        if (return_count) |n| @as(i64, n) else -1,
+        &correlation_id,
+    );
+    try grpcErrorFromCode(err_code);
+    return correlation_id;
+}
+
+/// Wait for the response to a stream request (responses may be collected in any order)
+pub fn grpcClientStreamWait(client: *GrpcClient, correlation_id: u64) GrpcError!ExecuteWordResult {
+    var result_stack: [*c]?*StackValue = null;
+    var result_len: usize = 0;
+    var error_info: ?*ErrorInfo = null;
+
+    const err_code = c.grpc_client_stream_wait(client, correlation_id, &result_stack, &result_len, &error_info);
+    try grpcErrorFromCode(err_code);
+
+    const result_slice = if (result_len > 0)
+        @as([*]*StackValue, @ptrCast(result_stack))[0..result_len]
+    else
+        &[_]*StackValue{};
+
+    return ExecuteWordResult{
+        .result_stack = result_slice,
+        .error_info = error_info,
+    };
+}
+
+/// Close the client's ExecuteStream session; the next submit opens a new one
+pub fn grpcClientStreamClose(client: *GrpcClient) void {
+    c.grpc_client_stream_close(client);
+}
+
+pub const ChunkedResultStart = struct {
+    /// null if the word failed (see error_info)
+    stream: ?*ResultStream,
+    error_info: ?*ErrorInfo,
+};
+
+/// Execute a word and read its result stack chunk by chunk (resultStreamNext)
+/// max_chunk_bytes: target chunk size (0 = runtime default)
+pub fn grpcClientExecuteWordChunked(
+    client: *GrpcClient,
+    word_name: []const u8,
+    stack: []*const StackValue,
+    max_chunk_bytes: u32,
+) GrpcError!ChunkedResultStart {
+    var stream: ?*ResultStream = null;
+    var error_info: ?*ErrorInfo = null;
+
+    const err_code = c.grpc_client_execute_word_chunked(
+        client,
+        word_name.ptr,
+        word_name.len,
+        @ptrCast(stack.ptr),
+        stack.len,
+        max_chunk_bytes,
+        &stream,
+        &error_info,
+    );
+    try grpcErrorFromCode(err_code);
+
+    return ChunkedResultStart{
+        .stream = stream,
+        .error_info = error_info,
+    };
+}
+
+pub const ResultChunk = struct {
+    kind: ResultChunkKind,
+    stack_index: usize,
+    /// Final chunk for stack_index
+    last: bool,
+    values: []*StackValue,
+
+    pub fn deinit(self: *ResultChunk) void {
+        if (self.values.len > 0) {
+            stackValueArrayDestroy(self.values, self.values.len);
+        }
+    }
+};
+
+pub fn resultStreamResultCount(stream: *const ResultStream) usize {
+    return c.result_stream_result_count(stream);
+}
+
+/// Next chunk of a chunked result, or null once the stream is exhausted
+pub fn resultStreamNext(stream: *ResultStream) GrpcError!?ResultChunk {
+    var kind: ResultChunkKind = RESULT_CHUNK_END;
+    var stack_index: usize = 0;
+    var last = false;
+    var values: [*c]?*StackValue = null;
+    var values_len: usize = 0;
+
+    const err_code = c.result_stream_next(stream, &kind, &stack_index, &last, &values, &values_len);
+    try grpcErrorFromCode(err_code);
+
+    if (kind == RESULT_CHUNK_END) return null;
+
+    return ResultChunk{
+        .kind = kind,
+        .stack_index = stack_index,
+        .last = last,
+        .values = if (values_len > 0) @as([*]*StackValue, @ptrCast(values))[0..values_len] else &[_]*StackValue{},
+    };
+}
+
+/// Cancels the call if chunks remain unread
+pub fn resultStreamDestroy(stream: *ResultStream) void {
+    c.result_stream_destroy(stream);
+}
+
+/// Whether the remote runtime has advertised support for compact temporal fields
+pub fn grpcClientPeerSupportsCompactTemporal(client: *const GrpcClient) bool {
+    return c.grpc_client_peer_supports_compact_temporal(client);
+}
+
+/// Let the remote runtime return large results as remote value handles
+pub fn grpcClientSetAcceptsRemoteRefs(client: *GrpcClient, accepts: bool) void {
+    c.grpc_client_set_accepts_remote_refs(client, accepts);
+}
+
+pub const FetchRefResult = struct {
+    value: ?*StackValue,
+    error_info: ?*ErrorInfo,
+
+    pub fn deinit(self: *FetchRefResult) void {
+        if (self.value) |value| {
+            stackValueDestroy(value);
+        }
+        if (self.error_info) |err_info| {
+            errorInfoDestroy(err_info);
+        }
+    }
+};
+
+pub fn grpcClientFetchRef(client: *GrpcClient, handle_id: []const u8) GrpcError!FetchRefResult {
+    var value: ?*StackValue = null;
+    var error_info: ?*ErrorInfo = null;
+
+    const err_code = c.grpc_client_fetch_ref(client, handle_id.ptr, handle_id.len, &value, &error_info);
+    try grpcErrorFromCode(err_code);
+
+    return FetchRefResult{
+        .value = value,
+        .error_info = error_info,
+    };
+}
+
+/// Release remote handles; handle_ids[i] has length handle_id_lens[i]
+/// Returns the number of handles the runtime actually released
+pub fn grpcClientReleaseRefs(
+    client: *GrpcClient,
+    handle_ids: []const [*]const u8,
+    handle_id_lens: []const usize,
+) GrpcError!usize {
+    std.debug.assert(handle_ids.len == handle_id_lens.len);
+
+    var released: usize = 0;
+    const err_code = c.grpc_client_release_refs(
+        client,
+        @ptrCast(handle_ids.ptr),
+        handle_id_lens.ptr,
+        handle_ids.len,
+        &released,
+    );
+    try grpcErrorFromCode(err_code);
+    return released;
+}
+
 pub fn grpcClientDestroy(client: *GrpcClient) void {
     c.grpc_client_destroy(client);
 }
 
+// =============================================================================
+// Module Discovery API
+// =============================================================================
+
+pub fn grpcClientListModules(client: *GrpcClient) GrpcError!*ModuleList {
+    var list: ?*ModuleList = null;
+    const err_code = c.grpc_client_list_modules(client, &list);
+    try grpcErrorFromCode(err_code);
+    return list orelse error.Unknown;
+}
+
+pub fn moduleListVersion(list: *const ModuleList) []const u8 {
+    var len: usize = 0;
+    const ptr = c.module_list_version(list, &len);
+    return ptr[0..len];
+}
+
+pub fn moduleListCount(list: *const ModuleList) usize {
+    return c.module_list_count(list);
+}
+
+pub fn moduleListName(list: *const ModuleList, index: usize) []const u8 {
+    var len: usize = 0;
+    const ptr = c.module_list_name(list, index, &len);
+    return ptr[0..len];
+}
+
+pub fn moduleListDestroy(list: *ModuleList) void {
+    c.module_list_destroy(list);
+}
+
+pub fn grpcClientGetModuleInfo(client: *GrpcClient, module_name: []const u8) GrpcError!*ModuleInfo {
+    var info: ?*ModuleInfo = null;
+    const err_code = c.grpc_client_get_module_info(client, module_name.ptr, module_name.len, &info);
+    try grpcErrorFromCode(err_code);
+    return info orelse error.Unknown;
+}
+
+pub fn moduleInfoDescription(info: *const ModuleInfo) []const u8 {
+    var len: usize = 0;
+    const ptr = c.module_info_description(info, &len);
+    return ptr[0..len];
+}
+
+pub fn moduleInfoVersion(info: *const ModuleInfo) []const u8 {
+    var len: usize = 0;
+    const ptr = c.module_info_version(info, &len);
+    return ptr[0..len];
+}
+
+pub fn moduleInfoWordCount(info: *const ModuleInfo) usize {
+    return c.module_info_word_count(info);
+}
+
+/// Borrowed view of one word (valid until moduleInfoDestroy)
+pub const WordInfoView = struct {
+    name: []const u8,
+    stack_effect: []const u8,
+    description: []const u8,
+    pure: bool,
+};
+
+pub fn moduleInfoGetWord(info: *const ModuleInfo, index: usize) ?WordInfoView {
+    var word: GrpcWordInfo = undefined;
+    if (!c.module_info_get_word(info, index, &word)) return null;
+    return WordInfoView{
+        .name = word.name[0..word.name_len],
+        .stack_effect = word.stack_effect[0..word.stack_effect_len],
+        .description = word.description[0..word.description_len],
+        .pure = word.pure,
+    };
+}
+
+pub fn moduleInfoDestroy(info: *ModuleInfo) void {
+    c.module_info_destroy(info);
+}
+
 // =============================================================================
 // ErrorInfo API
 // =============================================================================
 
-pub fn errorInfoGetMessage(error_info: *const ErrorInfo) [*:0]const u8 {
-    return c.error_info_get_message(error_info);
+pub fn errorInfoGetMessage(error_info: *const ErrorInfo) []const u8 {
+    var len: usize = 0;
+    const ptr = c.error_info_get_message_view(error_info, &len);
+    return ptr[0..len];
+}
+
+pub fn errorInfoGetRuntime(error_info: *const ErrorInfo) []const u8 {
+    var len: usize = 0;
+    const ptr = c.error_info_get_runtime_view(error_info, &len);
+    return ptr[0..len];
 }
 
-pub fn errorInfoGetRuntime(error_info: *const ErrorInfo) [*:0]const u8 {
-    return c.error_info_get_runtime(error_info);
+pub fn errorInfoGetErrorType(error_info: *const ErrorInfo) []const u8 {
+    var len: usize = 0;
+    const ptr = c.error_info_get_error_type_view(error_info, &len);
+    return ptr[0..len];
 }
 
-pub fn errorInfoGetErrorType(error_info: *const ErrorInfo) [*:0]const u8 {
-    return c.error_info_get_error_type(error_info);
+pub fn errorInfoCreate(message: []const u8, runtime: []const u8, error_type: []const u8) ?*ErrorInfo {
+    return c.error_info_create(message.ptr, message.len, runtime.ptr, runtime.len, error_type.ptr, error_type.len);
 }
 
 pub fn errorInfoDestroy(error_info: *ErrorInfo) void {
@@ -236,7 +845,7 @@ pub fn errorInfoDestroy(error_info: *ErrorInfo) void {
 }
 
 // =============================================================================
-// Server API (Stubs)
+// Server API
 // =============================================================================
 
 pub fn grpcServerCreate(port: u16) GrpcError!*GrpcServer {
@@ -246,6 +855,37 @@ pub fn grpcServerCreate(port: u16) GrpcError!*GrpcServer {
     return server orelse return error.Internal;
 }
 
+/// Create a server on an explicit address ("host:port", "unix:/path/to.sock", "inproc:name", ...)
+pub fn grpcServerCreateAddress(address: []const u8) GrpcError!*GrpcServer {
+    var server: ?*GrpcServer = null;
+    const err_code = c.forthic_grpc_server_create_address(address.ptr, address.len, &server);
+    try grpcErrorFromCode(err_code);
+    return server orelse return error.Internal;
+}
+
+/// Install the callbacks that execute words (required before start)
+pub fn grpcServerSetHandler(server: *GrpcServer, handler: *const GrpcServerHandler) GrpcError!void {
+    const err_code = c.forthic_grpc_server_set_handler(server, handler);
+    try grpcErrorFromCode(err_code);
+}
+
+/// Bound concurrent requests, queue length and request size (before start)
+pub fn grpcServerSetLimits(server: *GrpcServer, limits: *const GrpcServerLimits) GrpcError!void {
+    const err_code = c.forthic_grpc_server_set_limits(server, limits);
+    try grpcErrorFromCode(err_code);
+}
+
+pub fn grpcServerGetStats(server: *const GrpcServer) GrpcServerStats {
+    var stats: GrpcServerStats = undefined;
+    _ = c.forthic_grpc_server_get_stats(server, &stats);
+    return stats;
+}
+
+/// Listening port (resolves port 0 once started)
+pub fn grpcServerGetPort(server: *const GrpcServer) u16 {
+    return c.forthic_grpc_server_get_port(server);
+}
+
 pub fn grpcServerStart(server: *GrpcServer) GrpcError!void {
     const err_code = c.forthic_grpc_server_start(server);
     try grpcErrorFromCode(err_code);
@@ -5,6 +5,15 @@ const ArrayList = std.ArrayList;
 const Value = @import("../forthic/value.zig").Value;
 const c_bindings = @import("c_bindings.zig");
 const serializer = @import("serializer.zig");
+const result_cache = @import("result_cache.zig");
+const ResultCache = result_cache.ResultCache;
+pub const CacheOptions = result_cache.CacheOptions;
+pub const CacheStats = result_cache.CacheStats;
+const manifest_cache = @import("manifest_cache.zig");
+const Manifest = manifest_cache.Manifest;
+const ModuleManifest = manifest_cache.ModuleManifest;
+const WordManifest = manifest_cache.WordManifest;
+const OwnedManifest = manifest_cache.OwnedManifest;
 
 // =============================================================================
 // Error Types
@@ -31,6 +40,156 @@ pub const RemoteError = struct {
     }
 };
 
+// =============================================================================
+// Client and Call Options
+// =============================================================================
+
+pub const LoadBalancing = enum {
+    /// Endpoints in turn
+    round_robin,
+    /// Endpoint with the fewest calls in flight
+    least_outstanding,
+};
+
+/// gRPC message compression (see ClientOptions.compression)
+pub const Compression = enum {
+    none,
+    deflate,
+    gzip,
+};
+
+/// Connection and call behaviour of a GrpcClient (see initWithOptions, initPool)
+pub const ClientOptions = struct {
+    // Channel pool and load balancing
+
+    /// Channels (HTTP/2 connections) per address
+    channels_per_endpoint: u32 = 1,
+    load_balancing: LoadBalancing = .round_robin,
+    /// Consecutive transport failures that eject an endpoint (0 = never)
+    eject_after_failures: u32 = 5,
+    /// Average latency that ejects an endpoint (0 = never)
+    eject_latency_ms: u32 = 0,
+    /// How long an ejected endpoint is left out of rotation
+    ejection_ms: u32 = 30_000,
+
+    // Deadlines and keepalive
+
+    /// Deadline of every call unless CallOptions overrides it (0 = none)
+    deadline_ms: u32 = 0,
+    /// Connect when the client is created, failing with ConnectionFailed if
+    /// no address is reachable within this bound (0 = on the first call)
+    connect_timeout_ms: u32 = 0,
+    /// HTTP/2 keepalive ping interval (0 = no pings)
+    keepalive_time_ms: u32 = 30_000,
+    /// A connection whose ping is not acked in time is closed
+    keepalive_timeout_ms: u32 = 10_000,
+    /// Ping idle connections too
+    keepalive_without_calls: bool = false,
+
+    // Retries and hedging
+
+    /// Attempts for FetchRef, ReleaseRefs and module discovery on UNAVAILABLE
+    retry_max_attempts: u32 = 3,
+    /// Concurrent attempts for idempotent words (1 = no hedging)
+    hedging_max_attempts: u32 = 1,
+    /// Delay before each hedged attempt (0 = p95 of recent call latencies)
+    hedging_delay_ms: u32 = 0,
+
+    // Shared-memory side channel
+
+    /// ExecuteWord stacks of at least this many encoded bytes travel through
+    /// shared memory when the runtime is reached over "unix:" or "inproc:"
+    /// (0 = never)
+    shm_threshold_bytes: u64 = 0,
+    /// Size of the client's shared-memory region (0 = 64 MiB)
+    shm_region_bytes: u64 = 0,
+
+    // Compression
+
+    /// Algorithm for ExecuteWord requests and results across the network
+    compression: Compression = .none,
+    /// Messages smaller than this are not compressed
+    compression_threshold_bytes: u64 = 16 * 1024,
+
+    fn toC(self: ClientOptions) c_bindings.GrpcClientOptions {
+        return .{
+            .channels_per_endpoint = self.channels_per_endpoint,
+            .lb_policy = switch (self.load_balancing) {
+                .round_robin => c_bindings.GRPC_LB_ROUND_ROBIN,
+                .least_outstanding => c_bindings.GRPC_LB_LEAST_OUTSTANDING,
+            },
+            .eject_after_failures = self.eject_after_failures,
+            .eject_latency_ms = self.eject_latency_ms,
+            .ejection_ms = self.ejection_ms,
+            .deadline_ms = self.deadline_ms,
+            .keepalive_time_ms = self.keepalive_time_ms,
+            .keepalive_timeout_ms = self.keepalive_timeout_ms,
+            .keepalive_without_calls = self.keepalive_without_calls,
+            .retry_max_attempts = self.retry_max_attempts,
+            .hedging_max_attempts = self.hedging_max_attempts,
+            .hedging_delay_ms = self.hedging_delay_ms,
+            .shm_threshold_bytes = self.shm_threshold_bytes,
+            .shm_region_bytes = self.shm_region_bytes,
+            .compression = switch (self.compression) {
+                .none => c_bindings.GRPC_COMPRESSION_NONE,
+                .deflate => c_bindings.GRPC_COMPRESSION_DEFLATE,
+                .gzip => c_bindings.GRPC_COMPRESSION_GZIP,
+            },
+            .compression_threshold_bytes = self.compression_threshold_bytes,
+        };
+    }
+};
+
+/// Per-call overrides (see executeWordWithOptions)
+pub const CallOptions = struct {
+    /// Deadline of this call (0 = ClientOptions.deadline_ms)
+    deadline_ms: u32 = 0,
+    /// The word has no side effects, so it may be hedged
+    idempotent: bool = false,
+    /// Let the runtime return remote value handles from this call, for a
+    /// caller that tracks them (see RuntimeManager.enableRemoteRefs)
+    accepts_remote_refs: bool = false,
+
+    fn toC(self: CallOptions) c_bindings.GrpcCallOptions {
+        return .{
+            .deadline_ms = self.deadline_ms,
+            .idempotent = self.idempotent,
+            .accepts_remote_refs = self.accepts_remote_refs,
+        };
+    }
+};
+
+pub const EndpointStats = c_bindings.GrpcEndpointStats;
+/// Payload bytes and compression counters; compressed sizes are estimates
+pub const ClientStats = c_bindings.GrpcClientStats;
+pub const SharedMemoryStats = c_bindings.GrpcSharedMemoryStats;
+/// Per-word call, error, byte and latency counters (see wordMetrics)
+pub const WordMetrics = c_bindings.GrpcWordMetrics;
+pub const LatencyHistogram = c_bindings.GrpcLatencyHistogram;
+pub const WordMetricsEntry = c_bindings.WordMetricsEntry;
+
+/// Upper bound in nanoseconds of the histogram bucket holding the given
+/// quantile (0.0 - 1.0); 0 for an empty histogram
+pub fn latencyPercentile(histogram: *const LatencyHistogram, quantile: f64) u64 {
+    if (histogram.count == 0) return 0;
+
+    const clamped = std.math.clamp(quantile, 0.0, 1.0);
+    const rank: u64 = @max(1, @as(u64, @intFromFloat(@ceil(clamped * @as(f64, @floatFromInt(histogram.count))))));
+
+    var seen: u64 = 0;
+    for (histogram.buckets, 0..) |bucket, i| {
+        seen += bucket;
+        if (seen >= rank) return @as(u64, 1) << @intCast(i);
+    }
+    return @as(u64, 1) << (c_bindings.GRPC_LATENCY_BUCKETS - 1);
+}
+
+/// Mean in nanoseconds; 0 for an empty histogram
+pub fn latencyMean(histogram: *const LatencyHistogram) u64 {
+    if (histogram.count == 0) return 0;
+    return histogram.sum_ns / histogram.count;
+}
+
 // =============================================================================
 // GrpcClient
 // =============================================================================
@@ -40,17 +199,16 @@ pub const GrpcClient = struct {
     allocator: Allocator,
     c_client: *c_bindings.GrpcClient,
     address: []const u8,
+    result_cache: ?*ResultCache,
 
     const Self = @This();
 
     /// Create a new gRPC client connected to the specified address
-    /// Address format: "host:port" (e.g., "localhost:50051")
+    /// Address format: "host:port" (e.g., "localhost:50051"),
+    /// "unix:/path/to.sock" for a runtime on the same host, or "inproc:name"
+    /// for a GrpcServer started on that address in this process
     pub fn init(allocator: Allocator, address: []const u8) ClientError!Self {
-        // Create null-terminated address for C
-        const c_address = allocator.dupeZ(u8, address) catch return error.InvalidAddress;
-        defer allocator.free(c_address);
-
-        const c_client = c_bindings.grpcClientCreate(c_address.ptr) catch |err| {
+        const c_client = c_bindings.grpcClientCreate(address) catch |err| {
             return switch (err) {
                 error.InvalidArgument => error.InvalidAddress,
                 error.Unavailable => error.ConnectionFailed,
@@ -64,15 +222,217 @@ pub const GrpcClient = struct {
             .allocator = allocator,
             .c_client = c_client,
             .address = address_copy,
+            .result_cache = null,
+        };
+    }
+
+    /// Create a client with deadlines, keepalive, retries and hedging
+    pub fn initWithOptions(allocator: Allocator, address: []const u8, options: ClientOptions) ClientError!Self {
+        return initPool(allocator, &[_][]const u8{address}, options);
+    }
+
+    /// Create a client that balances calls over several addresses of one
+    /// runtime, with options.channels_per_endpoint channels each
+    /// address is set to the first address
+    pub fn initPool(allocator: Allocator, addresses: []const []const u8, options: ClientOptions) ClientError!Self {
+        if (addresses.len == 0) return error.InvalidAddress;
+
+        const ptrs = try allocator.alloc([*]const u8, addresses.len);
+        defer allocator.free(ptrs);
+        const lens = try allocator.alloc(usize, addresses.len);
+        defer allocator.free(lens);
+
+        for (addresses, 0..) |address, i| {
+            ptrs[i] = address.ptr;
+            lens[i] = address.len;
+        }
+
+        const c_options = options.toC();
+        const c_client = c_bindings.grpcClientCreateWithOptions(ptrs, lens, &c_options) catch |err| {
+            return switch (err) {
+                error.InvalidArgument => error.InvalidAddress,
+                else => error.ConnectionFailed,
+            };
+        };
+        errdefer c_bindings.grpcClientDestroy(c_client);
+
+        if (options.connect_timeout_ms > 0) {
+            c_bindings.grpcClientWaitForConnected(c_client, options.connect_timeout_ms) catch
+                return error.ConnectionFailed;
+        }
+
+        const address_copy = try allocator.dupe(u8, addresses[0]);
+
+        return Self{
+            .allocator = allocator,
+            .c_client = c_client,
+            .address = address_copy,
+            .result_cache = null,
         };
     }
 
+    /// Connect now instead of on the first call (DNS, TCP and HTTP/2 setup)
+    /// Fails with DeadlineExceeded if no address is ready within timeout_ms
+    pub fn waitForConnected(self: *Self, timeout_ms: u32) ClientError!void {
+        try c_bindings.grpcClientWaitForConnected(self.c_client, timeout_ms);
+    }
+
+    /// Whether a connection is up right now
+    pub fn isConnected(self: *const Self) bool {
+        return c_bindings.grpcClientIsConnected(self.c_client);
+    }
+
+    /// Number of addresses this client balances over
+    pub fn endpointCount(self: *const Self) usize {
+        return c_bindings.grpcClientEndpointCount(self.c_client);
+    }
+
+    /// Load and health counters of one endpoint, in the order given to initPool
+    pub fn endpointStats(self: *const Self, index: usize) ?EndpointStats {
+        return c_bindings.grpcClientGetEndpointStats(self.c_client, index) catch null;
+    }
+
+    /// Bytes sent and received, and how many of them went out compressed
+    pub fn clientStats(self: *const Self) ClientStats {
+        return c_bindings.grpcClientGetStats(self.c_client);
+    }
+
+    /// Counters of the shared-memory side channel (ClientOptions.shm_threshold_bytes)
+    pub fn sharedMemoryStats(self: *const Self) SharedMemoryStats {
+        return c_bindings.grpcClientGetSharedMemoryStats(self.c_client);
+    }
+
+    /// Number of words with metrics, indexable by wordMetrics
+    pub fn metricsWordCount(self: *const Self) usize {
+        return c_bindings.grpcClientMetricsWordCount(self.c_client);
+    }
+
+    /// Metrics of every word called through ExecuteWord, in first-call order
+    /// The word name is owned by the client
+    pub fn wordMetrics(self: *const Self, index: usize) ?WordMetricsEntry {
+        return c_bindings.grpcClientGetWordMetrics(self.c_client, index) catch null;
+    }
+
     /// Close the client and free resources
     pub fn deinit(self: *Self) void {
+        self.disableResultCache();
         c_bindings.grpcClientDestroy(self.c_client);
         self.allocator.free(self.address);
     }
 
+    /// Wire options for outgoing values
+    /// Compact temporal fields are used once the remote runtime has advertised support
+    pub fn serializeOptions(self: *const Self) serializer.SerializeOptions {
+        return .{
+            .temporal_encoding = if (c_bindings.grpcClientPeerSupportsCompactTemporal(self.c_client))
+                .compact
+            else
+                .iso8601,
+        };
+    }
+
+    /// Let the remote runtime keep large results resident and return them as
+    /// remote value handles on every call. Only enable when every caller
+    /// tracks and releases the handles; CallOptions.accepts_remote_refs asks
+    /// for them per call instead
+    pub fn setAcceptsRemoteRefs(self: *Self, accepts: bool) void {
+        c_bindings.grpcClientSetAcceptsRemoteRefs(self.c_client, accepts);
+    }
+
+    /// Fetch the value behind a remote value handle owned by this runtime
+    /// If the runtime could not resolve the handle, its error is returned in
+    /// FetchRefResult.remote_error. Caller must call deinit() on the result
+    pub fn fetchRef(self: *Self, handle_id: []const u8) ClientError!FetchRefResult {
+        var result = try c_bindings.grpcClientFetchRef(self.c_client, handle_id);
+        defer result.deinit();
+
+        if (result.error_info) |err_info| {
+            return FetchRefResult{
+                .value = null,
+                .remote_error = try remoteErrorFromInfo(self.allocator, err_info),
+            };
+        }
+
+        const stack_value = result.value orelse return error.DeserializationError;
+        const value = serializer.deserializeValue(self.allocator, stack_value) catch {
+            return error.DeserializationError;
+        };
+        return FetchRefResult{ .value = value, .remote_error = null };
+    }
+
+    // =========================================================================
+    // Module Discovery
+    // =========================================================================
+
+    /// Manifest version the runtime reports (ListModules)
+    /// Caller owns the returned string; empty if the runtime does not version
+    pub fn manifestVersion(self: *Self, allocator: Allocator) ClientError![]u8 {
+        const list = try c_bindings.grpcClientListModules(self.c_client);
+        defer c_bindings.moduleListDestroy(list);
+        return allocator.dupe(u8, c_bindings.moduleListVersion(list));
+    }
+
+    /// Words of one module (GetModuleInfo), allocated from arena
+    pub fn fetchModule(self: *Self, arena: Allocator, module_name: []const u8) ClientError!ModuleManifest {
+        const info = try c_bindings.grpcClientGetModuleInfo(self.c_client, module_name);
+        defer c_bindings.moduleInfoDestroy(info);
+
+        const words = try arena.alloc(WordManifest, c_bindings.moduleInfoWordCount(info));
+        for (words, 0..) |*word, i| {
+            const view = c_bindings.moduleInfoGetWord(info, i) orelse return error.DeserializationError;
+            word.* = .{
+                .name = try arena.dupe(u8, view.name),
+                .stack_effect = try arena.dupe(u8, view.stack_effect),
+                .description = try arena.dupe(u8, view.description),
+                .pure = view.pure,
+            };
+        }
+
+        return ModuleManifest{
+            .name = try arena.dupe(u8, module_name),
+            .description = try arena.dupe(u8, c_bindings.moduleInfoDescription(info)),
+            .words = words,
+        };
+    }
+
+    /// Manifests of every runtime-specific module: one ListModules call, then
+    /// GetModuleInfo per module. Caller owns the result
+    pub fn fetchManifest(self: *Self, allocator: Allocator) ClientError!OwnedManifest {
+        const list = try c_bindings.grpcClientListModules(self.c_client);
+        defer c_bindings.moduleListDestroy(list);
+
+        var owned = try OwnedManifest.init(allocator, self.address);
+        errdefer owned.deinit();
+        const arena = owned.arena.allocator();
+
+        const modules = try arena.alloc(ModuleManifest, c_bindings.moduleListCount(list));
+        for (modules, 0..) |*module, i| {
+            module.* = try self.fetchModule(arena, c_bindings.moduleListName(list, i));
+        }
+
+        owned.manifest.version = try arena.dupe(u8, c_bindings.moduleListVersion(list));
+        owned.manifest.modules = modules;
+        return owned;
+    }
+
+    /// Release remote value handles owned by this runtime
+    /// Returns the number of handles the runtime actually released
+    pub fn releaseRefs(self: *Self, handle_ids: []const []const u8) ClientError!usize {
+        if (handle_ids.len == 0) return 0;
+
+        const ptrs = try self.allocator.alloc([*]const u8, handle_ids.len);
+        defer self.allocator.free(ptrs);
+        const lens = try self.allocator.alloc(usize, handle_ids.len);
+        defer self.allocator.free(lens);
+
+        for (handle_ids, 0..) |handle_id, i| {
+            ptrs[i] = handle_id.ptr;
+            lens[i] = handle_id.len;
+        }
+
+        return c_bindings.grpcClientReleaseRefs(self.c_client, ptrs, lens);
+    }
+
     /// Execute a word in the remote runtime
     ///
     /// Args:
@@ -90,38 +450,181 @@ pub const GrpcClient = struct {
         word_name: []const u8,
         stack: []const Value,
     ) ClientError!ExecuteWordResult {
-        // Serialize input stack
-        var stack_values = serializer.serializeValueSlice(self.allocator, stack) catch {
-            return error.SerializationError;
+        return self.executeWordWithOptions(word_name, stack, .{});
+    }
+
+    /// Execute a word with a per-call deadline, or hedged if it is idempotent
+    /// A missed deadline fails with error.DeadlineExceeded
+    pub fn executeWordWithOptions(
+        self: *Self,
+        word_name: []const u8,
+        stack: []const Value,
+        call_options: CallOptions,
+    ) ClientError!ExecuteWordResult {
+        const started = std.time.nanoTimestamp();
+        var args = try SerializedArgs.init(self, stack);
+        defer args.deinit(self.allocator);
+
+        return self.executeSerialized(word_name, args.stack_values, call_options, elapsedNs(started));
+    }
+
+    /// Execute words in order on one remote stack, seeded with stack, in a
+    /// single round trip (ExecuteSequence). Returns the final stack; the
+    /// first failing word ends the sequence with a remote error.
+    pub fn executeSequence(
+        self: *Self,
+        word_names: []const []const u8,
+        stack: []const Value,
+    ) ClientError!ExecuteWordResult {
+        var args = try SerializedArgs.init(self, stack);
+        defer args.deinit(self.allocator);
+
+        const name_ptrs = try self.allocator.alloc([*]const u8, word_names.len);
+        defer self.allocator.free(name_ptrs);
+        const name_lens = try self.allocator.alloc(usize, word_names.len);
+        defer self.allocator.free(name_lens);
+        for (word_names, 0..) |name, i| {
+            name_ptrs[i] = name.ptr;
+            name_lens[i] = name.len;
+        }
+
+        var result = try c_bindings.grpcClientExecuteSequence(self.c_client, name_ptrs, name_lens, args.stack_values);
+        return self.takeResult(&result);
+    }
+
+    /// Execute a word whose result depends only on its arguments
+    ///
+    /// With the result cache enabled, a fresh result for the same word and
+    /// argument bytes is returned without an RPC. Remote errors and results
+    /// holding remote value handles are never cached. Such words are also
+    /// safe to hedge (ClientOptions.hedging_max_attempts).
+    pub fn executeWordCached(
+        self: *Self,
+        word_name: []const u8,
+        stack: []const Value,
+    ) ClientError!ExecuteWordResult {
+        return self.executeWordCachedWithOptions(word_name, stack, .{});
+    }
+
+    /// executeWordCached with per-call options (always hedgeable)
+    pub fn executeWordCachedWithOptions(
+        self: *Self,
+        word_name: []const u8,
+        stack: []const Value,
+        call_options: CallOptions,
+    ) ClientError!ExecuteWordResult {
+        var options = call_options;
+        options.idempotent = true;
+
+        const cache = self.result_cache orelse
+            return self.executeWordWithOptions(word_name, stack, options);
+
+        const started = std.time.nanoTimestamp();
+        var args = try SerializedArgs.init(self, stack);
+        defer args.deinit(self.allocator);
+        const serialize_ns = elapsedNs(started);
+
+        const key = ResultCache.Key{
+            .word_name = word_name,
+            .args_hash = c_bindings.stackValueArrayHash(args.stack_values),
         };
-        defer serializer.freeStackValueArray(self.allocator, stack_values);
 
-        // Convert to const slice for C API
-        var const_stack = try self.allocator.alloc(*const c_bindings.StackValue, stack_values.len);
-        defer self.allocator.free(const_stack);
+        if (try cache.get(self.allocator, key)) |cached| {
+            return ExecuteWordResult{ .values = ArrayList(Value).fromOwnedSlice(cached), .remote_error = null };
+        }
+
+        var result = try self.executeSerialized(word_name, args.stack_values, options, serialize_ns);
+        errdefer result.deinit(self.allocator);
+
+        if (result.remote_error == null and result_cache.isCacheable(result.values.items)) {
+            try cache.put(key, result.values.items);
+        }
+        return result;
+    }
+
+    /// Cache results of executeWordCached (replaces any existing cache)
+    pub fn enableResultCache(self: *Self, options: CacheOptions) Allocator.Error!void {
+        self.disableResultCache();
+        const cache = try self.allocator.create(ResultCache);
+        cache.* = ResultCache.init(self.allocator, options);
+        self.result_cache = cache;
+    }
 
-        for (stack_values, 0..) |sv, i| {
-            const_stack[i] = sv orelse return error.SerializationError;
+    pub fn disableResultCache(self: *Self) void {
+        if (self.result_cache) |cache| {
+            cache.deinit();
+            self.allocator.destroy(cache);
+            self.result_cache = null;
         }
+    }
+
+    /// Hit/miss counters of the result cache, or null if it is disabled
+    pub fn cacheStats(self: *const Self) ?CacheStats {
+        const cache = self.result_cache orelse return null;
+        return cache.getStats();
+    }
+
+    /// Arguments serialized once, for both the cache key and the RPC
+    const SerializedArgs = struct {
+        owned: []?*c_bindings.StackValue,
+        stack_values: []*const c_bindings.StackValue,
+
+        fn init(client: *const Self, stack: []const Value) ClientError!SerializedArgs {
+            const owned = serializer.serializeValueSlice(client.allocator, stack, client.serializeOptions()) catch {
+                return error.SerializationError;
+            };
+            errdefer serializer.freeStackValueArray(client.allocator, owned);
 
-        // Create C string for word name
-        const c_word_name = try self.allocator.dupeZ(u8, word_name);
-        defer self.allocator.free(c_word_name);
+            const stack_values = try client.allocator.alloc(*const c_bindings.StackValue, owned.len);
+            errdefer client.allocator.free(stack_values);
+
+            for (owned, 0..) |sv, i| {
+                stack_values[i] = sv orelse return error.SerializationError;
+            }
+
+            return SerializedArgs{ .owned = owned, .stack_values = stack_values };
+        }
 
-        // Execute the word via gRPC
-        var result = try c_bindings.grpcClientExecuteWord(
+        fn deinit(self: *SerializedArgs, allocator: Allocator) void {
+            allocator.free(self.stack_values);
+            serializer.freeStackValueArray(allocator, self.owned);
+        }
+    };
+
+    /// serialize_ns: time spent serializing the arguments, added to the
+    /// word's serialization histogram together with deserializing the result
+    fn executeSerialized(
+        self: *Self,
+        word_name: []const u8,
+        const_stack: []*const c_bindings.StackValue,
+        call_options: CallOptions,
+        serialize_ns: u64,
+    ) ClientError!ExecuteWordResult {
+        // Execute the word via gRPC (the C++ side times the RPC itself)
+        const c_call_options = call_options.toC();
+        var result = try c_bindings.grpcClientExecuteWordWithOptions(
             self.c_client,
-            c_word_name.ptr,
+            word_name,
             const_stack,
+            &c_call_options,
         );
 
+        const started = std.time.nanoTimestamp();
+        defer c_bindings.grpcClientRecordSerialization(self.c_client, word_name, serialize_ns +| elapsedNs(started));
+        return self.takeResult(&result);
+    }
+
+    fn elapsedNs(started: i128) u64 {
+        return @intCast(std.math.clamp(std.time.nanoTimestamp() - started, 0, std.math.maxInt(u64)));
+    }
+
+    /// Convert a C result into an ExecuteWordResult, consuming the C result
+    fn takeResult(self: *Self, result: *c_bindings.ExecuteWordResult) ClientError!ExecuteWordResult {
         // Check for remote execution error
         if (result.error_info) |err_info| {
             defer c_bindings.errorInfoDestroy(err_info);
 
-            const message = try self.allocator.dupe(u8, std.mem.span(c_bindings.errorInfoGetMessage(err_info)));
-            const runtime = try self.allocator.dupe(u8, std.mem.span(c_bindings.errorInfoGetRuntime(err_info)));
-            const error_type = try self.allocator.dupe(u8, std.mem.span(c_bindings.errorInfoGetErrorType(err_info)));
+            const remote_error = try remoteErrorFromInfo(self.allocator, err_info);
 
             // Clean up result stack if present
             if (result.result_stack.len > 0) {
@@ -129,42 +632,184 @@ pub const GrpcClient = struct {
             }
 
             return ExecuteWordResult{
-                .values = ArrayList(Value).init(self.allocator),
-                .remote_error = RemoteError{
-                    .message = message,
-                    .runtime = runtime,
-                    .error_type = error_type,
-                },
+                .values = .{},
+                .remote_error = remote_error,
             };
         }
 
-        // Deserialize result stack
-        var values = ArrayList(Value).init(self.allocator);
+        // Deserialize result stack, then clean up the C result
+        defer result.deinit();
+
+        var values: ArrayList(Value) = .{};
         errdefer {
             for (values.items) |*val| {
                 val.deinit(self.allocator);
             }
-            values.deinit();
+            values.deinit(self.allocator);
         }
+        try values.ensureTotalCapacity(self.allocator, result.result_stack.len);
 
         for (result.result_stack) |stack_value| {
             const value = serializer.deserializeValue(self.allocator, stack_value) catch {
-                // Clean up partial results
-                result.deinit();
                 return error.DeserializationError;
             };
-            try values.append(self.allocator, value);
+            values.appendAssumeCapacity(value);
         }
 
-        // Clean up C result
-        result.deinit();
-
         return ExecuteWordResult{
             .values = values,
             .remote_error = null,
         };
     }
 
+    // =========================================================================
+    // Pipelined execution (ExecuteStream)
+    // =========================================================================
+
+    /// Queue a word on this client's ExecuteStream session without waiting
+    ///
+    /// The session keeps a stack on the remote side between requests, so only
+    /// deltas travel:
+    ///   - push: values pushed onto the session stack before the word runs
+    ///   - return_count: values popped and returned afterwards
+    ///     (null returns and clears the whole session stack)
+    ///
+    /// Any number of requests may be in flight; collect each one with
+    /// awaitStream, in any order. Returns the request's correlation id.
+    pub fn submitStream(
+        self: *Self,
+        word_name: []const u8,
+        push: []const Value,
+        return_count: ?u32,
+    ) ClientError!u64 {
+        var args = try SerializedArgs.init(self, push);
+        defer args.deinit(self.allocator);
+
+        return c_bindings.grpcClientStreamSubmit(self.c_client, word_name, args.stack_values, return_count);
+    }
+
+    /// Wait for the result of a submitted stream request
+    pub fn awaitStream(self: *Self, correlation_id: u64) ClientError!ExecuteWordResult {
+        var result = try c_bindings.grpcClientStreamWait(self.c_client, correlation_id);
+        return self.takeResult(&result);
+    }
+
+    /// Submit a stream request and wait for its result
+    pub fn executeStreamed(
+        self: *Self,
+        word_name: []const u8,
+        push: []const Value,
+        return_count: ?u32,
+    ) ClientError!ExecuteWordResult {
+        const correlation_id = try self.submitStream(word_name, push, return_count);
+        return self.awaitStream(correlation_id);
+    }
+
+    /// Close the stream session; its remote stack is discarded
+    pub fn closeStream(self: *Self) void {
+        c_bindings.grpcClientStreamClose(self.c_client);
+    }
+
+    // =========================================================================
+    // Chunked results (ExecuteWordChunked)
+    // =========================================================================
+
+    /// Execute a word and consume its result stack lazily, chunk by chunk
+    ///
+    /// Large top-level arrays arrive as runs of elements, so only one chunk
+    /// (max_chunk_bytes, 0 = runtime default) is in flight at a time and the
+    /// first elements can be used before the last ones are sent.
+    /// A remote error is reported through ResultStream.remote_error.
+    pub fn openResultStream(
+        self: *Self,
+        word_name: []const u8,
+        stack: []const Value,
+        max_chunk_bytes: u32,
+    ) ClientError!ResultStream {
+        var args = try SerializedArgs.init(self, stack);
+        defer args.deinit(self.allocator);
+
+        const start = try c_bindings.grpcClientExecuteWordChunked(
+            self.c_client,
+            word_name,
+            args.stack_values,
+            max_chunk_bytes,
+        );
+
+        if (start.error_info) |err_info| {
+            defer c_bindings.errorInfoDestroy(err_info);
+            return ResultStream{
+                .allocator = self.allocator,
+                .c_stream = null,
+                .remote_error = try remoteErrorFromInfo(self.allocator, err_info),
+            };
+        }
+
+        return ResultStream{
+            .allocator = self.allocator,
+            .c_stream = start.stream orelse return error.Internal,
+            .remote_error = null,
+        };
+    }
+
+    /// Execute a word through ExecuteWordChunked, assembling the result stack
+    /// as chunks arrive (arrays grow element run by element run instead of
+    /// the whole response being buffered first)
+    pub fn executeWordChunked(
+        self: *Self,
+        word_name: []const u8,
+        stack: []const Value,
+        max_chunk_bytes: u32,
+    ) ClientError!ExecuteWordResult {
+        var stream = try self.openResultStream(word_name, stack, max_chunk_bytes);
+        defer stream.deinit();
+
+        if (stream.remote_error) |remote_error| {
+            stream.remote_error = null;
+            return ExecuteWordResult{ .values = .{}, .remote_error = remote_error };
+        }
+
+        var result = ExecuteWordResult{ .values = .{}, .remote_error = null };
+        errdefer result.deinit(self.allocator);
+        try result.values.ensureTotalCapacity(self.allocator, stream.resultCount());
+
+        while (try stream.next()) |next_chunk| {
+            var chunk = next_chunk;
+            // Once the values have moved into the result only the slice is freed
+            var moved = false;
+            defer if (moved) self.allocator.free(chunk.values) else chunk.deinit(self.allocator);
+
+            const values = &result.values;
+            switch (chunk.kind) {
+                .value => {
+                    if (chunk.stack_index != values.items.len or chunk.values.len != 1) {
+                        return error.DeserializationError;
+                    }
+                    try values.append(self.allocator, chunk.values[0]);
+                    moved = true;
+                },
+                .array_elements => {
+                    // The first run of an array opens it; later runs extend it
+                    if (chunk.stack_index == values.items.len) {
+                        try values.append(self.allocator, Value.initArray(self.allocator));
+                    } else if (chunk.stack_index + 1 != values.items.len) {
+                        return error.DeserializationError;
+                    }
+                    const array = &values.items[chunk.stack_index];
+                    if (array.* != .array_value) return error.DeserializationError;
+
+                    try array.array_value.appendSlice(self.allocator, chunk.values);
+                    moved = true;
+                },
+            }
+        }
+
+        if (result.values.items.len != stream.resultCount()) {
+            return error.DeserializationError;
+        }
+        return result;
+    }
+
     /// Execute a word and expect a single result value
     /// Convenience wrapper around executeWord for common case
     pub fn executeWordSingle(
@@ -205,6 +850,81 @@ pub const GrpcClient = struct {
 // Result Types
 // =============================================================================
 
+/// Lazily consumed result stack of ExecuteWordChunked (see openResultStream)
+pub const ResultStream = struct {
+    allocator: Allocator,
+    /// null if the word failed
+    c_stream: ?*c_bindings.ResultStream,
+    /// Set if the word failed; owned by the stream
+    remote_error: ?RemoteError,
+
+    pub const Chunk = struct {
+        /// Position in the result stack (bottom = 0)
+        stack_index: usize,
+        kind: Kind,
+        /// .value: the one complete value
+        /// .array_elements: the next elements of the array at stack_index
+        /// Owned by the caller (deinit)
+        values: []Value,
+        /// No more chunks follow for stack_index
+        last: bool,
+
+        pub const Kind = enum { value, array_elements };
+
+        pub fn deinit(self: *Chunk, allocator: Allocator) void {
+            for (self.values) |*value| value.deinit(allocator);
+            allocator.free(self.values);
+        }
+    };
+
+    /// Number of values in the result stack
+    pub fn resultCount(self: *const ResultStream) usize {
+        const c_stream = self.c_stream orelse return 0;
+        return c_bindings.resultStreamResultCount(c_stream);
+    }
+
+    /// Next chunk, or null once the result stack is complete
+    pub fn next(self: *ResultStream) ClientError!?Chunk {
+        const c_stream = self.c_stream orelse return null;
+
+        var c_chunk = (try c_bindings.resultStreamNext(c_stream)) orelse return null;
+        defer c_chunk.deinit();
+
+        const values = try self.allocator.alloc(Value, c_chunk.values.len);
+        var deserialized: usize = 0;
+        errdefer {
+            for (values[0..deserialized]) |*value| value.deinit(self.allocator);
+            self.allocator.free(values);
+        }
+
+        for (c_chunk.values, 0..) |stack_value, i| {
+            values[i] = serializer.deserializeValue(self.allocator, stack_value) catch {
+                return error.DeserializationError;
+            };
+            deserialized += 1;
+        }
+
+        return Chunk{
+            .stack_index = c_chunk.stack_index,
+            .kind = if (c_chunk.kind == c_bindings.RESULT_CHUNK_ARRAY_ELEMENTS) .array_elements else .value,
+            .values = values,
+            .last = c_chunk.last,
+        };
+    }
+
+    /// Cancels the call if chunks remain unread
+    pub fn deinit(self: *ResultStream) void {
+        if (self.c_stream) |c_stream| {
+            c_bindings.resultStreamDestroy(c_stream);
+            self.c_stream = null;
+        }
+        if (self.remote_error) |*err| {
+            err.deinit(self.allocator);
+            self.remote_error = null;
+        }
+    }
+};
+
 pub const ExecuteWordResult = struct {
     values: ArrayList(Value),
     remote_error: ?RemoteError,
@@ -213,7 +933,7 @@ pub const ExecuteWordResult = struct {
         for (self.values.items) |*val| {
             val.deinit(allocator);
         }
-        self.values.deinit();
+        self.values.deinit(allocator);
 
         if (self.remote_error) |*err| {
             err.deinit(allocator);
@@ -233,10 +953,52 @@ pub const ExecuteWordResult = struct {
     }
 };
 
+pub const FetchRefResult = struct {
+    /// null if the runtime reported an error
+    value: ?Value,
+    remote_error: ?RemoteError,
+
+    pub fn deinit(self: *FetchRefResult, allocator: Allocator) void {
+        if (self.value) |*value| {
+            value.deinit(allocator);
+        }
+
+        if (self.remote_error) |*err| {
+            err.deinit(allocator);
+        }
+    }
+
+    pub fn isError(self: *const FetchRefResult) bool {
+        return self.remote_error != null;
+    }
+
+    /// Move the value out; the result no longer owns it
+    pub fn takeValue(self: *FetchRefResult) ?Value {
+        const value = self.value;
+        self.value = null;
+        return value;
+    }
+};
+
 // =============================================================================
 // Helper Functions
 // =============================================================================
 
+/// Copy a C ErrorInfo into a RemoteError (the ErrorInfo stays owned by the caller)
+fn remoteErrorFromInfo(allocator: Allocator, err_info: *const c_bindings.ErrorInfo) Allocator.Error!RemoteError {
+    const message = try allocator.dupe(u8, c_bindings.errorInfoGetMessage(err_info));
+    errdefer allocator.free(message);
+    const runtime = try allocator.dupe(u8, c_bindings.errorInfoGetRuntime(err_info));
+    errdefer allocator.free(runtime);
+    const error_type = try allocator.dupe(u8, c_bindings.errorInfoGetErrorType(err_info));
+
+    return RemoteError{
+        .message = message,
+        .runtime = runtime,
+        .error_type = error_type,
+    };
+}
+
 /// Create a GrpcClient for localhost with default port
 pub fn initLocalhost(allocator: Allocator) ClientError!GrpcClient {
     return GrpcClient.init(allocator, "localhost:50051");
@@ -9,9 +9,28 @@
 #include "../../gen/protos/forthic_runtime.pb.h"
 #include "../../gen/protos/forthic_runtime.grpc.pb.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <grpcpp/grpcpp.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 using grpc::Server;
@@ -27,26 +46,255 @@ using forthic::ExecuteWordRequest;
 using forthic::ExecuteWordResponse;
 using forthic::ExecuteSequenceRequest;
 using forthic::ExecuteSequenceResponse;
+using forthic::ListModulesRequest;
+using forthic::ListModulesResponse;
+using forthic::GetModuleInfoRequest;
+using forthic::GetModuleInfoResponse;
+using forthic::FetchRefRequest;
+using forthic::FetchRefResponse;
+using forthic::ReleaseRefsRequest;
+using forthic::ReleaseRefsResponse;
+using forthic::StreamRequest;
+using forthic::StreamResponse;
+using forthic::ResultChunk;
+using forthic::SharedPayload;
 using ProtoErrorInfo = forthic::ErrorInfo;
+using ProtoStackValues = google::protobuf::RepeatedPtrField<forthic::StackValue>;
 
 // =============================================================================
 // Internal C++ Structures
 // =============================================================================
 
+class ForthicRuntimeServiceImpl;
+
+// Server-side load shedding: at most max_in_flight requests run, at most
+// max_queued wait for a slot, the rest fail fast with RESOURCE_EXHAUSTED
+struct AdmissionControl {
+    GrpcServerLimits limits{};
+
+    // Guards the counts below
+    std::mutex mu;
+    std::condition_variable cv;
+    uint32_t in_flight = 0;
+    uint32_t queued = 0;
+    uint32_t peak_queued = 0;
+
+    std::atomic<uint64_t> admitted{0};
+    std::atomic<uint64_t> rejected{0};
+    std::atomic<uint64_t> budget_exceeded{0};
+};
+
 struct GrpcServer {
     std::unique_ptr<Server> server;
+    std::unique_ptr<ForthicRuntimeServiceImpl> service;
+    GrpcServerHandler handler{};
+    bool has_handler = false;
+    AdmissionControl admission;
     uint16_t port;
+    // Listening address; empty means 0.0.0.0:port
+    std::string address;
+
+    ~GrpcServer();
+};
+
+// One address of a runtime, reached over one or more channels. Health is
+// tracked per endpoint: consecutive transport failures or a slow latency
+// average take it out of rotation for ejection_ms.
+struct Endpoint {
+    std::string address;
+    // channels[i] backs stubs[i]
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    std::vector<std::unique_ptr<ForthicRuntime::Stub>> stubs;
+    std::atomic<uint32_t> next_stub{0};
+    std::atomic<uint32_t> outstanding{0};
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> failures{0};
+
+    // Guards the health fields below
+    std::mutex mu;
+    uint32_t consecutive_failures = 0;
+    uint32_t latency_samples = 0;
+    double latency_ewma_ms = 0.0;
+    std::chrono::steady_clock::time_point ejected_until{};
+};
+
+class ChannelLease;
+class SharedRegionWriter;
+
+// Lock-free histogram behind GrpcLatencyHistogram
+struct LatencyHistogram {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum_ns{0};
+    std::atomic<uint64_t> buckets[GRPC_LATENCY_BUCKETS] = {};
+};
+
+// Counters of one word, behind GrpcWordMetrics
+struct WordMetrics {
+    std::string word_name;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> word_errors{0};
+    std::atomic<uint64_t> status_counts[GRPC_STATUS_SLOTS] = {};
+    std::atomic<uint64_t> request_bytes{0};
+    std::atomic<uint64_t> response_bytes{0};
+    LatencyHistogram rpc;
+    LatencyHistogram serialization;
+};
+
+// Per-word metrics of one client. The lock guards only the index; counters
+// are updated without it.
+struct ClientMetrics {
+    std::shared_mutex mu;
+    std::unordered_map<std::string, WordMetrics*> by_name;
+    // First-call order; entries are never removed, so pointers stay valid
+    std::deque<std::unique_ptr<WordMetrics>> words;
+};
+
+// Payload and compression counters behind GrpcClientStats
+struct TransferStats {
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> bytes_received{0};
+    std::atomic<uint64_t> compressed_messages_sent{0};
+    std::atomic<uint64_t> compressed_messages_received{0};
+    std::atomic<uint64_t> compression_input_bytes{0};
+};
+
+// Latencies of the most recent successful ExecuteWord calls, for the
+// adaptive (p95) hedging delay
+struct LatencyWindow {
+    static constexpr size_t kCapacity = 256;
+
+    std::mutex mu;
+    double samples_ms[kCapacity] = {};
+    size_t count = 0;
+    size_t next = 0;
+};
+
+// One ExecuteStream call per client. A reader thread files responses by
+// correlation id so that callers can wait for them in any order.
+struct ClientStream {
+    std::unique_ptr<ChannelLease> lease;
+    ClientContext context;
+    std::unique_ptr<grpc::ClientReaderWriter<StreamRequest, StreamResponse>> rpc;
+    std::thread reader;
+    std::mutex mu;
+    std::condition_variable cv;
+    std::unordered_map<uint64_t, StreamResponse> completed;
+    bool finished = false;
+    // Requests on this stream have correlation ids from here on. Earlier ids
+    // went out on a stream that has since ended; whatever of theirs had
+    // arrived is carried over into completed.
+    uint64_t first_correlation_id = 0;
 };
 
 struct GrpcClient {
-    std::shared_ptr<Channel> channel;
-    std::unique_ptr<ForthicRuntime::Stub> stub;
+    std::vector<std::unique_ptr<Endpoint>> endpoints;
+    GrpcClientOptions options{};
+    std::atomic<uint32_t> next_endpoint{0};
+    LatencyWindow latencies;
+    std::atomic<bool> peer_supports_compact_temporal{false};
+    std::atomic<bool> accepts_remote_refs{false};
+    TransferStats transfer;
+    ClientMetrics metrics;
+
+    // Guards stream creation, writes and correlation ids. Waiters hold
+    // their own reference, so close may drop the stream under them
+    std::mutex stream_mu;
+    std::shared_ptr<ClientStream> stream;
+    std::atomic<uint64_t> next_correlation_id{1};
+
+    // Shared-memory side channel (options.shm_threshold_bytes)
+    std::unique_ptr<SharedRegionWriter> shm_region;
+    std::atomic<bool> shm_active{false};
+    std::atomic<uint64_t> shm_requests{0};
+    std::atomic<uint64_t> shm_results{0};
+    std::atomic<uint64_t> shm_fallbacks{0};
+
+    ~GrpcClient();
 };
 
+// StackValue handles are read through proto(). Handles the C API creates
+// or returns as non-const are OwnedStackValue; borrowed handles into a
+// parent message are StackValueView.
+struct StackValueView;
+
 struct StackValue {
+    const ProtoStackValue& proto() const { return *proto_; }
+
+    // Borrowed view of one array item, built for all items on first use
+    const StackValue* array_item(int index) const;
+
+protected:
+    explicit StackValue(const ProtoStackValue* proto) : proto_(proto) {}
+    ~StackValue();
+
+    const ProtoStackValue* proto_;
+    mutable std::once_flag items_once_;
+    mutable std::unique_ptr<StackValueView[]> items_;
+};
+
+struct OwnedStackValue : StackValue {
+    OwnedStackValue() : StackValue(&proto_value) {}
     ProtoStackValue proto_value;
 };
 
+struct StackValueView : StackValue {
+    StackValueView() : StackValue(nullptr) {}
+    explicit StackValueView(const ProtoStackValue& proto) : StackValue(&proto) {}
+    void reset(const ProtoStackValue& proto) { proto_ = &proto; }
+};
+
+StackValue::~StackValue() = default;
+
+const StackValue* StackValue::array_item(int index) const {
+    std::call_once(items_once_, [this] {
+        const auto& items = proto_->array_value().items();
+        items_.reset(new StackValueView[items.size()]);
+        for (int i = 0; i < items.size(); i++) items_[i].reset(items.Get(i));
+    });
+    return &items_[index];
+}
+
+// Non-const handles from the C API are always owned
+static OwnedStackValue* owned_value(StackValue* value) {
+    return static_cast<OwnedStackValue*>(value);
+}
+
+struct ModuleList {
+    ListModulesResponse response;
+};
+
+struct ModuleInfo {
+    GetModuleInfoResponse response;
+};
+
+// One ExecuteWordChunked call, read chunk by chunk
+struct ResultStream {
+    GrpcClient* client = nullptr;
+    std::unique_ptr<ChannelLease> lease;
+    ClientContext context;
+    std::unique_ptr<grpc::ClientReader<ResultChunk>> reader;
+    size_t result_count = 0;
+    bool finished = false;
+};
+
+static const std::string kEmptyString;
+
+static const char* string_view_out(const std::string& str, size_t* out_len) {
+    if (out_len) *out_len = str.size();
+    return str.data();
+}
+
+static std::string string_from_n(const char* data, size_t len) {
+    return data ? std::string(data, len) : std::string();
+}
+
+struct RecordIterator {
+    google::protobuf::Map<std::string, ProtoStackValue>::const_iterator current;
+    google::protobuf::Map<std::string, ProtoStackValue>::const_iterator end;
+    // Field views stay valid until the iterator is destroyed
+    std::deque<StackValueView> views;
+};
+
 struct ErrorInfo {
     std::string message;
     std::string runtime;
@@ -57,6 +305,29 @@ struct ErrorInfo {
 // Helper Functions
 // =============================================================================
 
+static ErrorInfo* error_info_from_proto(const ProtoErrorInfo& proto) {
+    auto* error = new ErrorInfo();
+    error->message = proto.message();
+    error->runtime = proto.runtime();
+    error->error_type = proto.error_type();
+    return error;
+}
+
+// Move a repeated result stack into a malloc'd array of StackValue handles
+static void take_result_stack(ProtoStackValues* stack, StackValue*** out_result_stack, size_t* out_result_len) {
+    size_t result_len = stack->size();
+    auto** result_array = (StackValue**)malloc(sizeof(StackValue*) * result_len);
+
+    for (size_t i = 0; i < result_len; i++) {
+        auto* value = new OwnedStackValue();
+        value->proto_value.Swap(stack->Mutable(static_cast<int>(i)));
+        result_array[i] = value;
+    }
+
+    *out_result_stack = result_array;
+    *out_result_len = result_len;
+}
+
 static GrpcErrorCode status_to_error_code(const Status& status) {
     if (status.ok()) return GRPC_OK;
 
@@ -87,245 +358,2832 @@ static GrpcErrorCode status_to_error_code(const Status& status) {
             return GRPC_ERROR_DATA_LOSS;
         case grpc::StatusCode::UNAUTHENTICATED:
             return GRPC_ERROR_UNAUTHENTICATED;
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+            return GRPC_ERROR_DEADLINE_EXCEEDED;
         default:
             return GRPC_ERROR_UNKNOWN;
     }
 }
 
 // =============================================================================
-// StackValue API Implementation
+// Channel Pool and Endpoint Health
 // =============================================================================
 
-extern "C" StackValue* stack_value_create_null(void) {
-    auto* value = new StackValue();
-    value->proto_value.mutable_null_value();
-    return value;
-}
+// Weight of the newest sample in the per-endpoint latency average
+static constexpr double kLatencyEwmaAlpha = 0.2;
+// Samples needed before the latency average can eject an endpoint
+static constexpr uint32_t kMinLatencySamples = 5;
 
-extern "C" StackValue* stack_value_create_int(int64_t val) {
-    auto* value = new StackValue();
-    value->proto_value.set_int_value(val);
-    return value;
+static bool endpoint_available(Endpoint* endpoint, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(endpoint->mu);
+    return now >= endpoint->ejected_until;
 }
 
-extern "C" StackValue* stack_value_create_string(const char* val) {
-    auto* value = new StackValue();
-    value->proto_value.set_string_value(val);
-    return value;
-}
+// Pick the endpoint for the next call. Ejected endpoints are skipped unless
+// every endpoint is ejected, in which case all of them are candidates again.
+static Endpoint* select_endpoint(GrpcClient* client) {
+    const size_t count = client->endpoints.size();
+    if (count == 1) return client->endpoints[0].get();
 
-extern "C" StackValue* stack_value_create_bool(bool val) {
-    auto* value = new StackValue();
-    value->proto_value.set_bool_value(val);
-    return value;
+    const auto now = std::chrono::steady_clock::now();
+    const size_t start = client->next_endpoint.fetch_add(1, std::memory_order_relaxed) % count;
+
+    Endpoint* best = nullptr;
+    for (int pass = 0; pass < 2 && !best; pass++) {
+        for (size_t i = 0; i < count; i++) {
+            Endpoint* endpoint = client->endpoints[(start + i) % count].get();
+            if (pass == 0 && !endpoint_available(endpoint, now)) continue;
+
+            if (client->options.lb_policy == GRPC_LB_ROUND_ROBIN) {
+                best = endpoint;
+                break;
+            }
+            if (!best || endpoint->outstanding.load(std::memory_order_relaxed) <
+                             best->outstanding.load(std::memory_order_relaxed)) {
+                best = endpoint;
+            }
+        }
+    }
+    return best;
 }
 
-extern "C" StackValue* stack_value_create_float(double val) {
-    auto* value = new StackValue();
-    value->proto_value.set_float_value(val);
-    return value;
+// Failures that say something about the endpoint rather than the request
+static bool is_transport_failure(const Status& status) {
+    switch (status.error_code()) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        case grpc::StatusCode::INTERNAL:
+            return true;
+        default:
+            return false;
+    }
 }
 
-extern "C" StackValue* stack_value_create_array(const StackValue* const* items, size_t len) {
-    auto* value = new StackValue();
-    auto* array = value->proto_value.mutable_array_value();
+static void record_call(const GrpcClientOptions& options, Endpoint* endpoint, const Status& status,
+                        const double* latency_ms) {
+    endpoint->requests.fetch_add(1, std::memory_order_relaxed);
+    const bool failed = is_transport_failure(status);
+    if (failed) endpoint->failures.fetch_add(1, std::memory_order_relaxed);
 
-    for (size_t i = 0; i < len; i++) {
-        *array->add_items() = items[i]->proto_value;
+    std::lock_guard<std::mutex> lock(endpoint->mu);
+    bool eject = false;
+
+    if (failed) {
+        endpoint->consecutive_failures++;
+        eject = options.eject_after_failures > 0 &&
+                endpoint->consecutive_failures >= options.eject_after_failures;
+    } else {
+        endpoint->consecutive_failures = 0;
+        if (latency_ms) {
+            endpoint->latency_ewma_ms = endpoint->latency_samples == 0
+                ? *latency_ms
+                : kLatencyEwmaAlpha * *latency_ms + (1.0 - kLatencyEwmaAlpha) * endpoint->latency_ewma_ms;
+            endpoint->latency_samples++;
+            eject = options.eject_latency_ms > 0 && endpoint->latency_samples >= kMinLatencySamples &&
+                    endpoint->latency_ewma_ms > options.eject_latency_ms;
+        }
     }
 
-    return value;
+    if (eject) {
+        // An ejected endpoint comes back with a clean slate
+        endpoint->ejected_until = std::chrono::steady_clock::now() + std::chrono::milliseconds(options.ejection_ms);
+        endpoint->consecutive_failures = 0;
+        endpoint->latency_samples = 0;
+        endpoint->latency_ewma_ms = 0.0;
+    }
 }
 
-extern "C" StackValueType stack_value_get_type(const StackValue* value) {
-    if (!value) return STACK_VALUE_NULL;
+// One call's use of a pooled channel: counts it as outstanding on the chosen
+// endpoint and feeds its outcome into the endpoint's health
+class ChannelLease {
+public:
+    explicit ChannelLease(GrpcClient* client, Endpoint* endpoint = nullptr)
+        : client_(client),
+          endpoint_(endpoint ? endpoint : select_endpoint(client)),
+          started_(std::chrono::steady_clock::now()) {
+        endpoint_->outstanding.fetch_add(1, std::memory_order_relaxed);
+        uint32_t n = endpoint_->next_stub.fetch_add(1, std::memory_order_relaxed);
+        stub_ = endpoint_->stubs[n % endpoint_->stubs.size()].get();
+    }
 
-    const auto& proto = value->proto_value;
+    ~ChannelLease() {
+        endpoint_->outstanding.fetch_sub(1, std::memory_order_relaxed);
+    }
 
-    if (proto.has_null_value()) return STACK_VALUE_NULL;
-    if (proto.has_int_value()) return STACK_VALUE_INT;
-    if (proto.has_string_value()) return STACK_VALUE_STRING;
-    if (proto.has_bool_value()) return STACK_VALUE_BOOL;
-    if (proto.has_float_value()) return STACK_VALUE_FLOAT;
-    if (proto.has_array_value()) return STACK_VALUE_ARRAY;
-    if (proto.has_record_value()) return STACK_VALUE_RECORD;
-    if (proto.has_instant_value()) return STACK_VALUE_INSTANT;
-    if (proto.has_plain_date_value()) return STACK_VALUE_PLAIN_DATE;
-    if (proto.has_zoned_datetime_value()) return STACK_VALUE_ZONED_DATETIME;
+    ChannelLease(const ChannelLease&) = delete;
+    ChannelLease& operator=(const ChannelLease&) = delete;
 
-    return STACK_VALUE_NULL;
-}
+    ForthicRuntime::Stub* stub() const { return stub_; }
+    Endpoint* endpoint() const { return endpoint_; }
 
-extern "C" int64_t stack_value_get_int(const StackValue* value) {
-    return value ? value->proto_value.int_value() : 0;
-}
+    // Record the outcome of a unary call, including its latency
+    void record(const Status& status) {
+        double latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_).count();
+        record_call(client_->options, endpoint_, status, &latency_ms);
+    }
 
-extern "C" const char* stack_value_get_string(const StackValue* value) {
-    return value ? value->proto_value.string_value().c_str() : "";
+    // Record the outcome of a streaming call (its duration is not a latency)
+    void record_stream(const Status& status) {
+        record_call(client_->options, endpoint_, status, nullptr);
+    }
+
+private:
+    GrpcClient* client_;
+    Endpoint* endpoint_;
+    ForthicRuntime::Stub* stub_;
+    std::chrono::steady_clock::time_point started_;
+};
+
+// =============================================================================
+// Compression
+// =============================================================================
+
+// The client asks for compressed results through call metadata; the server
+// applies the same threshold to each response message
+static constexpr char kCompressionKey[] = "forthic-compression";
+static constexpr char kCompressionThresholdKey[] = "forthic-compression-threshold";
+
+static grpc_compression_algorithm compression_algorithm(GrpcCompression compression) {
+    switch (compression) {
+        case GRPC_COMPRESSION_DEFLATE:
+            return GRPC_COMPRESS_DEFLATE;
+        case GRPC_COMPRESSION_GZIP:
+            return GRPC_COMPRESS_GZIP;
+        default:
+            return GRPC_COMPRESS_NONE;
+    }
 }
 
-extern "C" bool stack_value_get_bool(const StackValue* value) {
-    return value ? value->proto_value.bool_value() : false;
+static const char* compression_name(GrpcCompression compression) {
+    return compression == GRPC_COMPRESSION_GZIP ? "gzip" : "deflate";
 }
 
-extern "C" double stack_value_get_float(const StackValue* value) {
-    return value ? value->proto_value.float_value() : 0.0;
+// Compress this call's request if it is large enough, and ask the runtime
+// to compress large results
+static void apply_compression(const GrpcClient* client, ClientContext* context, size_t request_bytes) {
+    const GrpcClientOptions& options = client->options;
+    if (options.compression == GRPC_COMPRESSION_NONE) return;
+
+    context->AddMetadata(kCompressionKey, compression_name(options.compression));
+    context->AddMetadata(kCompressionThresholdKey, std::to_string(options.compression_threshold_bytes));
+    if (request_bytes >= options.compression_threshold_bytes) {
+        context->set_compression_algorithm(compression_algorithm(options.compression));
+    }
 }
 
-extern "C" void stack_value_get_array(const StackValue* value, const StackValue*** out_items, size_t* out_len) {
-    if (!value || !out_items || !out_len) return;
+// Compression the caller asked for (forthic-compression metadata); false if none
+static bool requested_compression(
+    const ServerContext* context,
+    grpc_compression_algorithm* out_algorithm,
+    uint64_t* out_threshold
+) {
+    const auto& metadata = context->client_metadata();
+    auto name = metadata.find(kCompressionKey);
+    if (name == metadata.end()) return false;
 
-    if (!value->proto_value.has_array_value()) {
-        *out_items = nullptr;
-        *out_len = 0;
-        return;
+    std::string algorithm(name->second.data(), name->second.size());
+    if (algorithm == "gzip") {
+        *out_algorithm = GRPC_COMPRESS_GZIP;
+    } else if (algorithm == "deflate") {
+        *out_algorithm = GRPC_COMPRESS_DEFLATE;
+    } else {
+        return false;
     }
 
-    const auto& array = value->proto_value.array_value();
-    size_t len = array.items_size();
+    *out_threshold = 0;
+    auto threshold = metadata.find(kCompressionThresholdKey);
+    if (threshold != metadata.end()) {
+        *out_threshold = strtoull(std::string(threshold->second.data(), threshold->second.size()).c_str(), nullptr, 10);
+    }
+    return true;
+}
 
-    // Allocate array of pointers to StackValue
-    auto** items = (const StackValue**)malloc(sizeof(StackValue*) * len);
+// Account one ExecuteWord payload of `bytes` encoded bytes
+static void record_transfer(GrpcClient* client, size_t bytes, bool sent) {
+    TransferStats& stats = client->transfer;
+    (sent ? stats.bytes_sent : stats.bytes_received).fetch_add(bytes, std::memory_order_relaxed);
 
-    for (size_t i = 0; i < len; i++) {
-        auto* item = new StackValue();
-        item->proto_value = array.items(i);
-        items[i] = item;
+    const GrpcClientOptions& options = client->options;
+    if (options.compression == GRPC_COMPRESSION_NONE || bytes < options.compression_threshold_bytes) return;
+
+    (sent ? stats.compressed_messages_sent : stats.compressed_messages_received).fetch_add(1, std::memory_order_relaxed);
+    stats.compression_input_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Per-Word Metrics
+// =============================================================================
+
+static size_t latency_bucket(uint64_t ns) {
+    size_t bits = ns == 0 ? 0 : 64 - static_cast<size_t>(__builtin_clzll(ns));
+    return std::min<size_t>(bits, GRPC_LATENCY_BUCKETS - 1);
+}
+
+static void record_latency_sample(LatencyHistogram* histogram, uint64_t ns) {
+    histogram->count.fetch_add(1, std::memory_order_relaxed);
+    histogram->sum_ns.fetch_add(ns, std::memory_order_relaxed);
+    histogram->buckets[latency_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+static void snapshot_histogram(const LatencyHistogram& histogram, GrpcLatencyHistogram* out) {
+    out->count = histogram.count.load(std::memory_order_relaxed);
+    out->sum_ns = histogram.sum_ns.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < GRPC_LATENCY_BUCKETS; i++) {
+        out->buckets[i] = histogram.buckets[i].load(std::memory_order_relaxed);
     }
+}
 
-    *out_items = items;
-    *out_len = len;
+static size_t status_slot(GrpcErrorCode code) {
+    return code <= GRPC_ERROR_DEADLINE_EXCEEDED ? static_cast<size_t>(code) : GRPC_STATUS_SLOTS - 1;
 }
 
-extern "C" void stack_value_destroy(StackValue* value) {
-    delete value;
+static uint64_t elapsed_ns(std::chrono::steady_clock::time_point started) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count());
 }
 
-extern "C" void stack_value_array_destroy(StackValue** array, size_t len) {
-    if (!array) return;
-    for (size_t i = 0; i < len; i++) {
-        delete array[i];
+// Metrics of word_name, created on first use
+static WordMetrics* word_metrics(GrpcClient* client, const std::string& word_name) {
+    ClientMetrics& metrics = client->metrics;
+    {
+        std::shared_lock<std::shared_mutex> lock(metrics.mu);
+        auto found = metrics.by_name.find(word_name);
+        if (found != metrics.by_name.end()) return found->second;
     }
-    free(array);
+
+    std::unique_lock<std::shared_mutex> lock(metrics.mu);
+    auto found = metrics.by_name.find(word_name);
+    if (found != metrics.by_name.end()) return found->second;
+
+    auto word = std::make_unique<WordMetrics>();
+    word->word_name = word_name;
+    WordMetrics* ptr = word.get();
+    metrics.words.push_back(std::move(word));
+    metrics.by_name.emplace(word_name, ptr);
+    return ptr;
 }
 
 // =============================================================================
-// Client API Implementation
+// Deadlines and Hedging
 // =============================================================================
 
-extern "C" GrpcErrorCode grpc_client_create(const char* address, GrpcClient** out_client) {
-    if (!address || !out_client) {
-        return GRPC_ERROR_INVALID_ARGUMENT;
+// Hedging delay until the latency window has enough samples for a p95
+static constexpr uint32_t kDefaultHedgingDelayMs = 50;
+static constexpr size_t kMinHedgingSamples = 20;
+
+static uint32_t call_deadline_ms(const GrpcClient* client, const GrpcCallOptions* call_options) {
+    if (call_options && call_options->deadline_ms > 0) return call_options->deadline_ms;
+    return client->options.deadline_ms;
+}
+
+static void apply_deadline(ClientContext* context, std::chrono::system_clock::time_point deadline) {
+    if (deadline != std::chrono::system_clock::time_point::max()) context->set_deadline(deadline);
+}
+
+static std::chrono::system_clock::time_point deadline_from_now(uint32_t deadline_ms) {
+    if (deadline_ms == 0) return std::chrono::system_clock::time_point::max();
+    return std::chrono::system_clock::now() + std::chrono::milliseconds(deadline_ms);
+}
+
+static void record_latency(GrpcClient* client, std::chrono::steady_clock::time_point started) {
+    double latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+    LatencyWindow& window = client->latencies;
+    std::lock_guard<std::mutex> lock(window.mu);
+    window.samples_ms[window.next] = latency_ms;
+    window.next = (window.next + 1) % LatencyWindow::kCapacity;
+    if (window.count < LatencyWindow::kCapacity) window.count++;
+}
+
+static std::chrono::milliseconds hedging_delay(GrpcClient* client) {
+    if (client->options.hedging_delay_ms > 0) {
+        return std::chrono::milliseconds(client->options.hedging_delay_ms);
     }
 
-    auto* client = new GrpcClient();
-    client->channel = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
-    client->stub = ForthicRuntime::NewStub(client->channel);
+    double samples[LatencyWindow::kCapacity];
+    size_t count;
+    {
+        LatencyWindow& window = client->latencies;
+        std::lock_guard<std::mutex> lock(window.mu);
+        count = window.count;
+        std::copy(window.samples_ms, window.samples_ms + count, samples);
+    }
+    if (count < kMinHedgingSamples) {
+        return std::chrono::milliseconds(kDefaultHedgingDelayMs);
+    }
 
-    *out_client = client;
-    return GRPC_OK;
+    size_t p95 = (count * 95) / 100;
+    std::nth_element(samples, samples + p95, samples + count);
+    return std::chrono::milliseconds(static_cast<int64_t>(samples[p95]) + 1);
 }
 
-extern "C" GrpcErrorCode grpc_client_execute_word(
+static void release_shared_slot(const SharedPayload& payload);
+
+// Run ExecuteWord with up to hedging_max_attempts concurrent attempts. A new
+// attempt starts each time the hedging delay passes without a response (or
+// right away when an attempt fails with a transport error); the first
+// successful response wins and the others are cancelled.
+static Status hedged_execute_word(
     GrpcClient* client,
-    const char* word_name,
-    const StackValue* const* stack,
-    size_t stack_len,
-    StackValue*** out_result_stack,
-    size_t* out_result_len,
-    ErrorInfo** out_error
+    const ExecuteWordRequest& request,
+    size_t request_bytes,
+    std::chrono::system_clock::time_point deadline,
+    ExecuteWordResponse* out_response
 ) {
-    if (!client || !word_name || !out_result_stack || !out_result_len) {
-        return GRPC_ERROR_INVALID_ARGUMENT;
-    }
+    struct Attempt {
+        ClientContext context;
+        ExecuteWordResponse response;
+        Status status;
+        std::unique_ptr<ChannelLease> lease;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ExecuteWordResponse>> rpc;
+        bool done = false;
+    };
 
-    // Build request
-    ExecuteWordRequest request;
-    request.set_word_name(word_name);
+    const size_t max_attempts = client->options.hedging_max_attempts;
+    const auto delay = hedging_delay(client);
+    const auto started = std::chrono::steady_clock::now();
 
-    for (size_t i = 0; i < stack_len; i++) {
-        *request.add_stack() = stack[i]->proto_value;
-    }
+    grpc::CompletionQueue cq;
+    std::vector<std::unique_ptr<Attempt>> attempts;
+    size_t pending = 0;
 
-    // Make RPC call
-    ExecuteWordResponse response;
-    ClientContext context;
-    Status status = client->stub->ExecuteWord(&context, request, &response);
+    auto start_attempt = [&] {
+        auto attempt = std::make_unique<Attempt>();
+        apply_deadline(&attempt->context, deadline);
+        apply_compression(client, &attempt->context, request_bytes);
+        attempt->lease = std::make_unique<ChannelLease>(client);
+        attempt->rpc = attempt->lease->stub()->PrepareAsyncExecuteWord(&attempt->context, request, &cq);
+        attempt->rpc->StartCall();
+        attempt->rpc->Finish(&attempt->response, &attempt->status, reinterpret_cast<void*>(attempts.size()));
+        attempts.push_back(std::move(attempt));
+        pending++;
+    };
 
-    if (!status.ok()) {
-        return status_to_error_code(status);
-    }
+    start_attempt();
 
-    // Check for application-level error
-    if (response.has_error()) {
-        auto* error = new ErrorInfo();
-        error->message = response.error().message();
-        error->runtime = response.error().runtime();
-        error->error_type = response.error().error_type();
-        *out_error = error;
-        *out_result_len = 0;
-        *out_result_stack = nullptr;
-        return GRPC_OK;  // gRPC succeeded, but execution failed
-    }
+    Attempt* winner = nullptr;
+    Attempt* last_failure = nullptr;
+    while (pending > 0) {
+        void* tag = nullptr;
+        bool ok = false;
 
-    // Convert result stack
-    size_t result_len = response.result_stack_size();
-    auto** result_array = (StackValue**)malloc(sizeof(StackValue*) * result_len);
+        auto now = std::chrono::system_clock::now();
+        bool can_hedge = !winner && attempts.size() < max_attempts && now < deadline;
 
-    for (size_t i = 0; i < result_len; i++) {
-        result_array[i] = new StackValue();
-        result_array[i]->proto_value = response.result_stack(i);
+        if (can_hedge) {
+            auto result = cq.AsyncNext(&tag, &ok, std::min(now + delay, deadline));
+            if (result == grpc::CompletionQueue::SHUTDOWN) break;
+            if (result == grpc::CompletionQueue::TIMEOUT) {
+                if (std::chrono::system_clock::now() < deadline) start_attempt();
+                continue;
+            }
+        } else if (!cq.Next(&tag, &ok)) {
+            break;  // attempts carry the deadline, so this does not block past it
+        }
+
+        Attempt* attempt = attempts[reinterpret_cast<size_t>(tag)].get();
+        attempt->done = true;
+        pending--;
+
+        if (winner) {
+            // A cancelled loser draining; one that finished anyway holds a result slot
+            if (attempt->status.ok() && attempt->response.has_shared_result_stack()) {
+                release_shared_slot(attempt->response.shared_result_stack());
+            }
+            continue;
+        }
+
+        attempt->lease->record(attempt->status);
+        if (attempt->status.ok()) {
+            winner = attempt;
+            for (auto& other : attempts) {
+                if (!other->done) other->context.TryCancel();
+            }
+        } else {
+            last_failure = attempt;
+            if (pending == 0 && attempts.size() < max_attempts && is_transport_failure(attempt->status) &&
+                std::chrono::system_clock::now() < deadline) {
+                start_attempt();
+            }
+        }
     }
 
-    *out_result_stack = result_array;
-    *out_result_len = result_len;
-    *out_error = nullptr;
+    cq.Shutdown();
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq.Next(&tag, &ok)) {
+    }
 
-    return GRPC_OK;
-}
+    if (!winner) {
+        return last_failure ? last_failure->status : Status(grpc::StatusCode::UNKNOWN, "no attempt completed");
+    }
 
-extern "C" void grpc_client_destroy(GrpcClient* client) {
-    delete client;
+    record_latency(client, started);
+    out_response->Swap(&winner->response);
+    return Status::OK;
 }
 
 // =============================================================================
-// ErrorInfo API Implementation
+// Shared-Memory Side Channel
 // =============================================================================
 
-extern "C" const char* error_info_get_message(const ErrorInfo* error) {
-    return error ? error->message.c_str() : "";
-}
+// A region is a header followed by payload slots, allocated round-robin by
+// the one process that writes it. Before a slot overwrites older ones the
+// writer raises reclaimed_through to their generation; readers check their
+// descriptor's generation against it before and after decoding (seqlock).
+//
+// A result slot is pinned: the word behind it has already run, so it is not
+// reclaimed until its reader releases it (or the reader is gone). A write
+// that would need a pinned slot fails and the result goes inline.
+static constexpr uint64_t kSharedRegionMagic = 0x3243494854524f46ULL;  // "FORTHIC2" little-endian
+static constexpr uint64_t kDefaultSharedRegionBytes = 64ULL << 20;
+static constexpr char kSharedRegionPrefix[] = "/forthic-";
+static constexpr size_t kSharedSlotAlign = 64;
+// StackPayload.values: field 1, length-delimited
+static constexpr uint32_t kStackPayloadValuesTag = (1 << 3) | 2;
 
-extern "C" const char* error_info_get_runtime(const ErrorInfo* error) {
-    return error ? error->runtime.c_str() : "";
-}
+struct SharedRegionHeader {
+    uint64_t magic;
+    uint64_t size;
+    std::atomic<uint64_t> reclaimed_through;
+};
 
-extern "C" const char* error_info_get_error_type(const ErrorInfo* error) {
-    return error ? error->error_type.c_str() : "";
-}
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "region header is shared between processes");
 
-extern "C" void error_info_destroy(ErrorInfo* error) {
-    delete error;
+static constexpr size_t align_slot(size_t n) {
+    return (n + kSharedSlotAlign - 1) & ~(kSharedSlotAlign - 1);
 }
 
-// =============================================================================
-// Server API - Stub Implementation (requires Forthic interpreter integration)
-// =============================================================================
+static constexpr size_t kSharedDataStart = align_slot(sizeof(SharedRegionHeader));
 
-extern "C" GrpcErrorCode forthic_grpc_server_create(uint16_t port, GrpcServer** out_server) {
-    // Server implementation requires integrating with Zig Forthic interpreter
-    // This would be implemented after the client side is working
-    return GRPC_ERROR_UNIMPLEMENTED;
+// Precedes each slot's payload; the reader of a pinned slot stores the
+// slot's generation here when it is done with it
+struct SharedSlotHeader {
+    std::atomic<uint64_t> released;
+};
+
+static constexpr size_t kSharedSlotHeaderBytes = align_slot(sizeof(SharedSlotHeader));
+
+// The reader a pinned slot was written for is gone: its region was
+// unlinked, or the process named in it ("/forthic-<pid>-...") exited
+// without unlinking it
+static bool shared_region_owner_gone(const std::string& region) {
+    int fd = shm_open(region.c_str(), O_RDONLY, 0);
+    if (fd < 0) return errno == ENOENT;
+    close(fd);
+    if (region.compare(0, sizeof(kSharedRegionPrefix) - 1, kSharedRegionPrefix) != 0) return false;
+    long pid = strtol(region.c_str() + sizeof(kSharedRegionPrefix) - 1, nullptr, 10);
+    return pid > 0 && kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH;
 }
 
-extern "C" GrpcErrorCode forthic_grpc_server_start(GrpcServer* server) {
-    return GRPC_ERROR_UNIMPLEMENTED;
+// Encoded size of a StackPayload holding values (caches each value's size
+// for encode_stack_payload)
+static size_t encoded_stack_size(const std::vector<const ProtoStackValue*>& values) {
+    size_t total = 0;
+    for (const auto* value : values) {
+        size_t size = value->ByteSizeLong();
+        total += 1 + google::protobuf::io::CodedOutputStream::VarintSize64(size) + size;
+    }
+    return total;
 }
 
-extern "C" GrpcErrorCode forthic_grpc_server_stop(GrpcServer* server) {
-    return GRPC_ERROR_UNIMPLEMENTED;
+static bool encode_stack_payload(const std::vector<const ProtoStackValue*>& values, uint8_t* dest, size_t length) {
+    google::protobuf::io::ArrayOutputStream array(dest, static_cast<int>(length));
+    google::protobuf::io::CodedOutputStream coded(&array);
+    for (const auto* value : values) {
+        coded.WriteTag(kStackPayloadValuesTag);
+        coded.WriteVarint64(static_cast<uint64_t>(value->GetCachedSize()));
+        value->SerializeWithCachedSizes(&coded);
+    }
+    return !coded.HadError();
 }
 
-extern "C" void forthic_grpc_server_destroy(GrpcServer* server) {
+// A region this process writes; unlinked when destroyed
+class SharedRegionWriter {
+public:
+    static std::unique_ptr<SharedRegionWriter> create(uint64_t size) {
+        // A random suffix keeps other local users from guessing the name and
+        // creating it first
+        static std::atomic<uint32_t> next_id{0};
+        std::random_device random;
+        char suffix[17];
+        snprintf(suffix, sizeof(suffix), "%08x%08x", random(), random());
+        std::string name = kSharedRegionPrefix + std::to_string(getpid()) + "-" +
+                           std::to_string(next_id.fetch_add(1, std::memory_order_relaxed)) + "-" + suffix;
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) return nullptr;
+
+        void* base = MAP_FAILED;
+        if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (base == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            return nullptr;
+        }
+
+        auto* header = new (base) SharedRegionHeader();
+        header->magic = kSharedRegionMagic;
+        header->size = size;
+        header->reclaimed_through.store(0, std::memory_order_relaxed);
+
+        return std::unique_ptr<SharedRegionWriter>(
+            new SharedRegionWriter(std::move(name), static_cast<uint8_t*>(base), size));
+    }
+
+    ~SharedRegionWriter() {
+        munmap(base_, size_);
+        shm_unlink(name_.c_str());
+    }
+
+    SharedRegionWriter(const SharedRegionWriter&) = delete;
+    SharedRegionWriter& operator=(const SharedRegionWriter&) = delete;
+
+    const std::string& name() const { return name_; }
+
+    // Encode values (length = encoded_stack_size) into the next slot. A
+    // non-empty pinned_for names the region of the reader that must release
+    // the slot. Returns false if they do not fit in the region, or if the
+    // space they need is still pinned.
+    bool write(const std::vector<const ProtoStackValue*>& values, size_t length, SharedPayload* out,
+               const std::string& pinned_for = std::string()) {
+        size_t need = kSharedSlotHeaderBytes + align_slot(length);
+        if (length == 0 || need > size_ - kSharedDataStart) return false;
+
+        std::lock_guard<std::mutex> lock(mu_);
+
+        if (next_offset_ + need > size_) {
+            // Wrap; the skipped tail holds the oldest live slots
+            while (!live_.empty() && live_.front().offset >= next_offset_) {
+                if (!reclaim_front()) return false;
+            }
+            next_offset_ = kSharedDataStart;
+        }
+        size_t offset = next_offset_;
+        while (!live_.empty() && live_.front().offset < offset + need && live_.front().end > offset) {
+            if (!reclaim_front()) return false;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        size_t payload_offset = offset + kSharedSlotHeaderBytes;
+        if (!encode_stack_payload(values, base_ + payload_offset, length)) return false;
+
+        uint64_t generation = next_generation_++;
+        new (base_ + offset) SharedSlotHeader{};
+        live_.push_back(Slot{offset, offset + need, generation, pinned_for});
+        next_offset_ = offset + need;
+
+        out->set_region(name_);
+        out->set_offset(payload_offset);
+        out->set_length(length);
+        out->set_generation(generation);
+        return true;
+    }
+
+private:
+    struct Slot {
+        size_t offset;
+        size_t end;
+        uint64_t generation;
+        std::string pinned_for;
+    };
+
+    SharedRegionWriter(std::string name, uint8_t* base, size_t size)
+        : name_(std::move(name)), base_(base), size_(size) {}
+
+    SharedRegionHeader* header() { return reinterpret_cast<SharedRegionHeader*>(base_); }
+
+    // Returns false, reclaiming nothing, if the oldest slot is still pinned
+    bool reclaim_front() {
+        const Slot& slot = live_.front();
+        if (!slot.pinned_for.empty()) {
+            auto* slot_header = reinterpret_cast<SharedSlotHeader*>(base_ + slot.offset);
+            if (slot_header->released.load(std::memory_order_acquire) != slot.generation &&
+                !shared_region_owner_gone(slot.pinned_for)) {
+                return false;
+            }
+        }
+        header()->reclaimed_through.store(slot.generation, std::memory_order_relaxed);
+        live_.pop_front();
+        return true;
+    }
+
+    std::string name_;
+    uint8_t* base_;
+    size_t size_;
+
+    // Guards slot allocation and the payload bytes of new slots
+    std::mutex mu_;
+    size_t next_offset_ = kSharedDataStart;
+    uint64_t next_generation_ = 1;
+    std::deque<Slot> live_;
+};
+
+// A peer's region. Mapped writable only so that pinned slots can be
+// released; nothing else in it is written. Keeps the descriptor of the
+// inode it mapped, so it can tell when the writer has unlinked the region.
+class SharedRegionView {
+public:
+    static std::unique_ptr<SharedRegionView> open(const std::string& name) {
+        // Only regions written by this library
+        if (name.compare(0, sizeof(kSharedRegionPrefix) - 1, kSharedRegionPrefix) != 0) return nullptr;
+
+        int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) return nullptr;
+
+        struct stat st{};
+        void* base = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= kSharedDataStart) {
+            base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        if (base == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+
+        std::unique_ptr<SharedRegionView> view(
+            new SharedRegionView(fd, static_cast<uint8_t*>(base), static_cast<size_t>(st.st_size)));
+        const auto* header = view->header();
+        if (header->magic != kSharedRegionMagic || header->size != view->size_) return nullptr;
+        return view;
+    }
+
+    ~SharedRegionView() {
+        munmap(base_, size_);
+        close(fd_);
+    }
+
+    // The writer has unlinked the region; its name now means something else
+    // or nothing
+    bool unlinked() const {
+        struct stat st{};
+        return fstat(fd_, &st) != 0 || st.st_nlink == 0;
+    }
+
+    SharedRegionView(const SharedRegionView&) = delete;
+    SharedRegionView& operator=(const SharedRegionView&) = delete;
+
+    bool is_current(uint64_t generation) const {
+        return generation > header()->reclaimed_through.load(std::memory_order_acquire);
+    }
+
+    // Let the writer reclaim the slot whose payload starts at payload_offset
+    void release(uint64_t payload_offset, uint64_t generation) {
+        if (payload_offset < kSharedDataStart + kSharedSlotHeaderBytes || payload_offset > size_ ||
+            payload_offset % kSharedSlotAlign != 0) {
+            return;
+        }
+        auto* slot_header = reinterpret_cast<SharedSlotHeader*>(base_ + payload_offset - kSharedSlotHeaderBytes);
+        slot_header->released.store(generation, std::memory_order_release);
+    }
+
+    const uint8_t* base() const { return base_; }
+    size_t size() const { return size_; }
+
+private:
+    SharedRegionView(int fd, uint8_t* base, size_t size) : fd_(fd), base_(base), size_(size) {}
+
+    const SharedRegionHeader* header() const { return reinterpret_cast<const SharedRegionHeader*>(base_); }
+
+    int fd_;
+    uint8_t* base_;
+    size_t size_;
+};
+
+// Peer regions stay mapped between calls rather than being mapped (64 MiB by
+// default) per message. An entry belongs to the inode it mapped and is dropped
+// once the writer unlinks that inode, so the memory is released with it.
+class SharedRegionCache {
+public:
+    std::shared_ptr<SharedRegionView> open(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_sweep_ >= kSweepInterval) {
+            last_sweep_ = now;
+            for (auto it = views_.begin(); it != views_.end();) {
+                it = it->second->unlinked() ? views_.erase(it) : std::next(it);
+            }
+        }
+
+        auto it = views_.find(name);
+        if (it != views_.end()) {
+            if (!it->second->unlinked()) return it->second;
+            views_.erase(it);
+        }
+
+        std::shared_ptr<SharedRegionView> view = SharedRegionView::open(name);
+        if (view) views_.emplace(name, view);
+        return view;
+    }
+
+private:
+    static constexpr std::chrono::seconds kSweepInterval{1};
+
+    std::mutex mu_;
+    std::unordered_map<std::string, std::shared_ptr<SharedRegionView>> views_;
+    std::chrono::steady_clock::time_point last_sweep_{};
+};
+
+static SharedRegionCache& shared_region_cache() {
+    static SharedRegionCache cache;
+    return cache;
+}
+
+enum class SharedReadResult {
+    kOk,
+    kUnavailable,   // region cannot be mapped here (different host) or descriptor is invalid
+    kOverwritten    // the writer reused the slot before it was read
+};
+
+// Decode the stack a SharedPayload describes into out
+static SharedReadResult read_shared_stack(const SharedPayload& payload, ProtoStackValues* out) {
+    auto view = shared_region_cache().open(payload.region());
+    if (!view) return SharedReadResult::kUnavailable;
+
+    if (payload.offset() < kSharedDataStart || payload.offset() > view->size() ||
+        payload.length() > view->size() - payload.offset() || payload.length() > INT32_MAX) {
+        return SharedReadResult::kUnavailable;
+    }
+    if (!view->is_current(payload.generation())) return SharedReadResult::kOverwritten;
+
+    forthic::StackPayload decoded;
+    bool parsed = decoded.ParseFromArray(view->base() + payload.offset(), static_cast<int>(payload.length()));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!view->is_current(payload.generation())) return SharedReadResult::kOverwritten;
+    if (!parsed) return SharedReadResult::kUnavailable;
+
+    out->Swap(decoded.mutable_values());
+    return SharedReadResult::kOk;
+}
+
+// Done with a pinned slot (read or not): the writer may reuse it
+static void release_shared_slot(const SharedPayload& payload) {
+    auto view = shared_region_cache().open(payload.region());
+    if (view) view->release(payload.offset(), payload.generation());
+}
+
+// Place the request stack in the client's region if it is large enough
+static bool put_shared_stack(
+    GrpcClient* client,
+    const StackValue* const* stack,
+    size_t stack_len,
+    ExecuteWordRequest* request
+) {
+    std::vector<const ProtoStackValue*> values;
+    values.reserve(stack_len);
+    for (size_t i = 0; i < stack_len; i++) {
+        values.push_back(&stack[i]->proto());
+    }
+
+    size_t length = encoded_stack_size(values);
+    if (length < client->options.shm_threshold_bytes) return false;
+
+    // Only a payload that was written may reach the request
+    SharedPayload payload;
+    if (!client->shm_region->write(values, length, &payload)) return false;
+    request->mutable_shared_stack()->Swap(&payload);
+    return true;
+}
+
+GrpcClient::~GrpcClient() = default;
+
+// =============================================================================
+// StackValue API Implementation
+// =============================================================================
+
+extern "C" StackValue* stack_value_create_null(void) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_null_value();
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_int(int64_t val) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.set_int_value(val);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_string(const char* val) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.set_string_value(val);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_string_n(const char* data, size_t len) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.set_string_value(data ? std::string(data, len) : std::string());
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_bool(bool val) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.set_bool_value(val);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_float(double val) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.set_float_value(val);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_array(const StackValue* const* items, size_t len) {
+    auto* value = new OwnedStackValue();
+    auto* array = value->proto_value.mutable_array_value();
+
+    for (size_t i = 0; i < len; i++) {
+        *array->add_items() = items[i]->proto();
+    }
+
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_record(void) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_record_value();
+    return value;
+}
+
+extern "C" GrpcErrorCode stack_value_record_insert(StackValue* record, const char* key, StackValue* field_value) {
+    if (!key) {
+        stack_value_destroy(field_value);
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    return stack_value_record_insert_n(record, key, strlen(key), field_value);
+}
+
+extern "C" GrpcErrorCode stack_value_record_insert_n(StackValue* record, const char* key, size_t key_len, StackValue* field_value) {
+    std::unique_ptr<OwnedStackValue> owned(owned_value(field_value));
+
+    if (!record || (!key && key_len > 0) || !field_value || !record->proto().has_record_value()) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto& fields = *owned_value(record)->proto_value.mutable_record_value()->mutable_fields();
+    fields[std::string(key ? key : "", key_len)].Swap(&owned->proto_value);
+    return GRPC_OK;
+}
+
+extern "C" StackValue* stack_value_create_instant_nanos(int64_t epoch_nanos) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_instant_value()->set_epoch_nanos(epoch_nanos);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_instant_iso(const char* iso8601, size_t iso8601_len) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_instant_value()->set_iso8601(string_from_n(iso8601, iso8601_len));
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_plain_date_days(int32_t days_since_epoch) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_plain_date_value()->set_days_since_epoch(days_since_epoch);
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_plain_date_iso(const char* iso8601_date, size_t iso8601_date_len) {
+    auto* value = new OwnedStackValue();
+    value->proto_value.mutable_plain_date_value()->set_iso8601_date(string_from_n(iso8601_date, iso8601_date_len));
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_zoned_datetime_nanos(int64_t epoch_nanos, const char* timezone, size_t timezone_len) {
+    auto* value = new OwnedStackValue();
+    auto* zoned = value->proto_value.mutable_zoned_datetime_value();
+    zoned->set_epoch_nanos(epoch_nanos);
+    zoned->set_timezone(string_from_n(timezone, timezone_len));
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_zoned_datetime_iso(
+    const char* iso8601,
+    size_t iso8601_len,
+    const char* timezone,
+    size_t timezone_len
+) {
+    auto* value = new OwnedStackValue();
+    auto* zoned = value->proto_value.mutable_zoned_datetime_value();
+    zoned->set_iso8601(string_from_n(iso8601, iso8601_len));
+    zoned->set_timezone(string_from_n(timezone, timezone_len));
+    return value;
+}
+
+extern "C" StackValue* stack_value_create_remote_ref(
+    const char* handle_id,
+    size_t handle_id_len,
+    const char* runtime,
+    size_t runtime_len
+) {
+    auto* value = new OwnedStackValue();
+    auto* ref = value->proto_value.mutable_remote_ref_value();
+    ref->set_handle_id(string_from_n(handle_id, handle_id_len));
+    ref->set_runtime(string_from_n(runtime, runtime_len));
+    return value;
+}
+
+extern "C" StackValueType stack_value_get_type(const StackValue* value) {
+    if (!value) return STACK_VALUE_NULL;
+
+    const auto& proto = value->proto();
+
+    if (proto.has_null_value()) return STACK_VALUE_NULL;
+    if (proto.has_int_value()) return STACK_VALUE_INT;
+    if (proto.has_string_value()) return STACK_VALUE_STRING;
+    if (proto.has_bool_value()) return STACK_VALUE_BOOL;
+    if (proto.has_float_value()) return STACK_VALUE_FLOAT;
+    if (proto.has_array_value()) return STACK_VALUE_ARRAY;
+    if (proto.has_record_value()) return STACK_VALUE_RECORD;
+    if (proto.has_instant_value()) return STACK_VALUE_INSTANT;
+    if (proto.has_plain_date_value()) return STACK_VALUE_PLAIN_DATE;
+    if (proto.has_zoned_datetime_value()) return STACK_VALUE_ZONED_DATETIME;
+    if (proto.has_remote_ref_value()) return STACK_VALUE_REMOTE_REF;
+
+    return STACK_VALUE_NULL;
+}
+
+extern "C" int64_t stack_value_get_int(const StackValue* value) {
+    return value ? value->proto().int_value() : 0;
+}
+
+extern "C" const char* stack_value_get_string(const StackValue* value) {
+    return value ? value->proto().string_value().c_str() : "";
+}
+
+extern "C" const char* stack_value_get_string_view(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().string_value() : kEmptyString, out_len);
+}
+
+extern "C" bool stack_value_get_bool(const StackValue* value) {
+    return value ? value->proto().bool_value() : false;
+}
+
+extern "C" double stack_value_get_float(const StackValue* value) {
+    return value ? value->proto().float_value() : 0.0;
+}
+
+extern "C" void stack_value_get_array(const StackValue* value, const StackValue*** out_items, size_t* out_len) {
+    if (!value || !out_items || !out_len) return;
+
+    if (!value->proto().has_array_value()) {
+        *out_items = nullptr;
+        *out_len = 0;
+        return;
+    }
+
+    const auto& array = value->proto().array_value();
+    size_t len = array.items_size();
+
+    // Allocate array of pointers to StackValue
+    auto** items = (const StackValue**)malloc(sizeof(StackValue*) * len);
+
+    for (size_t i = 0; i < len; i++) {
+        auto* item = new OwnedStackValue();
+        item->proto_value = array.items(i);
+        items[i] = item;
+    }
+
+    *out_items = items;
+    *out_len = len;
+}
+
+extern "C" bool stack_value_get_instant_nanos(const StackValue* value, int64_t* out_epoch_nanos) {
+    if (!value || !out_epoch_nanos || !value->proto().has_instant_value()) return false;
+
+    const auto& instant = value->proto().instant_value();
+    if (!instant.has_epoch_nanos()) return false;
+
+    *out_epoch_nanos = instant.epoch_nanos();
+    return true;
+}
+
+extern "C" const char* stack_value_get_instant_iso(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().instant_value().iso8601() : kEmptyString, out_len);
+}
+
+extern "C" bool stack_value_get_plain_date_days(const StackValue* value, int32_t* out_days_since_epoch) {
+    if (!value || !out_days_since_epoch || !value->proto().has_plain_date_value()) return false;
+
+    const auto& date = value->proto().plain_date_value();
+    if (!date.has_days_since_epoch()) return false;
+
+    *out_days_since_epoch = date.days_since_epoch();
+    return true;
+}
+
+extern "C" const char* stack_value_get_plain_date_iso(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().plain_date_value().iso8601_date() : kEmptyString, out_len);
+}
+
+extern "C" bool stack_value_get_zoned_datetime_nanos(const StackValue* value, int64_t* out_epoch_nanos) {
+    if (!value || !out_epoch_nanos || !value->proto().has_zoned_datetime_value()) return false;
+
+    const auto& zoned = value->proto().zoned_datetime_value();
+    if (!zoned.has_epoch_nanos()) return false;
+
+    *out_epoch_nanos = zoned.epoch_nanos();
+    return true;
+}
+
+extern "C" const char* stack_value_get_zoned_datetime_iso(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().zoned_datetime_value().iso8601() : kEmptyString, out_len);
+}
+
+extern "C" const char* stack_value_get_zoned_datetime_timezone(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().zoned_datetime_value().timezone() : kEmptyString, out_len);
+}
+
+extern "C" const char* stack_value_get_remote_ref_handle(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().remote_ref_value().handle_id() : kEmptyString, out_len);
+}
+
+extern "C" const char* stack_value_get_remote_ref_runtime(const StackValue* value, size_t* out_len) {
+    return string_view_out(value ? value->proto().remote_ref_value().runtime() : kEmptyString, out_len);
+}
+
+extern "C" size_t stack_value_get_array_len(const StackValue* value) {
+    if (!value || !value->proto().has_array_value()) return 0;
+    return value->proto().array_value().items_size();
+}
+
+extern "C" const StackValue* stack_value_get_array_item(const StackValue* value, size_t index) {
+    if (!value || !value->proto().has_array_value()) return nullptr;
+
+    const auto& array = value->proto().array_value();
+    if (index >= static_cast<size_t>(array.items_size())) return nullptr;
+
+    return value->array_item(static_cast<int>(index));
+}
+
+extern "C" size_t stack_value_get_record_len(const StackValue* value) {
+    if (!value || !value->proto().has_record_value()) return 0;
+    return value->proto().record_value().fields_size();
+}
+
+extern "C" RecordIterator* stack_value_get_record_iterator(const StackValue* value) {
+    if (!value || !value->proto().has_record_value()) return nullptr;
+
+    const auto& fields = value->proto().record_value().fields();
+    auto* iter = new RecordIterator();
+    iter->current = fields.begin();
+    iter->end = fields.end();
+    return iter;
+}
+
+extern "C" bool record_iterator_next(RecordIterator* iter, const char** out_key, size_t* out_key_len, const StackValue** out_value) {
+    if (!iter || !out_key || !out_key_len || !out_value) return false;
+    if (iter->current == iter->end) return false;
+
+    const auto& entry = *iter->current;
+    *out_key = entry.first.data();
+    *out_key_len = entry.first.size();
+    iter->views.emplace_back(entry.second);
+    *out_value = &iter->views.back();
+
+    ++iter->current;
+    return true;
+}
+
+extern "C" void record_iterator_destroy(RecordIterator* iter) {
+    delete iter;
+}
+
+static uint64_t fnv1a_update(uint64_t hash, const void* data, size_t len) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+extern "C" uint64_t stack_value_array_hash(const StackValue* const* values, size_t len) {
+    uint64_t hash = 14695981039346656037ULL;
+    std::string bytes;
+
+    for (size_t i = 0; i < len; i++) {
+        bytes.clear();
+        if (values[i]) {
+            // Deterministic mode sorts map entries, so records hash by content
+            google::protobuf::io::StringOutputStream stream(&bytes);
+            google::protobuf::io::CodedOutputStream coded(&stream);
+            coded.SetSerializationDeterministic(true);
+            values[i]->proto().SerializeToCodedStream(&coded);
+        }
+
+        // Length-prefix each value so adjacent values cannot run together
+        uint64_t size = bytes.size();
+        hash = fnv1a_update(hash, &size, sizeof(size));
+        hash = fnv1a_update(hash, bytes.data(), bytes.size());
+    }
+
+    return hash;
+}
+
+extern "C" void stack_value_destroy(StackValue* value) {
+    delete owned_value(value);
+}
+
+extern "C" StackValue** stack_value_array_alloc(size_t len) {
+    return (StackValue**)calloc(len > 0 ? len : 1, sizeof(StackValue*));
+}
+
+extern "C" void stack_value_array_destroy(StackValue** array, size_t len) {
+    if (!array) return;
+    for (size_t i = 0; i < len; i++) {
+        delete owned_value(array[i]);
+    }
+    free(array);
+}
+
+// =============================================================================
+// Client API Implementation
+// =============================================================================
+
+extern "C" GrpcErrorCode grpc_client_create(const char* address, GrpcClient** out_client) {
+    if (!address) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    return grpc_client_create_n(address, strlen(address), out_client);
+}
+
+// Keepalive and retry settings shared by every channel of a client
+static grpc::ChannelArguments channel_arguments(const GrpcClientOptions& options) {
+    grpc::ChannelArguments args;
+
+    if (options.keepalive_time_ms > 0) {
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, static_cast<int>(options.keepalive_time_ms));
+        if (options.keepalive_timeout_ms > 0) {
+            args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, static_cast<int>(options.keepalive_timeout_ms));
+        }
+        args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, options.keepalive_without_calls ? 1 : 0);
+        args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+    }
+
+    // Words may have side effects, so ExecuteWord is never retried here;
+    // idempotent words are hedged per call instead (hedged_execute_word)
+    if (options.retry_max_attempts > 1) {
+        std::string attempts = std::to_string(std::min<uint32_t>(options.retry_max_attempts, 5));
+        args.SetServiceConfigJSON(
+            "{\"methodConfig\": [{"
+            "\"name\": ["
+            "{\"service\": \"forthic.ForthicRuntime\", \"method\": \"FetchRef\"},"
+            "{\"service\": \"forthic.ForthicRuntime\", \"method\": \"ReleaseRefs\"},"
+            "{\"service\": \"forthic.ForthicRuntime\", \"method\": \"ListModules\"},"
+            "{\"service\": \"forthic.ForthicRuntime\", \"method\": \"GetModuleInfo\"}],"
+            "\"retryPolicy\": {"
+            "\"maxAttempts\": " + attempts + ","
+            "\"initialBackoff\": \"0.05s\","
+            "\"maxBackoff\": \"1s\","
+            "\"backoffMultiplier\": 2,"
+            "\"retryableStatusCodes\": [\"UNAVAILABLE\"]}}]}");
+    }
+    return args;
+}
+
+// =============================================================================
+// In-Process Transport
+// =============================================================================
+
+// Servers running on an "inproc:name" address. Their clients get a channel
+// straight into the server, with no socket or HTTP/2 framing in between.
+static std::mutex inproc_mu;
+
+static std::unordered_map<std::string, GrpcServer*>& inproc_servers() {
+    static auto* servers = new std::unordered_map<std::string, GrpcServer*>();
+    return *servers;
+}
+
+static bool is_inproc_address(const std::string& address) {
+    return address.rfind("inproc:", 0) == 0;
+}
+
+static std::shared_ptr<grpc::Channel> inproc_channel(const std::string& address, const grpc::ChannelArguments& args) {
+    std::lock_guard<std::mutex> lock(inproc_mu);
+    auto found = inproc_servers().find(address);
+    if (found == inproc_servers().end()) return nullptr;
+    return found->second->server->InProcessChannel(args);
+}
+
+extern "C" GrpcErrorCode grpc_client_create_n(const char* address, size_t address_len, GrpcClient** out_client) {
+    if (!address || address_len == 0) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    return grpc_client_create_with_options(&address, &address_len, 1, nullptr, out_client);
+}
+
+extern "C" GrpcErrorCode grpc_client_create_with_options(
+    const char* const* addresses,
+    const size_t* address_lens,
+    size_t address_count,
+    const GrpcClientOptions* options,
+    GrpcClient** out_client
+) {
+    if (!addresses || !address_lens || address_count == 0 || !out_client) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    for (size_t i = 0; i < address_count; i++) {
+        if (!addresses[i] || address_lens[i] == 0) return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto client = std::make_unique<GrpcClient>();
+    if (options) client->options = *options;
+    if (client->options.channels_per_endpoint == 0) client->options.channels_per_endpoint = 1;
+
+    for (size_t i = 0; i < address_count; i++) {
+        auto endpoint = std::make_unique<Endpoint>();
+        endpoint->address.assign(addresses[i], address_lens[i]);
+
+        for (uint32_t c = 0; c < client->options.channels_per_endpoint; c++) {
+            // Channels with identical arguments share one connection; a local
+            // subchannel pool and a distinct id give each its own
+            grpc::ChannelArguments args = channel_arguments(client->options);
+            args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            args.SetInt("forthic.channel_id", static_cast<int>(c));
+
+            auto channel = is_inproc_address(endpoint->address)
+                ? inproc_channel(endpoint->address, args)
+                : grpc::CreateCustomChannel(endpoint->address, grpc::InsecureChannelCredentials(), args);
+            if (!channel) return GRPC_ERROR_UNAVAILABLE;
+            endpoint->stubs.push_back(ForthicRuntime::NewStub(channel));
+            endpoint->channels.push_back(std::move(channel));
+        }
+        client->endpoints.push_back(std::move(endpoint));
+    }
+
+    // Runtimes only honor shared memory over Unix domain sockets and
+    // in-process channels. Without a region (no /dev/shm) the client just
+    // stays on the socket.
+    bool local = std::all_of(client->endpoints.begin(), client->endpoints.end(), [](const auto& endpoint) {
+        return endpoint->address.rfind("unix:", 0) == 0 || is_inproc_address(endpoint->address);
+    });
+    if (client->options.shm_threshold_bytes > 0 && local) {
+        uint64_t region_bytes = client->options.shm_region_bytes > 0 ? client->options.shm_region_bytes
+                                                                     : kDefaultSharedRegionBytes;
+        client->shm_region = SharedRegionWriter::create(region_bytes);
+        client->shm_active.store(client->shm_region != nullptr, std::memory_order_relaxed);
+    }
+
+    *out_client = client.release();
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_wait_for_connected(GrpcClient* client, uint32_t timeout_ms) {
+    if (!client) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Start every connection before waiting on any, so they overlap
+    for (auto& endpoint : client->endpoints) {
+        for (auto& channel : endpoint->channels) channel->GetState(true);
+    }
+
+    auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(timeout_ms);
+    bool any_ready = false;
+    for (auto& endpoint : client->endpoints) {
+        for (auto& channel : endpoint->channels) {
+            if (channel->WaitForConnected(deadline)) any_ready = true;
+        }
+    }
+    return any_ready ? GRPC_OK : GRPC_ERROR_DEADLINE_EXCEEDED;
+}
+
+extern "C" bool grpc_client_is_connected(const GrpcClient* client) {
+    if (!client) return false;
+    for (auto& endpoint : client->endpoints) {
+        for (auto& channel : endpoint->channels) {
+            if (channel->GetState(false) == GRPC_CHANNEL_READY) return true;
+        }
+    }
+    return false;
+}
+
+extern "C" size_t grpc_client_endpoint_count(const GrpcClient* client) {
+    return client ? client->endpoints.size() : 0;
+}
+
+extern "C" GrpcErrorCode grpc_client_get_endpoint_stats(const GrpcClient* client, size_t index, GrpcEndpointStats* out_stats) {
+    if (!client || index >= client->endpoints.size() || !out_stats) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    Endpoint* endpoint = client->endpoints[index].get();
+    out_stats->requests = endpoint->requests.load(std::memory_order_relaxed);
+    out_stats->failures = endpoint->failures.load(std::memory_order_relaxed);
+    out_stats->outstanding = endpoint->outstanding.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(endpoint->mu);
+    out_stats->latency_ewma_ms = endpoint->latency_ewma_ms;
+    out_stats->ejected = std::chrono::steady_clock::now() < endpoint->ejected_until;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_get_stats(const GrpcClient* client, GrpcClientStats* out_stats) {
+    if (!client || !out_stats) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    const TransferStats& stats = client->transfer;
+    out_stats->bytes_sent = stats.bytes_sent.load(std::memory_order_relaxed);
+    out_stats->bytes_received = stats.bytes_received.load(std::memory_order_relaxed);
+    out_stats->compressed_messages_sent = stats.compressed_messages_sent.load(std::memory_order_relaxed);
+    out_stats->compressed_messages_received = stats.compressed_messages_received.load(std::memory_order_relaxed);
+    out_stats->compression_input_bytes = stats.compression_input_bytes.load(std::memory_order_relaxed);
+    return GRPC_OK;
+}
+
+extern "C" size_t grpc_client_metrics_word_count(const GrpcClient* client) {
+    if (!client) return 0;
+    auto& metrics = const_cast<GrpcClient*>(client)->metrics;
+    std::shared_lock<std::shared_mutex> lock(metrics.mu);
+    return metrics.words.size();
+}
+
+extern "C" GrpcErrorCode grpc_client_get_word_metrics(
+    const GrpcClient* client,
+    size_t index,
+    const char** out_word_name,
+    size_t* out_word_name_len,
+    GrpcWordMetrics* out_metrics
+) {
+    if (!client || !out_word_name || !out_word_name_len || !out_metrics) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto& metrics = const_cast<GrpcClient*>(client)->metrics;
+    const WordMetrics* word;
+    {
+        std::shared_lock<std::shared_mutex> lock(metrics.mu);
+        if (index >= metrics.words.size()) return GRPC_ERROR_OUT_OF_RANGE;
+        word = metrics.words[index].get();
+    }
+
+    *out_word_name = string_view_out(word->word_name, out_word_name_len);
+    out_metrics->calls = word->calls.load(std::memory_order_relaxed);
+    out_metrics->word_errors = word->word_errors.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < GRPC_STATUS_SLOTS; i++) {
+        out_metrics->status_counts[i] = word->status_counts[i].load(std::memory_order_relaxed);
+    }
+    out_metrics->request_bytes = word->request_bytes.load(std::memory_order_relaxed);
+    out_metrics->response_bytes = word->response_bytes.load(std::memory_order_relaxed);
+    snapshot_histogram(word->rpc, &out_metrics->rpc);
+    snapshot_histogram(word->serialization, &out_metrics->serialization);
+    return GRPC_OK;
+}
+
+extern "C" void grpc_client_record_serialization(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    uint64_t elapsed_ns
+) {
+    if (!client || !word_name) return;
+    record_latency_sample(&word_metrics(client, std::string(word_name, word_name_len))->serialization, elapsed_ns);
+}
+
+extern "C" GrpcErrorCode grpc_client_get_shared_memory_stats(const GrpcClient* client, GrpcSharedMemoryStats* out_stats) {
+    if (!client || !out_stats) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    out_stats->requests_shared = client->shm_requests.load(std::memory_order_relaxed);
+    out_stats->results_shared = client->shm_results.load(std::memory_order_relaxed);
+    out_stats->fallbacks = client->shm_fallbacks.load(std::memory_order_relaxed);
+    out_stats->active = client->shm_active.load(std::memory_order_relaxed);
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_execute_word(
+    GrpcClient* client,
+    const char* word_name,
+    const StackValue* const* stack,
+    size_t stack_len,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+) {
+    if (!word_name) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    return grpc_client_execute_word_n(
+        client, word_name, strlen(word_name), stack, stack_len,
+        out_result_stack, out_result_len, out_error);
+}
+
+extern "C" GrpcErrorCode grpc_client_execute_word_n(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+) {
+    return grpc_client_execute_word_with_options(
+        client, word_name, word_name_len, stack, stack_len, nullptr,
+        out_result_stack, out_result_len, out_error);
+}
+
+extern "C" GrpcErrorCode grpc_client_execute_word_with_options(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    const GrpcCallOptions* call_options,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+) {
+    if (!client || !word_name || !out_result_stack || !out_result_len) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Build request
+    ExecuteWordRequest request;
+    request.set_word_name(std::string(word_name, word_name_len));
+    request.set_accepts_compact_temporal(true);
+    request.set_accepts_remote_refs(client->accepts_remote_refs.load(std::memory_order_relaxed) ||
+                                    (call_options && call_options->accepts_remote_refs));
+
+    if (client->shm_active.load(std::memory_order_relaxed)) {
+        auto* offer = request.mutable_shared_memory();
+        offer->set_region(client->shm_region->name());
+        offer->set_min_bytes(client->options.shm_threshold_bytes);
+    }
+    auto add_inline_stack = [&] {
+        for (size_t i = 0; i < stack_len; i++) {
+            *request.add_stack() = stack[i]->proto();
+        }
+    };
+    if (request.has_shared_memory() && put_shared_stack(client, stack, stack_len, &request)) {
+        client->shm_requests.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        add_inline_stack();
+    }
+
+    // Make RPC call
+    ExecuteWordResponse response;
+    Status status;
+    auto deadline = deadline_from_now(call_deadline_ms(client, call_options));
+
+    size_t request_bytes = 0;
+    auto call = [&] {
+        request_bytes = request.ByteSizeLong();
+        if (call_options && call_options->idempotent && client->options.hedging_max_attempts > 1) {
+            return hedged_execute_word(client, request, request_bytes, deadline, &response);
+        }
+        ClientContext context;
+        apply_deadline(&context, deadline);
+        apply_compression(client, &context, request_bytes);
+        ChannelLease lease(client);
+        auto started = std::chrono::steady_clock::now();
+        Status call_status = lease.stub()->ExecuteWord(&context, request, &response);
+        lease.record(call_status);
+        if (call_status.ok()) record_latency(client, started);
+        return call_status;
+    };
+    auto rpc_started = std::chrono::steady_clock::now();
+    status = call();
+
+    // The runtime rejected the shared stack before running the word: it is on
+    // another host (FAILED_PRECONDITION, stop offering the region) or the slot
+    // was reused in flight (ABORTED). Either way, resend it inline.
+    if (request.has_shared_stack() && (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION ||
+                                       status.error_code() == grpc::StatusCode::ABORTED)) {
+        if (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) {
+            client->shm_active.store(false, std::memory_order_relaxed);
+            request.clear_shared_memory();
+        }
+        client->shm_fallbacks.fetch_add(1, std::memory_order_relaxed);
+        request.clear_shared_stack();
+        add_inline_stack();
+        response.Clear();
+        status = call();
+    }
+
+    uint64_t rpc_ns = elapsed_ns(rpc_started);
+    GrpcErrorCode code = status_to_error_code(status);
+    size_t response_bytes = status.ok() ? response.ByteSizeLong() : 0;
+
+    WordMetrics* metrics = word_metrics(client, request.word_name());
+    metrics->calls.fetch_add(1, std::memory_order_relaxed);
+    metrics->status_counts[status_slot(code)].fetch_add(1, std::memory_order_relaxed);
+    metrics->request_bytes.fetch_add(request_bytes, std::memory_order_relaxed);
+    metrics->response_bytes.fetch_add(response_bytes, std::memory_order_relaxed);
+    record_latency_sample(&metrics->rpc, rpc_ns);
+
+    if (!status.ok()) {
+        return code;
+    }
+
+    if (response.has_error()) metrics->word_errors.fetch_add(1, std::memory_order_relaxed);
+    record_transfer(client, request_bytes, true);
+    record_transfer(client, response_bytes, false);
+
+    if (response.supports_compact_temporal()) {
+        client->peer_supports_compact_temporal.store(true, std::memory_order_relaxed);
+    }
+
+    // Check for application-level error
+    if (response.has_error()) {
+        *out_error = error_info_from_proto(response.error());
+        *out_result_len = 0;
+        *out_result_stack = nullptr;
+        return GRPC_OK;  // gRPC succeeded, but execution failed
+    }
+
+    if (response.has_shared_result_stack()) {
+        // The slot stays pinned until released, so only a bad descriptor or
+        // a region this host cannot map loses a result of a word that has run
+        SharedReadResult read = read_shared_stack(response.shared_result_stack(), response.mutable_result_stack());
+        release_shared_slot(response.shared_result_stack());
+        if (read != SharedReadResult::kOk) {
+            return GRPC_ERROR_DATA_LOSS;
+        }
+        client->shm_results.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Convert result stack (move each value out of the response instead of copying)
+    take_result_stack(response.mutable_result_stack(), out_result_stack, out_result_len);
+    *out_error = nullptr;
+
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_execute_sequence(
+    GrpcClient* client,
+    const char* const* word_names,
+    const size_t* word_name_lens,
+    size_t word_names_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+) {
+    if (!client || (word_names_len > 0 && (!word_names || !word_name_lens)) || (stack_len > 0 && !stack) ||
+        !out_result_stack || !out_result_len || !out_error) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    ExecuteSequenceRequest request;
+    for (size_t i = 0; i < word_names_len; i++) {
+        request.add_word_names(word_names[i], word_name_lens[i]);
+    }
+    for (size_t i = 0; i < stack_len; i++) {
+        *request.add_stack() = stack[i]->proto();
+    }
+    request.set_accepts_compact_temporal(true);
+    request.set_accepts_remote_refs(client->accepts_remote_refs.load(std::memory_order_relaxed));
+
+    ExecuteSequenceResponse response;
+    size_t request_bytes = request.ByteSizeLong();
+    ClientContext context;
+    apply_deadline(&context, deadline_from_now(call_deadline_ms(client, nullptr)));
+    apply_compression(client, &context, request_bytes);
+
+    Status status;
+    {
+        ChannelLease lease(client);
+        auto started = std::chrono::steady_clock::now();
+        status = lease.stub()->ExecuteSequence(&context, request, &response);
+        lease.record(status);
+        if (status.ok()) record_latency(client, started);
+    }
+    if (!status.ok()) {
+        return status_to_error_code(status);
+    }
+
+    record_transfer(client, request_bytes, true);
+    record_transfer(client, response.ByteSizeLong(), false);
+
+    if (response.supports_compact_temporal()) {
+        client->peer_supports_compact_temporal.store(true, std::memory_order_relaxed);
+    }
+
+    if (response.has_error()) {
+        *out_error = error_info_from_proto(response.error());
+        *out_result_len = 0;
+        *out_result_stack = nullptr;
+        return GRPC_OK;  // gRPC succeeded, but execution failed
+    }
+
+    take_result_stack(response.mutable_result_stack(), out_result_stack, out_result_len);
+    *out_error = nullptr;
+    return GRPC_OK;
+}
+
+// =============================================================================
+// Client Stream (ExecuteStream) Implementation
+// =============================================================================
+
+static void read_stream_responses(GrpcClient* client, ClientStream* stream) {
+    StreamResponse response;
+    while (stream->rpc->Read(&response)) {
+        if (response.supports_compact_temporal()) {
+            client->peer_supports_compact_temporal.store(true, std::memory_order_relaxed);
+        }
+
+        std::lock_guard<std::mutex> lock(stream->mu);
+        stream->completed[response.correlation_id()].Swap(&response);
+        stream->cv.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock(stream->mu);
+    stream->finished = true;
+    stream->cv.notify_all();
+}
+
+// Caller holds client->stream_mu. A stream whose RPC has ended is retired
+// and replaced, so one broken stream does not fail every later submit.
+static ClientStream* open_client_stream(GrpcClient* client) {
+    std::unordered_map<uint64_t, StreamResponse> carried;
+    if (client->stream) {
+        bool finished;
+        {
+            std::lock_guard<std::mutex> stream_lock(client->stream->mu);
+            finished = client->stream->finished;
+        }
+        if (!finished) return client->stream.get();
+
+        // The reader has seen the end of the RPC and is about to exit
+        std::shared_ptr<ClientStream> dead = std::move(client->stream);
+        dead->reader.join();
+        dead->rpc->Finish();
+
+        std::lock_guard<std::mutex> stream_lock(dead->mu);
+        carried = std::move(dead->completed);
+    }
+
+    auto stream = std::make_shared<ClientStream>();
+    stream->completed = std::move(carried);
+    stream->lease = std::make_unique<ChannelLease>(client);
+    stream->rpc = stream->lease->stub()->ExecuteStream(&stream->context);
+    if (!stream->rpc) return nullptr;
+    stream->first_correlation_id = client->next_correlation_id.load(std::memory_order_relaxed);
+
+    ClientStream* raw = stream.get();
+    stream->reader = std::thread([client, raw] { read_stream_responses(client, raw); });
+    client->stream = std::move(stream);
+    return raw;
+}
+
+extern "C" GrpcErrorCode grpc_client_stream_submit(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* push,
+    size_t push_len,
+    int64_t return_count,
+    uint64_t* out_correlation_id
+) {
+    if (!client || !word_name || word_name_len == 0 || (push_len > 0 && !push) || !out_correlation_id) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    StreamRequest request;
+    request.set_word_name(std::string(word_name, word_name_len));
+    request.set_accepts_compact_temporal(true);
+    if (return_count >= 0) {
+        request.set_return_count(static_cast<uint32_t>(return_count));
+    }
+    for (size_t i = 0; i < push_len; i++) {
+        *request.add_push() = push[i]->proto();
+    }
+
+    std::lock_guard<std::mutex> lock(client->stream_mu);
+    ClientStream* stream = open_client_stream(client);
+    if (!stream) return GRPC_ERROR_UNAVAILABLE;
+
+    // Allocated under stream_mu so that ids never go backwards across streams
+    uint64_t correlation_id = client->next_correlation_id.fetch_add(1, std::memory_order_relaxed);
+    request.set_correlation_id(correlation_id);
+
+    if (!stream->rpc->Write(request)) {
+        return GRPC_ERROR_UNAVAILABLE;
+    }
+
+    *out_correlation_id = correlation_id;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_stream_wait(
+    GrpcClient* client,
+    uint64_t correlation_id,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+) {
+    if (!client || !out_result_stack || !out_result_len || !out_error) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::shared_ptr<ClientStream> stream;
+    {
+        std::lock_guard<std::mutex> lock(client->stream_mu);
+        stream = client->stream;
+    }
+    if (!stream) return GRPC_ERROR_FAILED_PRECONDITION;
+
+    StreamResponse response;
+    for (;;) {
+        {
+            // Responses to earlier streams are already here or never will be
+            bool earlier_stream = correlation_id < stream->first_correlation_id;
+            std::unique_lock<std::mutex> lock(stream->mu);
+            stream->cv.wait(lock, [&] {
+                return earlier_stream || stream->finished || stream->completed.count(correlation_id) > 0;
+            });
+
+            auto it = stream->completed.find(correlation_id);
+            if (it != stream->completed.end()) {
+                response.Swap(&it->second);
+                stream->completed.erase(it);
+                break;
+            }
+        }
+
+        // The stream ended without the response. If a submit has reopened it
+        // since, what had arrived was carried over: look there.
+        std::lock_guard<std::mutex> lock(client->stream_mu);
+        if (!client->stream || client->stream == stream) {
+            return GRPC_ERROR_UNAVAILABLE;  // stream ended before the response arrived
+        }
+        stream = client->stream;
+    }
+
+    if (response.has_error()) {
+        *out_error = error_info_from_proto(response.error());
+        *out_result_len = 0;
+        *out_result_stack = nullptr;
+        return GRPC_OK;  // gRPC succeeded, but execution failed
+    }
+
+    take_result_stack(response.mutable_result_stack(), out_result_stack, out_result_len);
+    *out_error = nullptr;
+    return GRPC_OK;
+}
+
+extern "C" void grpc_client_stream_close(GrpcClient* client) {
+    if (!client) return;
+
+    std::shared_ptr<ClientStream> stream;
+    {
+        std::lock_guard<std::mutex> lock(client->stream_mu);
+        stream = std::move(client->stream);
+        if (!stream) return;
+        stream->rpc->WritesDone();
+    }
+
+    // Uncollected responses are dropped, so there is no need to drain the stream
+    stream->context.TryCancel();
+    stream->reader.join();
+    stream->rpc->Finish();
+}
+
+// =============================================================================
+// Chunked Results (ExecuteWordChunked) Implementation
+// =============================================================================
+
+// Read what is left so that Finish() may be called
+static Status finish_result_stream(ResultStream* stream) {
+    ResultChunk discard;
+    while (stream->reader->Read(&discard)) {
+    }
+    stream->finished = true;
+    return stream->reader->Finish();
+}
+
+extern "C" GrpcErrorCode grpc_client_execute_word_chunked(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    uint32_t max_chunk_bytes,
+    ResultStream** out_stream,
+    ErrorInfo** out_error
+) {
+    if (!client || !word_name || (stack_len > 0 && !stack) || !out_stream || !out_error) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    *out_stream = nullptr;
+    *out_error = nullptr;
+
+    ExecuteWordRequest request;
+    request.set_word_name(std::string(word_name, word_name_len));
+    request.set_accepts_compact_temporal(true);
+    request.set_accepts_remote_refs(client->accepts_remote_refs.load(std::memory_order_relaxed));
+    request.set_max_chunk_bytes(max_chunk_bytes);
+
+    for (size_t i = 0; i < stack_len; i++) {
+        *request.add_stack() = stack[i]->proto();
+    }
+
+    size_t request_bytes = request.ByteSizeLong();
+
+    auto stream = std::make_unique<ResultStream>();
+    stream->client = client;
+    apply_deadline(&stream->context, deadline_from_now(client->options.deadline_ms));
+    apply_compression(client, &stream->context, request_bytes);
+    stream->lease = std::make_unique<ChannelLease>(client);
+    stream->reader = stream->lease->stub()->ExecuteWordChunked(&stream->context, request);
+    record_transfer(client, request_bytes, true);
+
+    // The first chunk is the header, or the error if the word failed
+    ResultChunk first;
+    if (!stream->reader->Read(&first)) {
+        stream->finished = true;
+        Status status = stream->reader->Finish();
+        stream->lease->record_stream(status);
+        return status.ok() ? GRPC_ERROR_DATA_LOSS : status_to_error_code(status);
+    }
+
+    if (first.has_error()) {
+        *out_error = error_info_from_proto(first.error());
+        finish_result_stream(stream.get());
+        return GRPC_OK;  // gRPC succeeded, but execution failed
+    }
+
+    if (!first.has_header()) {
+        stream->context.TryCancel();
+        finish_result_stream(stream.get());
+        return GRPC_ERROR_DATA_LOSS;
+    }
+
+    if (first.header().supports_compact_temporal()) {
+        client->peer_supports_compact_temporal.store(true, std::memory_order_relaxed);
+    }
+    stream->result_count = first.header().result_count();
+
+    *out_stream = stream.release();
+    return GRPC_OK;
+}
+
+extern "C" size_t result_stream_result_count(const ResultStream* stream) {
+    return stream ? stream->result_count : 0;
+}
+
+extern "C" GrpcErrorCode result_stream_next(
+    ResultStream* stream,
+    ResultChunkKind* out_kind,
+    size_t* out_stack_index,
+    bool* out_last,
+    StackValue*** out_values,
+    size_t* out_values_len
+) {
+    if (!stream || !out_kind || !out_stack_index || !out_last || !out_values || !out_values_len) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    *out_kind = RESULT_CHUNK_END;
+    *out_stack_index = 0;
+    *out_last = false;
+    *out_values = nullptr;
+    *out_values_len = 0;
+
+    if (stream->finished) return GRPC_OK;
+
+    ResultChunk chunk;
+    if (!stream->reader->Read(&chunk)) {
+        stream->finished = true;
+        Status status = stream->reader->Finish();
+        stream->lease->record_stream(status);
+        return status_to_error_code(status);
+    }
+
+    if (!chunk.has_value()) {
+        stream->context.TryCancel();
+        finish_result_stream(stream);
+        return GRPC_ERROR_DATA_LOSS;
+    }
+    record_transfer(stream->client, chunk.ByteSizeLong(), false);
+
+    auto* part = chunk.mutable_value();
+    *out_stack_index = part->stack_index();
+    *out_last = part->last();
+
+    if (part->has_array_elements()) {
+        *out_kind = RESULT_CHUNK_ARRAY_ELEMENTS;
+        take_result_stack(part->mutable_array_elements()->mutable_items(), out_values, out_values_len);
+        return GRPC_OK;
+    }
+
+    auto** values = (StackValue**)malloc(sizeof(StackValue*));
+    auto* value = new OwnedStackValue();
+    value->proto_value.Swap(part->mutable_value());
+    values[0] = value;
+
+    *out_kind = RESULT_CHUNK_VALUE;
+    *out_values = values;
+    *out_values_len = 1;
+    return GRPC_OK;
+}
+
+extern "C" void result_stream_destroy(ResultStream* stream) {
+    if (!stream) return;
+    if (!stream->finished) {
+        stream->context.TryCancel();
+        finish_result_stream(stream);
+    }
+    delete stream;
+}
+
+extern "C" bool grpc_client_peer_supports_compact_temporal(const GrpcClient* client) {
+    return client && client->peer_supports_compact_temporal.load(std::memory_order_relaxed);
+}
+
+extern "C" void grpc_client_set_accepts_remote_refs(GrpcClient* client, bool accepts) {
+    if (client) client->accepts_remote_refs.store(accepts, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Module Discovery Implementation
+// =============================================================================
+
+extern "C" GrpcErrorCode grpc_client_list_modules(GrpcClient* client, ModuleList** out_list) {
+    if (!client || !out_list) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto list = std::make_unique<ModuleList>();
+    ClientContext context;
+    apply_deadline(&context, deadline_from_now(client->options.deadline_ms));
+    ChannelLease lease(client);
+    Status status = lease.stub()->ListModules(&context, ListModulesRequest(), &list->response);
+    lease.record(status);
+
+    if (!status.ok()) {
+        return status_to_error_code(status);
+    }
+
+    *out_list = list.release();
+    return GRPC_OK;
+}
+
+extern "C" const char* module_list_version(const ModuleList* list, size_t* out_len) {
+    return string_view_out(list ? list->response.version() : kEmptyString, out_len);
+}
+
+extern "C" size_t module_list_count(const ModuleList* list) {
+    return list ? list->response.modules_size() : 0;
+}
+
+extern "C" const char* module_list_name(const ModuleList* list, size_t index, size_t* out_len) {
+    if (!list || index >= static_cast<size_t>(list->response.modules_size())) {
+        return string_view_out(kEmptyString, out_len);
+    }
+    return string_view_out(list->response.modules(static_cast<int>(index)).name(), out_len);
+}
+
+extern "C" void module_list_destroy(ModuleList* list) {
+    delete list;
+}
+
+extern "C" GrpcErrorCode grpc_client_get_module_info(
+    GrpcClient* client,
+    const char* module_name,
+    size_t module_name_len,
+    ModuleInfo** out_info
+) {
+    if (!client || !module_name || !out_info) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    GetModuleInfoRequest request;
+    request.set_module_name(std::string(module_name, module_name_len));
+
+    auto info = std::make_unique<ModuleInfo>();
+    ClientContext context;
+    apply_deadline(&context, deadline_from_now(client->options.deadline_ms));
+    ChannelLease lease(client);
+    Status status = lease.stub()->GetModuleInfo(&context, request, &info->response);
+    lease.record(status);
+
+    if (!status.ok()) {
+        return status_to_error_code(status);
+    }
+
+    *out_info = info.release();
+    return GRPC_OK;
+}
+
+extern "C" const char* module_info_description(const ModuleInfo* info, size_t* out_len) {
+    return string_view_out(info ? info->response.description() : kEmptyString, out_len);
+}
+
+extern "C" const char* module_info_version(const ModuleInfo* info, size_t* out_len) {
+    return string_view_out(info ? info->response.version() : kEmptyString, out_len);
+}
+
+extern "C" size_t module_info_word_count(const ModuleInfo* info) {
+    return info ? info->response.words_size() : 0;
+}
+
+extern "C" bool module_info_get_word(const ModuleInfo* info, size_t index, GrpcWordInfo* out_word) {
+    if (!info || !out_word || index >= static_cast<size_t>(info->response.words_size())) {
+        return false;
+    }
+
+    const auto& word = info->response.words(static_cast<int>(index));
+    out_word->name = string_view_out(word.name(), &out_word->name_len);
+    out_word->stack_effect = string_view_out(word.stack_effect(), &out_word->stack_effect_len);
+    out_word->description = string_view_out(word.description(), &out_word->description_len);
+    out_word->pure = word.pure();
+    return true;
+}
+
+extern "C" void module_info_destroy(ModuleInfo* info) {
+    delete info;
+}
+
+// =============================================================================
+// Remote Value Handles
+// =============================================================================
+
+extern "C" GrpcErrorCode grpc_client_fetch_ref(
+    GrpcClient* client,
+    const char* handle_id,
+    size_t handle_id_len,
+    StackValue** out_value,
+    ErrorInfo** out_error
+) {
+    if (!client || !handle_id || handle_id_len == 0 || !out_value || !out_error) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    FetchRefRequest request;
+    request.set_handle_id(std::string(handle_id, handle_id_len));
+    request.set_accepts_compact_temporal(true);
+
+    // A handle lives on the endpoint that returned it; with several
+    // endpoints, ask each until one knows it
+    std::vector<Endpoint*> order{select_endpoint(client)};
+    for (auto& endpoint : client->endpoints) {
+        if (endpoint.get() != order[0]) order.push_back(endpoint.get());
+    }
+
+    FetchRefResponse response;
+    Status status;
+    for (Endpoint* endpoint : order) {
+        response.Clear();
+        ClientContext context;
+        apply_deadline(&context, deadline_from_now(client->options.deadline_ms));
+        ChannelLease lease(client, endpoint);
+        status = lease.stub()->FetchRef(&context, request, &response);
+        lease.record(status);
+        if (status.ok() && !response.has_error()) break;
+    }
+
+    if (!status.ok()) {
+        return status_to_error_code(status);
+    }
+
+    if (response.has_error()) {
+        *out_error = error_info_from_proto(response.error());
+        *out_value = nullptr;
+        return GRPC_OK;  // gRPC succeeded, but the handle could not be resolved
+    }
+
+    auto* value = new OwnedStackValue();
+    value->proto_value.Swap(response.mutable_value());
+
+    *out_value = value;
+    *out_error = nullptr;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode grpc_client_release_refs(
+    GrpcClient* client,
+    const char* const* handle_ids,
+    const size_t* handle_id_lens,
+    size_t count,
+    size_t* out_released
+) {
+    if (!client || (count > 0 && (!handle_ids || !handle_id_lens))) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (out_released) *out_released = 0;
+    if (count == 0) return GRPC_OK;
+
+    ReleaseRefsRequest request;
+    for (size_t i = 0; i < count; i++) {
+        request.add_handle_ids(string_from_n(handle_ids[i], handle_id_lens[i]));
+    }
+
+    // Endpoints ignore handles they do not own, so every endpoint gets the
+    // full list
+    size_t released = 0;
+    Status first_failure;
+    for (auto& endpoint : client->endpoints) {
+        ReleaseRefsResponse response;
+        ClientContext context;
+        apply_deadline(&context, deadline_from_now(client->options.deadline_ms));
+        ChannelLease lease(client, endpoint.get());
+        Status status = lease.stub()->ReleaseRefs(&context, request, &response);
+        lease.record(status);
+
+        if (status.ok()) {
+            released += static_cast<size_t>(response.released_count());
+        } else if (first_failure.ok()) {
+            first_failure = status;
+        }
+    }
+
+    if (out_released) *out_released = released;
+    return status_to_error_code(first_failure);
+}
+
+extern "C" void grpc_client_destroy(GrpcClient* client) {
+    grpc_client_stream_close(client);
+    delete client;
+}
+
+// =============================================================================
+// ErrorInfo API Implementation
+// =============================================================================
+
+extern "C" const char* error_info_get_message(const ErrorInfo* error) {
+    return error ? error->message.c_str() : "";
+}
+
+extern "C" const char* error_info_get_runtime(const ErrorInfo* error) {
+    return error ? error->runtime.c_str() : "";
+}
+
+extern "C" const char* error_info_get_error_type(const ErrorInfo* error) {
+    return error ? error->error_type.c_str() : "";
+}
+
+extern "C" const char* error_info_get_message_view(const ErrorInfo* error, size_t* out_len) {
+    return string_view_out(error ? error->message : kEmptyString, out_len);
+}
+
+extern "C" const char* error_info_get_runtime_view(const ErrorInfo* error, size_t* out_len) {
+    return string_view_out(error ? error->runtime : kEmptyString, out_len);
+}
+
+extern "C" const char* error_info_get_error_type_view(const ErrorInfo* error, size_t* out_len) {
+    return string_view_out(error ? error->error_type : kEmptyString, out_len);
+}
+
+extern "C" ErrorInfo* error_info_create(
+    const char* message,
+    size_t message_len,
+    const char* runtime,
+    size_t runtime_len,
+    const char* error_type,
+    size_t error_type_len
+) {
+    auto* error = new ErrorInfo();
+    error->message = string_from_n(message, message_len);
+    error->runtime = string_from_n(runtime, runtime_len);
+    error->error_type = string_from_n(error_type, error_type_len);
+    return error;
+}
+
+extern "C" void error_info_destroy(ErrorInfo* error) {
+    delete error;
+}
+
+// =============================================================================
+// Server API Implementation
+// =============================================================================
+
+// Owns one handler session for the lifetime of an RPC
+class HandlerSession {
+public:
+    explicit HandlerSession(const GrpcServerHandler& handler)
+        : handler_(handler), session_(handler.session_create(handler.user_data)) {}
+
+    ~HandlerSession() {
+        if (session_) handler_.session_destroy(handler_.user_data, session_);
+    }
+
+    HandlerSession(const HandlerSession&) = delete;
+    HandlerSession& operator=(const HandlerSession&) = delete;
+
+    void* get() const { return session_; }
+
+private:
+    const GrpcServerHandler& handler_;
+    void* session_;
+};
+
+// Holds one in-flight slot for the lifetime of an RPC
+class Admission {
+public:
+    Admission(AdmissionControl& control, ServerContext* context) : control_(control) {
+        status_ = enter(context);
+    }
+
+    ~Admission() {
+        if (!status_.ok()) return;
+        std::lock_guard<std::mutex> lock(control_.mu);
+        control_.in_flight--;
+        control_.cv.notify_one();
+    }
+
+    Admission(const Admission&) = delete;
+    Admission& operator=(const Admission&) = delete;
+
+    // OK if admitted, else the status to fail the RPC with
+    const Status& status() const { return status_; }
+
+private:
+    // How often a queued request rechecks for cancellation
+    static constexpr auto kQueuePoll = std::chrono::milliseconds(10);
+
+    Status enter(ServerContext* context) {
+        std::unique_lock<std::mutex> lock(control_.mu);
+        const uint32_t max_in_flight = control_.limits.max_in_flight;
+        auto has_slot = [&] { return max_in_flight == 0 || control_.in_flight < max_in_flight; };
+
+        if (!has_slot()) {
+            if (control_.queued >= control_.limits.max_queued) {
+                control_.rejected.fetch_add(1, std::memory_order_relaxed);
+                return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "server overloaded: request queue full");
+            }
+
+            control_.queued++;
+            control_.peak_queued = std::max(control_.peak_queued, control_.queued);
+            // Wait no longer than the caller would
+            while (!has_slot() && !context->IsCancelled() &&
+                   std::chrono::system_clock::now() < context->deadline()) {
+                control_.cv.wait_for(lock, kQueuePoll);
+            }
+            control_.queued--;
+
+            if (!has_slot()) {
+                control_.rejected.fetch_add(1, std::memory_order_relaxed);
+                return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "server overloaded: queued past deadline");
+            }
+        }
+
+        control_.in_flight++;
+        control_.admitted.fetch_add(1, std::memory_order_relaxed);
+        return Status::OK;
+    }
+
+    AdmissionControl& control_;
+    Status status_;
+};
+
+// A unary request that ran out of instruction budget fails as a whole
+static bool budget_exceeded(AdmissionControl& control, const ProtoErrorInfo& error, Status* out_status) {
+    if (error.error_type() != GRPC_BUDGET_EXCEEDED_ERROR_TYPE) return false;
+    control.budget_exceeded.fetch_add(1, std::memory_order_relaxed);
+    *out_status = Status(grpc::StatusCode::RESOURCE_EXHAUSTED, error.message());
+    return true;
+}
+
+// Run one word through the handler. Returns false (with out_error filled)
+// if the word failed.
+static bool run_handler(
+    const GrpcServerHandler& handler,
+    void* session,
+    const std::string& word_name,
+    const ProtoStackValues& push,
+    int64_t return_count,
+    bool compact_temporal,
+    ProtoStackValues* out_stack,
+    ProtoErrorInfo* out_error,
+    size_t* out_session_depth
+) {
+    std::deque<StackValueView> views;
+    std::vector<const StackValue*> args;
+    args.reserve(push.size());
+    for (const auto& value : push) {
+        args.push_back(&views.emplace_back(value));
+    }
+
+    StackValue** results = nullptr;
+    size_t results_len = 0;
+    size_t session_depth = 0;
+    ErrorInfo* error = nullptr;
+
+    handler.execute(
+        handler.user_data, session,
+        word_name.data(), word_name.size(),
+        args.data(), args.size(),
+        return_count, compact_temporal,
+        &results, &results_len, &session_depth, &error);
+
+    *out_session_depth = session_depth;
+
+    if (error) {
+        out_error->set_message(std::move(error->message));
+        out_error->set_runtime(std::move(error->runtime));
+        out_error->set_error_type(std::move(error->error_type));
+        delete error;
+        stack_value_array_destroy(results, results_len);
+        return false;
+    }
+
+    for (size_t i = 0; i < results_len; i++) {
+        out_stack->Add()->Swap(&owned_value(results[i])->proto_value);
+    }
+    stack_value_array_destroy(results, results_len);
+    return true;
+}
+
+// Run a word sequence through the handler, on one session stack. Falls back
+// to one execute call per word for handlers without execute_sequence.
+static bool run_sequence_handler(
+    const GrpcServerHandler& handler,
+    void* session,
+    const google::protobuf::RepeatedPtrField<std::string>& word_names,
+    const ProtoStackValues& push,
+    bool compact_temporal,
+    ProtoStackValues* out_stack,
+    ProtoErrorInfo* out_error
+) {
+    if (!handler.execute_sequence) {
+        ProtoStackValues none;
+        size_t session_depth = 0;
+        for (int i = 0; i < word_names.size(); i++) {
+            bool last = i + 1 == word_names.size();
+            if (!run_handler(handler, session, word_names.Get(i), i == 0 ? push : none, last ? -1 : 0,
+                             compact_temporal, out_stack, out_error, &session_depth)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<const char*> names;
+    std::vector<size_t> name_lens;
+    names.reserve(word_names.size());
+    name_lens.reserve(word_names.size());
+    for (const auto& name : word_names) {
+        names.push_back(name.data());
+        name_lens.push_back(name.size());
+    }
+
+    std::deque<StackValueView> views;
+    std::vector<const StackValue*> args;
+    args.reserve(push.size());
+    for (const auto& value : push) {
+        args.push_back(&views.emplace_back(value));
+    }
+
+    StackValue** results = nullptr;
+    size_t results_len = 0;
+    ErrorInfo* error = nullptr;
+
+    handler.execute_sequence(
+        handler.user_data, session,
+        names.data(), name_lens.data(), names.size(),
+        args.data(), args.size(),
+        compact_temporal,
+        &results, &results_len, &error);
+
+    if (error) {
+        out_error->set_message(std::move(error->message));
+        out_error->set_runtime(std::move(error->runtime));
+        out_error->set_error_type(std::move(error->error_type));
+        delete error;
+        stack_value_array_destroy(results, results_len);
+        return false;
+    }
+
+    for (size_t i = 0; i < results_len; i++) {
+        out_stack->Add()->Swap(&owned_value(results[i])->proto_value);
+    }
+    stack_value_array_destroy(results, results_len);
+    return true;
+}
+
+// Default target size of one ResultChunk
+static constexpr size_t kDefaultMaxChunkBytes = 1 << 20;
+
+// Chunks below the caller's compression threshold go out uncompressed
+static bool write_chunk(grpc::ServerWriter<ResultChunk>* writer, const ResultChunk& chunk, uint64_t compression_threshold) {
+    grpc::WriteOptions options;
+    if (chunk.ByteSizeLong() < compression_threshold) options.set_no_compression();
+    return writer->Write(chunk, options);
+}
+
+// Send one result value, splitting a large top-level array into runs of
+// elements. Elements are moved out of value as they are sent.
+static bool write_result_value(
+    grpc::ServerWriter<ResultChunk>* writer,
+    uint32_t stack_index,
+    ProtoStackValue* value,
+    size_t max_chunk_bytes,
+    uint64_t compression_threshold
+) {
+    ResultChunk chunk;
+    auto* part = chunk.mutable_value();
+    part->set_stack_index(stack_index);
+
+    if (!value->has_array_value() || value->ByteSizeLong() <= max_chunk_bytes) {
+        part->mutable_value()->Swap(value);
+        part->set_last(true);
+        return write_chunk(writer, chunk, compression_threshold);
+    }
+
+    auto* items = value->mutable_array_value()->mutable_items();
+    auto* elements = part->mutable_array_elements();
+    size_t chunk_bytes = 0;
+
+    for (auto& item : *items) {
+        size_t item_bytes = item.ByteSizeLong();
+        if (chunk_bytes > 0 && chunk_bytes + item_bytes > max_chunk_bytes) {
+            if (!write_chunk(writer, chunk, compression_threshold)) return false;
+            elements->clear_items();
+            chunk_bytes = 0;
+        }
+        elements->add_items()->Swap(&item);
+        chunk_bytes += item_bytes;
+    }
+
+    part->set_last(true);
+    return write_chunk(writer, chunk, compression_threshold);
+}
+
+// Largest request the server accepts, inline or through shared memory
+static uint64_t max_request_bytes(const AdmissionControl& control) {
+    return control.limits.max_request_bytes > 0 ? control.limits.max_request_bytes
+                                                : GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH;
+}
+
+// Shared-memory descriptors are only honored from peers the kernel places on
+// this host: Unix domain sockets and in-process channels. A TCP peer could
+// name a local region it has no business reading.
+static bool peer_is_local(const ServerContext* context) {
+    const std::string peer = context->peer();
+    return peer.rfind("unix:", 0) == 0 || peer.rfind("inproc", 0) == 0;
+}
+
+class ForthicRuntimeServiceImpl final : public ForthicRuntime::Service {
+public:
+    ForthicRuntimeServiceImpl(const GrpcServerHandler* handler, AdmissionControl* admission)
+        : handler_(handler), admission_(admission) {}
+
+    Status ExecuteWord(ServerContext* context, const ExecuteWordRequest* request, ExecuteWordResponse* response) override {
+        if (request->has_shared_stack() && !peer_is_local(context)) {
+            return Status(grpc::StatusCode::FAILED_PRECONDITION, "shared memory needs a unix or inproc channel");
+        }
+
+        Admission admission(*admission_, context);
+        if (!admission.status().ok()) return admission.status();
+
+        // A shared stack bypasses gRPC's receive limit, so it is checked here
+        // before any of it is decoded
+        ProtoStackValues shared_stack;
+        if (request->has_shared_stack()) {
+            if (request->shared_stack().length() > max_request_bytes(*admission_)) {
+                return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "shared-memory stack exceeds max_request_bytes");
+            }
+            switch (read_shared_stack(request->shared_stack(), &shared_stack)) {
+                case SharedReadResult::kOk:
+                    break;
+                case SharedReadResult::kUnavailable:
+                    return Status(grpc::StatusCode::FAILED_PRECONDITION, "shared-memory region unavailable");
+                case SharedReadResult::kOverwritten:
+                    return Status(grpc::StatusCode::ABORTED, "shared-memory payload overwritten");
+            }
+        }
+
+        HandlerSession session(*handler_);
+        if (!session.get()) {
+            return Status(grpc::StatusCode::INTERNAL, "failed to create session");
+        }
+
+        response->set_supports_compact_temporal(true);
+
+        // Unary calls ship the whole stack in and out
+        ProtoErrorInfo error;
+        size_t session_depth = 0;
+        if (!run_handler(*handler_, session.get(), request->word_name(),
+                         request->has_shared_stack() ? shared_stack : request->stack(), -1,
+                         request->accepts_compact_temporal(), response->mutable_result_stack(),
+                         &error, &session_depth)) {
+            Status status;
+            if (budget_exceeded(*admission_, error, &status)) return status;
+            response->mutable_error()->Swap(&error);
+            return Status::OK;
+        }
+
+        if (request->has_shared_memory() && peer_is_local(context)) {
+            share_result_stack(request->shared_memory(), response);
+        }
+
+        grpc_compression_algorithm algorithm;
+        uint64_t compression_threshold;
+        if (requested_compression(context, &algorithm, &compression_threshold) &&
+            response->ByteSizeLong() >= compression_threshold) {
+            context->set_compression_algorithm(algorithm);
+        }
+        return Status::OK;
+    }
+
+    Status ExecuteSequence(ServerContext* context, const ExecuteSequenceRequest* request, ExecuteSequenceResponse* response) override {
+        Admission admission(*admission_, context);
+        if (!admission.status().ok()) return admission.status();
+
+        HandlerSession session(*handler_);
+        if (!session.get()) {
+            return Status(grpc::StatusCode::INTERNAL, "failed to create session");
+        }
+
+        response->set_supports_compact_temporal(true);
+
+        ProtoErrorInfo error;
+        if (!run_sequence_handler(*handler_, session.get(), request->word_names(), request->stack(),
+                                  request->accepts_compact_temporal(), response->mutable_result_stack(), &error)) {
+            Status status;
+            if (budget_exceeded(*admission_, error, &status)) return status;
+            response->clear_result_stack();
+            response->mutable_error()->Swap(&error);
+            return Status::OK;
+        }
+
+        grpc_compression_algorithm algorithm;
+        uint64_t compression_threshold;
+        if (requested_compression(context, &algorithm, &compression_threshold) &&
+            response->ByteSizeLong() >= compression_threshold) {
+            context->set_compression_algorithm(algorithm);
+        }
+        return Status::OK;
+    }
+
+    Status ExecuteWordChunked(ServerContext* context, const ExecuteWordRequest* request, grpc::ServerWriter<ResultChunk>* writer) override {
+        Admission admission(*admission_, context);
+        if (!admission.status().ok()) return admission.status();
+
+        HandlerSession session(*handler_);
+        if (!session.get()) {
+            return Status(grpc::StatusCode::INTERNAL, "failed to create session");
+        }
+
+        ProtoStackValues results;
+        ProtoErrorInfo error;
+        size_t session_depth = 0;
+        if (!run_handler(*handler_, session.get(), request->word_name(), request->stack(), -1,
+                         request->accepts_compact_temporal(), &results, &error, &session_depth)) {
+            Status status;
+            if (budget_exceeded(*admission_, error, &status)) return status;
+            ResultChunk chunk;
+            chunk.mutable_error()->Swap(&error);
+            writer->Write(chunk);
+            return Status::OK;
+        }
+
+        // Without a compression request no algorithm is set, so nothing is compressed
+        grpc_compression_algorithm algorithm = GRPC_COMPRESS_NONE;
+        uint64_t compression_threshold = 0;
+        if (requested_compression(context, &algorithm, &compression_threshold)) {
+            context->set_compression_algorithm(algorithm);
+        }
+
+        ResultChunk header;
+        header.mutable_header()->set_result_count(static_cast<uint32_t>(results.size()));
+        header.mutable_header()->set_supports_compact_temporal(true);
+        if (!write_chunk(writer, header, compression_threshold)) return Status::OK;
+
+        size_t max_chunk_bytes = request->max_chunk_bytes() > 0 ? request->max_chunk_bytes() : kDefaultMaxChunkBytes;
+        for (int i = 0; i < results.size(); i++) {
+            if (context->IsCancelled()) {
+                return Status(grpc::StatusCode::CANCELLED, "client cancelled");
+            }
+            if (!write_result_value(writer, static_cast<uint32_t>(i), results.Mutable(i), max_chunk_bytes,
+                                    compression_threshold)) {
+                break;
+            }
+            results.Mutable(i)->Clear();
+        }
+        return Status::OK;
+    }
+
+    Status ExecuteStream(ServerContext* context, grpc::ServerReaderWriter<StreamResponse, StreamRequest>* stream) override {
+        // An open stream holds its server thread, so it holds a slot too
+        Admission admission(*admission_, context);
+        if (!admission.status().ok()) return admission.status();
+
+        HandlerSession session(*handler_);
+        if (!session.get()) {
+            return Status(grpc::StatusCode::INTERNAL, "failed to create session");
+        }
+
+        // Requests run in arrival order against the session stack
+        StreamRequest request;
+        while (stream->Read(&request)) {
+            StreamResponse response;
+            response.set_correlation_id(request.correlation_id());
+            response.set_supports_compact_temporal(true);
+
+            int64_t return_count = request.has_return_count() ? static_cast<int64_t>(request.return_count()) : -1;
+            ProtoErrorInfo error;
+            size_t session_depth = 0;
+            if (!run_handler(*handler_, session.get(), request.word_name(), request.push(), return_count,
+                             request.accepts_compact_temporal(), response.mutable_result_stack(),
+                             &error, &session_depth)) {
+                response.mutable_error()->Swap(&error);
+            }
+            response.set_session_depth(static_cast<uint32_t>(session_depth));
+
+            if (!stream->Write(response)) break;
+        }
+        return Status::OK;
+    }
+
+private:
+    // Move a large result stack into this server's region if the caller
+    // can read it: being able to map the caller's region means the caller
+    // is on this host. The slot is pinned for the caller, which releases it
+    // once read; while the space is pinned the result stays inline.
+    void share_result_stack(const forthic::SharedMemoryOffer& offer, ExecuteWordResponse* response) {
+        if (offer.min_bytes() == 0) return;
+
+        std::vector<const ProtoStackValue*> values;
+        values.reserve(response->result_stack_size());
+        for (const auto& value : response->result_stack()) {
+            values.push_back(&value);
+        }
+
+        size_t length = encoded_stack_size(values);
+        if (length < offer.min_bytes() || !shared_region_cache().open(offer.region())) return;
+
+        std::call_once(shm_region_once_, [this] {
+            shm_region_ = SharedRegionWriter::create(kDefaultSharedRegionBytes);
+        });
+        if (!shm_region_) return;
+
+        SharedPayload payload;
+        if (shm_region_->write(values, length, &payload, offer.region())) {
+            response->clear_result_stack();
+            response->mutable_shared_result_stack()->Swap(&payload);
+        }
+    }
+
+    const GrpcServerHandler* handler_;
+    AdmissionControl* admission_;
+
+    // Created on first use
+    std::once_flag shm_region_once_;
+    std::unique_ptr<SharedRegionWriter> shm_region_;
+};
+
+GrpcServer::~GrpcServer() = default;
+
+extern "C" GrpcErrorCode forthic_grpc_server_create(uint16_t port, GrpcServer** out_server) {
+    if (!out_server) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto* server = new GrpcServer();
+    server->port = port;
+    *out_server = server;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_create_address(const char* address, size_t address_len, GrpcServer** out_server) {
+    if (!address || address_len == 0 || !out_server) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto* server = new GrpcServer();
+    server->port = 0;
+    server->address.assign(address, address_len);
+    *out_server = server;
+    return GRPC_OK;
+}
+
+static bool is_unix_address(const std::string& address) {
+    return address.rfind("unix:", 0) == 0 || address.rfind("unix-abstract:", 0) == 0;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_set_handler(GrpcServer* server, const GrpcServerHandler* handler) {
+    if (!server || !handler || !handler->session_create || !handler->session_destroy || !handler->execute) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    if (server->server) {
+        return GRPC_ERROR_FAILED_PRECONDITION;  // cannot swap handlers while serving
+    }
+
+    server->handler = *handler;
+    server->has_handler = true;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_set_limits(GrpcServer* server, const GrpcServerLimits* limits) {
+    if (!server || !limits) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    if (server->server) {
+        return GRPC_ERROR_FAILED_PRECONDITION;  // limits are fixed while serving
+    }
+
+    server->admission.limits = *limits;
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_get_stats(const GrpcServer* server, GrpcServerStats* out_stats) {
+    if (!server || !out_stats) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto& admission = const_cast<GrpcServer*>(server)->admission;
+    out_stats->admitted = admission.admitted.load(std::memory_order_relaxed);
+    out_stats->rejected = admission.rejected.load(std::memory_order_relaxed);
+    out_stats->budget_exceeded = admission.budget_exceeded.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(admission.mu);
+    out_stats->in_flight = admission.in_flight;
+    out_stats->queued = admission.queued;
+    out_stats->peak_queued = admission.peak_queued;
+    return GRPC_OK;
+}
+
+extern "C" uint16_t forthic_grpc_server_get_port(const GrpcServer* server) {
+    return server ? server->port : 0;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_start(GrpcServer* server) {
+    if (!server) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+    if (!server->has_handler) {
+        return GRPC_ERROR_FAILED_PRECONDITION;
+    }
+    if (server->server) {
+        return GRPC_ERROR_ALREADY_EXISTS;
+    }
+
+    server->service = std::make_unique<ForthicRuntimeServiceImpl>(&server->handler, &server->admission);
+
+    std::string listen_address = server->address.empty()
+        ? "0.0.0.0:" + std::to_string(server->port)
+        : server->address;
+    const bool inproc = is_inproc_address(listen_address);
+    // Unix domain sockets and in-process servers have no port to report
+    const bool has_port = !inproc && !is_unix_address(listen_address);
+
+    int selected_port = 0;
+    ServerBuilder builder;
+    if (!inproc) {
+        builder.AddListeningPort(listen_address, grpc::InsecureServerCredentials(), &selected_port);
+    }
+    if (server->admission.limits.max_request_bytes > 0) {
+        builder.SetMaxReceiveMessageSize(static_cast<int>(
+            std::min<uint32_t>(server->admission.limits.max_request_bytes, INT32_MAX)));
+    }
+    builder.RegisterService(server->service.get());
+    server->server = builder.BuildAndStart();
+
+    if (!server->server || (has_port && selected_port == 0)) {
+        server->server.reset();
+        server->service.reset();
+        return GRPC_ERROR_UNAVAILABLE;
+    }
+
+    if (inproc) {
+        std::lock_guard<std::mutex> lock(inproc_mu);
+        if (!inproc_servers().emplace(listen_address, server).second) {
+            server->server->Shutdown();
+            server->server.reset();
+            server->service.reset();
+            return GRPC_ERROR_ALREADY_EXISTS;
+        }
+    }
+
+    if (has_port) server->port = static_cast<uint16_t>(selected_port);
+    return GRPC_OK;
+}
+
+extern "C" GrpcErrorCode forthic_grpc_server_stop(GrpcServer* server) {
+    if (!server || !server->server) {
+        return GRPC_ERROR_INVALID_ARGUMENT;
+    }
+
+    // No new in-process clients from here on
+    if (is_inproc_address(server->address)) {
+        std::lock_guard<std::mutex> lock(inproc_mu);
+        inproc_servers().erase(server->address);
+    }
+
+    // Open streams are cancelled once the grace period runs out
+    server->server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+    server->server->Wait();
+    server->server.reset();
+    server->service.reset();
+    return GRPC_OK;
+}
+
+extern "C" void forthic_grpc_server_destroy(GrpcServer* server) {
+    if (server && server->server) {
+        forthic_grpc_server_stop(server);
+    }
     delete server;
 }
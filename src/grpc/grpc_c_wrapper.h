@@ -24,6 +24,73 @@ typedef struct GrpcServer GrpcServer;
 typedef struct GrpcClient GrpcClient;
 typedef struct StackValue StackValue;
 typedef struct ErrorInfo ErrorInfo;
+typedef struct RecordIterator RecordIterator;
+typedef struct ResultStream ResultStream;
+typedef struct ModuleList ModuleList;
+typedef struct ModuleInfo ModuleInfo;
+
+/** ErrorInfo.error_type of a request that ran out of its instruction budget */
+#define GRPC_BUDGET_EXCEEDED_ERROR_TYPE "InstructionBudgetExceeded"
+
+/**
+ * Callbacks that let a GrpcServer execute words in a host interpreter
+ *
+ * A session is an independent stack: one per ExecuteStream call, and a
+ * short-lived one per unary ExecuteWord call. Sessions may run concurrently
+ * on different server threads, but calls for one session never overlap.
+ */
+typedef struct GrpcServerHandler {
+    void* user_data;
+
+    /** Create session state; return NULL on failure */
+    void* (*session_create)(void* user_data);
+
+    /** Destroy session state */
+    void (*session_destroy)(void* user_data, void* session);
+
+    /**
+     * Push `push` onto the session stack, run word_name, then pop the top
+     * return_count values (the whole stack if return_count < 0) into
+     * *out_results, bottom to top. The array must come from
+     * stack_value_array_alloc; it and its values are owned by the server
+     * afterwards. On failure set *out_error (error_info_create) instead;
+     * an error_type of GRPC_BUDGET_EXCEEDED_ERROR_TYPE fails unary calls
+     * with RESOURCE_EXHAUSTED.
+     */
+    void (*execute)(
+        void* user_data,
+        void* session,
+        const char* word_name,
+        size_t word_name_len,
+        const StackValue* const* push,
+        size_t push_len,
+        int64_t return_count,
+        bool compact_temporal,
+        StackValue*** out_results,
+        size_t* out_results_len,
+        size_t* out_session_depth,
+        ErrorInfo** out_error
+    );
+
+    /**
+     * Optional (may be NULL): push `push`, run the words in order, then pop
+     * the whole stack into *out_results, with the same ownership rules as
+     * execute. Without it, ExecuteSequence calls execute once per word.
+     */
+    void (*execute_sequence)(
+        void* user_data,
+        void* session,
+        const char* const* word_names,
+        const size_t* word_name_lens,
+        size_t word_count,
+        const StackValue* const* push,
+        size_t push_len,
+        bool compact_temporal,
+        StackValue*** out_results,
+        size_t* out_results_len,
+        ErrorInfo** out_error
+    );
+} GrpcServerHandler;
 
 // =============================================================================
 // Error Codes
@@ -44,6 +111,7 @@ typedef enum {
     GRPC_ERROR_UNAVAILABLE = 11,
     GRPC_ERROR_DATA_LOSS = 12,
     GRPC_ERROR_UNAUTHENTICATED = 13,
+    GRPC_ERROR_DEADLINE_EXCEEDED = 14,
     GRPC_ERROR_UNKNOWN = 99
 } GrpcErrorCode;
 
@@ -61,9 +129,202 @@ typedef enum {
     STACK_VALUE_RECORD = 6,
     STACK_VALUE_INSTANT = 7,
     STACK_VALUE_PLAIN_DATE = 8,
-    STACK_VALUE_ZONED_DATETIME = 9
+    STACK_VALUE_ZONED_DATETIME = 9,
+    STACK_VALUE_REMOTE_REF = 10
 } StackValueType;
 
+// =============================================================================
+// Result Chunk Kinds (ExecuteWordChunked)
+// =============================================================================
+
+typedef enum {
+    RESULT_CHUNK_END = 0,             // no more chunks
+    RESULT_CHUNK_VALUE = 1,           // one complete result value
+    RESULT_CHUNK_ARRAY_ELEMENTS = 2   // next run of elements of an array result
+} ResultChunkKind;
+
+// =============================================================================
+// Client Options (channel pool and load balancing)
+// =============================================================================
+
+typedef enum {
+    GRPC_LB_ROUND_ROBIN = 0,        // endpoints in turn
+    GRPC_LB_LEAST_OUTSTANDING = 1   // endpoint with the fewest calls in flight
+} GrpcLbPolicy;
+
+typedef enum {
+    GRPC_COMPRESSION_NONE = 0,
+    GRPC_COMPRESSION_DEFLATE = 1,
+    GRPC_COMPRESSION_GZIP = 2
+} GrpcCompression;
+
+typedef struct GrpcClientOptions {
+    /** Channels (HTTP/2 connections) per address; 0 means 1 */
+    uint32_t channels_per_endpoint;
+    GrpcLbPolicy lb_policy;
+    /** Consecutive transport failures that eject an endpoint; 0 disables */
+    uint32_t eject_after_failures;
+    /** Average call latency (ms) that ejects an endpoint; 0 disables */
+    uint32_t eject_latency_ms;
+    /** How long an ejected endpoint is left out of rotation */
+    uint32_t ejection_ms;
+
+    /** Deadline of each call unless GrpcCallOptions overrides it; 0 = none */
+    uint32_t deadline_ms;
+
+    /** HTTP/2 keepalive ping interval; 0 = no keepalive pings */
+    uint32_t keepalive_time_ms;
+    /** How long to wait for a keepalive ack before closing the connection */
+    uint32_t keepalive_timeout_ms;
+    /** Send keepalive pings on idle connections too */
+    bool keepalive_without_calls;
+
+    /**
+     * Attempts for idempotent RPCs (FetchRef, ReleaseRefs, module discovery)
+     * failing with UNAVAILABLE, with exponential backoff; <= 1 disables
+     */
+    uint32_t retry_max_attempts;
+
+    /**
+     * Attempts for idempotent words (GrpcCallOptions.idempotent); <= 1
+     * disables hedging. A further attempt starts whenever the previous one
+     * has been outstanding for the hedging delay; the first response wins
+     * and the rest are cancelled.
+     */
+    uint32_t hedging_max_attempts;
+    /** Hedging delay; 0 = the p95 latency of recent calls */
+    uint32_t hedging_delay_ms;
+
+    /**
+     * ExecuteWord stacks of at least this many encoded bytes go through a
+     * shared-memory region instead of the socket when the runtime is reached
+     * over a Unix domain socket or in-process channel (results too); 0
+     * disables the side channel
+     */
+    uint64_t shm_threshold_bytes;
+    /** Size of the client's shared-memory region; 0 = 64 MiB */
+    uint64_t shm_region_bytes;
+
+    /**
+     * gRPC message compression for ExecuteWord requests and results (and
+     * ExecuteWordChunked chunks) of at least compression_threshold_bytes
+     * encoded bytes; smaller messages are sent as is
+     */
+    GrpcCompression compression;
+    uint64_t compression_threshold_bytes;
+} GrpcClientOptions;
+
+typedef struct GrpcCallOptions {
+    /** Deadline of this call; 0 = the client's deadline_ms */
+    uint32_t deadline_ms;
+    /** The word has no side effects, so it may be hedged */
+    bool idempotent;
+    /** Accept remote value handles in this call's result, even if the client does not */
+    bool accepts_remote_refs;
+} GrpcCallOptions;
+
+typedef struct GrpcEndpointStats {
+    uint64_t requests;
+    /** Transport failures (UNAVAILABLE, DEADLINE_EXCEEDED, ...) */
+    uint64_t failures;
+    uint32_t outstanding;
+    double latency_ewma_ms;
+    bool ejected;
+} GrpcEndpointStats;
+
+/** Borrowed view of one word of a ModuleInfo (valid until module_info_destroy) */
+typedef struct GrpcWordInfo {
+    const char* name;
+    size_t name_len;
+    const char* stack_effect;
+    size_t stack_effect_len;
+    const char* description;
+    size_t description_len;
+    bool pure;
+} GrpcWordInfo;
+
+/**
+ * Payload accounting of ExecuteWord and ExecuteWordChunked messages
+ * gRPC does not report wire sizes, so every count here is of encoded bytes
+ * before compression
+ */
+typedef struct GrpcClientStats {
+    /** Encoded request and result bytes, before compression */
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    /** Messages at or above the compression threshold */
+    uint64_t compressed_messages_sent;
+    uint64_t compressed_messages_received;
+    /** Size of those messages before compression */
+    uint64_t compression_input_bytes;
+} GrpcClientStats;
+
+// =============================================================================
+// Per-Word Metrics
+// =============================================================================
+
+/** Log2 latency buckets: bucket 0 counts samples under 1 ns, bucket i samples in [2^(i-1), 2^i) ns; the last bucket also takes anything slower */
+#define GRPC_LATENCY_BUCKETS 40
+
+/** GrpcWordMetrics.status_counts slots: one per GrpcErrorCode up to GRPC_ERROR_DEADLINE_EXCEEDED, then GRPC_ERROR_UNKNOWN */
+#define GRPC_STATUS_SLOTS 16
+
+typedef struct GrpcLatencyHistogram {
+    uint64_t count;
+    uint64_t sum_ns;
+    uint64_t buckets[GRPC_LATENCY_BUCKETS];
+} GrpcLatencyHistogram;
+
+typedef struct GrpcWordMetrics {
+    /** ExecuteWord calls, including failed ones */
+    uint64_t calls;
+    /** Calls whose word raised an error in the runtime (the RPC itself succeeded) */
+    uint64_t word_errors;
+    /** Calls by RPC outcome (status_to_error_code; GRPC_OK for word errors too) */
+    uint64_t status_counts[GRPC_STATUS_SLOTS];
+    /** Encoded request and response sizes */
+    uint64_t request_bytes;
+    uint64_t response_bytes;
+    /** The RPC as seen by the client: network, queueing and remote execution */
+    GrpcLatencyHistogram rpc;
+    /** Caller-side marshaling (grpc_client_record_serialization) */
+    GrpcLatencyHistogram serialization;
+} GrpcWordMetrics;
+
+typedef struct GrpcSharedMemoryStats {
+    /** Request stacks sent through shared memory */
+    uint64_t requests_shared;
+    /** Result stacks received through shared memory */
+    uint64_t results_shared;
+    /** Calls resent inline because the runtime could not map the region */
+    uint64_t fallbacks;
+    /** The side channel is active (enabled, and not turned off by a fallback) */
+    bool active;
+} GrpcSharedMemoryStats;
+
+typedef struct GrpcServerLimits {
+    /** Requests executing at once (an open stream counts as one); 0 = unlimited */
+    uint32_t max_in_flight;
+    /** Requests waiting for an in-flight slot; more are rejected with RESOURCE_EXHAUSTED */
+    uint32_t max_queued;
+    /** Largest request accepted, inline or in shared memory, in bytes; 0 = gRPC's default (4 MiB) */
+    uint32_t max_request_bytes;
+} GrpcServerLimits;
+
+typedef struct GrpcServerStats {
+    /** Requests executing now */
+    uint32_t in_flight;
+    /** Requests waiting for a slot now, and the most that ever waited at once */
+    uint32_t queued;
+    uint32_t peak_queued;
+    /** Requests that got a slot */
+    uint64_t admitted;
+    /** Requests shed because the queue was full or their deadline passed while queued */
+    uint64_t rejected;
+    /** Unary requests failed because they ran out of instruction budget */
+    uint64_t budget_exceeded;
+} GrpcServerStats;
+
 // =============================================================================
 // Server API
 // =============================================================================
@@ -76,6 +337,54 @@ typedef enum {
  */
 GrpcErrorCode forthic_grpc_server_create(uint16_t port, GrpcServer** out_server);
 
+/**
+ * Create a new gRPC server listening on an explicit address
+ * Accepts "host:port" as well as Unix domain sockets ("unix:/path/to.sock",
+ * "unix-abstract:name") for runtimes on the same host. "inproc:name" opens
+ * no socket at all: only clients in the same process reach it, through
+ * gRPC's in-process transport (for measuring marshaling without a network)
+ * @param address Address bytes (need not be NUL-terminated)
+ * @param address_len Length of address in bytes
+ * @param out_server Pointer to receive created server handle
+ * @return Error code
+ */
+GrpcErrorCode forthic_grpc_server_create_address(const char* address, size_t address_len, GrpcServer** out_server);
+
+/**
+ * Set the callbacks that execute words (required before start)
+ * The handler struct is copied; user_data must outlive the server
+ * @param server Server handle
+ * @param handler Handler callbacks
+ * @return Error code
+ */
+GrpcErrorCode forthic_grpc_server_set_handler(GrpcServer* server, const GrpcServerHandler* handler);
+
+/**
+ * Bound concurrent work and request size (before start)
+ * Requests beyond max_in_flight wait in a queue of at most max_queued, up
+ * to their deadline; requests that find it full fail right away with
+ * RESOURCE_EXHAUSTED, as do oversized messages (rejected by gRPC itself
+ * and not counted in GrpcServerStats) and shared-memory stacks larger than
+ * max_request_bytes
+ * @param server Server handle
+ * @param limits Limits (copied)
+ * @return Error code
+ */
+GrpcErrorCode forthic_grpc_server_set_limits(GrpcServer* server, const GrpcServerLimits* limits);
+
+/**
+ * Admission counters and current queue depth
+ * @param server Server handle
+ * @param out_stats Pointer to receive the stats
+ * @return Error code
+ */
+GrpcErrorCode forthic_grpc_server_get_stats(const GrpcServer* server, GrpcServerStats* out_stats);
+
+/**
+ * Port the server is listening on (resolves port 0 after start; 0 for Unix sockets)
+ */
+uint16_t forthic_grpc_server_get_port(const GrpcServer* server);
+
 /**
  * Start the server (non-blocking)
  * @param server Server handle
@@ -102,12 +411,106 @@ void forthic_grpc_server_destroy(GrpcServer* server);
 
 /**
  * Create a new gRPC client
- * @param address Server address (e.g., "localhost:50051")
+ * @param address Server address (e.g., "localhost:50051", or "unix:/path/to.sock"
+ *                for a runtime on the same host, or "inproc:name" for a
+ *                server started in this process on that address)
  * @param out_client Pointer to receive created client handle
- * @return Error code
+ * @return Error code (GRPC_ERROR_UNAVAILABLE for an inproc server that is not running)
  */
 GrpcErrorCode grpc_client_create(const char* address, GrpcClient** out_client);
 
+/**
+ * Create a new gRPC client from a (pointer, length) address
+ * @param address Server address bytes (need not be NUL-terminated)
+ * @param address_len Length of address in bytes
+ * @param out_client Pointer to receive created client handle
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_create_n(const char* address, size_t address_len, GrpcClient** out_client);
+
+/**
+ * Create a client that spreads calls over several addresses of one runtime
+ * Each address gets options->channels_per_endpoint channels. Calls go to a
+ * healthy endpoint chosen by options->lb_policy; endpoints that keep failing
+ * or run slow are ejected for a while. If every endpoint is ejected, all of
+ * them are used again.
+ * @param addresses Array of address pointers
+ * @param address_lens Array of address lengths
+ * @param address_count Number of addresses
+ * @param options Client options (NULL: one channel, round robin, no ejection,
+ *                no deadline, no keepalive, no retries or hedging)
+ * @param out_client Pointer to receive created client handle
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_create_with_options(
+    const char* const* addresses,
+    const size_t* address_lens,
+    size_t address_count,
+    const GrpcClientOptions* options,
+    GrpcClient** out_client
+);
+
+/**
+ * Number of addresses the client balances over
+ */
+size_t grpc_client_endpoint_count(const GrpcClient* client);
+
+/**
+ * Connect now instead of on the first call, waiting up to timeout_ms
+ * Every channel of every endpoint connects in parallel
+ * @return GRPC_OK once at least one endpoint is ready, GRPC_ERROR_DEADLINE_EXCEEDED if none is in time
+ */
+GrpcErrorCode grpc_client_wait_for_connected(GrpcClient* client, uint32_t timeout_ms);
+
+/**
+ * Whether any channel is connected right now (never starts a connection)
+ */
+bool grpc_client_is_connected(const GrpcClient* client);
+
+/**
+ * Health and load counters of one endpoint (index < grpc_client_endpoint_count)
+ */
+GrpcErrorCode grpc_client_get_endpoint_stats(const GrpcClient* client, size_t index, GrpcEndpointStats* out_stats);
+
+/**
+ * Payload and compression counters (see GrpcClientStats)
+ */
+GrpcErrorCode grpc_client_get_stats(const GrpcClient* client, GrpcClientStats* out_stats);
+
+/**
+ * Number of words with metrics (every word called through ExecuteWord)
+ */
+size_t grpc_client_metrics_word_count(const GrpcClient* client);
+
+/**
+ * Metrics of word index (< grpc_client_metrics_word_count, in first-call order)
+ * @param out_word_name Receives the word name (valid for the client's lifetime)
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_get_word_metrics(
+    const GrpcClient* client,
+    size_t index,
+    const char** out_word_name,
+    size_t* out_word_name_len,
+    GrpcWordMetrics* out_metrics
+);
+
+/**
+ * Add caller-side serialization time (arguments out, results in) for one
+ * call of word_name to its serialization histogram
+ */
+void grpc_client_record_serialization(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    uint64_t elapsed_ns
+);
+
+/**
+ * Counters of the shared-memory side channel (GrpcClientOptions.shm_threshold_bytes)
+ */
+GrpcErrorCode grpc_client_get_shared_memory_stats(const GrpcClient* client, GrpcSharedMemoryStats* out_stats);
+
 /**
  * Execute a word in the remote runtime
  * @param client Client handle
@@ -129,10 +532,46 @@ GrpcErrorCode grpc_client_execute_word(
     ErrorInfo** out_error
 );
 
+/**
+ * Execute a word in the remote runtime, with a (pointer, length) word name
+ * Same as grpc_client_execute_word otherwise
+ */
+GrpcErrorCode grpc_client_execute_word_n(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+);
+
+/**
+ * Execute a word with per-call options (deadline, hedging)
+ * call_options may be NULL. Same as grpc_client_execute_word_n otherwise.
+ * @return Error code (GRPC_ERROR_DEADLINE_EXCEEDED if the deadline passed,
+ *         GRPC_ERROR_DATA_LOSS if a shared-memory result was overwritten
+ *         before it could be read)
+ */
+GrpcErrorCode grpc_client_execute_word_with_options(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    const GrpcCallOptions* call_options,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+);
+
 /**
  * Execute a sequence of words in one batch
+ * The words run in order on one runtime stack, seeded with `stack`.
  * @param client Client handle
- * @param word_names Array of word names
+ * @param word_names Array of word name bytes
+ * @param word_name_lens Length in bytes of each word name
  * @param word_names_len Length of word names array
  * @param stack Array of stack values
  * @param stack_len Length of stack array
@@ -144,6 +583,7 @@ GrpcErrorCode grpc_client_execute_word(
 GrpcErrorCode grpc_client_execute_sequence(
     GrpcClient* client,
     const char* const* word_names,
+    const size_t* word_name_lens,
     size_t word_names_len,
     const StackValue* const* stack,
     size_t stack_len,
@@ -152,6 +592,199 @@ GrpcErrorCode grpc_client_execute_sequence(
     ErrorInfo** out_error
 );
 
+/**
+ * Queue a word on the client's ExecuteStream session without waiting
+ * The stream is opened on first use and kept open until
+ * grpc_client_stream_close or grpc_client_destroy. If it has ended (e.g. the
+ * server went away), the next submit opens a new session.
+ * @param client Client handle
+ * @param word_name Word name bytes
+ * @param word_name_len Length of word name in bytes
+ * @param push Values pushed onto the session stack before the word runs
+ * @param push_len Length of push array
+ * @param return_count Values to pop and return afterwards (< 0: whole session stack)
+ * @param out_correlation_id Pointer to receive the id to pass to grpc_client_stream_wait
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_stream_submit(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* push,
+    size_t push_len,
+    int64_t return_count,
+    uint64_t* out_correlation_id
+);
+
+/**
+ * Wait for the response to a submitted stream request
+ * Responses may be collected in any order. Output parameters are the same
+ * as grpc_client_execute_word.
+ * @return Error code (GRPC_ERROR_UNAVAILABLE if the stream ended first)
+ */
+GrpcErrorCode grpc_client_stream_wait(
+    GrpcClient* client,
+    uint64_t correlation_id,
+    StackValue*** out_result_stack,
+    size_t* out_result_len,
+    ErrorInfo** out_error
+);
+
+/**
+ * Close the client's ExecuteStream session (its session stack is discarded)
+ * Responses not yet collected are dropped. The next submit opens a new session.
+ */
+void grpc_client_stream_close(GrpcClient* client);
+
+/**
+ * Execute a word and receive its result stack as a stream of chunks
+ * Large top-level arrays arrive as runs of elements, so neither side holds
+ * the whole response message and the first values can be used early.
+ * @param client Client handle
+ * @param word_name Word name bytes
+ * @param word_name_len Length of word name in bytes
+ * @param stack Array of stack values
+ * @param stack_len Length of stack array
+ * @param max_chunk_bytes Target chunk size in bytes (0 = runtime default)
+ * @param out_stream Pointer to receive the result stream (NULL on remote error)
+ * @param out_error Pointer to receive error info (NULL if no error)
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_execute_word_chunked(
+    GrpcClient* client,
+    const char* word_name,
+    size_t word_name_len,
+    const StackValue* const* stack,
+    size_t stack_len,
+    uint32_t max_chunk_bytes,
+    ResultStream** out_stream,
+    ErrorInfo** out_error
+);
+
+/**
+ * Number of values in the result stack
+ */
+size_t result_stream_result_count(const ResultStream* stream);
+
+/**
+ * Read the next chunk (blocks until it arrives)
+ * VALUE chunks carry one value; ARRAY_ELEMENTS chunks carry elements to
+ * append, in order, to the array at stack_index. out_last is set on the
+ * final chunk of each value. Values are owned by the caller
+ * (stack_value_array_destroy). Returns GRPC_OK with RESULT_CHUNK_END once
+ * the stream is exhausted.
+ */
+GrpcErrorCode result_stream_next(
+    ResultStream* stream,
+    ResultChunkKind* out_kind,
+    size_t* out_stack_index,
+    bool* out_last,
+    StackValue*** out_values,
+    size_t* out_values_len
+);
+
+/**
+ * Destroy a result stream, cancelling the call if chunks remain unread
+ */
+void result_stream_destroy(ResultStream* stream);
+
+/**
+ * Whether the remote runtime has advertised support for the compact
+ * temporal encoding (epoch_nanos / days_since_epoch) in a previous response.
+ * Until it has, temporal values should be sent as ISO 8601 only.
+ */
+bool grpc_client_peer_supports_compact_temporal(const GrpcClient* client);
+
+/**
+ * Advertise that this client can hold remote value handles (accepts_remote_refs)
+ * When enabled, the remote runtime may return STACK_VALUE_REMOTE_REF values
+ * instead of materializing large results. Disabled by default.
+ */
+void grpc_client_set_accepts_remote_refs(GrpcClient* client, bool accepts);
+
+// =============================================================================
+// Module Discovery
+// =============================================================================
+
+/**
+ * List the runtime-specific modules of the remote runtime
+ * @param client Client handle
+ * @param out_list Pointer to receive the list (destroy with module_list_destroy)
+ * @return Error code (GRPC_ERROR_UNIMPLEMENTED if the runtime has no discovery)
+ */
+GrpcErrorCode grpc_client_list_modules(GrpcClient* client, ModuleList** out_list);
+
+/** Manifest version of the runtime (empty if it does not version manifests) */
+const char* module_list_version(const ModuleList* list, size_t* out_len);
+
+size_t module_list_count(const ModuleList* list);
+
+/** Name of module index (< module_list_count) */
+const char* module_list_name(const ModuleList* list, size_t index, size_t* out_len);
+
+void module_list_destroy(ModuleList* list);
+
+/**
+ * Fetch the words of one module
+ * @param client Client handle
+ * @param module_name Module name bytes
+ * @param module_name_len Length of module name in bytes
+ * @param out_info Pointer to receive the module info (destroy with module_info_destroy)
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_get_module_info(
+    GrpcClient* client,
+    const char* module_name,
+    size_t module_name_len,
+    ModuleInfo** out_info
+);
+
+const char* module_info_description(const ModuleInfo* info, size_t* out_len);
+
+/** Manifest version this module info belongs to */
+const char* module_info_version(const ModuleInfo* info, size_t* out_len);
+
+size_t module_info_word_count(const ModuleInfo* info);
+
+/** View of word index (< module_info_word_count); false if out of range */
+bool module_info_get_word(const ModuleInfo* info, size_t index, GrpcWordInfo* out_word);
+
+void module_info_destroy(ModuleInfo* info);
+
+/**
+ * Materialize the value behind a remote handle
+ * @param client Client handle (must be connected to the owning runtime)
+ * @param handle_id Handle id bytes
+ * @param handle_id_len Length of handle id in bytes
+ * @param out_value Pointer to receive the fetched value (caller destroys)
+ * @param out_error Pointer to receive error info (NULL if no error)
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_fetch_ref(
+    GrpcClient* client,
+    const char* handle_id,
+    size_t handle_id_len,
+    StackValue** out_value,
+    ErrorInfo** out_error
+);
+
+/**
+ * Release remote handles so the owning runtime can free their values
+ * @param client Client handle (must be connected to the owning runtime)
+ * @param handle_ids Array of handle id pointers
+ * @param handle_id_lens Array of handle id lengths
+ * @param count Number of handles
+ * @param out_released Pointer to receive the number of handles released (may be NULL)
+ * @return Error code
+ */
+GrpcErrorCode grpc_client_release_refs(
+    GrpcClient* client,
+    const char* const* handle_ids,
+    const size_t* handle_id_lens,
+    size_t count,
+    size_t* out_released
+);
+
 /**
  * Close the client and free resources
  * @param client Client handle
@@ -177,6 +810,12 @@ StackValue* stack_value_create_int(int64_t value);
  */
 StackValue* stack_value_create_string(const char* value);
 
+/**
+ * Create a string stack value from (pointer, length)
+ * The data may contain NUL bytes and need not be NUL-terminated
+ */
+StackValue* stack_value_create_string_n(const char* data, size_t len);
+
 /**
  * Create a boolean stack value
  */
@@ -192,6 +831,75 @@ StackValue* stack_value_create_float(double value);
  */
 StackValue* stack_value_create_array(const StackValue* const* items, size_t len);
 
+/**
+ * Create an empty record stack value
+ */
+StackValue* stack_value_create_record(void);
+
+/**
+ * Insert a field into a record stack value (must be STACK_VALUE_RECORD type)
+ * Takes ownership of field_value, even on error: its contents are moved into
+ * the record and the handle is destroyed. An existing field with the same
+ * key is replaced.
+ * @param record Record stack value
+ * @param key Field name
+ * @param field_value Field value (consumed)
+ * @return Error code
+ */
+GrpcErrorCode stack_value_record_insert(StackValue* record, const char* key, StackValue* field_value);
+
+/**
+ * Insert a field into a record stack value, with a (pointer, length) key
+ * Same ownership rules as stack_value_record_insert
+ */
+GrpcErrorCode stack_value_record_insert_n(StackValue* record, const char* key, size_t key_len, StackValue* field_value);
+
+/**
+ * Create an instant stack value from nanoseconds since the Unix epoch (compact encoding)
+ */
+StackValue* stack_value_create_instant_nanos(int64_t epoch_nanos);
+
+/**
+ * Create an instant stack value from an ISO 8601 string (e.g., "2025-01-15T10:30:00Z")
+ */
+StackValue* stack_value_create_instant_iso(const char* iso8601, size_t iso8601_len);
+
+/**
+ * Create a plain date stack value from days since 1970-01-01 (compact encoding)
+ */
+StackValue* stack_value_create_plain_date_days(int32_t days_since_epoch);
+
+/**
+ * Create a plain date stack value from an ISO 8601 date string (e.g., "2025-01-15")
+ */
+StackValue* stack_value_create_plain_date_iso(const char* iso8601_date, size_t iso8601_date_len);
+
+/**
+ * Create a zoned date-time stack value from nanoseconds since the Unix epoch
+ * and an IANA timezone name (compact encoding)
+ */
+StackValue* stack_value_create_zoned_datetime_nanos(int64_t epoch_nanos, const char* timezone, size_t timezone_len);
+
+/**
+ * Create a zoned date-time stack value from an ISO 8601 string and an IANA timezone name
+ */
+StackValue* stack_value_create_zoned_datetime_iso(
+    const char* iso8601,
+    size_t iso8601_len,
+    const char* timezone,
+    size_t timezone_len
+);
+
+/**
+ * Create a remote value handle from a handle id and the name of the owning runtime
+ */
+StackValue* stack_value_create_remote_ref(
+    const char* handle_id,
+    size_t handle_id_len,
+    const char* runtime,
+    size_t runtime_len
+);
+
 /**
  * Get the type of a stack value
  */
@@ -208,6 +916,14 @@ int64_t stack_value_get_int(const StackValue* value);
  */
 const char* stack_value_get_string(const StackValue* value);
 
+/**
+ * Get string value and its length (must be STACK_VALUE_STRING type)
+ * Returns pointer to internal string data - do not free
+ * @param value Stack value
+ * @param out_len Pointer to receive string length in bytes
+ */
+const char* stack_value_get_string_view(const StackValue* value, size_t* out_len);
+
 /**
  * Get boolean value (must be STACK_VALUE_BOOL type)
  */
@@ -218,19 +934,137 @@ bool stack_value_get_bool(const StackValue* value);
  */
 double stack_value_get_float(const StackValue* value);
 
+/**
+ * Get the compact encoding of an instant (must be STACK_VALUE_INSTANT type)
+ * @param value Stack value
+ * @param out_epoch_nanos Pointer to receive nanoseconds since the Unix epoch
+ * @return true if the compact field is present, false if only ISO 8601 is set
+ */
+bool stack_value_get_instant_nanos(const StackValue* value, int64_t* out_epoch_nanos);
+
+/**
+ * Get the ISO 8601 encoding of an instant (must be STACK_VALUE_INSTANT type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_instant_iso(const StackValue* value, size_t* out_len);
+
+/**
+ * Get the compact encoding of a plain date (must be STACK_VALUE_PLAIN_DATE type)
+ * @return true if the compact field is present, false if only ISO 8601 is set
+ */
+bool stack_value_get_plain_date_days(const StackValue* value, int32_t* out_days_since_epoch);
+
+/**
+ * Get the ISO 8601 encoding of a plain date (must be STACK_VALUE_PLAIN_DATE type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_plain_date_iso(const StackValue* value, size_t* out_len);
+
+/**
+ * Get the compact encoding of a zoned date-time (must be STACK_VALUE_ZONED_DATETIME type)
+ * @return true if the compact field is present, false if only ISO 8601 is set
+ */
+bool stack_value_get_zoned_datetime_nanos(const StackValue* value, int64_t* out_epoch_nanos);
+
+/**
+ * Get the ISO 8601 encoding of a zoned date-time (must be STACK_VALUE_ZONED_DATETIME type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_zoned_datetime_iso(const StackValue* value, size_t* out_len);
+
+/**
+ * Get the IANA timezone name of a zoned date-time (must be STACK_VALUE_ZONED_DATETIME type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_zoned_datetime_timezone(const StackValue* value, size_t* out_len);
+
+/**
+ * Get the handle id of a remote value handle (must be STACK_VALUE_REMOTE_REF type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_remote_ref_handle(const StackValue* value, size_t* out_len);
+
+/**
+ * Get the owning runtime of a remote value handle (must be STACK_VALUE_REMOTE_REF type)
+ * Returns pointer to internal string data - do not free
+ */
+const char* stack_value_get_remote_ref_runtime(const StackValue* value, size_t* out_len);
+
 /**
  * Get array items (must be STACK_VALUE_ARRAY type)
+ * Each item is a deep copy that the caller must destroy; prefer the
+ * borrowed stack_value_get_array_len/stack_value_get_array_item accessors.
  * @param value Stack value
  * @param out_items Pointer to receive array of items
  * @param out_len Pointer to receive array length
  */
 void stack_value_get_array(const StackValue* value, const StackValue*** out_items, size_t* out_len);
 
+/**
+ * Get number of array items (must be STACK_VALUE_ARRAY type)
+ */
+size_t stack_value_get_array_len(const StackValue* value);
+
+/**
+ * Borrow an array item (must be STACK_VALUE_ARRAY type)
+ * Returns a non-owning pointer into the parent value - do not destroy.
+ * Valid for as long as the parent value is alive and unmodified.
+ * @param value Stack value
+ * @param index Item index (must be < stack_value_get_array_len)
+ */
+const StackValue* stack_value_get_array_item(const StackValue* value, size_t index);
+
+/**
+ * Get number of record fields (must be STACK_VALUE_RECORD type)
+ */
+size_t stack_value_get_record_len(const StackValue* value);
+
+/**
+ * Create an iterator over the fields of a record (must be STACK_VALUE_RECORD type)
+ * Field order is unspecified. The iterator borrows from the record, which
+ * must stay alive and unmodified until record_iterator_destroy is called.
+ * @return Iterator, or NULL if value is not a record
+ */
+RecordIterator* stack_value_get_record_iterator(const StackValue* value);
+
+/**
+ * Advance a record iterator
+ * Key and value are borrowed from the record - do not free. The value
+ * handle stays valid until record_iterator_destroy.
+ * @param iter Record iterator
+ * @param out_key Pointer to receive field name
+ * @param out_key_len Pointer to receive field name length
+ * @param out_value Pointer to receive field value
+ * @return true if a field was produced, false when exhausted
+ */
+bool record_iterator_next(RecordIterator* iter, const char** out_key, size_t* out_key_len, const StackValue** out_value);
+
+/**
+ * Destroy a record iterator
+ */
+void record_iterator_destroy(RecordIterator* iter);
+
+/**
+ * Hash the deterministic wire encoding of a sequence of stack values
+ * Equal values hash equally regardless of record field order; used as a
+ * cache key for remote word arguments
+ * @param values Array of stack values
+ * @param len Length of values array
+ * @return 64-bit FNV-1a hash
+ */
+uint64_t stack_value_array_hash(const StackValue* const* values, size_t len);
+
 /**
  * Destroy a stack value and free resources
  */
 void stack_value_destroy(StackValue* value);
 
+/**
+ * Allocate an uninitialized array for len stack values
+ * Release with stack_value_array_destroy once every slot is filled
+ */
+StackValue** stack_value_array_alloc(size_t len);
+
 /**
  * Destroy an array of stack values
  */
@@ -240,6 +1074,18 @@ void stack_value_array_destroy(StackValue** array, size_t len);
 // ErrorInfo API
 // =============================================================================
 
+/**
+ * Create error info (for GrpcServerHandler.execute)
+ */
+ErrorInfo* error_info_create(
+    const char* message,
+    size_t message_len,
+    const char* runtime,
+    size_t runtime_len,
+    const char* error_type,
+    size_t error_type_len
+);
+
 /**
  * Get error message
  */
@@ -255,6 +1101,21 @@ const char* error_info_get_runtime(const ErrorInfo* error);
  */
 const char* error_info_get_error_type(const ErrorInfo* error);
 
+/**
+ * Get error message and its length
+ */
+const char* error_info_get_message_view(const ErrorInfo* error, size_t* out_len);
+
+/**
+ * Get runtime name and its length
+ */
+const char* error_info_get_runtime_view(const ErrorInfo* error, size_t* out_len);
+
+/**
+ * Get error type and its length
+ */
+const char* error_info_get_error_type_view(const ErrorInfo* error, size_t* out_len);
+
 /**
  * Destroy error info
  */
@@ -0,0 +1,236 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const ArrayList = std.ArrayList;
+
+const Module = @import("../forthic/module.zig").Module;
+const Interpreter = @import("../forthic/interpreter.zig").Interpreter;
+const Value = @import("../forthic/value.zig").Value;
+const word_mod = @import("../forthic/word.zig");
+const ModuleWord = word_mod.ModuleWord;
+const client_mod = @import("client.zig");
+const GrpcClient = client_mod.GrpcClient;
+const LatencyHistogram = client_mod.LatencyHistogram;
+const runtime_manager = @import("runtime_manager.zig");
+const RuntimeManager = runtime_manager.RuntimeManager;
+
+/// GrpcWordMetrics.status_counts slot names
+const status_names = [_][]const u8{
+    "OK",                "INVALID_ARGUMENT", "NOT_FOUND",      "ALREADY_EXISTS",
+    "PERMISSION_DENIED", "RESOURCE_EXHAUSTED", "FAILED_PRECONDITION", "ABORTED",
+    "OUT_OF_RANGE",      "UNIMPLEMENTED",    "INTERNAL",       "UNAVAILABLE",
+    "DATA_LOSS",         "UNAUTHENTICATED",  "DEADLINE_EXCEEDED", "UNKNOWN",
+};
+
+comptime {
+    std.debug.assert(status_names.len == @import("c_bindings.zig").GRPC_STATUS_SLOTS);
+}
+
+/// Words for inspecting remote runtime connections
+pub const GrpcModule = struct {
+    module: Module,
+    allocator: Allocator,
+    word_ptrs: ArrayList(*ModuleWord),
+
+    pub fn init(allocator: Allocator) !*GrpcModule {
+        const self = try allocator.create(GrpcModule);
+        self.* = .{
+            .module = Module.init(allocator, "grpc", ""),
+            .allocator = allocator,
+            .word_ptrs = ArrayList(*ModuleWord){},
+        };
+        try self.registerWords();
+        return self;
+    }
+
+    pub fn deinit(self: *GrpcModule) void {
+        for (self.word_ptrs.items) |word_ptr| {
+            word_ptr.asWord().deinit(self.allocator);
+            self.allocator.destroy(word_ptr);
+        }
+        self.word_ptrs.deinit(self.allocator);
+
+        self.module.deinit();
+        self.allocator.destroy(self);
+    }
+
+    fn addModuleWord(self: *GrpcModule, name: []const u8, handler: word_mod.HandlerFn) !void {
+        const word_ptr = try self.allocator.create(ModuleWord);
+        word_ptr.* = ModuleWord.init(self.allocator, name, handler);
+        try self.word_ptrs.append(self.allocator, word_ptr);
+        try self.module.addExportableWord(word_ptr.asWord());
+    }
+
+    fn registerWords(self: *GrpcModule) !void {
+        try self.addModuleWord("REMOTE-STATS", remoteStats);
+        try self.addModuleWord("RUNTIME-GROUP", runtimeGroup);
+        try self.addModuleWord("SCATTER-GATHER", scatterGather);
+    }
+
+    /// ( name:string runtimes:string[] -- ) Name a group of connected
+    /// runtimes for SCATTER-GATHER
+    fn runtimeGroup(interp: *Interpreter) !void {
+        const allocator = interp.allocator;
+        var runtimes = try interp.stackPop();
+        defer runtimes.deinit(allocator);
+        var name = try interp.stackPop();
+        defer name.deinit(allocator);
+
+        if (name != .string_value or runtimes != .array_value) return error.InvalidArgument;
+        const manager = RuntimeManager.current() orelse return error.RuntimeNotConnected;
+
+        const runtime_names = try allocator.alloc([]const u8, runtimes.array_value.items.len);
+        defer allocator.free(runtime_names);
+        for (runtimes.array_value.items, 0..) |item, i| {
+            if (item != .string_value) return error.InvalidArgument;
+            runtime_names[i] = item.string_value;
+        }
+
+        try manager.defineGroup(name.string_value, runtime_names);
+    }
+
+    /// ( shards:any[] group:string word:string -- results:any[] errors:record[] )
+    /// Run word on every shard across the runtimes of group, concurrently.
+    /// results holds each shard's value in shard order (an array if the word
+    /// left more or less than one value, null if it failed); errors has a
+    /// {shard, runtime, error} record per failed shard
+    fn scatterGather(interp: *Interpreter) !void {
+        const allocator = interp.allocator;
+        var word = try interp.stackPop();
+        defer word.deinit(allocator);
+        var group = try interp.stackPop();
+        defer group.deinit(allocator);
+        var shards = try interp.stackPop();
+        defer shards.deinit(allocator);
+
+        if (word != .string_value or group != .string_value or shards != .array_value) return error.InvalidArgument;
+        const manager = RuntimeManager.current() orelse return error.RuntimeNotConnected;
+
+        var gathered = try manager.scatterGather(group.string_value, word.string_value, shards.array_value.items, .{
+            .call_options = .{ .accepts_remote_refs = interp.remote_ref_hooks != null },
+        });
+        defer gathered.deinit(allocator);
+
+        var results = Value.initArray(allocator);
+        errdefer results.deinit(allocator);
+        try results.array_value.ensureTotalCapacity(allocator, gathered.shards.len);
+        var errors = Value.initArray(allocator);
+        errdefer errors.deinit(allocator);
+        try errors.array_value.ensureTotalCapacity(allocator, gathered.failures);
+
+        for (gathered.shards, 0..) |*shard, i| {
+            if (shard.isError()) {
+                results.array_value.appendAssumeCapacity(Value.initNull());
+                errors.array_value.appendAssumeCapacity(try shardError(allocator, i, shard));
+                continue;
+            }
+
+            // Values move out of the gathered result
+            const values = &shard.outcome.result.values;
+            if (values.items.len == 1) {
+                results.array_value.appendAssumeCapacity(values.pop().?);
+            } else {
+                results.array_value.appendAssumeCapacity(.{ .array_value = values.* });
+                values.* = .{};
+            }
+        }
+
+        try interp.trackRemoteRefs(results.array_value.items);
+        try interp.stackPush(results);
+        try interp.stackPush(errors);
+    }
+
+    fn shardError(allocator: Allocator, index: usize, shard: *const runtime_manager.ShardResult) !Value {
+        var record = Value.initRecord(allocator);
+        errdefer record.deinit(allocator);
+
+        const message = switch (shard.outcome) {
+            .result => |*result| result.remote_error.?.message,
+            .failed => |err| @errorName(err),
+        };
+
+        try putField(allocator, &record, "shard", Value.initInt(@intCast(index)));
+        try putField(allocator, &record, "runtime", Value.initString(try allocator.dupe(u8, shard.runtime)));
+        try putField(allocator, &record, "error", Value.initString(try allocator.dupe(u8, message)));
+        return record;
+    }
+
+    /// ( -- stats ) Per-word call metrics of every connected runtime:
+    /// {runtime: {word: {calls, word_errors, failures, status, request_bytes,
+    /// response_bytes, rpc_*_us, serialization_*_us}}}
+    fn remoteStats(interp: *Interpreter) !void {
+        const allocator = interp.allocator;
+        var stats = Value.initRecord(allocator);
+        errdefer stats.deinit(allocator);
+
+        if (RuntimeManager.current()) |manager| {
+            var iter = manager.clientSnapshot().iterator();
+            while (iter.next()) |entry| {
+                var runtime = try runtimeStats(allocator, entry.value_ptr.*);
+                errdefer runtime.deinit(allocator);
+                try putField(allocator, &stats, entry.key_ptr.*, runtime);
+            }
+        }
+
+        try interp.stackPush(stats);
+    }
+
+    fn runtimeStats(allocator: Allocator, client: *GrpcClient) !Value {
+        var words = Value.initRecord(allocator);
+        errdefer words.deinit(allocator);
+
+        for (0..client.metricsWordCount()) |i| {
+            const entry = client.wordMetrics(i) orelse continue;
+            const metrics = &entry.metrics;
+
+            var word = Value.initRecord(allocator);
+            errdefer word.deinit(allocator);
+
+            var failures: u64 = 0;
+            {
+                var status = Value.initRecord(allocator);
+                errdefer status.deinit(allocator);
+                for (metrics.status_counts, status_names, 0..) |count, name, slot| {
+                    if (count == 0) continue;
+                    if (slot != 0) failures += count;
+                    try putField(allocator, &status, name, Value.initInt(@intCast(count)));
+                }
+                try putField(allocator, &word, "status", status);
+            }
+
+            try putField(allocator, &word, "calls", Value.initInt(@intCast(metrics.calls)));
+            try putField(allocator, &word, "word_errors", Value.initInt(@intCast(metrics.word_errors)));
+            try putField(allocator, &word, "failures", Value.initInt(@intCast(failures)));
+            try putField(allocator, &word, "request_bytes", Value.initInt(@intCast(metrics.request_bytes)));
+            try putField(allocator, &word, "response_bytes", Value.initInt(@intCast(metrics.response_bytes)));
+            try putLatency(allocator, &word, "rpc", &metrics.rpc);
+            try putLatency(allocator, &word, "serialization", &metrics.serialization);
+
+            try putField(allocator, &words, entry.word_name, word);
+        }
+        return words;
+    }
+
+    /// <prefix>_mean_us, <prefix>_p50_us, <prefix>_p99_us
+    fn putLatency(allocator: Allocator, record: *Value, prefix: []const u8, histogram: *const LatencyHistogram) !void {
+        const fields = [_]struct { suffix: []const u8, ns: u64 }{
+            .{ .suffix = "mean_us", .ns = client_mod.latencyMean(histogram) },
+            .{ .suffix = "p50_us", .ns = client_mod.latencyPercentile(histogram, 0.50) },
+            .{ .suffix = "p99_us", .ns = client_mod.latencyPercentile(histogram, 0.99) },
+        };
+
+        var key_buf: [64]u8 = undefined;
+        for (fields) |field| {
+            const key = try std.fmt.bufPrint(&key_buf, "{s}_{s}", .{ prefix, field.suffix });
+            const us = @as(f64, @floatFromInt(field.ns)) / std.time.ns_per_us;
+            try putField(allocator, record, key, Value.initFloat(us));
+        }
+    }
+
+    /// Insert value under a copy of key; the record owns value once this succeeds
+    fn putField(allocator: Allocator, record: *Value, key: []const u8, value: Value) !void {
+        const owned_key = try allocator.dupe(u8, key);
+        errdefer allocator.free(owned_key);
+
+        try record.record_value.put(owned_key, value);
+    }
+};
@@ -0,0 +1,168 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+// =============================================================================
+// Manifests
+// =============================================================================
+
+pub const WordManifest = struct {
+    name: []const u8,
+    stack_effect: []const u8 = "",
+    description: []const u8 = "",
+    pure: bool = false,
+};
+
+pub const ModuleManifest = struct {
+    name: []const u8,
+    description: []const u8 = "",
+    words: []const WordManifest = &.{},
+};
+
+/// Module manifests of one runtime at one version
+pub const Manifest = struct {
+    address: []const u8,
+    /// ListModulesResponse.version; empty if the runtime does not version manifests
+    version: []const u8 = "",
+    modules: []const ModuleManifest = &.{},
+
+    pub fn findModule(self: *const Manifest, name: []const u8) ?*const ModuleManifest {
+        for (self.modules) |*module| {
+            if (std.mem.eql(u8, module.name, name)) return module;
+        }
+        return null;
+    }
+};
+
+/// A Manifest together with the arena that holds all of its strings
+pub const OwnedManifest = struct {
+    arena: *std.heap.ArenaAllocator,
+    manifest: Manifest,
+
+    /// Empty manifest; allocate its contents from arena.allocator()
+    pub fn init(allocator: Allocator, address: []const u8) !OwnedManifest {
+        const arena = try allocator.create(std.heap.ArenaAllocator);
+        arena.* = std.heap.ArenaAllocator.init(allocator);
+        errdefer {
+            arena.deinit();
+            allocator.destroy(arena);
+        }
+
+        return OwnedManifest{
+            .arena = arena,
+            .manifest = .{ .address = try arena.allocator().dupe(u8, address) },
+        };
+    }
+
+    pub fn deinit(self: *OwnedManifest) void {
+        const allocator = self.arena.child_allocator;
+        self.arena.deinit();
+        allocator.destroy(self.arena);
+    }
+};
+
+// =============================================================================
+// ManifestCache
+// =============================================================================
+
+/// On-disk cache of runtime manifests, one JSON file per runtime address
+///
+/// Lets remote modules bind their words at startup without a round trip per
+/// module; RuntimeManager revalidates the cached version in the background.
+/// Files are replaced atomically, so concurrent readers see either the old
+/// or the new manifest.
+pub const ManifestCache = struct {
+    allocator: Allocator,
+    dir_path: []const u8,
+
+    const Self = @This();
+
+    /// Cached files larger than this are ignored
+    const max_file_bytes = 16 * 1024 * 1024;
+
+    pub fn init(allocator: Allocator, dir_path: []const u8) !Self {
+        return Self{
+            .allocator = allocator,
+            .dir_path = try allocator.dupe(u8, dir_path),
+        };
+    }
+
+    pub fn deinit(self: *Self) void {
+        self.allocator.free(self.dir_path);
+    }
+
+    /// $FORTHIC_MANIFEST_CACHE, else $XDG_CACHE_HOME/forthic, else
+    /// $HOME/.cache/forthic. Caller owns the returned path
+    pub fn defaultDir(allocator: Allocator) ![]u8 {
+        if (std.process.getEnvVarOwned(allocator, "FORTHIC_MANIFEST_CACHE")) |dir| {
+            return dir;
+        } else |_| {}
+
+        if (std.process.getEnvVarOwned(allocator, "XDG_CACHE_HOME")) |cache_home| {
+            defer allocator.free(cache_home);
+            return std.fs.path.join(allocator, &.{ cache_home, "forthic" });
+        } else |_| {}
+
+        const home = try std.process.getEnvVarOwned(allocator, "HOME");
+        defer allocator.free(home);
+        return std.fs.path.join(allocator, &.{ home, ".cache", "forthic" });
+    }
+
+    /// The cached manifest for address, or null if there is none or it
+    /// cannot be read
+    pub fn load(self: *const Self, address: []const u8) !?OwnedManifest {
+        var name_buf: [32]u8 = undefined;
+        const file_name = fileName(&name_buf, address);
+
+        var dir = std.fs.cwd().openDir(self.dir_path, .{}) catch return null;
+        defer dir.close();
+
+        var owned = try OwnedManifest.init(self.allocator, address);
+        errdefer owned.deinit();
+        const arena = owned.arena.allocator();
+
+        const bytes = dir.readFileAlloc(arena, file_name, max_file_bytes) catch {
+            owned.deinit();
+            return null;
+        };
+        const manifest = std.json.parseFromSliceLeaky(Manifest, arena, bytes, .{
+            .ignore_unknown_fields = true,
+            .allocate = .alloc_always,
+        }) catch {
+            owned.deinit();
+            return null;
+        };
+
+        // File names are hashes; a collision reads as a miss
+        if (!std.mem.eql(u8, manifest.address, address)) {
+            owned.deinit();
+            return null;
+        }
+
+        owned.manifest = manifest;
+        return owned;
+    }
+
+    /// Write manifest as the cached entry for manifest.address
+    pub fn store(self: *const Self, manifest: *const Manifest) !void {
+        var name_buf: [32]u8 = undefined;
+        const file_name = fileName(&name_buf, manifest.address);
+
+        const bytes = try std.json.Stringify.valueAlloc(self.allocator, manifest.*, .{});
+        defer self.allocator.free(bytes);
+
+        try std.fs.cwd().makePath(self.dir_path);
+        var dir = try std.fs.cwd().openDir(self.dir_path, .{});
+        defer dir.close();
+
+        var tmp_buf: [64]u8 = undefined;
+        const tmp_name = try std.fmt.bufPrint(&tmp_buf, "{s}.{x}.tmp", .{ file_name, std.crypto.random.int(u64) });
+        errdefer dir.deleteFile(tmp_name) catch {};
+
+        try dir.writeFile(.{ .sub_path = tmp_name, .data = bytes });
+        try dir.rename(tmp_name, file_name);
+    }
+
+    fn fileName(buf: *[32]u8, address: []const u8) []const u8 {
+        return std.fmt.bufPrint(buf, "{x:0>16}.json", .{std.hash.Wyhash.hash(0, address)}) catch unreachable;
+    }
+};
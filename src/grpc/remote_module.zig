@@ -7,6 +7,7 @@ const Module = @import("../forthic/module.zig").Module;
 const Word = @import("../forthic/word.zig").Word;
 const GrpcClient = @import("client.zig").GrpcClient;
 const RemoteWord = @import("remote_word.zig").RemoteWord;
+const ModuleManifest = @import("manifest_cache.zig").ModuleManifest;
 
 /// Module that wraps a remote Forthic module via gRPC
 pub const RemoteModule = struct {
@@ -32,7 +33,7 @@ pub const RemoteModule = struct {
             .description = try allocator.dupe(u8, ""),
             .client = client,
             .runtime_name = try allocator.dupe(u8, runtime_name),
-            .words = ArrayList(*RemoteWord).init(allocator),
+            .words = .{},
             .initialized = false,
         };
     }
@@ -42,7 +43,7 @@ pub const RemoteModule = struct {
             word.deinit();
             self.allocator.destroy(word);
         }
-        self.words.deinit();
+        self.words.deinit(self.allocator);
         self.allocator.free(self.name);
         self.allocator.free(self.description);
         self.allocator.free(self.runtime_name);
@@ -52,8 +53,25 @@ pub const RemoteModule = struct {
     pub fn initialize(self: *Self) !void {
         if (self.initialized) return;
 
-        // TODO: Call client.getModuleInfo() when implemented
-        // For now, mark as initialized without remote words
+        var arena = std.heap.ArenaAllocator.init(self.allocator);
+        defer arena.deinit();
+
+        const manifest = try self.client.fetchModule(arena.allocator(), self.name);
+        try self.initializeFromManifest(&manifest);
+    }
+
+    /// Initialize from an already known manifest (e.g. the on-disk cache),
+    /// without a round trip
+    pub fn initializeFromManifest(self: *Self, manifest: *const ModuleManifest) !void {
+        if (self.initialized) return;
+
+        const description = try self.allocator.dupe(u8, manifest.description);
+        self.allocator.free(self.description);
+        self.description = description;
+
+        for (manifest.words) |word| {
+            try self.addRemoteWord(word.name, word.stack_effect, word.description, word.pure);
+        }
         self.initialized = true;
     }
 
@@ -62,6 +80,7 @@ pub const RemoteModule = struct {
         name: []const u8,
         stack_effect: []const u8,
         description: []const u8,
+        pure: bool,
     ) !void {
         const word = try self.allocator.create(RemoteWord);
         word.* = try RemoteWord.init(
@@ -72,8 +91,9 @@ pub const RemoteModule = struct {
             self.name,
             stack_effect,
             description,
+            pure,
         );
-        try self.words.append(word);
+        try self.words.append(self.allocator, word);
     }
 
     pub fn getName(self: *const Self) []const u8 {
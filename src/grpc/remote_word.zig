@@ -5,7 +5,39 @@ const ArrayList = std.ArrayList;
 const Word = @import("../forthic/word.zig").Word;
 const Value = @import("../forthic/value.zig").Value;
 const Interpreter = @import("../forthic/interpreter.zig").Interpreter;
+const errors = @import("../forthic/errors.zig");
 const GrpcClient = @import("client.zig").GrpcClient;
+const CallOptions = @import("client.zig").CallOptions;
+
+/// Arity described by a stack effect comment such as "( a b -- c )"
+pub const StackEffect = struct {
+    inputs: usize,
+    outputs: usize,
+
+    /// Parse "( inputs -- outputs )" notation
+    /// Returns null if the text has no "--" separator (arity unknown)
+    pub fn parse(text: []const u8) ?StackEffect {
+        const trimmed = std.mem.trim(u8, text, &std.ascii.whitespace);
+        const open = std.mem.indexOfScalar(u8, trimmed, '(') orelse return null;
+        const close = std.mem.lastIndexOfScalar(u8, trimmed, ')') orelse return null;
+        if (close <= open) return null;
+
+        const body = trimmed[open + 1 .. close];
+        const sep = std.mem.indexOf(u8, body, "--") orelse return null;
+
+        return StackEffect{
+            .inputs = countItems(body[0..sep]),
+            .outputs = countItems(body[sep + 2 ..]),
+        };
+    }
+
+    fn countItems(text: []const u8) usize {
+        var count: usize = 0;
+        var iter = std.mem.tokenizeAny(u8, text, &std.ascii.whitespace);
+        while (iter.next()) |_| count += 1;
+        return count;
+    }
+};
 
 /// Word that executes in a remote Forthic runtime via gRPC
 pub const RemoteWord = struct {
@@ -16,6 +48,10 @@ pub const RemoteWord = struct {
     module_name: []const u8,
     stack_effect: []const u8,
     description: []const u8,
+    arity: ?StackEffect,
+    /// Result depends only on the arguments (WordInfo.pure or caller opt-in),
+    /// so it may be served from the client's result cache
+    pure: bool,
 
     const Self = @This();
 
@@ -27,6 +63,7 @@ pub const RemoteWord = struct {
         module_name: []const u8,
         stack_effect: []const u8,
         description: []const u8,
+        pure: bool,
     ) !Self {
         return Self{
             .allocator = allocator,
@@ -36,6 +73,8 @@ pub const RemoteWord = struct {
             .module_name = try allocator.dupe(u8, module_name),
             .stack_effect = try allocator.dupe(u8, stack_effect),
             .description = try allocator.dupe(u8, description),
+            .arity = StackEffect.parse(stack_effect),
+            .pure = pure,
         };
     }
 
@@ -48,26 +87,47 @@ pub const RemoteWord = struct {
     }
 
     pub fn execute(self: *Self, interp: *Interpreter) !void {
-        // Get current stack items
-        const stack_items = interp.stack.items();
+        const stack_items = interp.stack.items.items;
+
+        // Only ship the arguments the word consumes. Without a parseable
+        // stack effect, fall back to sending the whole stack.
+        const arg_count = if (self.arity) |arity| arity.inputs else stack_items.len;
+        if (arg_count > stack_items.len) {
+            return errors.ForthicErrorType.StackUnderflow;
+        }
+        const base = stack_items.len - arg_count;
+
+        // Handles owned by this runtime go back untouched; handles owned by
+        // another runtime mean nothing here and must be fetched first
+        for (stack_items[base..]) |*item| {
+            try interp.materializeRemoteRefs(item, self.runtime_name);
+        }
 
-        // Execute remotely
-        var result = try self.client.executeWord(self.name, stack_items);
+        // Execute remotely; handles come back only if this interpreter tracks them
+        const args = stack_items[base..];
+        const call_options = CallOptions{ .accepts_remote_refs = interp.remote_ref_hooks != null };
+        var result = if (self.pure)
+            try self.client.executeWordCachedWithOptions(self.name, args, call_options)
+        else
+            try self.client.executeWordWithOptions(self.name, args, call_options);
         defer result.deinit(self.allocator);
 
         // Check for remote error
-        if (result.remote_error) |err| {
+        if (result.remote_error) |_| {
             return error.RemoteExecutionFailed;
         }
 
-        // Clear local stack
-        interp.stack.clear();
+        try interp.trackRemoteRefs(result.values.items);
+
+        // Drop the consumed arguments, leaving the lower stack untouched
+        interp.stack.truncate(base);
 
-        // Push result values
+        // Move result values onto the stack (ownership leaves the result list)
+        try interp.stack.items.ensureUnusedCapacity(interp.stack.allocator, result.values.items.len);
         for (result.values.items) |value| {
-            const value_clone = try value.clone(self.allocator);
-            try interp.stack.push(value_clone);
+            interp.stack.items.appendAssumeCapacity(value);
         }
+        result.values.clearRetainingCapacity();
     }
 
     pub fn getName(self: *const Self) []const u8 {
@@ -81,4 +141,8 @@ pub const RemoteWord = struct {
     pub fn getDescription(self: *const Self) []const u8 {
         return self.description;
     }
+
+    pub fn setPure(self: *Self, pure: bool) void {
+        self.pure = pure;
+    }
 };
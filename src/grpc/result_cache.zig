@@ -0,0 +1,253 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+const Value = @import("../forthic/value.zig").Value;
+
+// =============================================================================
+// Options and Stats
+// =============================================================================
+
+pub const CacheOptions = struct {
+    /// Least recently used entries are evicted beyond this count
+    max_entries: usize = 256,
+    /// Entries older than this are treated as misses
+    ttl_ms: i64 = 60_000,
+};
+
+pub const CacheStats = struct {
+    hits: u64 = 0,
+    misses: u64 = 0,
+    evictions: u64 = 0,
+    expirations: u64 = 0,
+    entries: usize = 0,
+};
+
+// =============================================================================
+// ResultCache
+// =============================================================================
+
+/// Size-bounded LRU cache of remote word results with a TTL
+///
+/// Keyed by word name and a hash of the serialized argument bytes. Each
+/// GrpcClient (one per runtime) owns its own cache, so the runtime is part
+/// of the key by construction.
+///
+/// Thread-safe: interpreters on different threads share a client.
+pub const ResultCache = struct {
+    allocator: Allocator,
+    options: CacheOptions,
+    /// Guards everything below
+    mutex: std.Thread.Mutex,
+    map: std.HashMapUnmanaged(Key, *Entry, KeyContext, std.hash_map.default_max_load_percentage),
+    /// Most recently used
+    head: ?*Entry,
+    /// Least recently used
+    tail: ?*Entry,
+    stats: CacheStats,
+    /// Millisecond clock (overridable for tests)
+    clock: *const fn () i64,
+
+    const Self = @This();
+
+    pub const Key = struct {
+        word_name: []const u8,
+        args_hash: u64,
+    };
+
+    const KeyContext = struct {
+        pub fn hash(_: KeyContext, key: Key) u64 {
+            var hasher = std.hash.Wyhash.init(key.args_hash);
+            hasher.update(key.word_name);
+            return hasher.final();
+        }
+
+        pub fn eql(_: KeyContext, a: Key, b: Key) bool {
+            return a.args_hash == b.args_hash and std.mem.eql(u8, a.word_name, b.word_name);
+        }
+    };
+
+    const Entry = struct {
+        key: Key,
+        values: []Value,
+        expires_at_ms: i64,
+        prev: ?*Entry,
+        next: ?*Entry,
+    };
+
+    pub fn init(allocator: Allocator, options: CacheOptions) Self {
+        return Self{
+            .allocator = allocator,
+            .options = options,
+            .mutex = .{},
+            .map = .{},
+            .head = null,
+            .tail = null,
+            .stats = .{},
+            .clock = std.time.milliTimestamp,
+        };
+    }
+
+    pub fn deinit(self: *Self) void {
+        self.clearLocked();
+        self.map.deinit(self.allocator);
+    }
+
+    /// Drop every entry (counters are kept)
+    pub fn clear(self: *Self) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.clearLocked();
+    }
+
+    fn clearLocked(self: *Self) void {
+        var entry = self.head;
+        while (entry) |e| {
+            entry = e.next;
+            self.destroyEntry(e);
+        }
+        self.head = null;
+        self.tail = null;
+        self.map.clearRetainingCapacity();
+    }
+
+    /// Look up a fresh result
+    /// Returns a copy allocated with allocator (free it with freeValues):
+    /// another thread may replace the entry as soon as the lock is released
+    pub fn get(self: *Self, allocator: Allocator, key: Key) Allocator.Error!?[]Value {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        const entry = self.map.get(key) orelse {
+            self.stats.misses += 1;
+            return null;
+        };
+
+        if (self.clock() >= entry.expires_at_ms) {
+            self.remove(entry);
+            self.stats.expirations += 1;
+            self.stats.misses += 1;
+            return null;
+        }
+
+        const copies = try cloneValues(allocator, entry.values);
+        self.moveToFront(entry);
+        self.stats.hits += 1;
+        return copies;
+    }
+
+    /// Store a deep copy of values under key, replacing any previous result
+    pub fn put(self: *Self, key: Key, values: []const Value) !void {
+        if (self.options.max_entries == 0) return;
+
+        const copies = try cloneValues(self.allocator, values);
+        errdefer freeValues(self.allocator, copies);
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        const expires_at_ms = self.clock() +| self.options.ttl_ms;
+
+        if (self.map.get(key)) |entry| {
+            freeValues(self.allocator, entry.values);
+            entry.values = copies;
+            entry.expires_at_ms = expires_at_ms;
+            self.moveToFront(entry);
+            return;
+        }
+
+        const entry = try self.allocator.create(Entry);
+        errdefer self.allocator.destroy(entry);
+
+        const word_name = try self.allocator.dupe(u8, key.word_name);
+        errdefer self.allocator.free(word_name);
+
+        entry.* = Entry{
+            .key = .{ .word_name = word_name, .args_hash = key.args_hash },
+            .values = copies,
+            .expires_at_ms = expires_at_ms,
+            .prev = null,
+            .next = null,
+        };
+        try self.map.put(self.allocator, entry.key, entry);
+
+        self.pushFront(entry);
+        while (self.map.count() > self.options.max_entries) {
+            self.remove(self.tail.?);
+            self.stats.evictions += 1;
+        }
+    }
+
+    pub fn getStats(self: *Self) CacheStats {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        var stats = self.stats;
+        stats.entries = self.map.count();
+        return stats;
+    }
+
+    fn remove(self: *Self, entry: *Entry) void {
+        _ = self.map.remove(entry.key);
+        self.unlink(entry);
+        self.destroyEntry(entry);
+    }
+
+    fn destroyEntry(self: *Self, entry: *Entry) void {
+        freeValues(self.allocator, entry.values);
+        self.allocator.free(entry.key.word_name);
+        self.allocator.destroy(entry);
+    }
+
+    fn moveToFront(self: *Self, entry: *Entry) void {
+        if (self.head == entry) return;
+        self.unlink(entry);
+        self.pushFront(entry);
+    }
+
+    fn pushFront(self: *Self, entry: *Entry) void {
+        entry.prev = null;
+        entry.next = self.head;
+        if (self.head) |head| head.prev = entry;
+        self.head = entry;
+        if (self.tail == null) self.tail = entry;
+    }
+
+    fn unlink(self: *Self, entry: *Entry) void {
+        if (entry.prev) |prev| prev.next = entry.next else self.head = entry.next;
+        if (entry.next) |next| next.prev = entry.prev else self.tail = entry.prev;
+        entry.prev = null;
+        entry.next = null;
+    }
+};
+
+// =============================================================================
+// Helper Functions
+// =============================================================================
+
+/// Results that hold remote value handles are not cached: the handles can be
+/// released by the owning runtime while the entry is still alive
+pub fn isCacheable(values: []const Value) bool {
+    for (values) |*value| {
+        if (value.containsRemoteRef()) return false;
+    }
+    return true;
+}
+
+fn cloneValues(allocator: Allocator, values: []const Value) ![]Value {
+    const copies = try allocator.alloc(Value, values.len);
+    var cloned: usize = 0;
+    errdefer {
+        for (copies[0..cloned]) |*copy| copy.deinit(allocator);
+        allocator.free(copies);
+    }
+
+    for (values, 0..) |*value, i| {
+        copies[i] = try value.clone(allocator);
+        cloned += 1;
+    }
+    return copies;
+}
+
+pub fn freeValues(allocator: Allocator, values: []Value) void {
+    for (values) |*value| value.deinit(allocator);
+    allocator.free(values);
+}
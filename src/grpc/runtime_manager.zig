@@ -1,36 +1,219 @@
 const std = @import("std");
 const Allocator = std.mem.Allocator;
+const ArrayList = std.ArrayList;
 const StringHashMap = std.StringHashMap;
 
-const GrpcClient = @import("client.zig").GrpcClient;
+const value_mod = @import("../forthic/value.zig");
+const Value = value_mod.Value;
+const RemoteRef = value_mod.RemoteRef;
+const Module = @import("../forthic/module.zig").Module;
+const interpreter_mod = @import("../forthic/interpreter.zig");
+const Interpreter = interpreter_mod.Interpreter;
+const client_mod = @import("client.zig");
+const GrpcClient = client_mod.GrpcClient;
+const ClientOptions = client_mod.ClientOptions;
+const CallOptions = client_mod.CallOptions;
+const ExecuteWordResult = client_mod.ExecuteWordResult;
+const FetchRefResult = client_mod.FetchRefResult;
 const RemoteModule = @import("remote_module.zig").RemoteModule;
+const manifest_cache = @import("manifest_cache.zig");
+const ManifestCache = manifest_cache.ManifestCache;
+const OwnedManifest = manifest_cache.OwnedManifest;
+
+/// Remote value handles handed out by one runtime
+/// Keys are owned handle ids; values are the mark bits used by collectRefs
+const RefTable = StringHashMap(bool);
+
+/// Handles held by one interpreter (see RuntimeManager.enableRemoteRefs);
+/// the context of its hooks. Tables are keyed by owned runtime name
+const RefScope = struct {
+    manager: *RuntimeManager,
+    tables: StringHashMap(RefTable),
+};
+
+/// Manifest a runtime's modules were bound from, and its background check
+const RuntimeManifest = struct {
+    owned: OwnedManifest,
+    /// Set once revalidation found a newer version (already written to the
+    /// cache; modules bound from this manifest keep their words until restart)
+    stale: std.atomic.Value(bool),
+    revalidation: ?std.Thread,
+};
+
+// =============================================================================
+// Scatter-Gather
+// =============================================================================
+
+pub const ScatterOptions = struct {
+    /// Calls in flight at once (each on its own thread; 0 = one per shard)
+    max_concurrency: usize = 64,
+    call_options: CallOptions = .{},
+};
+
+pub const ShardResult = struct {
+    /// Group member the shard was sent to (owned by the group definition)
+    runtime: []const u8,
+    outcome: Outcome,
+
+    pub const Outcome = union(enum) {
+        /// The values the word left, or the error it raised remotely
+        result: ExecuteWordResult,
+        /// The call itself failed (connection, deadline, ...)
+        failed: anyerror,
+    };
+
+    pub fn isError(self: *const ShardResult) bool {
+        return switch (self.outcome) {
+            .result => |*result| result.isError(),
+            .failed => true,
+        };
+    }
+};
+
+/// Per-shard results of scatterGather, in shard order
+pub const GatherResult = struct {
+    shards: []ShardResult,
+    /// Shards whose call failed or whose word raised an error
+    failures: usize,
+
+    pub fn deinit(self: *GatherResult, allocator: Allocator) void {
+        for (self.shards) |*shard| {
+            switch (shard.outcome) {
+                .result => |*result| result.deinit(allocator),
+                .failed => {},
+            }
+        }
+        allocator.free(self.shards);
+    }
+};
+
+/// Read-only view of the connected runtimes
+/// Replaced, never modified, when a runtime connects. Keys and clients
+/// belong to RuntimeManager.clients
+pub const ClientSnapshot = struct {
+    map: std.StringHashMapUnmanaged(*GrpcClient),
+
+    pub fn get(self: *const ClientSnapshot, runtime_name: []const u8) ?*GrpcClient {
+        return self.map.get(runtime_name);
+    }
+
+    pub fn count(self: *const ClientSnapshot) usize {
+        return self.map.count();
+    }
+
+    pub fn iterator(self: *const ClientSnapshot) std.StringHashMapUnmanaged(*GrpcClient).Iterator {
+        return self.map.iterator();
+    }
+};
 
 /// Singleton manager for gRPC runtime connections
+///
+/// Safe to share between interpreters on different threads (the allocator
+/// must be thread-safe too). Client lookups read an immutable snapshot and
+/// take no lock; registration is serialized by registry_mutex. Runtimes and
+/// modules are never removed before deinit, which must not race with any
+/// other use.
 pub const RuntimeManager = struct {
     allocator: Allocator,
+    /// Guards clients, modules, manifests, groups and manifest_cache
+    registry_mutex: std.Thread.Mutex,
     clients: StringHashMap(*GrpcClient),
+    /// Published copy of clients for lock-free lookup (getClient)
+    client_snapshot: std.atomic.Value(*ClientSnapshot),
+    /// Replaced snapshots and group member lists; readers may still hold
+    /// them, so they are only freed by deinit
+    retired_snapshots: ArrayList(*ClientSnapshot),
+    retired_members: ArrayList([][]u8),
     modules: StringHashMap(*RemoteModule),
+    /// Guards ref_scopes and their tables
+    refs_mutex: std.Thread.Mutex,
+    /// Keyed by the interpreter the hooks were installed on
+    ref_scopes: std.AutoHashMap(*const Interpreter, *RefScope),
+    manifest_cache: ?ManifestCache,
+    /// Keyed by runtime name
+    manifests: StringHashMap(*RuntimeManifest),
+    /// Runtime groups for scatterGather; members are owned runtime names
+    groups: StringHashMap([][]u8),
 
     const Self = @This();
 
-    var instance: ?*Self = null;
+    var instance = std.atomic.Value(?*Self).init(null);
+    var instance_mutex: std.Thread.Mutex = .{};
 
+    /// The process-wide manager, created by the first caller (thread-safe)
     pub fn getInstance(allocator: Allocator) !*Self {
-        if (instance) |inst| {
+        if (instance.load(.acquire)) |inst| {
             return inst;
         }
 
+        instance_mutex.lock();
+        defer instance_mutex.unlock();
+        if (instance.load(.monotonic)) |inst| {
+            return inst;
+        }
+
+        const snapshot = try allocator.create(ClientSnapshot);
+        errdefer allocator.destroy(snapshot);
+        snapshot.* = .{ .map = .{} };
+
         const mgr = try allocator.create(Self);
         mgr.* = Self{
             .allocator = allocator,
+            .registry_mutex = .{},
             .clients = StringHashMap(*GrpcClient).init(allocator),
+            .client_snapshot = std.atomic.Value(*ClientSnapshot).init(snapshot),
+            .retired_snapshots = .{},
+            .retired_members = .{},
             .modules = StringHashMap(*RemoteModule).init(allocator),
+            .refs_mutex = .{},
+            .ref_scopes = std.AutoHashMap(*const Interpreter, *RefScope).init(allocator),
+            .manifest_cache = null,
+            .manifests = StringHashMap(*RuntimeManifest).init(allocator),
+            .groups = StringHashMap([][]u8).init(allocator),
         };
-        instance = mgr;
+        instance.store(mgr, .release);
         return mgr;
     }
 
+    /// The manager if getInstance has created it
+    pub fn current() ?*Self {
+        return instance.load(.acquire);
+    }
+
     pub fn deinit(self: *Self) void {
+        instance_mutex.lock();
+        defer instance_mutex.unlock();
+
+        // Revalidation threads use the clients
+        var manifest_iter = self.manifests.iterator();
+        while (manifest_iter.next()) |entry| {
+            const runtime_manifest = entry.value_ptr.*;
+            if (runtime_manifest.revalidation) |thread| thread.join();
+            runtime_manifest.owned.deinit();
+            self.allocator.destroy(runtime_manifest);
+            self.allocator.free(entry.key_ptr.*);
+        }
+        self.manifests.deinit();
+        if (self.manifest_cache) |*cache| cache.deinit();
+
+        // Release outstanding handles while the clients are still connected
+        self.releaseAllRefs();
+        self.ref_scopes.deinit();
+
+        var group_iter = self.groups.iterator();
+        while (group_iter.next()) |entry| {
+            freeMembers(self.allocator, entry.value_ptr.*);
+            self.allocator.free(entry.key_ptr.*);
+        }
+        self.groups.deinit();
+        for (self.retired_members.items) |members| freeMembers(self.allocator, members);
+        self.retired_members.deinit(self.allocator);
+
+        // Snapshots share keys and clients with self.clients
+        for (self.retired_snapshots.items) |snapshot| self.destroySnapshot(snapshot);
+        self.retired_snapshots.deinit(self.allocator);
+        self.destroySnapshot(self.client_snapshot.load(.monotonic));
+
         // Clean up clients
         var client_iter = self.clients.iterator();
         while (client_iter.next()) |entry| {
@@ -49,36 +232,163 @@ pub const RuntimeManager = struct {
         }
         self.modules.deinit();
 
-        instance = null;
+        instance.store(null, .release);
         self.allocator.destroy(self);
     }
 
+    /// Connect to a runtime at "host:port", or "unix:/path/to.sock" for a
+    /// sidecar on the same host
     pub fn connectRuntime(self: *Self, runtime_name: []const u8, address: []const u8) !*GrpcClient {
         // Check if already connected
-        if (self.clients.get(runtime_name)) |client| {
+        if (self.getClient(runtime_name)) |client| {
             return client;
         }
 
-        // Create new client
+        return self.addClient(runtime_name, try GrpcClient.init(self.allocator, address));
+    }
+
+    /// Connect to a runtime served from several addresses
+    /// Calls are spread over options.channels_per_endpoint channels per
+    /// address; failing or slow addresses are ejected for a while.
+    /// Also the way to set deadlines, keepalive and hedging for a runtime
+    pub fn connectRuntimePool(
+        self: *Self,
+        runtime_name: []const u8,
+        addresses: []const []const u8,
+        options: ClientOptions,
+    ) !*GrpcClient {
+        // Check if already connected
+        if (self.getClient(runtime_name)) |client| {
+            return client;
+        }
+
+        return self.addClient(runtime_name, try GrpcClient.initPool(self.allocator, addresses, options));
+    }
+
+    /// Connect to a runtime with client options, e.g. connect_timeout_ms
+    /// to pay for connection setup here rather than in the first word
+    pub fn connectRuntimeWithOptions(
+        self: *Self,
+        runtime_name: []const u8,
+        address: []const u8,
+        options: ClientOptions,
+    ) !*GrpcClient {
+        return self.connectRuntimePool(runtime_name, &[_][]const u8{address}, options);
+    }
+
+    /// Warm up the connection of every connected runtime, in parallel
+    ///
+    /// Meant for interpreter startup, after the connectRuntime calls: the
+    /// slowest runtime bounds the wait instead of the sum of all of them.
+    /// Returns how many runtimes were not ready within timeout_ms (they keep
+    /// connecting in the background; see GrpcClient.isConnected).
+    pub fn connectAll(self: *Self, timeout_ms: u32) !usize {
+        const snapshot = self.clientSnapshot();
+        const clients = try self.allocator.alloc(*GrpcClient, snapshot.count());
+        defer self.allocator.free(clients);
+        var client_iter = snapshot.map.valueIterator();
+        for (clients) |*client| client.* = client_iter.next().?.*;
+
+        const ready = try self.allocator.alloc(bool, clients.len);
+        defer self.allocator.free(ready);
+
+        const threads = try self.allocator.alloc(?std.Thread, clients.len);
+        defer self.allocator.free(threads);
+
+        for (clients, ready, threads) |client, *is_ready, *thread| {
+            thread.* = std.Thread.spawn(.{}, warmUp, .{ client, timeout_ms, is_ready }) catch null;
+            // No thread: warm this one inline
+            if (thread.* == null) warmUp(client, timeout_ms, is_ready);
+        }
+
+        var not_ready: usize = 0;
+        for (threads, ready) |thread, is_ready| {
+            if (thread) |t| t.join();
+            if (!is_ready) not_ready += 1;
+        }
+        return not_ready;
+    }
+
+    fn warmUp(client: *GrpcClient, timeout_ms: u32, ready: *bool) void {
+        client.waitForConnected(timeout_ms) catch {
+            ready.* = false;
+            return;
+        };
+        ready.* = true;
+    }
+
+    /// Clients are created (and eagerly connected) outside the lock; if
+    /// another thread registered the same runtime meanwhile, its client wins
+    fn addClient(self: *Self, runtime_name: []const u8, initialized: GrpcClient) !*GrpcClient {
+        var owned = initialized;
+        errdefer owned.deinit();
+
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
+        if (self.clients.get(runtime_name)) |existing| {
+            owned.deinit();
+            return existing;
+        }
+
         const client = try self.allocator.create(GrpcClient);
-        client.* = try GrpcClient.init(self.allocator, address);
+        errdefer self.allocator.destroy(client);
+        client.* = owned;
 
         const key = try self.allocator.dupe(u8, runtime_name);
+        errdefer self.allocator.free(key);
         try self.clients.put(key, client);
+        errdefer _ = self.clients.remove(key);
 
+        try self.publishClients();
         return client;
     }
 
+    /// Lock-free; safe to call from any thread
     pub fn getClient(self: *Self, runtime_name: []const u8) ?*GrpcClient {
-        return self.clients.get(runtime_name);
+        return self.clientSnapshot().get(runtime_name);
     }
 
+    /// Every connected runtime as of now (lock-free; valid until deinit)
+    pub fn clientSnapshot(self: *Self) *const ClientSnapshot {
+        return self.client_snapshot.load(.acquire);
+    }
+
+    /// Replace the published snapshot with a copy of clients
+    /// Caller holds registry_mutex
+    fn publishClients(self: *Self) !void {
+        const snapshot = try self.allocator.create(ClientSnapshot);
+        errdefer self.allocator.destroy(snapshot);
+        snapshot.* = .{ .map = try self.clients.unmanaged.clone(self.allocator) };
+        errdefer snapshot.map.deinit(self.allocator);
+
+        try self.retired_snapshots.ensureUnusedCapacity(self.allocator, 1);
+        self.retired_snapshots.appendAssumeCapacity(self.client_snapshot.swap(snapshot, .acq_rel));
+    }
+
+    fn destroySnapshot(self: *Self, snapshot: *ClientSnapshot) void {
+        snapshot.map.deinit(self.allocator);
+        self.allocator.destroy(snapshot);
+    }
+
+    /// Create a remote module of a runtime
+    /// With the manifest cache enabled, its words are bound right away from
+    /// the runtime's manifest; otherwise call RemoteModule.initialize
     pub fn registerModule(
         self: *Self,
         runtime_name: []const u8,
         module_name: []const u8,
     ) !*RemoteModule {
-        const client = self.clients.get(runtime_name) orelse return error.RuntimeNotConnected;
+        const client = self.getClient(runtime_name) orelse return error.RuntimeNotConnected;
+
+        // May read the disk or fetch over the network, so it runs unlocked
+        const runtime_manifest = if (self.manifestCache()) |cache|
+            try self.runtimeManifest(runtime_name, client, cache)
+        else
+            null;
+
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
 
         const module = try self.allocator.create(RemoteModule);
         module.* = try RemoteModule.init(self.allocator, module_name, client, runtime_name);
@@ -86,10 +396,559 @@ pub const RuntimeManager = struct {
         const key = try self.allocator.dupe(u8, module_name);
         try self.modules.put(key, module);
 
+        if (runtime_manifest) |manifest| {
+            if (manifest.owned.manifest.findModule(module_name)) |module_manifest| {
+                try module.initializeFromManifest(module_manifest);
+            }
+        }
+
         return module;
     }
 
+    // ========================================================================
+    // Manifest Cache
+    // ========================================================================
+
+    /// Persist runtime manifests under dir_path (see ManifestCache.defaultDir)
+    ///
+    /// registerModule then binds words from the cached manifest of the
+    /// runtime's address without a network round trip, and checks the
+    /// runtime's manifest version in the background. A changed version is
+    /// fetched and written to the cache for the next start; manifestStale
+    /// reports it. Without a cached manifest, the first registerModule of a
+    /// runtime fetches all of its modules once.
+    ///
+    /// Revalidation runs on its own thread, so the allocator must be thread-safe.
+    pub fn enableManifestCache(self: *Self, dir_path: []const u8) !void {
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
+        if (self.manifest_cache != null) return;
+        self.manifest_cache = try ManifestCache.init(self.allocator, dir_path);
+    }
+
+    /// Whether revalidation found that the runtime's manifest has changed
+    /// since its modules were bound
+    pub fn manifestStale(self: *Self, runtime_name: []const u8) bool {
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
+        const runtime_manifest = self.manifests.get(runtime_name) orelse return false;
+        return runtime_manifest.stale.load(.acquire);
+    }
+
+    /// Set once by enableManifestCache and kept until deinit
+    fn manifestCache(self: *Self) ?*ManifestCache {
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+        return if (self.manifest_cache) |*cache| cache else null;
+    }
+
+    /// Loaded or fetched without registry_mutex; if another thread got the
+    /// runtime's manifest in meanwhile, its entry wins
+    fn runtimeManifest(self: *Self, runtime_name: []const u8, client: *GrpcClient, cache: *ManifestCache) !*RuntimeManifest {
+        {
+            self.registry_mutex.lock();
+            defer self.registry_mutex.unlock();
+            if (self.manifests.get(runtime_name)) |runtime_manifest| return runtime_manifest;
+        }
+
+        const cached = try cache.load(client.address);
+
+        var owned = cached orelse try client.fetchManifest(self.allocator);
+        errdefer owned.deinit();
+        if (cached == null) {
+            // Best effort: the manifest is usable even if it cannot be persisted
+            cache.store(&owned.manifest) catch {};
+        }
+
+        const runtime_manifest = try self.allocator.create(RuntimeManifest);
+        errdefer self.allocator.destroy(runtime_manifest);
+        runtime_manifest.* = .{
+            .owned = owned,
+            .stale = std.atomic.Value(bool).init(false),
+            .revalidation = null,
+        };
+
+        const key = try self.allocator.dupe(u8, runtime_name);
+        errdefer self.allocator.free(key);
+
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
+        if (self.manifests.get(runtime_name)) |existing| {
+            self.allocator.free(key);
+            self.allocator.destroy(runtime_manifest);
+            owned.deinit();
+            return existing;
+        }
+        try self.manifests.put(key, runtime_manifest);
+
+        if (cached != null) {
+            runtime_manifest.revalidation = std.Thread.spawn(.{}, revalidate, .{ cache, client, runtime_manifest }) catch null;
+        }
+        return runtime_manifest;
+    }
+
+    /// Background check of a cached manifest against the runtime
+    fn revalidate(cache: *const ManifestCache, client: *GrpcClient, runtime_manifest: *RuntimeManifest) void {
+        const allocator = cache.allocator;
+
+        const version = client.manifestVersion(allocator) catch return;
+        defer allocator.free(version);
+
+        const cached_version = runtime_manifest.owned.manifest.version;
+        if (version.len > 0 and std.mem.eql(u8, version, cached_version)) return;
+
+        var fresh = client.fetchManifest(allocator) catch return;
+        defer fresh.deinit();
+        cache.store(&fresh.manifest) catch return;
+
+        // Unversioned runtimes are refetched every time but never reported stale
+        if (!std.mem.eql(u8, fresh.manifest.version, cached_version)) {
+            runtime_manifest.stale.store(true, .release);
+        }
+    }
+
     pub fn getModule(self: *Self, module_name: []const u8) ?*RemoteModule {
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
         return self.modules.get(module_name);
     }
+
+    // ========================================================================
+    // Scatter-Gather
+    // ========================================================================
+
+    /// Name a set of connected runtimes serving the same words (replaces
+    /// any existing group of that name)
+    pub fn defineGroup(self: *Self, group_name: []const u8, runtime_names: []const []const u8) !void {
+        if (runtime_names.len == 0) return error.EmptyRuntimeGroup;
+
+        const members = try self.allocator.alloc([]u8, runtime_names.len);
+        var owned: usize = 0;
+        errdefer {
+            for (members[0..owned]) |member| self.allocator.free(member);
+            self.allocator.free(members);
+        }
+        for (runtime_names, 0..) |runtime_name, i| {
+            members[i] = try self.allocator.dupe(u8, runtime_name);
+            owned += 1;
+        }
+
+        self.registry_mutex.lock();
+        defer self.registry_mutex.unlock();
+
+        // A running scatterGather may still use the old members
+        try self.retired_members.ensureUnusedCapacity(self.allocator, 1);
+        const entry = try self.groups.getOrPut(group_name);
+        if (entry.found_existing) {
+            self.retired_members.appendAssumeCapacity(entry.value_ptr.*);
+        } else {
+            entry.key_ptr.* = self.allocator.dupe(u8, group_name) catch |err| {
+                self.groups.removeByPtr(entry.key_ptr);
+                return err;
+            };
+        }
+        entry.value_ptr.* = members;
+    }
+
+    fn freeMembers(allocator: Allocator, members: [][]u8) void {
+        for (members) |member| allocator.free(member);
+        allocator.free(members);
+    }
+
+    /// Run word_name once per shard across the runtimes of a group
+    ///
+    /// Shard i is pushed as the word's only argument on member i mod group
+    /// size. Calls run concurrently, so the total latency is close to that
+    /// of the slowest shard. A failing shard does not fail the others: each
+    /// ShardResult holds either the word's result or the call's error.
+    /// Handles in the results (call_options.accepts_remote_refs) are not
+    /// tracked; report them with Interpreter.trackRemoteRefs.
+    ///
+    /// Calls run on their own threads, so the allocator must be thread-safe.
+    pub fn scatterGather(
+        self: *Self,
+        group_name: []const u8,
+        word_name: []const u8,
+        shards: []const Value,
+        options: ScatterOptions,
+    ) !GatherResult {
+        const members = blk: {
+            self.registry_mutex.lock();
+            defer self.registry_mutex.unlock();
+            break :blk self.groups.get(group_name) orelse return error.UnknownRuntimeGroup;
+        };
+
+        const clients = try self.allocator.alloc(*GrpcClient, members.len);
+        defer self.allocator.free(clients);
+        for (members, 0..) |member, i| {
+            clients[i] = self.getClient(member) orelse return error.RuntimeNotConnected;
+        }
+
+        const results = try self.allocator.alloc(ShardResult, shards.len);
+        errdefer self.allocator.free(results);
+
+        var scatter = Scatter{
+            .members = members,
+            .clients = clients,
+            .word_name = word_name,
+            .shards = shards,
+            .results = results,
+            .call_options = options.call_options,
+            .next = std.atomic.Value(usize).init(0),
+        };
+
+        // The calling thread works too; if threads cannot be spawned it
+        // simply takes more of the shards
+        const limit = if (options.max_concurrency == 0) shards.len else options.max_concurrency;
+        const worker_count = @min(limit, shards.len) -| 1;
+        const threads = try self.allocator.alloc(std.Thread, worker_count);
+        defer self.allocator.free(threads);
+
+        var spawned: usize = 0;
+        for (threads) |*thread| {
+            thread.* = std.Thread.spawn(.{}, Scatter.run, .{&scatter}) catch break;
+            spawned += 1;
+        }
+        scatter.run();
+        for (threads[0..spawned]) |thread| thread.join();
+
+        var failures: usize = 0;
+        for (results) |*shard| {
+            if (shard.isError()) failures += 1;
+        }
+        return GatherResult{ .shards = results, .failures = failures };
+    }
+
+    /// Shared by the threads of one scatterGather call
+    const Scatter = struct {
+        members: []const []u8,
+        clients: []const *GrpcClient,
+        word_name: []const u8,
+        shards: []const Value,
+        results: []ShardResult,
+        call_options: CallOptions,
+        /// Next shard to claim
+        next: std.atomic.Value(usize),
+
+        fn run(self: *Scatter) void {
+            while (true) {
+                const i = self.next.fetchAdd(1, .monotonic);
+                if (i >= self.shards.len) return;
+
+                const member = i % self.clients.len;
+                const client = self.clients[member];
+                self.results[i] = .{
+                    .runtime = self.members[member],
+                    .outcome = if (client.executeWordWithOptions(self.word_name, self.shards[i .. i + 1], self.call_options)) |result|
+                        .{ .result = result }
+                    else |err|
+                        .{ .failed = err },
+                };
+            }
+        }
+    };
+
+    // ========================================================================
+    // Remote Value Handles
+    // ========================================================================
+
+    /// Let remote runtimes return large results to interp's remote words as
+    /// handles that stay resident on their side. The interpreter fetches a
+    /// handle only when a local word inspects it; call collectRefs to release
+    /// handles nothing references. Handles are tracked per interpreter, and
+    /// interpreters without hooks keep getting plain values.
+    pub fn enableRemoteRefs(self: *Self, interp: *Interpreter) !void {
+        const scope = blk: {
+            self.refs_mutex.lock();
+            defer self.refs_mutex.unlock();
+
+            const entry = try self.ref_scopes.getOrPut(interp);
+            if (entry.found_existing) break :blk entry.value_ptr.*;
+
+            const scope = self.allocator.create(RefScope) catch |err| {
+                self.ref_scopes.removeByPtr(entry.key_ptr);
+                return err;
+            };
+            scope.* = .{ .manager = self, .tables = StringHashMap(RefTable).init(self.allocator) };
+            entry.value_ptr.* = scope;
+            break :blk scope;
+        };
+
+        interp.setRemoteRefHooks(.{
+            .ctx = scope,
+            .resolve = resolveHook,
+            .track = trackHook,
+        });
+    }
+
+    /// Remove interp's hooks and release every handle it still holds
+    /// (best effort). Call before interp is destroyed; handles left on its
+    /// stack can no longer be fetched.
+    pub fn disableRemoteRefs(self: *Self, interp: *Interpreter) void {
+        interp.setRemoteRefHooks(null);
+
+        const scope = blk: {
+            self.refs_mutex.lock();
+            defer self.refs_mutex.unlock();
+            const removed = self.ref_scopes.fetchRemove(interp) orelse return;
+            break :blk removed.value;
+        };
+        self.releaseScope(scope);
+    }
+
+    fn resolveHook(ctx: *anyopaque, ref: RemoteRef) anyerror!Value {
+        const scope: *RefScope = @ptrCast(@alignCast(ctx));
+        const self = scope.manager;
+        var result = try self.fetchRef(ref);
+        defer result.deinit(self.allocator);
+
+        if (result.isError()) {
+            return error.RemoteExecutionFailed;
+        }
+        return result.takeValue().?;
+    }
+
+    fn trackHook(ctx: *anyopaque, values: []const Value) anyerror!void {
+        const scope: *RefScope = @ptrCast(@alignCast(ctx));
+        try scope.manager.trackRefs(scope, values);
+    }
+
+    /// Fetch the value behind a handle from the runtime that owns it
+    /// A handle the runtime could not resolve comes back with its remote_error
+    /// Caller must call deinit() on the result with the manager's allocator
+    pub fn fetchRef(self: *Self, ref: RemoteRef) !FetchRefResult {
+        const client = self.getClient(ref.runtime) orelse return error.RuntimeNotConnected;
+        return client.fetchRef(ref.handle_id);
+    }
+
+    /// Start tracking every handle contained in values (including nested ones)
+    fn trackRefs(self: *Self, scope: *RefScope, values: []const Value) !void {
+        self.refs_mutex.lock();
+        defer self.refs_mutex.unlock();
+
+        for (values) |*value| {
+            try self.trackValue(scope, value);
+        }
+    }
+
+    fn trackValue(self: *Self, scope: *RefScope, value: *const Value) !void {
+        switch (value.*) {
+            .remote_ref_value => |ref| {
+                const table = try self.refTable(scope, ref.runtime);
+                if (table.contains(ref.handle_id)) return;
+
+                const key = try self.allocator.dupe(u8, ref.handle_id);
+                errdefer self.allocator.free(key);
+                try table.put(key, false);
+            },
+            .array_value => |arr| {
+                for (arr.items) |*item| try self.trackValue(scope, item);
+            },
+            .record_value => |rec| {
+                var iter = rec.valueIterator();
+                while (iter.next()) |item| try self.trackValue(scope, item);
+            },
+            else => {},
+        }
+    }
+
+    fn refTable(self: *Self, scope: *RefScope, runtime_name: []const u8) !*RefTable {
+        const entry = try scope.tables.getOrPut(runtime_name);
+        if (!entry.found_existing) {
+            entry.key_ptr.* = self.allocator.dupe(u8, runtime_name) catch |err| {
+                scope.tables.removeByPtr(entry.key_ptr);
+                return err;
+            };
+            entry.value_ptr.* = RefTable.init(self.allocator);
+        }
+        return entry.value_ptr;
+    }
+
+    /// Number of handles currently tracked across all interpreters and runtimes
+    pub fn liveRefCount(self: *Self) usize {
+        self.refs_mutex.lock();
+        defer self.refs_mutex.unlock();
+
+        var count: usize = 0;
+        var scope_iter = self.ref_scopes.valueIterator();
+        while (scope_iter.next()) |scope| {
+            var iter = scope.*.tables.valueIterator();
+            while (iter.next()) |table| {
+                count += table.count();
+            }
+        }
+        return count;
+    }
+
+    /// Handles of one runtime that are about to be released
+    const DeadRefs = struct {
+        /// Owned by the scope's table
+        runtime: []const u8,
+        /// Owned; removed from the table
+        handle_ids: ArrayList([]const u8),
+    };
+
+    /// Release every handle interp tracks that it no longer reaches
+    ///
+    /// Roots are interp's stack, the variables of its app module and
+    /// registered modules, plus extra_roots for values held elsewhere (e.g.
+    /// memoized words). Handles other interpreters received are not touched.
+    /// Each runtime gets a single ReleaseRefs call, made without holding the
+    /// lock. Handles whose release fails stay tracked and are retried on the
+    /// next collection. Must run on the thread that uses interp.
+    ///
+    /// Returns the number of handles the runtimes released
+    pub fn collectRefs(self: *Self, interp: *Interpreter, extra_roots: []const Value) !usize {
+        var dead: ArrayList(DeadRefs) = .{};
+        defer {
+            for (dead.items) |*refs| {
+                for (refs.handle_ids.items) |handle_id| self.allocator.free(handle_id);
+                refs.handle_ids.deinit(self.allocator);
+            }
+            dead.deinit(self.allocator);
+        }
+
+        const scope = blk: {
+            self.refs_mutex.lock();
+            defer self.refs_mutex.unlock();
+
+            const scope = self.ref_scopes.get(interp) orelse return 0;
+
+            // Mark
+            for (interp.stack.items.items) |*value| {
+                markValue(scope, value);
+            }
+            markModuleVariables(scope, &interp.app_module);
+            var module_iter = interp.registered_modules.valueIterator();
+            while (module_iter.next()) |module| {
+                markModuleVariables(scope, module.*);
+            }
+            for (extra_roots) |*value| {
+                markValue(scope, value);
+            }
+
+            // Sweep: unmarked handles leave the tables
+            var table_iter = scope.tables.iterator();
+            while (table_iter.next()) |entry| {
+                const table = entry.value_ptr;
+
+                var handle_ids: ArrayList([]const u8) = .{};
+                errdefer handle_ids.deinit(self.allocator);
+                var handle_iter = table.iterator();
+                while (handle_iter.next()) |handle| {
+                    if (handle.value_ptr.*) {
+                        handle.value_ptr.* = false;
+                    } else {
+                        try handle_ids.append(self.allocator, handle.key_ptr.*);
+                    }
+                }
+                if (handle_ids.items.len == 0) continue;
+
+                try dead.append(self.allocator, .{ .runtime = entry.key_ptr.*, .handle_ids = handle_ids });
+                for (handle_ids.items) |handle_id| _ = table.remove(handle_id);
+            }
+            break :blk scope;
+        };
+
+        var released: usize = 0;
+        var first_error: ?anyerror = null;
+
+        for (dead.items) |*refs| {
+            // A runtime that is no longer connected has dropped its handles already
+            const client = self.getClient(refs.runtime) orelse continue;
+            released += client.releaseRefs(refs.handle_ids.items) catch |err| {
+                first_error = first_error orelse err;
+                self.retrack(scope, refs);
+                continue;
+            };
+        }
+
+        if (first_error) |err| return err;
+        return released;
+    }
+
+    /// Put handles whose release failed back into their table (ownership of
+    /// the ids moves back too)
+    fn retrack(self: *Self, scope: *RefScope, refs: *DeadRefs) void {
+        self.refs_mutex.lock();
+        defer self.refs_mutex.unlock();
+
+        const table = scope.tables.getPtr(refs.runtime).?;
+        var kept: usize = 0;
+        for (refs.handle_ids.items) |handle_id| {
+            table.put(handle_id, false) catch {
+                refs.handle_ids.items[kept] = handle_id;
+                kept += 1;
+            };
+        }
+        refs.handle_ids.shrinkRetainingCapacity(kept);
+    }
+
+    fn markValue(scope: *RefScope, value: *const Value) void {
+        switch (value.*) {
+            .remote_ref_value => |ref| {
+                const table = scope.tables.getPtr(ref.runtime) orelse return;
+                if (table.getPtr(ref.handle_id)) |marked| marked.* = true;
+            },
+            .array_value => |arr| {
+                for (arr.items) |*item| markValue(scope, item);
+            },
+            .record_value => |rec| {
+                var iter = rec.valueIterator();
+                while (iter.next()) |item| markValue(scope, item);
+            },
+            else => {},
+        }
+    }
+
+    fn markModuleVariables(scope: *RefScope, module: *const Module) void {
+        var iter = module.variables.valueIterator();
+        while (iter.next()) |variable| {
+            markValue(scope, &variable.value);
+        }
+    }
+
+    /// Release every handle of a scope no longer in ref_scopes (best
+    /// effort), then free it
+    fn releaseScope(self: *Self, scope: *RefScope) void {
+        var handle_ids: ArrayList([]const u8) = .{};
+        defer handle_ids.deinit(self.allocator);
+
+        var table_iter = scope.tables.iterator();
+        while (table_iter.next()) |entry| {
+            const table = entry.value_ptr;
+
+            handle_ids.clearRetainingCapacity();
+            var key_iter = table.keyIterator();
+            while (key_iter.next()) |key| {
+                handle_ids.append(self.allocator, key.*) catch break;
+            }
+
+            if (self.getClient(entry.key_ptr.*)) |client| {
+                _ = client.releaseRefs(handle_ids.items) catch {};
+            }
+
+            key_iter = table.keyIterator();
+            while (key_iter.next()) |key| {
+                self.allocator.free(key.*);
+            }
+            table.deinit();
+            self.allocator.free(entry.key_ptr.*);
+        }
+        scope.tables.deinit();
+        self.allocator.destroy(scope);
+    }
+
+    /// Release every tracked handle (best effort) and forget them all
+    fn releaseAllRefs(self: *Self) void {
+        var scope_iter = self.ref_scopes.valueIterator();
+        while (scope_iter.next()) |scope| {
+            self.releaseScope(scope.*);
+        }
+        self.ref_scopes.clearRetainingCapacity();
+    }
 };
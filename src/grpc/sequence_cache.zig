@@ -0,0 +1,289 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+const Interpreter = @import("../forthic/interpreter.zig").Interpreter;
+const Module = @import("../forthic/module.zig").Module;
+const Word = @import("../forthic/word.zig").Word;
+
+// =============================================================================
+// Options and Stats
+// =============================================================================
+
+pub const SequenceCacheOptions = struct {
+    /// The cache is cleared when it would grow beyond this many sequences
+    max_entries: usize = 1024,
+};
+
+pub const SequenceCacheStats = struct {
+    hits: u64 = 0,
+    misses: u64 = 0,
+    /// Entries recompiled because the dictionary changed shape
+    invalidations: u64 = 0,
+    entries: usize = 0,
+};
+
+// =============================================================================
+// SequenceCache
+// =============================================================================
+
+/// Server-side cache of compiled ExecuteSequence word lists
+///
+/// Resolving a name walks every module on the interpreter's module stack,
+/// comparing names word by word. A compiled sequence instead records where
+/// each name resolved - module stack position and word index - so a repeat
+/// request costs one name compare per word.
+///
+/// Sessions each have their own Interpreter, so entries hold positions
+/// rather than Word pointers and are shared by every session whose
+/// dictionary has the same shape: the module stack, and the word, import
+/// and variable counts of each module on it. Defining, importing or pushing a
+/// module changes the shape and recompiles the entry. Session setup must
+/// install the same words for the same shape; call invalidate() after
+/// changing what it installs.
+///
+/// Thread-safe: sessions run on gRPC server threads.
+pub const SequenceCache = struct {
+    allocator: Allocator,
+    options: SequenceCacheOptions,
+    mutex: std.Thread.Mutex,
+    map: std.AutoHashMapUnmanaged(u64, *Entry),
+    stats: SequenceCacheStats,
+
+    const Self = @This();
+
+    /// Where a name resolved: a word of the module at this module stack
+    /// position, in its words or one of its word tables
+    const Slot = struct {
+        module: u32,
+        /// module_words, own_table, or an index into imported_tables
+        source: u32,
+        word: u32,
+    };
+
+    const module_words = std.math.maxInt(u32);
+    const own_table = std.math.maxInt(u32) - 1;
+
+    const Entry = struct {
+        names: [][]u8,
+        /// null: resolved per call by Interpreter.run (variables, literals,
+        /// unknown words)
+        slots: []?Slot,
+        shape: u64,
+    };
+
+    pub fn init(allocator: Allocator, options: SequenceCacheOptions) Self {
+        return Self{
+            .allocator = allocator,
+            .options = options,
+            .mutex = .{},
+            .map = .{},
+            .stats = .{},
+        };
+    }
+
+    pub fn deinit(self: *Self) void {
+        self.clearLocked();
+        self.map.deinit(self.allocator);
+    }
+
+    /// Drop every compiled sequence (counters are kept)
+    pub fn invalidate(self: *Self) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.stats.invalidations += self.map.count();
+        self.clearLocked();
+    }
+
+    pub fn getStats(self: *Self) SequenceCacheStats {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        var stats = self.stats;
+        stats.entries = self.map.count();
+        return stats;
+    }
+
+    /// Resolve word_names against interp's dictionary into out (one per
+    /// name; null where the name must go through Interpreter.run)
+    /// Returns the dictionary shape the words are valid for: once a word
+    /// changes it, run the remaining names through Interpreter.run
+    pub fn resolve(self: *Self, interp: *Interpreter, word_names: []const []const u8, out: []?Word) !u64 {
+        std.debug.assert(out.len == word_names.len);
+        const key = hashNames(word_names);
+        const shape = shapeOf(interp);
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        if (self.map.get(key)) |entry| {
+            if (namesEqual(entry.names, word_names)) {
+                if (entry.shape == shape and bind(entry, interp, out)) {
+                    self.stats.hits += 1;
+                    return shape;
+                }
+                self.stats.invalidations += 1;
+                compileSlots(interp, word_names, entry.slots);
+                entry.shape = shape;
+                self.stats.misses += 1;
+                _ = bind(entry, interp, out);
+                return shape;
+            }
+        }
+
+        // Miss, or a different list with the same hash: it takes the slot
+        self.stats.misses += 1;
+        const entry = try self.createEntry(interp, word_names, shape);
+        errdefer self.destroyEntry(entry);
+
+        if (self.map.count() >= self.options.max_entries and !self.map.contains(key)) {
+            self.clearLocked();
+        }
+        const gop = try self.map.getOrPut(self.allocator, key);
+        if (gop.found_existing) self.destroyEntry(gop.value_ptr.*);
+        gop.value_ptr.* = entry;
+
+        _ = bind(entry, interp, out);
+        return shape;
+    }
+
+    /// Cheap fingerprint of everything findWord depends on
+    pub fn shapeOf(interp: *const Interpreter) u64 {
+        var hasher = std.hash.Wyhash.init(0);
+        for (interp.module_stack.items) |module| {
+            const counts = [3]usize{
+                module.words.items.len,
+                module.imported_tables.items.len,
+                module.variables.count(),
+            };
+            hasher.update(std.mem.asBytes(&counts));
+            hasher.update(module.name);
+        }
+        return hasher.final();
+    }
+
+    fn hashNames(word_names: []const []const u8) u64 {
+        var hasher = std.hash.Wyhash.init(word_names.len);
+        for (word_names) |name| {
+            hasher.update(std.mem.asBytes(&name.len));
+            hasher.update(name);
+        }
+        return hasher.final();
+    }
+
+    fn namesEqual(a: []const []const u8, b: []const []const u8) bool {
+        if (a.len != b.len) return false;
+        for (a, b) |x, y| {
+            if (!std.mem.eql(u8, x, y)) return false;
+        }
+        return true;
+    }
+
+    /// Fill out from entry's slots; false if a slot no longer names its word
+    fn bind(entry: *const Entry, interp: *Interpreter, out: []?Word) bool {
+        const modules = interp.module_stack.items;
+        for (entry.slots, entry.names, 0..) |maybe_slot, name, i| {
+            const slot = maybe_slot orelse {
+                out[i] = null;
+                continue;
+            };
+            if (slot.module >= modules.len) return false;
+            const w = wordAt(modules[slot.module], slot) orelse return false;
+            if (!std.mem.eql(u8, w.getName(), name)) return false;
+            out[i] = w;
+        }
+        return true;
+    }
+
+    fn wordAt(module: *const Module, slot: Slot) ?Word {
+        const words = switch (slot.source) {
+            module_words => module.words.items,
+            own_table => (module.static_words orelse return null).words,
+            else => blk: {
+                if (slot.source >= module.imported_tables.items.len) return null;
+                break :blk module.imported_tables.items[slot.source].table.words;
+            },
+        };
+        if (slot.word >= words.len) return null;
+        return words[slot.word];
+    }
+
+    /// Same search order as Interpreter.findWord: module stack top down,
+    /// each module's words and imported tables (last added wins) and own
+    /// table before its variables
+    fn compileSlots(interp: *const Interpreter, word_names: []const []const u8, slots: []?Slot) void {
+        for (word_names, slots) |name, *slot| {
+            slot.* = findSlot(interp, name);
+        }
+    }
+
+    fn findSlot(interp: *const Interpreter, name: []const u8) ?Slot {
+        var i: usize = interp.module_stack.items.len;
+        while (i > 0) {
+            i -= 1;
+            const module = interp.module_stack.items[i];
+
+            // Words added after each table import shadow that table
+            var end: usize = module.words.items.len;
+            var t: usize = module.imported_tables.items.len;
+            while (true) {
+                const start = if (t > 0) @min(module.imported_tables.items[t - 1].word_count, end) else 0;
+                var j: usize = end;
+                while (j > start) {
+                    j -= 1;
+                    if (std.mem.eql(u8, module.words.items[j].getName(), name)) {
+                        return Slot{ .module = @intCast(i), .source = module_words, .word = @intCast(j) };
+                    }
+                }
+
+                if (t == 0) break;
+                t -= 1;
+                if (module.imported_tables.items[t].table.indexOf(name)) |index| {
+                    return Slot{ .module = @intCast(i), .source = @intCast(t), .word = index };
+                }
+                end = start;
+            }
+            if (module.static_words) |table| {
+                if (table.indexOf(name)) |index| {
+                    return Slot{ .module = @intCast(i), .source = own_table, .word = index };
+                }
+            }
+
+            if (module.variables.contains(name)) return null;
+        }
+        return null;
+    }
+
+    fn createEntry(self: *Self, interp: *const Interpreter, word_names: []const []const u8, shape: u64) !*Entry {
+        const entry = try self.allocator.create(Entry);
+        errdefer self.allocator.destroy(entry);
+
+        const names = try self.allocator.alloc([]u8, word_names.len);
+        var duped: usize = 0;
+        errdefer {
+            for (names[0..duped]) |name| self.allocator.free(name);
+            self.allocator.free(names);
+        }
+        for (word_names, 0..) |name, i| {
+            names[i] = try self.allocator.dupe(u8, name);
+            duped += 1;
+        }
+
+        const slots = try self.allocator.alloc(?Slot, word_names.len);
+        compileSlots(interp, word_names, slots);
+
+        entry.* = Entry{ .names = names, .slots = slots, .shape = shape };
+        return entry;
+    }
+
+    fn destroyEntry(self: *Self, entry: *Entry) void {
+        for (entry.names) |name| self.allocator.free(name);
+        self.allocator.free(entry.names);
+        self.allocator.free(entry.slots);
+        self.allocator.destroy(entry);
+    }
+
+    fn clearLocked(self: *Self) void {
+        var iter = self.map.valueIterator();
+        while (iter.next()) |entry| self.destroyEntry(entry.*);
+        self.map.clearRetainingCapacity();
+    }
+};
@@ -4,8 +4,25 @@ const ArrayList = std.ArrayList;
 const StringHashMap = std.StringHashMap;
 
 const Value = @import("../forthic/value.zig").Value;
+const utils = @import("../forthic/utils.zig");
 const c_bindings = @import("c_bindings.zig");
 
+// =============================================================================
+// Options
+// =============================================================================
+
+/// How temporal values are encoded on the wire
+pub const TemporalEncoding = enum {
+    /// ISO 8601 strings - understood by every runtime
+    iso8601,
+    /// Integer epoch fields - only once the peer has advertised support
+    compact,
+};
+
+pub const SerializeOptions = struct {
+    temporal_encoding: TemporalEncoding = .iso8601,
+};
+
 // =============================================================================
 // Serialization: Forthic Value -> C StackValue
 // =============================================================================
@@ -13,24 +30,26 @@ const c_bindings = @import("c_bindings.zig");
 /// Serialize a Forthic Value to a C StackValue for gRPC transmission
 /// Caller must call c_bindings.stackValueDestroy() on the returned value
 pub fn serializeValue(allocator: Allocator, value: Value) !?*c_bindings.StackValue {
+    return serializeValueWithOptions(allocator, value, .{});
+}
+
+/// Serialize a Forthic Value using the given wire options
+/// Caller must call c_bindings.stackValueDestroy() on the returned value
+pub fn serializeValueWithOptions(allocator: Allocator, value: Value, options: SerializeOptions) !?*c_bindings.StackValue {
     return switch (value) {
         .null_value => c_bindings.stackValueCreateNull(),
         .bool_value => |b| c_bindings.stackValueCreateBool(b),
         .int_value => |i| c_bindings.stackValueCreateInt(i),
         .float_value => |f| c_bindings.stackValueCreateFloat(f),
-        .string_value => |s| blk: {
-            // Need null-terminated string for C
-            const c_str = try allocator.dupeZ(u8, s);
-            defer allocator.free(c_str);
-            break :blk c_bindings.stackValueCreateString(c_str.ptr);
-        },
-        .array_value => |arr| try serializeArray(allocator, arr),
-        .record_value => |rec| try serializeRecord(allocator, rec),
-        .datetime_value => |dt| try serializeDateTime(allocator, dt),
+        .string_value => |s| c_bindings.stackValueCreateString(s),
+        .array_value => |arr| try serializeArray(allocator, arr, options),
+        .record_value => |rec| try serializeRecord(allocator, rec, options),
+        .datetime_value => |dt| try serializeDateTime(dt, options),
+        .remote_ref_value => |ref| c_bindings.stackValueCreateRemoteRef(ref.handle_id, ref.runtime),
     };
 }
 
-fn serializeArray(allocator: Allocator, arr: ArrayList(Value)) !?*c_bindings.StackValue {
+fn serializeArray(allocator: Allocator, arr: ArrayList(Value), options: SerializeOptions) !?*c_bindings.StackValue {
     // Serialize each item
     var items = try allocator.alloc(?*c_bindings.StackValue, arr.items.len);
     defer allocator.free(items);
@@ -44,7 +63,7 @@ fn serializeArray(allocator: Allocator, arr: ArrayList(Value)) !?*c_bindings.Sta
     }
 
     for (arr.items, 0..) |item, i| {
-        items[i] = try serializeValue(allocator, item);
+        items[i] = try serializeValueWithOptions(allocator, item, options);
         serialized_count += 1;
     }
 
@@ -66,65 +85,47 @@ fn serializeArray(allocator: Allocator, arr: ArrayList(Value)) !?*c_bindings.Sta
     return result;
 }
 
-fn serializeRecord(allocator: Allocator, rec: StringHashMap(Value)) !?*c_bindings.StackValue {
-    // For now, serialize record as an array of [key, value] pairs
-    // This matches the pattern from other Forthic implementations
-
-    // Create array to hold key-value pairs
-    var pairs = ArrayList(?*c_bindings.StackValue).init(allocator);
-    defer pairs.deinit();
+fn serializeRecord(allocator: Allocator, rec: StringHashMap(Value), options: SerializeOptions) !?*c_bindings.StackValue {
+    // Records use the native RecordValue map, matching the other Forthic runtimes
+    const record = c_bindings.stackValueCreateRecord() orelse return error.SerializationFailed;
+    errdefer c_bindings.stackValueDestroy(record);
 
     var iter = rec.iterator();
-    errdefer {
-        // Clean up on error
-        for (pairs.items) |pair| {
-            if (pair) |sv| c_bindings.stackValueDestroy(sv);
-        }
-    }
-
     while (iter.next()) |entry| {
-        // Create key-value pair as a 2-element array
-        const key_str = try allocator.dupeZ(u8, entry.key_ptr.*);
-        defer allocator.free(key_str);
-
-        const key_sv = c_bindings.stackValueCreateString(key_str.ptr) orelse return error.SerializationFailed;
-        const value_sv = try serializeValue(allocator, entry.value_ptr.*) orelse return error.SerializationFailed;
-
-        const pair_items = [_]*const c_bindings.StackValue{ key_sv, value_sv };
-        const pair_sv = c_bindings.stackValueCreateArray(&pair_items, 2);
-
-        // Clean up intermediate values
-        c_bindings.stackValueDestroy(key_sv);
-        c_bindings.stackValueDestroy(value_sv);
+        const field_sv = try serializeValueWithOptions(allocator, entry.value_ptr.*, options) orelse return error.SerializationFailed;
 
-        try pairs.append(pair_sv);
+        // The record takes ownership of field_sv
+        c_bindings.stackValueRecordInsert(record, entry.key_ptr.*, field_sv) catch return error.SerializationFailed;
     }
 
-    // Convert to const slice for C API
-    const pairs_const = try allocator.alloc(*const c_bindings.StackValue, pairs.items.len);
-    defer allocator.free(pairs_const);
-
-    for (pairs.items, 0..) |pair, i| {
-        pairs_const[i] = pair orelse return error.SerializationFailed;
-    }
-
-    const result = c_bindings.stackValueCreateArray(pairs_const, pairs.items.len);
-
-    // Clean up intermediate pairs
-    for (pairs.items) |pair| {
-        if (pair) |sv| c_bindings.stackValueDestroy(sv);
-    }
-
-    return result;
+    return record;
 }
 
-fn serializeDateTime(allocator: Allocator, dt: anytype) !?*c_bindings.StackValue {
-    // For now, serialize datetime as ISO8601 string
-    // TODO: Use proper instant_value once protobuf support is added
-    _ = allocator;
-    _ = dt;
-    // Placeholder: return null for now
-    return c_bindings.stackValueCreateNull();
+fn serializeDateTime(dt: utils.DateTime, options: SerializeOptions) !?*c_bindings.StackValue {
+    // utils.DateTime carries no timezone, so it travels as a UTC instant
+    switch (options.temporal_encoding) {
+        .compact => {
+            const nanos = std.math.mul(i64, utils.dateTimeToEpochSeconds(dt), std.time.ns_per_s) catch {
+                return error.SerializationFailed;
+            };
+            return c_bindings.stackValueCreateInstantNanos(nanos);
+        },
+        .iso8601 => {
+            // ISO 8601 expanded years: the sign goes before the zero-padded digits
+            const sign: []const u8 = if (dt.year < 0) "-" else if (dt.year > 9999) "+" else "";
+            var buf: [32]u8 = undefined;
+            const iso = std.fmt.bufPrint(&buf, "{s}{d:0>4}-{d:0>2}-{d:0>2}T{d:0>2}:{d:0>2}:{d:0>2}Z", .{
+                sign,
+                @abs(dt.year),
+                dt.month,
+                dt.day,
+                dt.hour,
+                dt.minute,
+                dt.second,
+            }) catch return error.SerializationFailed;
+            return c_bindings.stackValueCreateInstantIso(iso);
+        },
+    }
 }
 
 // =============================================================================
@@ -142,50 +143,73 @@ pub fn deserializeValue(allocator: Allocator, stack_value: *const c_bindings.Sta
         c_bindings.STACK_VALUE_INT => Value.initInt(c_bindings.stackValueGetInt(stack_value)),
         c_bindings.STACK_VALUE_FLOAT => Value.initFloat(c_bindings.stackValueGetFloat(stack_value)),
         c_bindings.STACK_VALUE_STRING => blk: {
-            const c_str = c_bindings.stackValueGetString(stack_value);
-            const str = try allocator.dupe(u8, std.mem.span(c_str));
+            const str = try allocator.dupe(u8, c_bindings.stackValueGetStringSlice(stack_value));
             break :blk Value.initString(str);
         },
         c_bindings.STACK_VALUE_ARRAY => try deserializeArray(allocator, stack_value),
         c_bindings.STACK_VALUE_RECORD => try deserializeRecord(allocator, stack_value),
-        c_bindings.STACK_VALUE_INSTANT,
-        c_bindings.STACK_VALUE_PLAIN_DATE,
-        c_bindings.STACK_VALUE_ZONED_DATETIME,
-        => {
-            // TODO: Implement proper datetime deserialization
-            return Value.initNull();
-        },
+        c_bindings.STACK_VALUE_INSTANT => Value.initDateTime(try deserializeInstant(stack_value)),
+        c_bindings.STACK_VALUE_PLAIN_DATE => Value.initDateTime(try deserializePlainDate(stack_value)),
+        c_bindings.STACK_VALUE_ZONED_DATETIME => Value.initDateTime(try deserializeZonedDateTime(stack_value)),
+        c_bindings.STACK_VALUE_REMOTE_REF => try deserializeRemoteRef(allocator, stack_value),
         else => error.UnknownStackValueType,
     };
 }
 
+// Temporal values prefer the compact epoch fields and fall back to ISO 8601
+
+fn deserializeInstant(stack_value: *const c_bindings.StackValue) !utils.DateTime {
+    if (c_bindings.stackValueGetInstantNanos(stack_value)) |nanos| {
+        return utils.dateTimeFromEpochSeconds(@divFloor(nanos, std.time.ns_per_s));
+    }
+    return utils.parseDateTimeUtc(c_bindings.stackValueGetInstantIso(stack_value)) catch error.InvalidDateTimeFormat;
+}
+
+fn deserializePlainDate(stack_value: *const c_bindings.StackValue) !utils.DateTime {
+    if (c_bindings.stackValueGetPlainDateDays(stack_value)) |days| {
+        return utils.civilFromDays(days);
+    }
+    return utils.parseIsoDate(c_bindings.stackValueGetPlainDateIso(stack_value)) catch error.InvalidDateTimeFormat;
+}
+
+/// Zoned date-times are normalized to UTC (utils.DateTime has no timezone)
+fn deserializeZonedDateTime(stack_value: *const c_bindings.StackValue) !utils.DateTime {
+    if (c_bindings.stackValueGetZonedDateTimeNanos(stack_value)) |nanos| {
+        return utils.dateTimeFromEpochSeconds(@divFloor(nanos, std.time.ns_per_s));
+    }
+    return utils.parseDateTimeUtc(c_bindings.stackValueGetZonedDateTimeIso(stack_value)) catch error.InvalidDateTimeFormat;
+}
+
+fn deserializeRemoteRef(allocator: Allocator, stack_value: *const c_bindings.StackValue) !Value {
+    const handle_id = try allocator.dupe(u8, c_bindings.stackValueGetRemoteRefHandle(stack_value));
+    errdefer allocator.free(handle_id);
+    const runtime = try allocator.dupe(u8, c_bindings.stackValueGetRemoteRefRuntime(stack_value));
+    return Value.initRemoteRef(handle_id, runtime);
+}
+
 fn deserializeArray(allocator: Allocator, stack_value: *const c_bindings.StackValue) !Value {
-    var array_items = c_bindings.stackValueGetArray(stack_value);
-    defer array_items.deinit();
+    // Borrow items straight out of the parent message - no per-item copies
+    const view = c_bindings.stackValueGetArrayView(stack_value);
 
-    var arr = ArrayList(Value).init(allocator);
+    var arr: ArrayList(Value) = .{};
     errdefer {
         for (arr.items) |*item| {
             item.deinit(allocator);
         }
-        arr.deinit();
+        arr.deinit(allocator);
     }
 
-    try arr.ensureTotalCapacity(allocator, array_items.len);
+    try arr.ensureTotalCapacity(allocator, view.len);
 
-    for (array_items.items) |item| {
-        const value = try deserializeValue(allocator, item);
-        try arr.append(allocator, value);
+    for (0..view.len) |i| {
+        const value = try deserializeValue(allocator, view.at(i));
+        arr.appendAssumeCapacity(value);
     }
 
     return Value{ .array_value = arr };
 }
 
 fn deserializeRecord(allocator: Allocator, stack_value: *const c_bindings.StackValue) !Value {
-    // Record is serialized as an array of [key, value] pairs
-    var array_items = c_bindings.stackValueGetArray(stack_value);
-    defer array_items.deinit();
-
     var rec = StringHashMap(Value).init(allocator);
     errdefer {
         var iter = rec.iterator();
@@ -196,27 +220,16 @@ fn deserializeRecord(allocator: Allocator, stack_value: *const c_bindings.StackV
         rec.deinit();
     }
 
-    for (array_items.items) |pair_sv| {
-        // Each pair should be a 2-element array [key, value]
-        var pair_items = c_bindings.stackValueGetArray(pair_sv);
-        defer pair_items.deinit();
+    try rec.ensureTotalCapacity(@intCast(c_bindings.stackValueGetRecordLen(stack_value)));
 
-        if (pair_items.len != 2) {
-            return error.InvalidRecordFormat;
-        }
-
-        // Get key (should be string)
-        const key_type = c_bindings.stackValueGetType(pair_items.items[0]);
-        if (key_type != c_bindings.STACK_VALUE_STRING) {
-            return error.InvalidRecordKeyType;
-        }
+    var fields = c_bindings.stackValueGetRecordIterator(stack_value) orelse return error.InvalidRecordFormat;
+    defer fields.deinit();
 
-        const c_key = c_bindings.stackValueGetString(pair_items.items[0]);
-        const key = try allocator.dupe(u8, std.mem.span(c_key));
+    while (fields.next()) |field| {
+        const key = try allocator.dupe(u8, field.key);
         errdefer allocator.free(key);
 
-        // Get value
-        const value = try deserializeValue(allocator, pair_items.items[1]);
+        var value = try deserializeValue(allocator, field.value);
         errdefer value.deinit(allocator);
 
         try rec.put(key, value);
@@ -231,7 +244,7 @@ fn deserializeRecord(allocator: Allocator, stack_value: *const c_bindings.StackV
 
 /// Serialize a slice of Values to a slice of StackValues
 /// Caller must call freeStackValueArray() on the returned slice
-pub fn serializeValueSlice(allocator: Allocator, values: []const Value) ![]?*c_bindings.StackValue {
+pub fn serializeValueSlice(allocator: Allocator, values: []const Value, options: SerializeOptions) ![]?*c_bindings.StackValue {
     var stack_values = try allocator.alloc(?*c_bindings.StackValue, values.len);
     errdefer allocator.free(stack_values);
 
@@ -243,7 +256,7 @@ pub fn serializeValueSlice(allocator: Allocator, values: []const Value) ![]?*c_b
     }
 
     for (values, 0..) |value, i| {
-        stack_values[i] = try serializeValue(allocator, value);
+        stack_values[i] = try serializeValueWithOptions(allocator, value, options);
         serialized_count += 1;
     }
 
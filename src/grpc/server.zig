@@ -0,0 +1,331 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+const Interpreter = @import("../forthic/interpreter.zig").Interpreter;
+const InterpreterPool = @import("../forthic/interpreter_pool.zig").InterpreterPool;
+const c_bindings = @import("c_bindings.zig");
+const serializer = @import("serializer.zig");
+const sequence_cache = @import("sequence_cache.zig");
+const SequenceCache = sequence_cache.SequenceCache;
+const Word = @import("../forthic/word.zig").Word;
+
+pub const SequenceCacheStats = sequence_cache.SequenceCacheStats;
+pub const ServerStats = c_bindings.GrpcServerStats;
+
+/// Reported as ErrorInfo.runtime for failed words
+const runtime_name = "zig";
+
+// =============================================================================
+// GrpcServer
+// =============================================================================
+
+/// Serves words from Zig interpreters over gRPC (ExecuteWord, ExecuteSequence
+/// and ExecuteStream)
+///
+/// Every session - one per ExecuteStream call, one per unary ExecuteWord
+/// call - gets its own Interpreter, so sessions never share a stack.
+/// Interpreters come from an InterpreterPool: the setup hook runs once per
+/// pooled interpreter, and a finished session is reset rather than torn
+/// down. Sessions run on gRPC server threads: the allocator and anything the
+/// setup hook shares between interpreters must be thread-safe.
+///
+/// ExecuteSequence word lists are compiled once and reused by later
+/// requests for the same list (see SequenceCache).
+///
+/// Under overload the server sheds requests with RESOURCE_EXHAUSTED rather
+/// than letting them queue without bound (see Limits).
+pub const GrpcServer = struct {
+    allocator: Allocator,
+    c_server: *c_bindings.GrpcServer,
+    pool: InterpreterPool,
+    sequences: SequenceCache,
+    instruction_budget: ?u64,
+
+    const Self = @This();
+
+    /// Prepares each session interpreter (register and import modules, ...)
+    /// setupFn may return per-interpreter state, handed back to teardownFn
+    pub const SessionSetup = InterpreterPool.Setup;
+
+    /// Interpreters built at init and kept idle between sessions
+    pub const session_pool_size = 4;
+
+    /// Admission limits; zero means unlimited
+    pub const Limits = struct {
+        /// Requests executing at once (an open stream counts as one)
+        max_in_flight: u32 = 0,
+        /// Requests waiting for a slot, each up to its deadline; more fail
+        /// right away
+        max_queued: u32 = 0,
+        /// Largest request message, in bytes, shared-memory stacks included
+        /// (0 = gRPC's 4 MiB default)
+        max_request_bytes: u32 = 0,
+        /// Words one request may execute, nested words included; unary
+        /// requests that run out fail with RESOURCE_EXHAUSTED, stream
+        /// requests with an InstructionBudgetExceeded remote error
+        instruction_budget: ?u64 = null,
+    };
+
+    const Session = InterpreterPool.Pooled;
+
+    /// Create a server for the given port (0 picks a free port, see getPort)
+    /// Heap-allocated: the C server keeps a pointer to it
+    pub fn init(allocator: Allocator, port: u16, setup: SessionSetup) !*Self {
+        return initServer(allocator, try c_bindings.grpcServerCreate(port), setup);
+    }
+
+    /// Create a server on an explicit address
+    /// "unix:/path/to.sock" serves runtimes on the same host over a Unix
+    /// domain socket, skipping the TCP loopback stack. "inproc:name" opens no
+    /// socket: clients in this process reach it through gRPC's in-process
+    /// transport, which leaves only marshaling and dispatch to measure.
+    /// Destroy those clients before the server.
+    pub fn initAddress(allocator: Allocator, address: []const u8, setup: SessionSetup) !*Self {
+        return initServer(allocator, try c_bindings.grpcServerCreateAddress(address), setup);
+    }
+
+    fn initServer(allocator: Allocator, c_server: *c_bindings.GrpcServer, setup: SessionSetup) !*Self {
+        errdefer c_bindings.grpcServerDestroy(c_server);
+
+        const self = try allocator.create(Self);
+        errdefer allocator.destroy(self);
+
+        self.* = Self{
+            .allocator = allocator,
+            .c_server = c_server,
+            .pool = try InterpreterPool.init(allocator, session_pool_size, setup),
+            .sequences = SequenceCache.init(allocator, .{}),
+            .instruction_budget = null,
+        };
+        errdefer {
+            self.sequences.deinit();
+            self.pool.deinit();
+        }
+
+        const handler = c_bindings.GrpcServerHandler{
+            .user_data = self,
+            .session_create = &sessionCreate,
+            .session_destroy = &sessionDestroy,
+            .execute = &execute,
+            .execute_sequence = &executeSequence,
+        };
+        try c_bindings.grpcServerSetHandler(c_server, &handler);
+
+        return self;
+    }
+
+    /// Stops the server if it is running
+    pub fn deinit(self: *Self) void {
+        c_bindings.grpcServerDestroy(self.c_server);
+        self.sequences.deinit();
+        self.pool.deinit();
+        self.allocator.destroy(self);
+    }
+
+    /// Set admission limits (before start)
+    pub fn setLimits(self: *Self, limits: Limits) c_bindings.GrpcError!void {
+        const c_limits = c_bindings.GrpcServerLimits{
+            .max_in_flight = limits.max_in_flight,
+            .max_queued = limits.max_queued,
+            .max_request_bytes = limits.max_request_bytes,
+        };
+        try c_bindings.grpcServerSetLimits(self.c_server, &c_limits);
+        self.instruction_budget = limits.instruction_budget;
+    }
+
+    /// Queue depth and admission counters
+    pub fn stats(self: *const Self) ServerStats {
+        return c_bindings.grpcServerGetStats(self.c_server);
+    }
+
+    /// Start serving (non-blocking)
+    pub fn start(self: *Self) c_bindings.GrpcError!void {
+        try c_bindings.grpcServerStart(self.c_server);
+    }
+
+    /// Stop serving; open streams are cancelled after a short grace period
+    pub fn stop(self: *Self) c_bindings.GrpcError!void {
+        try c_bindings.grpcServerStop(self.c_server);
+    }
+
+    /// Port after start (0 when listening on a Unix domain socket)
+    pub fn getPort(self: *const Self) u16 {
+        return c_bindings.grpcServerGetPort(self.c_server);
+    }
+
+    /// Drop compiled ExecuteSequence word lists, e.g. after changing what
+    /// the setup hook installs without changing the dictionary's shape
+    pub fn invalidateSequences(self: *Self) void {
+        self.sequences.invalidate();
+    }
+
+    pub fn sequenceCacheStats(self: *Self) SequenceCacheStats {
+        return self.sequences.getStats();
+    }
+
+    // =========================================================================
+    // Handler callbacks (called from gRPC server threads)
+    // =========================================================================
+
+    fn sessionCreate(user_data: ?*anyopaque) callconv(.c) ?*anyopaque {
+        const self: *Self = @ptrCast(@alignCast(user_data.?));
+        return self.pool.acquire() catch null;
+    }
+
+    fn sessionDestroy(user_data: ?*anyopaque, session_ptr: ?*anyopaque) callconv(.c) void {
+        const self: *Self = @ptrCast(@alignCast(user_data.?));
+        const session: *Session = @ptrCast(@alignCast(session_ptr.?));
+        self.pool.release(session);
+    }
+
+    fn execute(
+        user_data: ?*anyopaque,
+        session_ptr: ?*anyopaque,
+        word_name: [*c]const u8,
+        word_name_len: usize,
+        push: [*c]const ?*const c_bindings.StackValue,
+        push_len: usize,
+        return_count: i64,
+        compact_temporal: bool,
+        out_results: [*c][*c]?*c_bindings.StackValue,
+        out_results_len: [*c]usize,
+        out_session_depth: [*c]usize,
+        out_error: [*c]?*c_bindings.ErrorInfo,
+    ) callconv(.c) void {
+        const self: *Self = @ptrCast(@alignCast(user_data.?));
+        const session: *Session = @ptrCast(@alignCast(session_ptr.?));
+        const push_values: []const ?*const c_bindings.StackValue = if (push_len > 0) push[0..push_len] else &.{};
+
+        defer out_session_depth.* = session.interp.stack.length();
+        session.interp.setInstructionBudget(self.instruction_budget);
+
+        const results = self.runWord(
+            &session.interp,
+            word_name[0..word_name_len],
+            push_values,
+            return_count,
+            compact_temporal,
+        ) catch |err| {
+            out_error.* = c_bindings.errorInfoCreate(@errorName(err), runtime_name, @errorName(err));
+            return;
+        };
+
+        out_results.* = results.ptr;
+        out_results_len.* = results.len;
+    }
+
+    fn executeSequence(
+        user_data: ?*anyopaque,
+        session_ptr: ?*anyopaque,
+        word_names: [*c]const [*c]const u8,
+        word_name_lens: [*c]const usize,
+        word_count: usize,
+        push: [*c]const ?*const c_bindings.StackValue,
+        push_len: usize,
+        compact_temporal: bool,
+        out_results: [*c][*c]?*c_bindings.StackValue,
+        out_results_len: [*c]usize,
+        out_error: [*c]?*c_bindings.ErrorInfo,
+    ) callconv(.c) void {
+        const self: *Self = @ptrCast(@alignCast(user_data.?));
+        const session: *Session = @ptrCast(@alignCast(session_ptr.?));
+        const push_values: []const ?*const c_bindings.StackValue = if (push_len > 0) push[0..push_len] else &.{};
+        session.interp.setInstructionBudget(self.instruction_budget);
+
+        const results = self.runSequence(&session.interp, word_names, word_name_lens, word_count, push_values, compact_temporal) catch |err| {
+            out_error.* = c_bindings.errorInfoCreate(@errorName(err), runtime_name, @errorName(err));
+            return;
+        };
+
+        out_results.* = results.ptr;
+        out_results_len.* = results.len;
+    }
+
+    /// Push, run, then pop the top return_count values (all if negative)
+    fn runWord(
+        self: *Self,
+        interp: *Interpreter,
+        word_name: []const u8,
+        push: []const ?*const c_bindings.StackValue,
+        return_count: i64,
+        compact_temporal: bool,
+    ) ![]?*c_bindings.StackValue {
+        for (push) |stack_value| {
+            var value = try serializer.deserializeValue(self.allocator, stack_value orelse return error.InvalidArgument);
+            errdefer value.deinit(self.allocator);
+            try interp.stackPush(value);
+        }
+
+        try interp.run(word_name);
+        return self.popResults(interp, return_count, compact_temporal);
+    }
+
+    /// Push, run the words in order, then pop the whole stack
+    fn runSequence(
+        self: *Self,
+        interp: *Interpreter,
+        word_names: [*c]const [*c]const u8,
+        word_name_lens: [*c]const usize,
+        word_count: usize,
+        push: []const ?*const c_bindings.StackValue,
+        compact_temporal: bool,
+    ) ![]?*c_bindings.StackValue {
+        const names = try self.allocator.alloc([]const u8, word_count);
+        defer self.allocator.free(names);
+        for (names, 0..) |*name, i| {
+            name.* = word_names[i][0..word_name_lens[i]];
+        }
+
+        for (push) |stack_value| {
+            var value = try serializer.deserializeValue(self.allocator, stack_value orelse return error.InvalidArgument);
+            errdefer value.deinit(self.allocator);
+            try interp.stackPush(value);
+        }
+
+        const words = try self.allocator.alloc(?Word, word_count);
+        defer self.allocator.free(words);
+        const shape = try self.sequences.resolve(interp, names, words);
+
+        // A word that reshapes the dictionary leaves the rest to findWord
+        var compiled = true;
+        for (names, words) |name, maybe_word| {
+            if (compiled and maybe_word != null) {
+                try maybe_word.?.execute(interp);
+            } else {
+                try interp.run(name);
+            }
+            if (compiled and SequenceCache.shapeOf(interp) != shape) compiled = false;
+        }
+
+        return self.popResults(interp, -1, compact_temporal);
+    }
+
+    /// Pop the top return_count values (all if negative) as StackValues
+    fn popResults(
+        self: *Self,
+        interp: *Interpreter,
+        return_count: i64,
+        compact_temporal: bool,
+    ) ![]?*c_bindings.StackValue {
+        const items = interp.stack.items.items;
+        const count: usize = if (return_count < 0) items.len else @intCast(return_count);
+        if (count > items.len) {
+            return error.StackUnderflow;
+        }
+        const base = items.len - count;
+
+        const results = c_bindings.stackValueArrayAlloc(count) orelse return error.OutOfMemory;
+        errdefer c_bindings.stackValueArrayFree(results);
+
+        const options = serializer.SerializeOptions{
+            .temporal_encoding = if (compact_temporal) .compact else .iso8601,
+        };
+        for (items[base..], 0..) |value, i| {
+            results[i] = try serializer.serializeValueWithOptions(self.allocator, value, options) orelse
+                return error.SerializationFailed;
+        }
+
+        interp.stack.truncate(base);
+        return results;
+    }
+};
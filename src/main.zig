@@ -9,11 +9,15 @@ pub const word = @import("forthic/word.zig");
 pub const variable = @import("forthic/variable.zig");
 pub const module = @import("forthic/module.zig");
 pub const interpreter = @import("forthic/interpreter.zig");
+pub const interpreter_pool = @import("forthic/interpreter_pool.zig");
+pub const word_table = @import("forthic/word_table.zig");
+pub const image = @import("forthic/image.zig");
 pub const value = @import("forthic/value.zig");
 
 // Re-export commonly used types
 pub const Value = value.Value;
 pub const Interpreter = interpreter.Interpreter;
+pub const InterpreterPool = interpreter_pool.InterpreterPool;
 pub const Module = module.Module;
 pub const Variable = variable.Variable;
 pub const WordOptions = word_options.WordOptions;
@@ -37,14 +41,20 @@ pub const grpc = struct {
     pub const c_bindings = @import("grpc/c_bindings.zig");
     pub const serializer = @import("grpc/serializer.zig");
     pub const client = @import("grpc/client.zig");
+    pub const result_cache = @import("grpc/result_cache.zig");
+    pub const sequence_cache = @import("grpc/sequence_cache.zig");
+    pub const manifest_cache = @import("grpc/manifest_cache.zig");
     pub const remote_word = @import("grpc/remote_word.zig");
     pub const remote_module = @import("grpc/remote_module.zig");
     pub const runtime_manager = @import("grpc/runtime_manager.zig");
+    pub const server = @import("grpc/server.zig");
+    pub const grpc_module = @import("grpc/grpc_module.zig");
 
     pub const GrpcClient = client.GrpcClient;
     pub const RemoteWord = remote_word.RemoteWord;
     pub const RemoteModule = remote_module.RemoteModule;
     pub const RuntimeManager = runtime_manager.RuntimeManager;
+    pub const GrpcServer = server.GrpcServer;
 };
 
 test {
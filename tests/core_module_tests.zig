@@ -1,7 +1,11 @@
 const std = @import("std");
 const testing = std.testing;
 const Interpreter = @import("forthic").Interpreter;
+const InterpreterPool = @import("forthic").InterpreterPool;
+const image = @import("forthic").image;
 const Value = @import("forthic").Value;
+const Word = @import("forthic").word.Word;
+const ModuleWord = @import("forthic").word.ModuleWord;
 const CoreModule = @import("forthic").modules.standard.CoreModule;
 const MathModule = @import("forthic").modules.standard.MathModule;
 
@@ -509,3 +513,239 @@ test "Core: INTERPRET with Variables" {
     defer result.deinit(allocator);
     try testing.expectEqual(@as(i64, 30), result.int_value);
 }
+
+// ========================================
+// Static Word Tables
+// ========================================
+
+test "WordTable: imports share the standard modules' static words" {
+    const allocator = testing.allocator;
+    var ctx = try setupCoreInterpreter(allocator);
+    defer ctx.deinit();
+
+    const app = ctx.interp.getAppModule();
+    try testing.expectEqual(@as(usize, 0), app.words.items.len);
+    try testing.expectEqual(@as(usize, 2), app.imported_tables.items.len);
+
+    const dup = ctx.core_mod.module.findDictionaryWord("DUP").?;
+    try testing.expectEqualStrings("DUP", dup.getName());
+    try testing.expectEqual(dup.ptr, app.findDictionaryWord("DUP").?.ptr);
+    try testing.expect(ctx.core_mod.module.findDictionaryWord("NO-SUCH-WORD") == null);
+
+    try ctx.interp.run("3 DUP *");
+    var result = try ctx.interp.stackPop();
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(i64, 9), result.int_value);
+}
+
+test "WordTable: lookup follows insertion order across words and imported tables" {
+    const allocator = testing.allocator;
+
+    var interp = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+    const core_mod = try CoreModule.init(allocator);
+    defer core_mod.deinit();
+    const math_mod = try MathModule.init(allocator);
+    defer math_mod.deinit();
+    try interp.registerModule(&core_mod.module);
+    try interp.registerModule(&math_mod.module);
+    try interp.curModule().importModule("", &core_mod.module, &interp);
+
+    // A table imported after a definition shadows it...
+    try interp.run(": + 100 ;");
+    try interp.curModule().importModule("", &math_mod.module, &interp);
+    try interp.run("1 2 +");
+    const sum = try interp.stackPop();
+    try testing.expectEqual(@as(i64, 3), sum.int_value);
+
+    // ...and a later definition shadows the table
+    try interp.run(": + 7 ; +");
+    const seven = try interp.stackPop();
+    try testing.expectEqual(@as(i64, 7), seven.int_value);
+}
+
+test "WordTable: static words reject error handlers" {
+    const allocator = testing.allocator;
+    var ctx = try setupCoreInterpreter(allocator);
+    defer ctx.deinit();
+
+    const Handler = struct {
+        fn ignore(_: anyerror, _: *Word, _: *Interpreter) anyerror!void {}
+    };
+    const dup = ctx.interp.getAppModule().findDictionaryWord("DUP").?;
+    const module_word: *ModuleWord = @ptrCast(@alignCast(dup.ptr));
+    try testing.expectError(error.StaticWord, module_word.addErrorHandler(&Handler.ignore));
+    try testing.expectEqual(@as(usize, 0), module_word.error_handlers.items.len);
+}
+
+// ========================================
+// Interpreter Pool
+// ========================================
+
+const PoolModules = struct {
+    core_mod: *CoreModule,
+    math_mod: *MathModule,
+
+    fn setup(_: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+        const allocator = interp.allocator;
+        const self = try allocator.create(PoolModules);
+        errdefer allocator.destroy(self);
+
+        self.core_mod = try CoreModule.init(allocator);
+        self.math_mod = try MathModule.init(allocator);
+        try interp.registerModule(&self.core_mod.module);
+        try interp.registerModule(&self.math_mod.module);
+        try interp.curModule().importModule("", &self.core_mod.module, interp);
+        try interp.curModule().importModule("", &self.math_mod.module, interp);
+        return self;
+    }
+
+    fn teardown(_: ?*anyopaque, interp: *Interpreter, state: ?*anyopaque) void {
+        const self: *PoolModules = @ptrCast(@alignCast(state orelse return));
+        self.core_mod.deinit();
+        self.math_mod.deinit();
+        interp.allocator.destroy(self);
+    }
+};
+
+test "InterpreterPool: released interpreters return to their post-setup state" {
+    const allocator = testing.allocator;
+    var pool = try InterpreterPool.init(allocator, 1, .{
+        .setupFn = PoolModules.setup,
+        .teardownFn = PoolModules.teardown,
+    });
+    defer pool.deinit();
+
+    const first = try pool.acquire();
+    const word_count = first.interp.getAppModule().words.items.len;
+    try first.interp.run("[\"x\"] VARIABLES 24 \"x\" ! 1 2 + {");
+    try testing.expectEqual(@as(usize, 2), first.interp.module_stack.items.len);
+    pool.release(first);
+
+    const second = try pool.acquire();
+    defer pool.release(second);
+    try testing.expectEqual(first, second);
+    try testing.expectEqual(@as(usize, 0), second.interp.stack.length());
+    try testing.expectEqual(@as(usize, 1), second.interp.module_stack.items.len);
+    try testing.expectEqual(word_count, second.interp.getAppModule().words.items.len);
+    try testing.expect(second.interp.getAppModule().getVariable("x") == null);
+
+    try second.interp.run("3 4 +");
+    var result = try second.interp.stackPop();
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(i64, 7), result.int_value);
+
+    const stats = pool.getStats();
+    try testing.expectEqual(@as(u64, 1), stats.created);
+    try testing.expectEqual(@as(u64, 1), stats.reused);
+}
+
+const ConfigModules = struct {
+    fn setup(ctx: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+        const state = try PoolModules.setup(ctx, interp);
+        try interp.run("{cfg [\"count\"] VARIABLES 1 \"count\" ! @: STAMP \"count\" @ 10 * ; }");
+        return state;
+    }
+};
+
+test "InterpreterPool: module variables and memos do not leak into the next session" {
+    const allocator = testing.allocator;
+
+    var pool = try InterpreterPool.init(allocator, 1, .{
+        .setupFn = ConfigModules.setup,
+        .teardownFn = PoolModules.teardown,
+    });
+    defer pool.deinit();
+
+    const first = try pool.acquire();
+    try first.interp.run("{cfg 5 \"count\" ! STAMP POP }");
+    pool.release(first);
+
+    const second = try pool.acquire();
+    defer pool.release(second);
+    try testing.expectEqual(first, second);
+    try second.interp.run("{cfg STAMP \"count\" @ }");
+
+    var count = try second.interp.stackPop();
+    defer count.deinit(allocator);
+    var stamp = try second.interp.stackPop();
+    defer stamp.deinit(allocator);
+    try testing.expectEqual(@as(i64, 1), count.int_value);
+    try testing.expectEqual(@as(i64, 10), stamp.int_value);
+}
+
+test "InterpreterPool: words and modules a session creates are freed on release" {
+    const allocator = testing.allocator;
+    var pool = try InterpreterPool.init(allocator, 1, .{
+        .setupFn = PoolModules.setup,
+        .teardownFn = PoolModules.teardown,
+    });
+    defer pool.deinit();
+
+    for (0..4) |_| {
+        const pooled = try pool.acquire();
+        defer pool.release(pooled);
+        try testing.expectEqual(pooled.mark.created_word_count, pooled.interp.created_words.items.len);
+        try testing.expectEqual(pooled.mark.created_module_count, pooled.interp.created_modules.items.len);
+
+        try pooled.interp.run(": FOO 1 ; @: BAR \"bar\" ; {tmp : BAZ [FOO 2.5] ; } FOO BAR");
+        _ = try pooled.interp.findModule("tmp");
+
+        var bar = try pooled.interp.stackPop();
+        defer bar.deinit(allocator);
+        var foo = try pooled.interp.stackPop();
+        defer foo.deinit(allocator);
+        try testing.expectEqualStrings("bar", bar.string_value);
+        try testing.expectEqual(@as(i64, 1), foo.int_value);
+    }
+
+    try testing.expectEqual(@as(u64, 3), pool.getStats().reused);
+}
+
+// ========================================
+// Interpreter Image
+// ========================================
+
+test "Image: a loaded image runs definitions, memos and variables without recompiling" {
+    const allocator = testing.allocator;
+    var tmp = testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    var word_count: usize = 0;
+    {
+        var arena = std.heap.ArenaAllocator.init(allocator);
+        defer arena.deinit();
+        var ctx = try setupCoreInterpreter(arena.allocator());
+        defer ctx.deinit();
+
+        try ctx.interp.run(": DOUBLE 2 * ; @: ANSWER 40 2 + ; @: LATER [1 2] ; [\"x\"] VARIABLES 5 \"x\" ! ANSWER POP");
+        word_count = ctx.interp.getAppModule().words.items.len;
+        try image.save(ctx.interp, tmp.dir, "app.fimg");
+    }
+
+    var interp = try Interpreter.init(allocator);
+    try interp.fixupAfterMove();
+    const core_mod = try CoreModule.init(allocator);
+    defer core_mod.deinit();
+    const math_mod = try MathModule.init(allocator);
+    defer math_mod.deinit();
+    try interp.registerModule(&core_mod.module);
+    try interp.registerModule(&math_mod.module);
+
+    var loaded = try image.Image.load(&interp, tmp.dir, "app.fimg");
+    defer loaded.deinit();
+    defer interp.deinit();
+
+    try testing.expectEqual(word_count, interp.getAppModule().words.items.len);
+    try interp.run("3 DOUBLE ANSWER + \"x\" @ +");
+    var result = try interp.stackPop();
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(i64, 53), result.int_value);
+
+    // A memo first computed after load is freed with the image
+    try interp.run("LATER");
+    var later = try interp.stackPop();
+    defer later.deinit(allocator);
+    try testing.expectEqual(@as(usize, 2), later.array_value.items.len);
+}
@@ -43,6 +43,17 @@ test "c_bindings: create and read string stack value" {
     c_bindings.stackValueDestroy(value.?);
 }
 
+test "c_bindings: string with embedded NUL survives the C boundary" {
+    const data = "nul\x00inside";
+    const value = c_bindings.stackValueCreateString(data);
+    try testing.expect(value != null);
+    defer c_bindings.stackValueDestroy(value.?);
+
+    const slice = c_bindings.stackValueGetStringSlice(value.?);
+    try testing.expectEqual(data.len, slice.len);
+    try testing.expectEqualStrings(data, slice);
+}
+
 test "c_bindings: create and read bool stack value" {
     const value = c_bindings.stackValueCreateBool(true);
     try testing.expect(value != null);
@@ -88,6 +99,72 @@ test "c_bindings: create and destroy array stack value" {
     c_bindings.stackValueDestroy(item3.?);
 }
 
+test "c_bindings: borrowed array view and string slice" {
+    const item1 = c_bindings.stackValueCreateInt(7);
+    const item2 = c_bindings.stackValueCreateString("borrowed");
+
+    const items = [_]*const c_bindings.StackValue{ item1.?, item2.? };
+    const array = c_bindings.stackValueCreateArray(&items, items.len);
+    c_bindings.stackValueDestroy(item1.?);
+    c_bindings.stackValueDestroy(item2.?);
+    defer c_bindings.stackValueDestroy(array.?);
+
+    const view = c_bindings.stackValueGetArrayView(array.?);
+    try testing.expectEqual(@as(usize, 2), view.len);
+    try testing.expectEqual(@as(i64, 7), c_bindings.stackValueGetInt(view.at(0)));
+    try testing.expectEqualStrings("borrowed", c_bindings.stackValueGetStringSlice(view.at(1)));
+}
+
+test "c_bindings: create and iterate record stack value" {
+    const record = c_bindings.stackValueCreateRecord();
+    try testing.expect(record != null);
+    defer c_bindings.stackValueDestroy(record.?);
+
+    try c_bindings.stackValueRecordInsert(record.?, "answer", c_bindings.stackValueCreateInt(42).?);
+
+    try testing.expectEqual(c_bindings.STACK_VALUE_RECORD, c_bindings.stackValueGetType(record.?));
+    try testing.expectEqual(@as(usize, 1), c_bindings.stackValueGetRecordLen(record.?));
+
+    var fields = c_bindings.stackValueGetRecordIterator(record.?).?;
+    defer fields.deinit();
+
+    const field = fields.next().?;
+    try testing.expectEqualStrings("answer", field.key);
+    try testing.expectEqual(@as(i64, 42), c_bindings.stackValueGetInt(field.value));
+    try testing.expect(fields.next() == null);
+}
+
+test "c_bindings: create and read remote ref stack value" {
+    const ref = c_bindings.stackValueCreateRemoteRef("h-17", "python");
+    try testing.expect(ref != null);
+    defer c_bindings.stackValueDestroy(ref.?);
+
+    try testing.expectEqual(c_bindings.STACK_VALUE_REMOTE_REF, c_bindings.stackValueGetType(ref.?));
+    try testing.expectEqualStrings("h-17", c_bindings.stackValueGetRemoteRefHandle(ref.?));
+    try testing.expectEqualStrings("python", c_bindings.stackValueGetRemoteRefRuntime(ref.?));
+}
+
+test "c_bindings: argument hash ignores record field order" {
+    const a = c_bindings.stackValueCreateRecord().?;
+    defer c_bindings.stackValueDestroy(a);
+    try c_bindings.stackValueRecordInsert(a, "x", c_bindings.stackValueCreateInt(1).?);
+    try c_bindings.stackValueRecordInsert(a, "y", c_bindings.stackValueCreateInt(2).?);
+
+    const b = c_bindings.stackValueCreateRecord().?;
+    defer c_bindings.stackValueDestroy(b);
+    try c_bindings.stackValueRecordInsert(b, "y", c_bindings.stackValueCreateInt(2).?);
+    try c_bindings.stackValueRecordInsert(b, "x", c_bindings.stackValueCreateInt(1).?);
+
+    const c = c_bindings.stackValueCreateInt(3).?;
+    defer c_bindings.stackValueDestroy(c);
+
+    const args_a = [_]*const c_bindings.StackValue{ a, c };
+    const args_b = [_]*const c_bindings.StackValue{ b, c };
+    const args_c = [_]*const c_bindings.StackValue{ c, a };
+    try testing.expectEqual(c_bindings.stackValueArrayHash(&args_a), c_bindings.stackValueArrayHash(&args_b));
+    try testing.expect(c_bindings.stackValueArrayHash(&args_a) != c_bindings.stackValueArrayHash(&args_c));
+}
+
 // =============================================================================
 // Serializer Tests
 // =============================================================================
@@ -222,6 +299,120 @@ test "serializer: serialize and deserialize array" {
     try testing.expectEqual(@as(i64, 3), deserialized.array_value.items[2].int_value);
 }
 
+test "serializer: serialize and deserialize record" {
+    const allocator = testing.allocator;
+
+    var value = Value.initRecord(allocator);
+    defer value.deinit(allocator);
+    try value.record_value.put(try allocator.dupe(u8, "x"), Value.initInt(1));
+    try value.record_value.put(try allocator.dupe(u8, "name"), Value.initString(try allocator.dupe(u8, "forthic")));
+
+    const stack_value = try serializer.serializeValue(allocator, value);
+    defer if (stack_value) |sv| c_bindings.stackValueDestroy(sv);
+
+    try testing.expectEqual(c_bindings.STACK_VALUE_RECORD, c_bindings.stackValueGetType(stack_value.?));
+
+    var deserialized = try serializer.deserializeValue(allocator, stack_value.?);
+    defer deserialized.deinit(allocator);
+
+    try testing.expectEqual(@as(u32, 2), deserialized.record_value.count());
+    try testing.expectEqual(@as(i64, 1), deserialized.record_value.get("x").?.int_value);
+    try testing.expectEqualStrings("forthic", deserialized.record_value.get("name").?.string_value);
+}
+
+test "serializer: datetime round-trips through both temporal encodings" {
+    const allocator = testing.allocator;
+
+    const dt = forthic.utils.DateTime{ .year = 2025, .month = 1, .day = 15, .hour = 10, .minute = 30, .second = 5 };
+    const value = Value.initDateTime(dt);
+
+    inline for (.{ serializer.TemporalEncoding.iso8601, serializer.TemporalEncoding.compact }) |encoding| {
+        const stack_value = try serializer.serializeValueWithOptions(allocator, value, .{ .temporal_encoding = encoding });
+        defer if (stack_value) |sv| c_bindings.stackValueDestroy(sv);
+
+        try testing.expectEqual(c_bindings.STACK_VALUE_INSTANT, c_bindings.stackValueGetType(stack_value.?));
+        try testing.expectEqual(encoding == .compact, c_bindings.stackValueGetInstantNanos(stack_value.?) != null);
+
+        var deserialized = try serializer.deserializeValue(allocator, stack_value.?);
+        defer deserialized.deinit(allocator);
+
+        try testing.expect(deserialized.equals(&value));
+    }
+}
+
+test "serializer: temporal values from other runtimes" {
+    const allocator = testing.allocator;
+
+    // Zoned ISO string with an offset is normalized to UTC
+    const zoned = c_bindings.stackValueCreateZonedDateTimeIso("2025-01-15T10:30:00-05:00[America/New_York]", "America/New_York").?;
+    defer c_bindings.stackValueDestroy(zoned);
+    const zoned_dt = (try serializer.deserializeValue(allocator, zoned)).datetime_value;
+    try testing.expectEqual(@as(u8, 15), zoned_dt.hour);
+    try testing.expectEqual(@as(u8, 30), zoned_dt.minute);
+
+    // 2025-01-15 is 20103 days after the epoch
+    const date = c_bindings.stackValueCreatePlainDateDays(20103).?;
+    defer c_bindings.stackValueDestroy(date);
+    const date_dt = (try serializer.deserializeValue(allocator, date)).datetime_value;
+    try testing.expectEqual(@as(i32, 2025), date_dt.year);
+    try testing.expectEqual(@as(u8, 1), date_dt.month);
+    try testing.expectEqual(@as(u8, 15), date_dt.day);
+}
+
+test "serializer: ISO 8601 years outside 0000-9999 keep their sign" {
+    const allocator = testing.allocator;
+
+    const cases = .{
+        .{ forthic.utils.DateTime{ .year = -44, .month = 3, .day = 15, .hour = 12, .minute = 0, .second = 0 }, "-0044-03-15T12:00:00Z" },
+        .{ forthic.utils.DateTime{ .year = 12345, .month = 1, .day = 2, .hour = 3, .minute = 4, .second = 5 }, "+12345-01-02T03:04:05Z" },
+    };
+
+    inline for (cases) |case| {
+        const value = Value.initDateTime(case[0]);
+        const stack_value = try serializer.serializeValueWithOptions(allocator, value, .{ .temporal_encoding = .iso8601 });
+        defer if (stack_value) |sv| c_bindings.stackValueDestroy(sv);
+
+        try testing.expectEqualStrings(case[1], c_bindings.stackValueGetInstantIso(stack_value.?));
+
+        var deserialized = try serializer.deserializeValue(allocator, stack_value.?);
+        defer deserialized.deinit(allocator);
+
+        try testing.expect(deserialized.equals(&value));
+    }
+
+    const date = try forthic.utils.parseIsoDate("-0044-03-15");
+    try testing.expectEqual(@as(i32, -44), date.year);
+    try testing.expectEqual(@as(u8, 3), date.month);
+    try testing.expectEqual(@as(u8, 15), date.day);
+}
+
+test "serializer: UTC offsets must be +HH:MM or -HH:MM" {
+    const utc = try forthic.utils.parseDateTimeUtc("2025-01-15T10:30:00.250-05:00");
+    try testing.expectEqual(@as(u8, 15), utc.hour);
+    try testing.expectEqual(@as(u8, 30), utc.minute);
+
+    try testing.expectError(error.InvalidFormat, forthic.utils.parseDateTimeUtc("2025-01-15T10:30:00-0500"));
+    try testing.expectError(error.InvalidFormat, forthic.utils.parseDateTimeUtc("2025-01-15T10:30:00+05-00"));
+    try testing.expectError(error.InvalidFormat, forthic.utils.parseDateTimeUtc("25-01-15T10:30:00Z"));
+}
+
+test "serializer: remote refs round-trip untouched" {
+    const allocator = testing.allocator;
+
+    var value = Value.initRemoteRef(try allocator.dupe(u8, "df-1"), try allocator.dupe(u8, "python"));
+    defer value.deinit(allocator);
+
+    const stack_value = try serializer.serializeValue(allocator, value);
+    defer if (stack_value) |sv| c_bindings.stackValueDestroy(sv);
+
+    try testing.expectEqual(c_bindings.STACK_VALUE_REMOTE_REF, c_bindings.stackValueGetType(stack_value.?));
+
+    var deserialized = try serializer.deserializeValue(allocator, stack_value.?);
+    defer deserialized.deinit(allocator);
+
+    try testing.expect(deserialized.equals(&value));
+}
+
 // =============================================================================
 // Client Tests
 // =============================================================================
@@ -264,3 +455,1068 @@ test "client: helper constructors" {
         // Expected to fail without server
     }
 }
+
+// =============================================================================
+// Result Cache Tests
+// =============================================================================
+
+const ResultCache = forthic.grpc.result_cache.ResultCache;
+
+var fake_now_ms: i64 = 0;
+
+fn fakeClock() i64 {
+    return fake_now_ms;
+}
+
+/// The cached int under key, or null on a miss
+fn cachedInt(cache: *ResultCache, key: ResultCache.Key) !?i64 {
+    const values = (try cache.get(testing.allocator, key)) orelse return null;
+    defer forthic.grpc.result_cache.freeValues(testing.allocator, values);
+    return values[0].int_value;
+}
+
+test "result_cache: LRU eviction, TTL expiry and counters" {
+    const allocator = testing.allocator;
+
+    var cache = ResultCache.init(allocator, .{ .max_entries = 2, .ttl_ms = 1000 });
+    defer cache.deinit();
+    cache.clock = fakeClock;
+    fake_now_ms = 0;
+
+    const one = [_]Value{Value.initInt(1)};
+    const two = [_]Value{Value.initInt(2)};
+    const three = [_]Value{Value.initInt(3)};
+
+    try cache.put(.{ .word_name = "LOOKUP", .args_hash = 1 }, &one);
+    try cache.put(.{ .word_name = "LOOKUP", .args_hash = 2 }, &two);
+
+    // Touch 1 so that 2 becomes least recently used
+    try testing.expectEqual(@as(?i64, 1), try cachedInt(&cache, .{ .word_name = "LOOKUP", .args_hash = 1 }));
+    try cache.put(.{ .word_name = "LOOKUP", .args_hash = 3 }, &three);
+
+    try testing.expectEqual(@as(?i64, null), try cachedInt(&cache, .{ .word_name = "LOOKUP", .args_hash = 2 }));
+    try testing.expectEqual(@as(?i64, null), try cachedInt(&cache, .{ .word_name = "OTHER", .args_hash = 1 }));
+    try testing.expectEqual(@as(?i64, 3), try cachedInt(&cache, .{ .word_name = "LOOKUP", .args_hash = 3 }));
+
+    fake_now_ms = 1000;
+    try testing.expectEqual(@as(?i64, null), try cachedInt(&cache, .{ .word_name = "LOOKUP", .args_hash = 1 }));
+
+    const stats = cache.getStats();
+    try testing.expectEqual(@as(u64, 2), stats.hits);
+    try testing.expectEqual(@as(u64, 3), stats.misses);
+    try testing.expectEqual(@as(u64, 1), stats.evictions);
+    try testing.expectEqual(@as(u64, 1), stats.expirations);
+    try testing.expectEqual(@as(usize, 1), stats.entries);
+}
+
+test "result_cache: concurrent hits while the entry is replaced" {
+    const allocator = testing.allocator;
+
+    var cache = ResultCache.init(allocator, .{});
+    defer cache.deinit();
+    const key = ResultCache.Key{ .word_name = "LOOKUP", .args_hash = 1 };
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..64) |i| {
+        try array.array_value.append(allocator, Value.initString(try std.fmt.allocPrint(allocator, "item {d}", .{i})));
+    }
+    const values = [_]Value{array};
+    try cache.put(key, &values);
+
+    const Worker = struct {
+        fn run(c: *ResultCache, k: ResultCache.Key, values: []const Value, failed: *std.atomic.Value(bool)) void {
+            for (0..500) |i| {
+                // Every fourth round replaces the entry under the readers
+                if (i % 4 == 0) {
+                    c.put(k, values) catch failed.store(true, .release);
+                    continue;
+                }
+                const hit = (c.get(testing.allocator, k) catch null) orelse {
+                    failed.store(true, .release);
+                    continue;
+                };
+                defer forthic.grpc.result_cache.freeValues(testing.allocator, hit);
+                if (!std.mem.eql(u8, "item 63", hit[0].array_value.items[63].string_value)) {
+                    failed.store(true, .release);
+                }
+            }
+        }
+    };
+
+    var failed = std.atomic.Value(bool).init(false);
+    var threads: [4]std.Thread = undefined;
+    for (&threads) |*thread| {
+        thread.* = try std.Thread.spawn(.{}, Worker.run, .{ &cache, key, @as([]const Value, &values), &failed });
+    }
+    for (threads) |thread| thread.join();
+
+    try testing.expect(!failed.load(.acquire));
+    try testing.expectEqual(@as(u64, 4 * 375), cache.getStats().hits);
+}
+
+test "result_cache: results holding remote refs are not cacheable" {
+    const allocator = testing.allocator;
+
+    var ref = Value.initRemoteRef(try allocator.dupe(u8, "df-1"), try allocator.dupe(u8, "python"));
+    defer ref.deinit(allocator);
+
+    try testing.expect(forthic.grpc.result_cache.isCacheable(&[_]Value{Value.initInt(1)}));
+    try testing.expect(!forthic.grpc.result_cache.isCacheable(&[_]Value{ Value.initInt(1), ref }));
+}
+
+// =============================================================================
+// Remote Word Tests
+// =============================================================================
+
+const manifest_cache = forthic.grpc.manifest_cache;
+
+test "manifest_cache: cached manifests bind remote words without a round trip" {
+    const allocator = testing.allocator;
+
+    var tmp = testing.tmpDir(.{});
+    defer tmp.cleanup();
+    const dir_path = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(dir_path);
+
+    // Nothing listens here: binding must not need the runtime
+    const address = "localhost:1";
+    const words = [_]manifest_cache.WordManifest{
+        .{ .name = "DISTANCE", .stack_effect = "( a b -- d )", .description = "Great-circle distance", .pure = true },
+        .{ .name = "GEOCODE", .stack_effect = "( place -- point )" },
+    };
+    const modules = [_]manifest_cache.ModuleManifest{
+        .{ .name = "geo", .description = "Geospatial words", .words = &words },
+    };
+
+    var cache = try manifest_cache.ManifestCache.init(allocator, dir_path);
+    defer cache.deinit();
+    try cache.store(&.{ .address = address, .version = "v1", .modules = &modules });
+    try testing.expect((try cache.load("localhost:2")) == null);
+
+    var loaded = (try cache.load(address)).?;
+    defer loaded.deinit();
+    try testing.expectEqualStrings("v1", loaded.manifest.version);
+    try testing.expectEqual(@as(usize, 2), loaded.manifest.findModule("geo").?.words.len);
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+    try manager.enableManifestCache(dir_path);
+    _ = try manager.connectRuntime("geo-runtime", address);
+
+    const module = try manager.registerModule("geo-runtime", "geo");
+    try testing.expect(module.initialized);
+    try testing.expectEqualStrings("Geospatial words", module.getDescription());
+    try testing.expect(module.findWord("DISTANCE").?.pure);
+    try testing.expect(!module.findWord("GEOCODE").?.pure);
+
+    // Revalidation cannot reach the runtime, so the manifest stays current
+    try testing.expect(!manager.manifestStale("geo-runtime"));
+}
+
+const StackEffect = forthic.grpc.remote_word.StackEffect;
+
+test "remote_word: parse stack effect arity" {
+    const two_to_one = StackEffect.parse("( a b -- c )").?;
+    try testing.expectEqual(@as(usize, 2), two_to_one.inputs);
+    try testing.expectEqual(@as(usize, 1), two_to_one.outputs);
+
+    const nothing = StackEffect.parse("( -- )").?;
+    try testing.expectEqual(@as(usize, 0), nothing.inputs);
+    try testing.expectEqual(@as(usize, 0), nothing.outputs);
+
+    const typed = StackEffect.parse("( items:any[] forthic:string -- result:any[] )").?;
+    try testing.expectEqual(@as(usize, 2), typed.inputs);
+    try testing.expectEqual(@as(usize, 1), typed.outputs);
+
+    try testing.expect(StackEffect.parse("") == null);
+    try testing.expect(StackEffect.parse("( a b c )") == null);
+}
+
+// =============================================================================
+// Remote Value Handle Tests
+// =============================================================================
+
+const Interpreter = forthic.Interpreter;
+const RemoteRef = forthic.value.RemoteRef;
+
+const FakeRefRuntime = struct {
+    fetches: usize = 0,
+    tracked: usize = 0,
+
+    fn resolve(ctx: *anyopaque, ref: RemoteRef) anyerror!Value {
+        const self: *FakeRefRuntime = @ptrCast(@alignCast(ctx));
+        self.fetches += 1;
+        try testing.expectEqualStrings("df-1", ref.handle_id);
+        return Value.initInt(99);
+    }
+
+    fn track(ctx: *anyopaque, values: []const Value) anyerror!void {
+        const self: *FakeRefRuntime = @ptrCast(@alignCast(ctx));
+        self.tracked += values.len;
+    }
+};
+
+test "remote refs: materialized only when a word inspects them" {
+    const allocator = testing.allocator;
+
+    const interp = try allocator.create(Interpreter);
+    defer allocator.destroy(interp);
+    interp.* = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+
+    var runtime = FakeRefRuntime{};
+    interp.setRemoteRefHooks(.{
+        .ctx = &runtime,
+        .resolve = FakeRefRuntime.resolve,
+        .track = FakeRefRuntime.track,
+    });
+
+    try interp.stackPush(Value.initRemoteRef(try allocator.dupe(u8, "df-1"), try allocator.dupe(u8, "python")));
+
+    // Moving the handle around does not fetch it
+    const raw = try interp.stackPopRaw();
+    try testing.expect(raw == .remote_ref_value);
+    try interp.stackPush(raw);
+    try testing.expectEqual(@as(usize, 0), runtime.fetches);
+
+    // Inspecting it does
+    var value = try interp.stackPop();
+    defer value.deinit(allocator);
+    try testing.expectEqual(@as(i64, 99), value.int_value);
+    try testing.expectEqual(@as(usize, 1), runtime.fetches);
+}
+
+test "remote refs: nested handles are materialized too" {
+    const allocator = testing.allocator;
+
+    const interp = try allocator.create(Interpreter);
+    defer allocator.destroy(interp);
+    interp.* = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+
+    var runtime = FakeRefRuntime{};
+    interp.setRemoteRefHooks(.{
+        .ctx = &runtime,
+        .resolve = FakeRefRuntime.resolve,
+        .track = FakeRefRuntime.track,
+    });
+
+    var record = Value.initRecord(allocator);
+    try record.record_value.put(try allocator.dupe(u8, "df"), Value.initRemoteRef(try allocator.dupe(u8, "df-1"), try allocator.dupe(u8, "python")));
+    var array = Value.initArray(allocator);
+    try array.array_value.append(allocator, record);
+
+    // Arrays and records are only searched for handles once one has been tracked
+    try testing.expect(!interp.holds_remote_refs);
+    try interp.trackRemoteRefs(&.{array});
+    try testing.expect(interp.holds_remote_refs);
+    try testing.expectEqual(@as(usize, 1), runtime.tracked);
+    try interp.stackPush(array);
+
+    // Handles owned by the runtime being called stay opaque
+    const stack_items = interp.stack.items.items;
+    try interp.materializeRemoteRefs(&stack_items[stack_items.len - 1], "python");
+    try testing.expectEqual(@as(usize, 0), runtime.fetches);
+
+    var value = try interp.stackPop();
+    defer value.deinit(allocator);
+    try testing.expectEqual(@as(i64, 99), value.array_value.items[0].record_value.get("df").?.int_value);
+    try testing.expectEqual(@as(usize, 1), runtime.fetches);
+}
+
+test "remote refs: each interpreter collects only the handles it received" {
+    const allocator = testing.allocator;
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+
+    var interps: [2]*Interpreter = undefined;
+    for (&interps) |*interp| {
+        interp.* = try allocator.create(Interpreter);
+        interp.*.* = try Interpreter.init(allocator);
+        try interp.*.fixupAfterMove();
+        try manager.enableRemoteRefs(interp.*);
+    }
+    defer {
+        for (interps) |interp| {
+            manager.disableRemoteRefs(interp);
+            interp.deinit();
+            allocator.destroy(interp);
+        }
+    }
+
+    // The first interpreter keeps its handle on the stack; the second drops its own
+    const kept = Value.initRemoteRef(try allocator.dupe(u8, "df-1"), try allocator.dupe(u8, "python"));
+    try interps[0].trackRemoteRefs(&.{kept});
+    try interps[0].stackPush(kept);
+    var dropped = Value.initRemoteRef(try allocator.dupe(u8, "df-2"), try allocator.dupe(u8, "python"));
+    defer dropped.deinit(allocator);
+    try interps[1].trackRemoteRefs(&.{dropped});
+    try testing.expectEqual(@as(usize, 2), manager.liveRefCount());
+
+    // Collecting the first does not see the second's roots, so it leaves its handles alone
+    _ = try manager.collectRefs(interps[0], &.{});
+    try testing.expectEqual(@as(usize, 2), manager.liveRefCount());
+
+    // The runtime is not connected, so the dead handle is simply forgotten
+    try testing.expectEqual(@as(usize, 0), try manager.collectRefs(interps[1], &.{}));
+    try testing.expectEqual(@as(usize, 1), manager.liveRefCount());
+}
+
+// =============================================================================
+// Server and ExecuteStream Tests
+// =============================================================================
+
+const GrpcServer = forthic.grpc.GrpcServer;
+const CoreModule = forthic.modules.standard.CoreModule;
+const MathModule = forthic.modules.standard.MathModule;
+const ModuleWord = forthic.word.ModuleWord;
+
+const SessionModules = struct {
+    core_mod: *CoreModule,
+    math_mod: *MathModule,
+    nap_word: ModuleWord,
+
+    /// NAP ( -- ) sleeps, for deadline and hedging tests
+    const nap_ms = 200;
+
+    fn nap(_: *Interpreter) anyerror!void {
+        std.Thread.sleep(nap_ms * std.time.ns_per_ms);
+    }
+
+    fn setup(_: ?*anyopaque, interp: *Interpreter) anyerror!?*anyopaque {
+        const allocator = interp.allocator;
+        const self = try allocator.create(SessionModules);
+        errdefer allocator.destroy(self);
+
+        self.core_mod = try CoreModule.init(allocator);
+        self.math_mod = try MathModule.init(allocator);
+        try interp.registerModule(&self.core_mod.module);
+        try interp.registerModule(&self.math_mod.module);
+        try interp.curModule().importModule("", &self.core_mod.module, interp);
+        try interp.curModule().importModule("", &self.math_mod.module, interp);
+
+        self.nap_word = ModuleWord.init(allocator, "NAP", nap);
+        try interp.curModule().addWord(self.nap_word.asWord());
+        return self;
+    }
+
+    fn teardown(_: ?*anyopaque, interp: *Interpreter, state: ?*anyopaque) void {
+        const self: *SessionModules = @ptrCast(@alignCast(state orelse return));
+        self.core_mod.deinit();
+        self.math_mod.deinit();
+        self.nap_word.deinit();
+        interp.allocator.destroy(self);
+    }
+};
+
+test "server: stream requests share a session stack and may be awaited out of order" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    // 2 DUP leaves [2 2] on the session stack; + then returns 4
+    const dup_id = try client.submitStream("DUP", &[_]Value{Value.initInt(2)}, 0);
+    const plus_id = try client.submitStream("+", &[_]Value{}, 1);
+
+    var plus_result = try client.awaitStream(plus_id);
+    defer plus_result.deinit(allocator);
+    try testing.expect(!plus_result.isError());
+    try testing.expectEqual(@as(usize, 1), plus_result.getValues().len);
+    try testing.expectEqual(@as(i64, 4), plus_result.getValues()[0].int_value);
+
+    var dup_result = try client.awaitStream(dup_id);
+    defer dup_result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 0), dup_result.getValues().len);
+
+    // Errors come back per request and leave the stream usable
+    var underflow = try client.executeStreamed("+", &[_]Value{}, 1);
+    defer underflow.deinit(allocator);
+    try testing.expect(underflow.isError());
+
+    // Unary calls get a fresh interpreter each time
+    var unary = try client.executeWord("+", &[_]Value{ Value.initInt(3), Value.initInt(4) });
+    defer unary.deinit(allocator);
+    try testing.expectEqual(@as(usize, 1), unary.getValues().len);
+    try testing.expectEqual(@as(i64, 7), unary.getValues()[0].int_value);
+
+    client.closeStream();
+}
+
+test "server: sequences are compiled once and reused across sessions" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    // 2 DUP 3 * + : literals are resolved per call, words from the cache
+    const words = [_][]const u8{ "DUP", "3", "*", "+" };
+    for (0..2) |_| {
+        var result = try client.executeSequence(&words, &[_]Value{Value.initInt(2)});
+        defer result.deinit(allocator);
+        try testing.expect(!result.isError());
+        try testing.expectEqual(@as(usize, 1), result.getValues().len);
+        try testing.expectEqual(@as(i64, 8), result.getValues()[0].int_value);
+    }
+
+    var stats = server.sequenceCacheStats();
+    try testing.expectEqual(@as(u64, 1), stats.misses);
+    try testing.expectEqual(@as(u64, 1), stats.hits);
+    try testing.expectEqual(@as(usize, 1), stats.entries);
+
+    // A failing word ends the sequence with a remote error
+    var underflow = try client.executeSequence(&[_][]const u8{ "POP", "+" }, &[_]Value{Value.initInt(1)});
+    defer underflow.deinit(allocator);
+    try testing.expect(underflow.isError());
+
+    server.invalidateSequences();
+    stats = server.sequenceCacheStats();
+    try testing.expectEqual(@as(usize, 0), stats.entries);
+}
+
+test "server: overload and exhausted budgets fail with RESOURCE_EXHAUSTED" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    try server.setLimits(.{ .max_in_flight = 1, .max_queued = 0, .instruction_budget = 4 });
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var napper = try GrpcClient.init(allocator, address);
+    defer napper.deinit();
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    // NAP holds the only slot; with no queue the next request is shed
+    const Nap = struct {
+        fn run(c: *GrpcClient) void {
+            var result = c.executeWord("NAP", &[_]Value{}) catch return;
+            result.deinit(c.allocator);
+        }
+    };
+    const thread = try std.Thread.spawn(.{}, Nap.run, .{&napper});
+    std.Thread.sleep(SessionModules.nap_ms / 4 * std.time.ns_per_ms);
+    try testing.expectError(error.ResourceExhausted, client.executeWord("NAP", &[_]Value{}));
+    thread.join();
+
+    // 1 2 + 3 + executes five words against a budget of four
+    const words = [_][]const u8{ "1", "2", "+", "3", "+" };
+    try testing.expectError(error.ResourceExhausted, client.executeSequence(&words, &[_]Value{}));
+
+    var within_budget = try client.executeSequence(words[0..3], &[_]Value{});
+    defer within_budget.deinit(allocator);
+    try testing.expectEqual(@as(i64, 3), within_budget.getValues()[0].int_value);
+
+    const stats = server.stats();
+    try testing.expectEqual(@as(u64, 1), stats.rejected);
+    try testing.expectEqual(@as(u64, 1), stats.budget_exceeded);
+    try testing.expectEqual(@as(u32, 0), stats.in_flight);
+}
+
+test "server: chunked results split large arrays and reassemble in order" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..500) |i| {
+        try array.array_value.append(allocator, Value.initInt(@intCast(i)));
+    }
+    const args = [_]Value{ array, Value.initInt(7) };
+
+    // Lazily: the array arrives as several runs of elements, then the int
+    {
+        var stream = try client.openResultStream("DUP", &args, 256);
+        defer stream.deinit();
+        try testing.expectEqual(@as(usize, 3), stream.resultCount());
+
+        var element_runs: usize = 0;
+        var elements: usize = 0;
+        var last_index: usize = 0;
+        while (try stream.next()) |next_chunk| {
+            var chunk = next_chunk;
+            defer chunk.deinit(allocator);
+            last_index = chunk.stack_index;
+            if (chunk.kind == .array_elements) {
+                try testing.expectEqual(@as(usize, 0), chunk.stack_index);
+                try testing.expectEqual(@as(i64, @intCast(elements)), chunk.values[0].int_value);
+                element_runs += 1;
+                elements += chunk.values.len;
+            }
+        }
+        try testing.expect(element_runs > 1);
+        try testing.expectEqual(@as(usize, 500), elements);
+        try testing.expectEqual(@as(usize, 2), last_index);
+    }
+
+    // Assembled: same values as the unary call
+    var chunked = try client.executeWordChunked("DUP", &args, 256);
+    defer chunked.deinit(allocator);
+    var unary = try client.executeWord("DUP", &args);
+    defer unary.deinit(allocator);
+
+    try testing.expectEqual(unary.getValues().len, chunked.getValues().len);
+    for (unary.getValues(), chunked.getValues()) |expected, actual| {
+        try testing.expect(expected.equals(&actual));
+    }
+
+    // A failing word reports its error instead of a stream
+    var failed = try client.executeWordChunked("+", &[_]Value{}, 0);
+    defer failed.deinit(allocator);
+    try testing.expect(failed.isError());
+}
+
+test "client pool: round robin over endpoints and ejection of a dead one" {
+    const allocator = testing.allocator;
+    const setup = GrpcServer.SessionSetup{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    };
+
+    // Skipped where the sandbox cannot bind a local port
+    const live = GrpcServer.init(allocator, 0, setup) catch return error.SkipZigTest;
+    defer live.deinit();
+    live.start() catch return error.SkipZigTest;
+
+    // A port that was just released has nobody listening on it
+    const dead = try GrpcServer.init(allocator, 0, setup);
+    dead.start() catch {
+        dead.deinit();
+        return error.SkipZigTest;
+    };
+    const dead_port = dead.getPort();
+    dead.deinit();
+
+    var live_buf: [32]u8 = undefined;
+    var dead_buf: [32]u8 = undefined;
+    const addresses = [_][]const u8{
+        try std.fmt.bufPrint(&live_buf, "localhost:{d}", .{live.getPort()}),
+        try std.fmt.bufPrint(&dead_buf, "localhost:{d}", .{dead_port}),
+    };
+
+    var client = try GrpcClient.initPool(allocator, &addresses, .{
+        .channels_per_endpoint = 2,
+        .eject_after_failures = 1,
+        .ejection_ms = 60_000,
+    });
+    defer client.deinit();
+    try testing.expectEqual(@as(usize, 2), client.endpointCount());
+
+    // At most one call lands on the dead endpoint before it is ejected
+    var failures: usize = 0;
+    for (0..6) |_| {
+        var result = client.executeWord("DUP", &[_]Value{Value.initInt(1)}) catch {
+            failures += 1;
+            continue;
+        };
+        result.deinit(allocator);
+    }
+    try testing.expect(failures <= 1);
+
+    const live_stats = client.endpointStats(0).?;
+    const dead_stats = client.endpointStats(1).?;
+    try testing.expect(live_stats.requests >= 5);
+    try testing.expectEqual(@as(u64, 0), live_stats.failures);
+    try testing.expect(dead_stats.ejected);
+    try testing.expect(client.endpointStats(2) == null);
+}
+
+test "client options: per-call deadlines and hedged idempotent calls" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.initWithOptions(allocator, address, .{
+        .channels_per_endpoint = 2,
+        .hedging_max_attempts = 2,
+        .hedging_delay_ms = 20,
+    });
+    defer client.deinit();
+
+    // A call that outlives its deadline fails instead of hanging
+    try testing.expectError(
+        error.DeadlineExceeded,
+        client.executeWordWithOptions("NAP", &[_]Value{}, .{ .deadline_ms = SessionModules.nap_ms / 4 }),
+    );
+
+    // Hedged attempts still produce exactly one result
+    var hedged = try client.executeWordWithOptions("NAP", &[_]Value{Value.initInt(5)}, .{ .idempotent = true });
+    defer hedged.deinit(allocator);
+    try testing.expectEqual(@as(usize, 1), hedged.getValues().len);
+    try testing.expectEqual(@as(i64, 5), hedged.getValues()[0].int_value);
+}
+
+test "server: large stacks travel through shared memory on the same host" {
+    const allocator = testing.allocator;
+
+    var path_buf: [64]u8 = undefined;
+    const path = try std.fmt.bufPrint(&path_buf, "/tmp/forthic-shm-test-{d}.sock", .{std.time.milliTimestamp()});
+    defer std.fs.deleteFileAbsolute(path) catch {};
+
+    var address_buf: [80]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "unix:{s}", .{path});
+
+    // Skipped where the sandbox cannot create the socket
+    const server = GrpcServer.initAddress(allocator, address, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var client = try GrpcClient.initWithOptions(allocator, address, .{ .shm_threshold_bytes = 1024 });
+    defer client.deinit();
+    if (!client.sharedMemoryStats().active) return error.SkipZigTest; // no /dev/shm
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..1000) |i| {
+        try array.array_value.append(allocator, Value.initInt(@intCast(i)));
+    }
+
+    var result = try client.executeWord("DUP", &[_]Value{array});
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 2), result.getValues().len);
+    for (result.getValues()) |value| {
+        try testing.expectEqual(@as(usize, 1000), value.array_value.items.len);
+        try testing.expectEqual(@as(i64, 999), value.array_value.items[999].int_value);
+    }
+
+    // Small stacks stay inline
+    var small = try client.executeWord("+", &[_]Value{ Value.initInt(3), Value.initInt(4) });
+    defer small.deinit(allocator);
+    try testing.expectEqual(@as(i64, 7), small.getValues()[0].int_value);
+
+    const stats = client.sharedMemoryStats();
+    try testing.expectEqual(@as(u64, 1), stats.requests_shared);
+    try testing.expectEqual(@as(u64, 1), stats.results_shared);
+    try testing.expectEqual(@as(u64, 0), stats.fallbacks);
+}
+
+test "server: shared-memory stacks are held to max_request_bytes" {
+    const allocator = testing.allocator;
+
+    var path_buf: [64]u8 = undefined;
+    const path = try std.fmt.bufPrint(&path_buf, "/tmp/forthic-shm-limit-{d}.sock", .{std.time.milliTimestamp()});
+    defer std.fs.deleteFileAbsolute(path) catch {};
+
+    var address_buf: [80]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "unix:{s}", .{path});
+
+    // Skipped where the sandbox cannot create the socket
+    const server = GrpcServer.initAddress(allocator, address, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    try server.setLimits(.{ .max_request_bytes = 2048 });
+    server.start() catch return error.SkipZigTest;
+
+    var client = try GrpcClient.initWithOptions(allocator, address, .{ .shm_threshold_bytes = 1024 });
+    defer client.deinit();
+    if (!client.sharedMemoryStats().active) return error.SkipZigTest; // no /dev/shm
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..1000) |i| {
+        try array.array_value.append(allocator, Value.initInt(@intCast(i)));
+    }
+
+    try testing.expectError(error.ResourceExhausted, client.executeWord("DUP", &[_]Value{array}));
+    try testing.expectEqual(@as(u64, 1), client.sharedMemoryStats().requests_shared);
+}
+
+test "server: shared memory is not offered over TCP" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.initWithOptions(allocator, address, .{ .shm_threshold_bytes = 1024 });
+    defer client.deinit();
+    try testing.expect(!client.sharedMemoryStats().active);
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..1000) |i| {
+        try array.array_value.append(allocator, Value.initInt(@intCast(i)));
+    }
+
+    var result = try client.executeWord("DUP", &[_]Value{array});
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 2), result.getValues().len);
+
+    const stats = client.sharedMemoryStats();
+    try testing.expectEqual(@as(u64, 0), stats.requests_shared);
+    try testing.expectEqual(@as(u64, 0), stats.results_shared);
+}
+
+test "server: messages above the compression threshold are compressed" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+    var client = try GrpcClient.initWithOptions(allocator, address, .{
+        .compression = .gzip,
+        .compression_threshold_bytes = 1024,
+    });
+    defer client.deinit();
+
+    // Small calls go out as is
+    var small = try client.executeWord("+", &[_]Value{ Value.initInt(3), Value.initInt(4) });
+    defer small.deinit(allocator);
+    try testing.expectEqual(@as(u64, 0), client.clientStats().compressed_messages_sent);
+
+    var array = Value.initArray(allocator);
+    defer array.deinit(allocator);
+    for (0..500) |_| {
+        try array.array_value.append(allocator, Value.initString(try allocator.dupe(u8, "the same string, over and over")));
+    }
+
+    var result = try client.executeWord("DUP", &[_]Value{array});
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 2), result.getValues().len);
+    try testing.expectEqualStrings("the same string, over and over", result.getValues()[1].array_value.items[499].string_value);
+
+    const stats = client.clientStats();
+    try testing.expectEqual(@as(u64, 1), stats.compressed_messages_sent);
+    try testing.expectEqual(@as(u64, 1), stats.compressed_messages_received);
+    try testing.expect(stats.bytes_sent > stats.compression_input_bytes / 2);
+}
+
+test "server: unix domain socket transport through RuntimeManager" {
+    const allocator = testing.allocator;
+
+    var path_buf: [64]u8 = undefined;
+    const path = try std.fmt.bufPrint(&path_buf, "/tmp/forthic-test-{d}.sock", .{std.time.milliTimestamp()});
+    defer std.fs.deleteFileAbsolute(path) catch {};
+
+    var address_buf: [80]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "unix:{s}", .{path});
+
+    // Skipped where the sandbox cannot create the socket
+    const server = GrpcServer.initAddress(allocator, address, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+    try testing.expectEqual(@as(u16, 0), server.getPort());
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+
+    const client = try manager.connectRuntime("sidecar", address);
+    var result = try client.executeWord("+", &[_]Value{ Value.initInt(2), Value.initInt(3) });
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 1), result.getValues().len);
+    try testing.expectEqual(@as(i64, 5), result.getValues()[0].int_value);
+}
+
+test "client metrics: per-word counters, latency histograms and REMOTE-STATS" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+    const client = try manager.connectRuntime("calc", address);
+
+    for (0..3) |i| {
+        var result = try client.executeWord("+", &[_]Value{ Value.initInt(@intCast(i)), Value.initInt(1) });
+        result.deinit(allocator);
+    }
+    // Stack underflow: the RPC succeeds, the word fails
+    var underflow = try client.executeWord("+", &[_]Value{});
+    underflow.deinit(allocator);
+    var dup = try client.executeWord("DUP", &[_]Value{Value.initInt(5)});
+    dup.deinit(allocator);
+
+    try testing.expectEqual(@as(usize, 2), client.metricsWordCount());
+    const plus = client.wordMetrics(0).?;
+    try testing.expectEqualStrings("+", plus.word_name);
+    try testing.expectEqual(@as(u64, 4), plus.metrics.calls);
+    try testing.expectEqual(@as(u64, 1), plus.metrics.word_errors);
+    try testing.expectEqual(@as(u64, 4), plus.metrics.status_counts[0]);
+    try testing.expect(plus.metrics.request_bytes > 0);
+    try testing.expect(plus.metrics.response_bytes > 0);
+    try testing.expectEqual(@as(u64, 4), plus.metrics.rpc.count);
+    try testing.expectEqual(@as(u64, 4), plus.metrics.serialization.count);
+
+    const p50 = forthic.grpc.client.latencyPercentile(&plus.metrics.rpc, 0.5);
+    const p99 = forthic.grpc.client.latencyPercentile(&plus.metrics.rpc, 0.99);
+    try testing.expect(p50 > 0 and p50 <= p99);
+    try testing.expect(client.wordMetrics(2) == null);
+
+    // The same numbers from Forthic
+    const interp = try allocator.create(Interpreter);
+    defer allocator.destroy(interp);
+    interp.* = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+
+    const grpc_mod = try forthic.grpc.grpc_module.GrpcModule.init(allocator);
+    defer grpc_mod.deinit();
+    try interp.registerModule(&grpc_mod.module);
+    try interp.curModule().importModule("", &grpc_mod.module, interp);
+
+    try interp.run("REMOTE-STATS");
+    var stats = try interp.stackPop();
+    defer stats.deinit(allocator);
+
+    const plus_stats = stats.record_value.get("calc").?.record_value.get("+").?.record_value;
+    try testing.expectEqual(@as(i64, 4), plus_stats.get("calls").?.int_value);
+    try testing.expectEqual(@as(i64, 1), plus_stats.get("word_errors").?.int_value);
+    try testing.expectEqual(@as(i64, 0), plus_stats.get("failures").?.int_value);
+    try testing.expect(plus_stats.get("rpc_p99_us").?.float_value > 0);
+}
+
+test "scatter-gather: shards run concurrently and fail independently" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+    _ = try manager.connectRuntime("shard-a", address);
+    _ = try manager.connectRuntime("shard-b", address);
+    // Nothing listens here
+    _ = try manager.connectRuntime("dead", "localhost:1");
+    try manager.defineGroup("pair", &.{ "shard-a", "shard-b" });
+    try testing.expectError(error.UnknownRuntimeGroup, manager.scatterGather("none", "NAP", &.{}, .{}));
+
+    // NAP sleeps and leaves its shard on the stack
+    const shards = [_]Value{ Value.initInt(10), Value.initInt(11), Value.initInt(12), Value.initInt(13) };
+    var timer = try std.time.Timer.start();
+    var gathered = try manager.scatterGather("pair", "NAP", &shards, .{});
+    defer gathered.deinit(allocator);
+    const elapsed_ms = timer.read() / std.time.ns_per_ms;
+
+    try testing.expect(elapsed_ms < 3 * SessionModules.nap_ms);
+    try testing.expectEqual(@as(usize, 0), gathered.failures);
+    for (gathered.shards, 0..) |*shard, i| {
+        try testing.expectEqualStrings(if (i % 2 == 0) "shard-a" else "shard-b", shard.runtime);
+        try testing.expectEqual(@as(i64, @intCast(10 + i)), shard.outcome.result.getValues()[0].int_value);
+    }
+
+    // From Forthic, with one member down
+    const interp = try allocator.create(Interpreter);
+    defer allocator.destroy(interp);
+    interp.* = try Interpreter.init(allocator);
+    defer interp.deinit();
+    try interp.fixupAfterMove();
+
+    const grpc_mod = try forthic.grpc.grpc_module.GrpcModule.init(allocator);
+    defer grpc_mod.deinit();
+    try interp.registerModule(&grpc_mod.module);
+    try interp.curModule().importModule("", &grpc_mod.module, interp);
+
+    try interp.run("\"flaky\" [\"shard-a\" \"dead\"] RUNTIME-GROUP");
+    try interp.run("[1 2] \"flaky\" \"NAP\" SCATTER-GATHER");
+
+    var errors = try interp.stackPop();
+    defer errors.deinit(allocator);
+    var results = try interp.stackPop();
+    defer results.deinit(allocator);
+
+    try testing.expectEqual(@as(usize, 2), results.array_value.items.len);
+    try testing.expectEqual(@as(i64, 1), results.array_value.items[0].int_value);
+    try testing.expect(results.array_value.items[1] == .null_value);
+
+    try testing.expectEqual(@as(usize, 1), errors.array_value.items.len);
+    const failure = errors.array_value.items[0].record_value;
+    try testing.expectEqual(@as(i64, 1), failure.get("shard").?.int_value);
+    try testing.expectEqualStrings("dead", failure.get("runtime").?.string_value);
+}
+
+test "runtime manager: eager connect and parallel warm-up" {
+    const allocator = testing.allocator;
+
+    // Skipped where the sandbox cannot bind a local port
+    const server = GrpcServer.init(allocator, 0, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    }) catch return error.SkipZigTest;
+    defer server.deinit();
+    server.start() catch return error.SkipZigTest;
+
+    var address_buf: [32]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "localhost:{d}", .{server.getPort()});
+
+    const manager = try forthic.grpc.RuntimeManager.getInstance(allocator);
+    defer manager.deinit();
+
+    const eager = try manager.connectRuntimeWithOptions("eager", address, .{ .connect_timeout_ms = 5_000 });
+    try testing.expect(eager.isConnected());
+    try testing.expectError(
+        error.ConnectionFailed,
+        manager.connectRuntimeWithOptions("eager-dead", "localhost:1", .{ .connect_timeout_ms = 200 }),
+    );
+    try testing.expect(manager.getClient("eager-dead") == null);
+
+    // Lazy clients stay idle until warmed up
+    const lazy = try manager.connectRuntime("lazy", address);
+    _ = try manager.connectRuntime("dead", "localhost:1");
+    try testing.expect(!lazy.isConnected());
+
+    try testing.expectEqual(@as(usize, 1), try manager.connectAll(500));
+    try testing.expect(lazy.isConnected());
+}
+
+test "runtime manager: concurrent getInstance, registration and lookup" {
+    const allocator = testing.allocator;
+    const RuntimeManager = forthic.grpc.RuntimeManager;
+    const thread_count = 8;
+
+    const Worker = struct {
+        manager: ?*RuntimeManager = null,
+        client: ?*GrpcClient = null,
+        mismatches: usize = 0,
+
+        fn run(self: *@This(), index: usize) void {
+            const manager = RuntimeManager.getInstance(testing.allocator) catch return;
+            self.manager = manager;
+
+            // Threads share four runtime names, so registrations race
+            var name_buf: [16]u8 = undefined;
+            const name = std.fmt.bufPrint(&name_buf, "rt-{d}", .{index % 4}) catch return;
+            const client = manager.connectRuntime(name, "localhost:1") catch return;
+            self.client = client;
+
+            for (0..10_000) |_| {
+                if (manager.getClient(name) != client) self.mismatches += 1;
+            }
+        }
+    };
+
+    var workers = [_]Worker{.{}} ** thread_count;
+    var threads: [thread_count]std.Thread = undefined;
+    for (&threads, &workers, 0..) |*thread, *worker, i| {
+        thread.* = try std.Thread.spawn(.{}, Worker.run, .{ worker, i });
+    }
+    for (threads) |thread| thread.join();
+
+    const manager = RuntimeManager.current().?;
+    defer manager.deinit();
+
+    try testing.expectEqual(@as(usize, 4), manager.clientSnapshot().count());
+    for (workers, 0..) |worker, i| {
+        try testing.expectEqual(manager, worker.manager.?);
+        try testing.expectEqual(@as(usize, 0), worker.mismatches);
+        try testing.expectEqual(workers[i % 4].client.?, worker.client.?);
+    }
+}
+
+test "server: in-process transport reaches a server in the same process" {
+    const allocator = testing.allocator;
+
+    var address_buf: [48]u8 = undefined;
+    const address = try std.fmt.bufPrint(&address_buf, "inproc:test-{d}", .{std.time.milliTimestamp()});
+
+    // No running server on the address yet
+    try testing.expectError(error.ConnectionFailed, GrpcClient.init(allocator, address));
+
+    const server = try GrpcServer.initAddress(allocator, address, .{
+        .setupFn = SessionModules.setup,
+        .teardownFn = SessionModules.teardown,
+    });
+    defer server.deinit();
+    try server.start();
+    try testing.expectEqual(@as(u16, 0), server.getPort());
+
+    // One server per in-process address
+    const twin = try GrpcServer.initAddress(allocator, address, .{});
+    defer twin.deinit();
+    try testing.expectError(error.AlreadyExists, twin.start());
+
+    var client = try GrpcClient.init(allocator, address);
+    defer client.deinit();
+
+    var result = try client.executeWord("+", &[_]Value{ Value.initInt(20), Value.initInt(22) });
+    defer result.deinit(allocator);
+    try testing.expectEqual(@as(usize, 1), result.getValues().len);
+    try testing.expectEqual(@as(i64, 42), result.getValues()[0].int_value);
+}